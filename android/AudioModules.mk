@@ -13,7 +13,9 @@ LOCAL_PROPRIETARY_MODULE := true
 LOCAL_MODULE_OWNER := intel
 LOCAL_CLANG := true
 
-LOCAL_SRC_FILES := ../private/src/helper/IasRamp.cpp
+LOCAL_SRC_FILES := \
+    ../private/src/helper/IasRamp.cpp \
+    ../private/src/helper/IasRtHelperPool.cpp
 
 LOCAL_C_INCLUDES := \
     $(LOCAL_PATH)/../public/inc \
@@ -35,11 +35,16 @@ LOCAL_SRC_FILES := \
     ../private/src/smartx/IasEventProvider.cpp \
     ../private/src/smartx/IasConfigFile.cpp \
     ../private/src/smartx/IasThreadNames.cpp \
+    ../private/src/smartx/IasRtLog.cpp \
     ../private/src/smartx/IasProperties.cpp \
+    ../private/src/smartx/IasLatencyProbe.cpp \
+    ../private/src/smartx/IasStreamProbe.cpp \
+    ../private/src/smartx/IasMultiPointProbe.cpp \
 
 LOCAL_SRC_FILES += \
     ../private/src/alsahandler/IasAlsaHandler.cpp \
     ../private/src/alsahandler/IasAlsaHandlerWorkerThread.cpp \
+    ../private/src/alsahandler/IasAsrcFillController.cpp \
 
 LOCAL_SRC_FILES += \
     ../private/src/model/IasAudioPort.cpp \
@@ -48,6 +53,7 @@ LOCAL_SRC_FILES += \
     ../private/src/model/IasAudioSourceDevice.cpp \
     ../private/src/model/IasRoutingZone.cpp \
     ../private/src/model/IasRoutingZoneWorkerThread.cpp \
+    ../private/src/model/IasSinkFillController.cpp \
     ../private/src/model/IasAudioPin.cpp \
     ../private/src/model/IasPipeline.cpp \
     ../private/src/model/IasProcessingModule.cpp \
@@ -71,6 +77,7 @@ LOCAL_SRC_FILES += \
     ../private/src/rtprocessingfwx/IasBundleSequencer.cpp \
     ../private/src/rtprocessingfwx/IasStreamParams.cpp \
     ../private/src/rtprocessingfwx/IasSimpleAudioStream.cpp \
+    ../private/src/rtprocessingfwx/IasSampleLayoutConverter.cpp \
     ../private/src/rtprocessingfwx/IasPluginEngine.cpp \
     ../private/src/rtprocessingfwx/IasAudioBuffer.cpp \
     ../private/src/rtprocessingfwx/IasAudioBufferPool.cpp \
@@ -18,6 +18,7 @@
 #include "avbaudiomodules/internal/audio/common/helper/IasIRunnable.hpp"
 #include "diagnostic/IasDiagnostic.hpp"
 #include "smartx/IasAudioTypedefs.hpp"
+#include "alsahandler/IasAsrcFillController.hpp"
 
 namespace IasAudio {
 
@@ -264,6 +265,10 @@ class IAS_AUDIO_PUBLIC IasAlsaHandlerWorkerThread : public IasIRunnable
     bool                                 mThreadIsRunning;         //!< Flag indicating whether thread is running
     IasSrcFarrow                        *mSrc;                     //!< Handle for the sample rate converter
     IasSrcController                    *mSrcController;           //!< Handle for the ASRC closed loop controller
+    IasAsrcFillController                mAsrcFillController;      //!< Adaptation of the target fill level of the ASRC buffer
+    bool                                 mAsrcAdaptive;            //!< Flag indicating whether the target fill level of the ASRC buffer is adapted
+    uint32_t                             mAsrcMinFill;             //!< Lowest target fill level of the ASRC buffer, 0 selects the default
+    uint32_t                             mAsrcMaxFill;             //!< Highest target fill level of the ASRC buffer, 0 selects the default
     float const                        **mSrcInputBuffersFloat32;  //!< Vector with pointers to the SRC input buffers (Float32)
     int32_t const                      **mSrcInputBuffersInt32;    //!< Vector with pointers to the SRC input buffers (Int32)
     int16_t const                      **mSrcInputBuffersInt16;    //!< Vector with pointers to the SRC input buffers (Int16)
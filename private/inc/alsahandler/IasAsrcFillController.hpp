@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasAsrcFillController.hpp
+ * @date   2018
+ * @brief  Adaptation of the target fill level of the ASRC buffer of an asynchronous ALSA handler.
+ */
+
+#ifndef IASASRCFILLCONTROLLER_HPP_
+#define IASASRCFILLCONTROLLER_HPP_
+
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+
+namespace IasAudio {
+
+/**
+ * @brief Adapts the target fill level of the ASRC buffer to the observed jitter.
+ *
+ * The ASRC closed-loop controller drives the fill level of the ASRC buffer, i.e., the number of physical
+ * plus virtual frames, toward a target level. With a fixed target in the middle of the buffer, every device
+ * pays the latency required for the worst jitter. This controller observes the fill level once per period.
+ * At the end of each measurement window, it determines how far the fill level fell below the mean fill level
+ * of the window. This is the jitter of the window, which is independent of the target the closed-loop
+ * controller is tracking.
+ *
+ * The jitter envelope follows a larger jitter immediately and decays slowly afterwards, so that rare spikes
+ * are remembered for a while. The required target is one period plus 1.5 times the jitter envelope, limited
+ * to the configured bounds. If the required target is higher than the current target, the target is raised
+ * at once. If it is at least an eighth period lower for several windows in a row, the target is lowered by an
+ * eighth period, so that the closed-loop controller can follow without audible ratio changes.
+ *
+ * The controller is used by the real-time thread of the ALSA handler only.
+ */
+class IAS_AUDIO_PUBLIC IasAsrcFillController
+{
+  public:
+    /**
+     * @brief Constructor.
+     */
+    IasAsrcFillController();
+
+    /**
+     * @brief Destructor.
+     */
+    ~IasAsrcFillController();
+
+    /**
+     * @brief Initialize the controller for an ASRC buffer.
+     *
+     * If adaptive is false, the target stays at defaultTarget. Otherwise the target starts at defaultTarget,
+     * limited to the bounds, and is adapted at runtime.
+     *
+     * @param[in] periodSize The period size of the ASRC buffer in frames
+     * @param[in] bufferLength The length of the ASRC buffer in frames
+     * @param[in] defaultTarget The fixed target fill level of the ASRC buffer
+     * @param[in] adaptive Adapt the target to the observed jitter
+     * @param[in] minTarget Lowest target of the adaptation, 0 selects one and a half periods
+     * @param[in] maxTarget Highest target of the adaptation, 0 selects the buffer length minus one period
+     * @param[in] windowLength The number of periods of one measurement window
+     */
+    void init(uint32_t periodSize, uint32_t bufferLength, uint32_t defaultTarget,
+              bool adaptive, uint32_t minTarget, uint32_t maxTarget, uint32_t windowLength);
+
+    /**
+     * @brief Report the number of physical plus virtual frames of the ASRC buffer of the current period.
+     *
+     * @param[in] numTotalFrames The fill level that is also passed to the ASRC closed-loop controller
+     *
+     * @return True, if the target fill level has changed
+     */
+    bool update(uint32_t numTotalFrames);
+
+    /**
+     * @brief Discard the measurements of the current window.
+     *
+     * Called when the ALSA handler falls back to the start-up phase. The learned jitter envelope is kept.
+     */
+    void resetWindow();
+
+    /**
+     * @brief Get the current target fill level in frames.
+     */
+    uint32_t getTarget() const { return mTarget; }
+
+    /**
+     * @brief Get the current jitter envelope in frames.
+     */
+    uint32_t getJitter() const { return mJitter; }
+
+    /**
+     * @brief Check whether the target is adapted at runtime.
+     */
+    bool isAdaptive() const { return mAdaptive; }
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasAsrcFillController(IasAsrcFillController const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasAsrcFillController& operator=(IasAsrcFillController const &other);
+
+    uint32_t     mPeriodSize;            //!< Period size in frames
+    uint32_t     mWindowLength;          //!< Number of periods of one measurement window
+    bool         mAdaptive;              //!< Adapt the target to the observed jitter
+    uint32_t     mTargetMin;             //!< Lowest target of the adaptation
+    uint32_t     mTargetMax;             //!< Highest target of the adaptation
+    uint32_t     mTarget;                //!< Current target fill level
+    uint32_t     mJitter;                //!< Jitter envelope in frames
+    uint32_t     mNumMeasurements;       //!< Number of fill levels reported in the current window
+    uint64_t     mSumFill;               //!< Sum of the fill levels of the current window
+    uint32_t     mLowestFill;            //!< Lowest fill level of the current window
+    uint32_t     mNumLowerWindows;       //!< Number of consecutive windows that allowed a lower target
+};
+
+} //namespace IasAudio
+
+#endif /* IASASRCFILLCONTROLLER_HPP_ */
@@ -94,6 +94,20 @@ class IAS_AUDIO_PUBLIC IasConfigSinkDevice
      */
     IasResult createLinkRoutingZone(IasISetup *setup);
 
+    /*!
+     * @brief Set the sink prefill of the routing zone
+     *
+     * Evaluates the optional attributes prefill_frames, prefill_adaptive, prefill_min_frames and
+     * prefill_max_frames of the routing zone node. Nothing is set if none of them is present.
+     *
+     * @param[in]  setup Pointer to the smartx setup
+     * @param[in]  routingZoneNode     Pointer to routing zone node.
+     * @return The result of setting the sink prefill
+     * @retval IasConfigSinkDevice::eIasOk  operation Successful
+     * @retval IasConfigSinkDevice::eIasFailed operation Failed
+     */
+    IasResult setRoutingZonePrefill(IasISetup *setup, xmlNodePtr routingZoneNode);
+
     /*!
      * @brief Set routing zone port params
      *
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasRoutingRecorder.hpp
+ * @date   2018
+ * @brief  smartXConfigParser: Decorator for the IasIRouting instance that records the connections for the IasTopologyCache
+ */
+
+#ifndef IASROUTINGRECORDER_HPP
+#define IASROUTINGRECORDER_HPP
+
+#include "audio/smartx/IasIRouting.hpp"
+#include "configparser/IasTopologyCache.hpp"
+
+/*!
+ * @brief namespace IasAudio
+ */
+namespace IasAudio {
+
+/**
+ * @brief Decorator for the IasIRouting instance that records the connections for the IasTopologyCache
+ *
+ * Successful connections are recorded, a disconnect invalidates the recording.
+ */
+class IAS_AUDIO_PUBLIC IasRoutingRecorder : public IasIRouting
+{
+  public:
+      /**
+       * @brief Constructor
+       *
+       * @param[in] routing   Pointer to the IasIRouting instance to be decorated, not owned by the recorder
+       * @param[in] cache     The cache the connections are recorded in
+       */
+      IasRoutingRecorder(IasIRouting *routing, IasTopologyCache *cache);
+
+      /**
+       * @brief Destructor
+       */
+      virtual ~IasRoutingRecorder();
+
+      /**
+       * @brief Inherited from IasIRouting.
+       */
+      IasResult connect(std::int32_t sourceId, std::int32_t sinkId) override;
+
+      /**
+       * @brief Inherited from IasIRouting.
+       */
+      IasResult disconnect(std::int32_t sourceId, std::int32_t sinkId) override;
+
+      /**
+       * @brief Inherited from IasIRouting.
+       */
+      IasConnectionVector getActiveConnections() const override;
+
+      /**
+       * @brief Inherited from IasIRouting.
+       */
+      IasDummySourcesSet getDummySources() const override;
+
+  private:
+      /**
+       * @brief Copy constructor, private deleted to prevent misuse.
+       */
+      IasRoutingRecorder(IasRoutingRecorder const &other) = delete;
+      /**
+       * @brief Assignment operator, private deleted to prevent misuse.
+       */
+      IasRoutingRecorder& operator=(IasRoutingRecorder const &other) = delete;
+
+      IasIRouting         *mRouting;       //!< Pointer to original IasIRouting instance
+      IasTopologyCache    *mCache;         //!< The cache the connections are recorded in
+};
+
+} //namespace IasAudio
+
+#endif // IASROUTINGRECORDER_HPP
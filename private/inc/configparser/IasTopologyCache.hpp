@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasTopologyCache.hpp
+ * @date   2018
+ * @brief  smartXConfigParser: Binary cache of the topology created from an XML file
+ */
+
+#ifndef IASTOPOLOGYCACHE_HPP
+#define IASTOPOLOGYCACHE_HPP
+
+#include <string>
+#include <vector>
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
+#include "audio/smartx/IasProperties.hpp"
+
+/*!
+ * @brief namespace IasAudio
+ */
+namespace IasAudio {
+
+class IasISetup;
+class IasIRouting;
+
+/**
+ * @brief Binary cache of the topology created from an XML file.
+ *
+ * While the XML file is parsed, the IasSetupRecorder and the IasRoutingRecorder record every call of the
+ * setup and routing interfaces that changes the topology, with the resolved parameters. Objects are referred
+ * to by handles, which are the indices of the calls that created them. On later boots, the recorded calls are
+ * replayed without reading the XML file.
+ *
+ * The cache file stores the FNV-1a hash and the size of the XML file and the SmartX API version. It is only
+ * used if all of them match and its checksum is valid, otherwise the XML file is parsed again.
+ */
+class IAS_AUDIO_PUBLIC IasTopologyCache
+{
+  public:
+    /**
+     * @brief The result type for the IasTopologyCache methods
+     */
+    enum IasResult
+    {
+      eIasOk,               //!< Operation successful
+      eIasFailed,           //!< Operation failed
+      eIasNotFound,         //!< The cache file does not exist
+      eIasOutdated,         //!< The cache file was created from another XML file or SmartX API version
+      eIasInvalid           //!< The cache file is corrupt
+    };
+
+    /**
+     * @brief The recorded operations
+     */
+    enum IasOpType
+    {
+      eIasOpUndef = 0,                //!< Undefined operation
+      eIasOpCreateRoutingZone,        //!< createRoutingZone, creates a handle
+      eIasOpCreateSourceDevice,       //!< createAudioSourceDevice, creates a handle
+      eIasOpCreateSinkDevice,         //!< createAudioSinkDevice, creates a handle
+      eIasOpCreateAudioPort,          //!< createAudioPort, creates a handle
+      eIasOpCreatePipeline,           //!< createPipeline, creates a handle
+      eIasOpCreateAudioPin,           //!< createAudioPin, creates a handle
+      eIasOpCreateProcessingModule,   //!< createProcessingModule, creates a handle
+      eIasOpAddDerivedZone,           //!< addDerivedZone
+      eIasOpLinkZoneToSink,           //!< link(IasRoutingZonePtr, IasAudioSinkDevicePtr)
+      eIasOpAddSourceOutputPort,      //!< addAudioOutputPort
+      eIasOpAddSinkInputPort,         //!< addAudioInputPort(IasAudioSinkDevicePtr, IasAudioPortPtr)
+      eIasOpAddZoneInputPort,         //!< addAudioInputPort(IasRoutingZonePtr, IasAudioPortPtr)
+      eIasOpLinkPorts,                //!< link(IasAudioPortPtr, IasAudioPortPtr)
+      eIasOpAddSourceGroup,           //!< addSourceGroup
+      eIasOpAddPipeline,              //!< addPipeline
+      eIasOpAddInputPin,              //!< addAudioInputPin
+      eIasOpAddOutputPin,             //!< addAudioOutputPin
+      eIasOpAddInOutPin,              //!< addAudioInOutPin
+      eIasOpAddPinMapping,            //!< addAudioPinMapping
+      eIasOpAddProcessingModule,      //!< addProcessingModule
+      eIasOpLinkPortToPin,            //!< link(IasAudioPortPtr, IasAudioPinPtr)
+      eIasOpLinkPins,                 //!< link(IasAudioPinPtr, IasAudioPinPtr, IasAudioPinLinkType)
+      eIasOpSetProperties,            //!< setProperties
+      eIasOpInitPipelineAudioChain,   //!< initPipelineAudioChain
+      eIasOpSetRuntimeRelinking,      //!< setRuntimeRelinking
+      eIasOpCommitPinLinks,           //!< commitPinLinks
+      eIasOpSetSinkPrefill,           //!< setSinkPrefill
+      eIasOpLast                      //!< ATTENTION: Always has to be last entry
+    };
+
+    /**
+     * @brief One recorded operation
+     */
+    struct IasOp
+    {
+      IasOp()
+        :type(eIasOpUndef)
+        ,handles()
+        ,values()
+        ,strings()
+        ,properties(nullptr)
+      {};
+      explicit IasOp(IasOpType opType)
+        :type(opType)
+        ,handles()
+        ,values()
+        ,strings()
+        ,properties(nullptr)
+      {};
+      IasOpType                 type;           //!< The operation
+      std::vector<uint32_t>     handles;        //!< Handles of the objects the operation refers to
+      std::vector<int64_t>      values;         //!< Numeric parameters
+      std::vector<std::string>  strings;        //!< String parameters
+      IasPropertiesPtr          properties;     //!< Properties, only set for eIasOpSetProperties
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    IasTopologyCache();
+
+    /**
+     * @brief Destructor.
+     */
+    ~IasTopologyCache();
+
+    /**
+     * @brief Remove all recorded operations and connections and mark the recording as valid.
+     */
+    void clear();
+
+    /**
+     * @brief Append a recorded setup operation.
+     *
+     * @param[in] op The operation
+     */
+    void addOp(const IasOp &op);
+
+    /**
+     * @brief Append a recorded connection of the routing interface.
+     *
+     * @param[in] sourceId The source ID
+     * @param[in] sinkId The sink ID
+     */
+    void addConnection(int32_t sourceId, int32_t sinkId);
+
+    /**
+     * @brief Mark the recording as unusable, e.g. because an object was used that was not created by a recorded call.
+     *
+     * @param[in] reason The reason, used for the log
+     */
+    void invalidate(const std::string &reason);
+
+    /**
+     * @brief Check whether the recording can be saved.
+     */
+    bool isValid() const { return mValid; }
+
+    /**
+     * @brief Get the number of recorded setup operations.
+     */
+    uint32_t getNumOps() const { return static_cast<uint32_t>(mOps.size()); }
+
+    /**
+     * @brief Get the number of recorded connections.
+     */
+    uint32_t getNumConnections() const { return static_cast<uint32_t>(mConnections.size()); }
+
+    /**
+     * @brief Write the recording to a cache file.
+     *
+     * The file is written to a temporary file first and renamed afterwards, so that an interrupted write
+     * never leaves a partial cache file behind.
+     *
+     * @param[in] fileName The name of the cache file
+     * @param[in] xmlHash The hash of the XML file the recording was created from
+     * @param[in] xmlSize The size of the XML file the recording was created from
+     *
+     * @return The result of the call
+     * @retval eIasOk The cache file was written
+     * @retval eIasFailed The recording is invalid or the cache file could not be written
+     */
+    IasResult save(const std::string &fileName, uint64_t xmlHash, uint64_t xmlSize) const;
+
+    /**
+     * @brief Read the recording from a cache file and validate it.
+     *
+     * Besides the header and the checksum, every handle is checked to refer to an object of the right type
+     * that was created by a preceding operation, so that #replaySetup does not need any further checks.
+     *
+     * @param[in] fileName The name of the cache file
+     * @param[in] xmlHash The hash of the current XML file
+     * @param[in] xmlSize The size of the current XML file
+     *
+     * @return The result of the call
+     * @retval eIasOk The recording was read and can be replayed
+     * @retval eIasNotFound The cache file does not exist
+     * @retval eIasOutdated The cache file was created from another XML file or SmartX API version
+     * @retval eIasInvalid The cache file is corrupt
+     */
+    IasResult load(const std::string &fileName, uint64_t xmlHash, uint64_t xmlSize);
+
+    /**
+     * @brief Replay the recorded setup operations.
+     *
+     * @param[in] setup The setup interface of the SmartXbar
+     *
+     * @return eIasOk if all operations succeeded, eIasFailed otherwise
+     */
+    IasResult replaySetup(IasISetup *setup) const;
+
+    /**
+     * @brief Replay the recorded connections.
+     *
+     * @param[in] routing The routing interface of the SmartXbar
+     *
+     * @return eIasOk if all connections were established, eIasFailed otherwise
+     */
+    IasResult replayConnections(IasIRouting *routing) const;
+
+    /**
+     * @brief Calculate the FNV-1a hash and the size of a file.
+     *
+     * @param[in] fileName The name of the file
+     * @param[out] hash The hash of the file content
+     * @param[out] size The size of the file in bytes
+     *
+     * @return eIasOk if the file could be read, eIasNotFound otherwise
+     */
+    static IasResult hashFile(const std::string &fileName, uint64_t *hash, uint64_t *size);
+
+    /**
+     * @brief Check whether an operation creates a handle.
+     */
+    static bool createsHandle(IasOpType type);
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasTopologyCache(IasTopologyCache const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasTopologyCache& operator=(IasTopologyCache const &other);
+
+    /**
+     * @brief Check the handles and the number of parameters of all operations
+     */
+    bool validate() const;
+
+    DltContext                                  *mLog;            //!< The DLT log context
+    std::vector<IasOp>                          mOps;             //!< The recorded setup operations
+    std::vector<std::pair<int32_t, int32_t>>    mConnections;     //!< The recorded connections, source ID and sink ID
+    bool                                        mValid;           //!< False if the recording cannot be saved
+};
+
+/**
+ * @brief Function to get a IasTopologyCache::IasResult as string.
+ *
+ * @return String carrying the result message.
+ */
+std::string toString(const IasTopologyCache::IasResult& type);
+
+} //namespace IasAudio
+
+#endif // IASTOPOLOGYCACHE_HPP
@@ -55,6 +55,77 @@ struct IasEqualizerCoreStreamStatus
 
 using IasEqualizerCoreStreamStatusMap = std::map<int32_t, IasEqualizerCoreStreamStatus>;
 
+/*!
+ *  @class IasEqualizerSnapshot
+ *  @brief Parameter snapshot of the IasEqualizerCore, i.e., the filter cascades of several streams.
+ *
+ *  The snapshot is filled by the tuning application and passed to
+ *  IasGenericAudioCompCore::setParameterSnapshot. The equalizer calculates all filter
+ *  coefficients before the snapshot is passed to the processing thread, which adopts
+ *  the filters of all streams within the same period.
+ *
+ *  The snapshot is prepared on a private copy of the channel parameters of the equalizer,
+ *  which replaces the channel parameters of the equalizer only if the whole snapshot is valid.
+ */
+class IAS_AUDIO_PUBLIC IasEqualizerSnapshot : public IasParameterSnapshot
+{
+  public:
+    /**
+     * @brief Constructor.
+     */
+    IasEqualizerSnapshot();
+
+    /**
+     * @brief Destructor, virtual by default.
+     */
+    virtual ~IasEqualizerSnapshot();
+
+    /**
+     * @brief Add the filter cascade of one stream.
+     *
+     * The parameters are the same as for IasEqualizerCore::setFiltersSingleStream.
+     *
+     *  @param[in] streamId           ID of the stream, whose filter parameters shall be updated.
+     *  @param[in] channelIdTable     Vector containing the channel IDs, whose filter parameters
+     *                                shall be updated. An empty vector indicates that all channels
+     *                                belonging to this stream shall be updated.
+     *  @param[in] filterParamsTable  Vector containing the parameters of each filter.
+     */
+    void addStream(int32_t streamId,
+                   std::vector<uint32_t> const &channelIdTable,
+                   std::vector<IasAudioFilterParams> const &filterParamsTable);
+
+  private:
+    friend class IasEqualizerCore;
+
+    /**
+     * @brief The filter cascade of one stream as added by the application
+     */
+    struct IasStreamFilters
+    {
+      int32_t                            streamId;            //!< ID of the stream
+      std::vector<uint32_t>              channelIdTable;      //!< Channels of the stream to be updated
+      std::vector<IasAudioFilterParams>  filterParamsTable;   //!< Parameters of each filter of the cascade
+    };
+
+    /**
+     * @brief The prepared update of one channel of one filter stage
+     */
+    struct IasPreparedUpdate
+    {
+      uint32_t                  bundleIndex;   //!< Index of the bundle
+      uint32_t                  stageIndex;    //!< Index of the filter stage
+      IasAudioFilterQueueEntry  updateEntry;   //!< Update entry including the filter coefficients
+    };
+
+    std::vector<IasStreamFilters>                mStreams;                 //!< The filter cascades added by the application
+    std::vector<IasPreparedUpdate>               mPreparedUpdates;         //!< Updates of all filter stages, filled by the equalizer
+    std::vector<uint32_t>                        mNumActiveFilterStages;   //!< Number of active filter stages per bundle, filled by the equalizer
+    std::vector<IasEqualizerCoreChannelParams>   mChannelParams;           //!< Copy of the channel parameters [numBundles*cIasNumChannelsPerBundle]
+    std::vector<IasAudioFilterParams>            mFilterParamsTabs;        //!< Storage of the filterParamsTab of all channels of mChannelParams
+    std::vector<uint32_t>                        mFilterStageIndexTabs;    //!< Storage of the filterStageIndexTab of all channels of mChannelParams
+};
+
 /*!
  *  @class IasEqualizerCore
  *  @brief This class implements the Equalizer Core Module.
@@ -239,6 +310,43 @@ class IAS_AUDIO_PUBLIC IasEqualizerCore : public IasGenericAudioCompCore, IasAud
      */
     IasAudioProcessingResult processChild() override;
 
+    /**
+     * @brief Verify an IasEqualizerSnapshot and calculate the coefficients of all filter stages.
+     */
+    IasAudioProcessingResult prepareParameterSnapshot(IasParameterSnapshot &snapshot) override;
+
+    /**
+     * @brief Adopt the filter stages of a prepared IasEqualizerSnapshot.
+     */
+    void applyParameterSnapshot(const IasParameterSnapshot &snapshot) override;
+
+    /**
+     * @brief Set the filters of one stream, either immediately or as part of a snapshot.
+     *
+     * @param[in] streamId           ID of the stream.
+     * @param[in] channelIdTable     Channel IDs to be updated, all channels if empty.
+     * @param[in] filterParamsTable  Parameters of each filter.
+     * @param[in] snapshot           If not nullptr, the updates are added to the snapshot instead of being passed to the filters.
+     */
+    IasAudioProcessingResult setFiltersSingleStream(int32_t streamId,
+                                                    std::vector<uint32_t> const &channelIdTable,
+                                                    std::vector<IasAudioFilterParams> const &filterParamsTable,
+                                                    IasEqualizerSnapshot *snapshot);
+
+    /**
+     * @brief Get the parameters of one channel, either of the equalizer or of the copy in a snapshot.
+     *
+     * @param[in] bundleIndex  Index of the bundle.
+     * @param[in] channel      Index of the channel within the bundle.
+     * @param[in] snapshot     If not nullptr, the parameters are taken from the copy in the snapshot.
+     */
+    IasEqualizerCoreChannelParams& getChannelParams(uint32_t bundleIndex, uint32_t channel, IasEqualizerSnapshot *snapshot);
+
+    /**
+     * @brief Copy the parameters of one channel, including the filter tables.
+     */
+    void copyChannelParams(IasEqualizerCoreChannelParams const &source, IasEqualizerCoreChannelParams &destination) const;
+
     // Member variables
     std::list<IasAudioChannelBundle*>  mOutputBundlesList;  //!< Sorted+unique list of all output bundles
     uint32_t                              mNumFilterStagesMax; //!< Maximum number of filter stages per channel
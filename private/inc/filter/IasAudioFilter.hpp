@@ -23,6 +23,7 @@
 #include "rtprocessingfwx/IasAudioChannelBundle.hpp"
 #include "audio/smartx/rtprocessingfwx/IasProcessingTypes.hpp" // typedef IasAudioFilterTypes
 #include "IasAudioFilterCallback.hpp"
+#include "helper/IasParameterMailbox.hpp"
 
 namespace IasAudio {
 
@@ -113,6 +114,8 @@ struct IasAudioFilterQueueEntry
   double  biquadCoeffs64[cIasNumCoeffsBiquad]; //!< Biquad coefficients as Float64.
   bool     useDoublePrecision;                  //!< True, if double precision shall be used.
   bool     clearStates;                         //!< True, if the filter variables shall be cleared.
+  uint32_t sequenceNumber;                      //!< Order in which the updates have been requested.
+  uint32_t freq;                                //!< Cut-off frequency or mid frequency of the prepared update.
 };
 
 
@@ -183,6 +186,18 @@ class IAS_AUDIO_PUBLIC IasAudioFilter
      */
     inline void setBundlePointer(IasAudioChannelBundle* bundle){mBundle = bundle;}
 
+    /*!
+     * @brief Select the kernel of the double-precision path.
+     *
+     * By default, the AVX kernel is used if the CPU supports it. Disabling it forces the
+     * SSE2 kernel, e.g. for comparing both kernels within one test run.
+     *
+     * @return              True, if the AVX kernel is used now.
+     *
+     * @param[in] useAvx    True to use the AVX kernel if the CPU supports it, false to use SSE2.
+     */
+    bool setUseAvx(bool useAvx);
+
     /*!
      * @brief Set the filter parameters of one single channel.
      *
@@ -204,6 +219,40 @@ class IAS_AUDIO_PUBLIC IasAudioFilter
      */
     int32_t setChannelFilter(uint32_t channel, IasAudioFilterParams const * params );
 
+    /*!
+     * @brief Prepare an immediate update of the filter parameters without applying it.
+     *
+     * Verifies the parameters and calculates the filter coefficients like
+     * IasAudioFilter::setChannelFilter, but stores the update in @a updateEntry
+     * instead of passing it to the processing thread. The update can be adopted
+     * later by IasAudioFilter::applyPreparedUpdate, e.g. as part of a parameter snapshot.
+     * The stored filter parameters of the channel are not changed before the update
+     * is adopted, so a prepared update that is never applied has no effect.
+     *
+     * @return                  Error value.
+     * @retval 0                Success!
+     * @retval -1               Invalid parameters.
+     *
+     * @param[in]  channel      Channel, whose parameters shall be set. Must be < 4.
+     * @param[in]  params       Filter parameters, which shall be used.
+     * @param[out] updateEntry  The prepared update.
+     */
+    int32_t prepareChannelFilter(uint32_t channel, IasAudioFilterParams const * params, IasAudioFilterQueueEntry *updateEntry);
+
+    /*!
+     * @brief Adopt an update prepared by IasAudioFilter::prepareChannelFilter.
+     *
+     * Must be called by the processing thread, before IasAudioFilter::calculate.
+     * Updates that have been requested before the prepared update and that have not
+     * been adopted yet are discarded. The prepared update is skipped if a later update
+     * has already been adopted. Otherwise the prepared parameters become the stored
+     * filter parameters of the channel. The command thread must not update the same
+     * channel while the prepared update is adopted.
+     *
+     * @param[in] updateEntry  The prepared update.
+     */
+    void applyPreparedUpdate(IasAudioFilterQueueEntry const &updateEntry);
+
     /*!
      * @brief Update the gain of the filter.
      *
@@ -294,6 +343,32 @@ class IAS_AUDIO_PUBLIC IasAudioFilter
      */
     IasAudioFilter& operator=(IasAudioFilter const &other); //lint !e1704
 
+    /*!
+     *  @brief Adopt a ramped update from the mailbox of its channel, called by calculate().
+     */
+    void applyRampedUpdate(IasAudioFilterQueueEntry const &updateEntry);
+
+    /*!
+     *  @brief Adopt an immediate update from the mailbox of its channel, called by calculate().
+     */
+    void applyImmediateUpdate(IasAudioFilterQueueEntry const &updateEntry);
+
+    /*!
+     *  @brief Store the filter parameters of a prepared update as the parameters of its channel.
+     */
+    void storeChannelParams(IasAudioFilterQueueEntry const &updateEntry);
+
+    /*!
+     *  @brief Execute the filter for one frame while the coefficients of at least one channel are ramped.
+     *
+     *  The coefficients are interpolated linearly from their values at the start of the frame
+     *  (mCoeffsStartBundle) to their values at the end of the frame (mCoeffsBundle), so that a
+     *  gain ramp does not step once per frame. Called by calculate().
+     *
+     *  @param[in] useDoublePrecision  True, if double precision shall be used.
+     */
+    void calculateInterpolated(bool useDoublePrecision);
+
     uint32_t                     mSampleFreq;
     uint32_t                     mFrameLength;
     float                   *mStateVarsBundle;
@@ -304,12 +379,21 @@ class IAS_AUDIO_PUBLIC IasAudioFilter
     double                  **mStateVars64;
     double                   *mCoeffsBundle64;
     double                  **mCoeffs64;
+    float                   *mCoeffsStartBundle;        //!< Coefficients at the start of the frame, while interpolating
+    float                   *mCoeffsDeltaBundle;        //!< Per-sample increment of the coefficients, while interpolating
+    double                   *mCoeffsStartBundle64;      //!< Coefficients at the start of the frame, double precision
+    double                   *mCoeffsDeltaBundle64;      //!< Per-sample increment of the coefficients, double precision
     IasAudioChannelBundle          *mBundle;
     IasAudioFilterProcessingParams  mProcessingParams[cIasNumChannelsPerBundle];
     IasAudioFilterParams            mFilterParams[cIasNumChannelsPerBundle];
     IasAudioFilterParamsInternal    mFilterParamsInternal[cIasNumChannelsPerBundle];
     IasAudioFilterCallback         *mCallback;
-    tbb::concurrent_queue<IasAudioFilterQueueEntry> filterUpdateQueue;
+    bool                         mUseAvx;                            //!< True, if the CPU supports the AVX kernel of the double-precision path
+    IasParameterMailbox<IasAudioFilterQueueEntry> mImmediateUpdateMailboxes[cIasNumChannelsPerBundle]; //!< Latest immediate update per channel
+    IasParameterMailbox<IasAudioFilterQueueEntry> mRampedUpdateMailboxes[cIasNumChannelsPerBundle];    //!< Latest ramped update per channel
+    std::atomic<bool>            mClearStatesPending[cIasNumChannelsPerBundle]; //!< Keeps a request to clear the states if immediate updates are coalesced
+    std::atomic<uint32_t>        mUpdateSequenceNumber;              //!< Sequence number of the next update
+    uint32_t                     mAppliedSequenceNumber[cIasNumChannelsPerBundle]; //!< Sequence number of the latest adopted update per channel, used by the processing thread only
     DltContext                  *mLogContext;                       //!< The log context for the audio filter
 };
 
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/**
+ * @file IasParameterMailbox.hpp
+ * @date 2018
+ * @brief Bounded "latest value wins" mailboxes to pass parameters to the real-time thread.
+ */
+
+#ifndef IASPARAMETERMAILBOX_HPP_
+#define IASPARAMETERMAILBOX_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace IasAudio {
+
+/** \class IasParameterMailbox
+ *  Mailbox for one parameter, e.g. the volume of one stream. The mailbox holds three preallocated slots of
+ *  type T (triple buffering): one slot is owned by the writer, one by the real-time reader and one holds
+ *  the latest value that was posted and not fetched yet. Posting a new value before the reader fetched the
+ *  previous one replaces the previous value, so the reader always gets the latest value only.
+ *
+ *  #post can be called by several non-real-time threads, it copies the value into the slot of the writer and
+ *  may allocate memory if T contains containers. #fetch is called by the real-time thread, it only exchanges
+ *  slot indices and neither allocates memory nor takes a lock. The slot returned by #fetch stays owned by
+ *  the reader until the next call of #fetch, so the reader may swap its content, e.g. a table, with its own
+ *  working copy instead of copying it.
+ */
+template <typename T>
+class IasParameterMailbox
+{
+  public:
+    /*!
+     *  @brief Constructor.
+     */
+    IasParameterMailbox()
+      :mSlots()
+      ,mWriteSlot(0)
+      ,mReadSlot(1)
+      ,mPendingSlot(2)
+      ,mWriteMutex()
+    {
+    }
+
+    /*!
+     *  @brief Destructor, virtual by default.
+     */
+    virtual ~IasParameterMailbox() {}
+
+    /**
+     * @brief Call a function for each slot, e.g. to reserve the capacity of contained tables.
+     *
+     * Must only be called during initialization, before the mailbox is used.
+     *
+     * @param[in] func Function called with a reference to each slot
+     */
+    template <typename Func>
+    void forEachSlot(Func func)
+    {
+      for (auto &slot : mSlots)
+      {
+        func(slot);
+      }
+    }
+
+    /**
+     * @brief Post a new value, replacing the value that has not been fetched yet.
+     *
+     * @param[in] value The new value
+     */
+    void post(const T &value)
+    {
+      std::lock_guard<std::mutex> lock(mWriteMutex);
+      mSlots[mWriteSlot] = value;
+      uint32_t previous = mPendingSlot.exchange(mWriteSlot | cNewValueFlag, std::memory_order_acq_rel);
+      mWriteSlot = previous & cSlotMask;
+    }
+
+    /**
+     * @brief Fetch the latest value, called by the real-time thread.
+     *
+     * @return Pointer to the latest value or nullptr if no new value was posted since the last call
+     */
+    T* fetch()
+    {
+      if ((mPendingSlot.load(std::memory_order_relaxed) & cNewValueFlag) == 0)
+      {
+        return nullptr;
+      }
+      uint32_t previous = mPendingSlot.exchange(mReadSlot, std::memory_order_acq_rel);
+      mReadSlot = previous & cSlotMask;
+      return &mSlots[mReadSlot];
+    }
+
+  private:
+    /*!
+     *  @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasParameterMailbox(IasParameterMailbox const &other);
+
+    /*!
+     *  @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasParameterMailbox& operator=(IasParameterMailbox const &other);
+
+    static const uint32_t cSlotMask = 0x3;         //!< Mask for the slot index
+    static const uint32_t cNewValueFlag = 0x4;     //!< Marks that the pending slot holds a value not fetched yet
+
+    T                        mSlots[3];            //!< The preallocated slots
+    uint32_t                 mWriteSlot;           //!< Slot owned by the writer
+    uint32_t                 mReadSlot;            //!< Slot owned by the reader
+    std::atomic<uint32_t>    mPendingSlot;         //!< Slot with the latest value, including the new value flag
+    std::mutex               mWriteMutex;          //!< Serializes concurrent writers
+};
+
+/** \class IasParameterMailboxMap
+ *  Fixed set of mailboxes for one parameter, one per key (e.g. per stream id or per filter band).
+ *  All keys have to be added during initialization. Afterwards, the set of mailboxes does not change,
+ *  so the real-time thread does a bounded amount of work per period, independent of the command rate.
+ */
+template <typename K, typename T>
+class IasParameterMailboxMap
+{
+  public:
+    /*!
+     *  @brief Constructor.
+     */
+    IasParameterMailboxMap()
+      :mMailboxes()
+    {
+    }
+
+    /*!
+     *  @brief Destructor, virtual by default.
+     */
+    virtual ~IasParameterMailboxMap() {}
+
+    /**
+     * @brief Add a mailbox for a key, must only be called during initialization.
+     *
+     * @param[in] key The key of the new mailbox
+     */
+    void add(const K &key)
+    {
+      if (mMailboxes.find(key) == mMailboxes.end())
+      {
+        mMailboxes[key].reset(new IasParameterMailbox<T>());
+      }
+    }
+
+    /**
+     * @brief Call a function for each slot of all mailboxes, must only be called during initialization.
+     *
+     * @param[in] func Function called with a reference to each slot
+     */
+    template <typename Func>
+    void forEachSlot(Func func)
+    {
+      for (auto &entry : mMailboxes)
+      {
+        entry.second->forEachSlot(func);
+      }
+    }
+
+    /**
+     * @brief Post a new value for a key.
+     *
+     * @param[in] key The key of the mailbox
+     * @param[in] value The new value
+     *
+     * @return False if there is no mailbox for the key
+     */
+    bool post(const K &key, const T &value)
+    {
+      auto mailboxIt = mMailboxes.find(key);
+      if (mailboxIt == mMailboxes.end())
+      {
+        return false;
+      }
+      mailboxIt->second->post(value);
+      return true;
+    }
+
+    /**
+     * @brief Call a function for each mailbox that holds a new value, called by the real-time thread.
+     *
+     * @param[in] func Function called with the key and a reference to the latest value
+     */
+    template <typename Func>
+    void fetchAll(Func func)
+    {
+      for (auto &entry : mMailboxes)
+      {
+        T *value = entry.second->fetch();
+        if (value != nullptr)
+        {
+          func(entry.first, *value);
+        }
+      }
+    }
+
+  private:
+    /*!
+     *  @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasParameterMailboxMap(IasParameterMailboxMap const &other);
+
+    /*!
+     *  @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasParameterMailboxMap& operator=(IasParameterMailboxMap const &other);
+
+    std::map<K, std::unique_ptr<IasParameterMailbox<T>>>  mMailboxes;  //!< One mailbox per key
+};
+
+} // namespace IasAudio
+
+#endif // IASPARAMETERMAILBOX_HPP_
@@ -18,6 +18,8 @@
 
 namespace IasAudio {
 
+static const uint32_t cIasRampBlockSize = 8;   //!< Number of ramp values computed at once
+
 /**
  * @brief enum for the possible return values
  */
@@ -139,6 +141,19 @@ class IAS_AUDIO_PUBLIC IasRamp
      */
     void setTimedRampExponential(float startValue, float endValue, uint32_t rampTime);
 
+    /*
+     * @brief This function precomputes the powers of the increment multiplier for the lanes of one block
+     */
+    void setLanePowers();
+
+    /*
+     * @brief This function computes the next ramp values in blocks of cIasRampBlockSize values
+     *
+     * @param numValues the number of ramp values to compute, must not exceed the remaining ramp length
+     * @param store     called with the index of the first value, the values and the number of values of each block
+     */
+    template <typename Store>
+    void computeRampValues(uint32_t numValues, Store store);
 
     uint32_t  mSampleFreq;
     uint32_t  mFrameSize;
@@ -152,6 +167,11 @@ class IAS_AUDIO_PUBLIC IasRamp
     uint32_t  mNumRampValues;
     bool    mRampSetActive;
     bool    mRampLinear;
+    double  mMultPowers[cIasRampBlockSize];        //!< mIncrementMult^1 to mIncrementMult^8
+    float   mMultPowersFloat[cIasRampBlockSize];   //!< mMultPowers as float for the vector computation
+    float  *mSettledData;                          //!< buffer that already holds the settled end value, nullptr if none
+    uint32_t  mSettledChannelIndex;                //!< first channel of mSettledData that holds the end value
+    uint32_t  mSettledNumChannels;                 //!< number of channels of mSettledData that hold the end value
 };
 
 } //namespace IasAudio
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/**
+ * @file IasRtHelperPool.hpp
+ * @date 2018
+ * @brief Small pool of real-time helper threads that execute independent jobs of one processing period.
+ */
+
+#ifndef IASRTHELPERPOOL_HPP_
+#define IASRTHELPERPOOL_HPP_
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <semaphore.h>
+#include <dlt/dlt.h>
+
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+
+namespace IasAudio {
+
+/** \class IasRtHelperPool
+ *  The calling real-time thread distributes a number of independent jobs over itself and the helper threads
+ *  and returns as soon as all jobs have been executed. The helper threads are named by the pool name and get
+ *  the scheduling parameters of the section [scheduling.rt.helperpool.<name>] of the config file.
+ *
+ *  #execute does not allocate memory and does not take any lock. It must not be called concurrently.
+ */
+class IAS_AUDIO_PUBLIC IasRtHelperPool
+{
+  public:
+    /**
+     * @brief The result type for the IasRtHelperPool methods
+     */
+    enum IasResult
+    {
+      eIasOk,                     //!< Operation successful
+      eIasFailed,                 //!< Operation failed
+    };
+
+    /**
+     * @brief The job function, called with the index of the job.
+     */
+    using IasJobFunction = std::function<void(uint32_t)>;
+
+    /*!
+     *  @brief Constructor.
+     *
+     *  @param[in] name The name of the pool, used for the thread names and the scheduling parameters
+     *  @param[in] numThreads The number of helper threads, the calling thread is not included
+     */
+    IasRtHelperPool(const std::string &name, uint32_t numThreads);
+
+    /*!
+     *  @brief Destructor, virtual by default.
+     */
+    virtual ~IasRtHelperPool();
+
+    /**
+     * @brief Start the helper threads.
+     *
+     * @return The result of the init call
+     */
+    IasResult init();
+
+    /**
+     * @brief Execute the jobs 0 to numJobs-1 and wait until all of them are finished.
+     *
+     * The job function is only referenced, so it has to be created once by the caller and not per call.
+     *
+     * @param[in] numJobs The number of jobs
+     * @param[in] job The job function
+     */
+    void execute(uint32_t numJobs, const IasJobFunction &job);
+
+    /**
+     * @brief Get the number of helper threads.
+     */
+    uint32_t getNumThreads() const { return static_cast<uint32_t>(mThreads.size()); }
+
+  private:
+    /*!
+     *  @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasRtHelperPool(IasRtHelperPool const &other);
+
+    /*!
+     *  @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasRtHelperPool& operator=(IasRtHelperPool const &other);
+
+    /**
+     * @brief The helper thread
+     */
+    void helperThread(uint32_t index);
+
+    /**
+     * @brief Execute jobs until there are no jobs left.
+     */
+    void executeJobs();
+
+    DltContext                    *mLog;            //!< DLT context
+    std::string                    mName;           //!< Name of the pool
+    uint32_t                       mNumThreads;     //!< Number of helper threads
+    std::vector<std::thread>       mThreads;        //!< The helper threads
+    std::vector<sem_t>             mStartSems;      //!< One start semaphore per helper thread
+    sem_t                          mDoneSem;        //!< Posted by each helper thread that finished its share of jobs
+    const IasJobFunction          *mJob;            //!< The current job function
+    uint32_t                       mNumJobs;        //!< Number of jobs of the current call
+    std::atomic<uint32_t>          mNextJob;        //!< Index of the next job that has not been claimed yet
+    std::atomic<bool>              mIsRunning;      //!< Exit condition of the helper threads
+};
+
+} // namespace IasAudio
+
+#endif // IASRTHELPERPOOL_HPP_
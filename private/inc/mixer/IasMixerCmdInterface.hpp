@@ -57,6 +57,18 @@ class IAS_AUDIO_PUBLIC IasMixerCmdInterface : public IasIModuleId
      */
     IasIModuleId::IasResult processCmd(const IasProperties& cmdProperties, IasProperties& returnProperties) override;
 
+    /**
+     * @brief Balance, fader and input gain offset can be sent via the fast command path.
+     */
+    bool isFastCmd(int32_t cmdId) const override;
+
+    /**
+     * @brief Process a balance, fader or input gain offset command, the value is given in dB/10.
+     *
+     * The mixer always ramps with its own fixed ramp, so commands with a ramp time other than 0 are rejected.
+     */
+    IasIModuleId::IasResult processFastCmd(const IasCmdHandle &handle, float value) override;
+
 
   private:
 
@@ -143,6 +155,21 @@ class IAS_AUDIO_PUBLIC IasMixerCmdInterface : public IasIModuleId
      */
     IasIModuleId::IasResult setInputGainOffset(const IasProperties& cmdProperties, IasProperties& returnProperties);
 
+    /**
+     * @brief Apply a balance value in dB/10, shared by the property based and the fast command path
+     */
+    IasIModuleId::IasResult applyBalance(int32_t streamId, float balance);
+
+    /**
+     * @brief Apply a fader value in dB/10, shared by the property based and the fast command path
+     */
+    IasIModuleId::IasResult applyFader(int32_t streamId, float fader);
+
+    /**
+     * @brief Apply an input gain offset in dB/10, shared by the property based and the fast command path
+     */
+    IasIModuleId::IasResult applyInputGainOffset(int32_t streamId, float gain);
+
     using IasCmdFunction = std::function<IasIModuleId::IasResult(IasMixerCmdInterface*, const IasProperties& cmdProperties, IasProperties& returnProperties)>;
 
     IasMixerCore                            *mCore;           //!< pointer to the module core
@@ -18,6 +18,7 @@
 #include "audio/smartx/rtprocessingfwx/IasGenericAudioCompCore.hpp"
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "mixer/IasMixerElementary.hpp"
+#include "helper/IasRtHelperPool.hpp"
 
 
 namespace IasAudio {
@@ -131,10 +132,25 @@ class IAS_AUDIO_PUBLIC IasMixerCore : public IasGenericAudioCompCore
      */
     IasAudioProcessingResult processChild() override;
 
+    /**
+     * @brief Create the helper pool if the property "numHelperThreads" asks for it.
+     *
+     * Elementary mixers whose output streams share a channel bundle add their samples to the same memory,
+     * so they are grouped and each group is executed by one thread, in the order of the serial processing.
+     *
+     * @return error                              the error code
+     * @retval eIasAudioProcInitializationFailed  the helper pool could not be started
+     * @retval eIasAudioProcOK                    no error
+     */
+    IasAudioProcessingResult initHelperPool();
+
     // Member variables
     IasMixerElementaryVector                 mElementaryMixers;  //!< vector containing the elementary mixers
     IasMixerCoreStreamMap                    mCoreStreamMap;     //!< map that connects the elementary mixer and the belonging streams
     std::list<IasAudioChannelBundle*>  mOutputBundlesList; //!< Sorted+unique list of all output bundles
+    std::unique_ptr<IasRtHelperPool>         mHelperPool;        //!< Helper threads that run the elementary mixers in parallel, nullptr if disabled
+    std::vector<IasMixerElementaryVector>    mElementaryMixerGroups; //!< Elementary mixers grouped by shared output bundles, one job of the helper pool per group
+    IasRtHelperPool::IasJobFunction          mRunElementaryMixerGroup; //!< Job function of the helper pool, runs the elementary mixers of one group
     DltContext                              *mLogContext;        //!< The log context for the mixer
 };
 
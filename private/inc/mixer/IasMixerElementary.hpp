@@ -22,6 +22,7 @@
 #include "rtprocessingfwx/IasGenericAudioCompConfig.hpp"
 #include "rtprocessingfwx/IasAudioChannelBundle.hpp"
 #include "helper/IasRamp.hpp"
+#include "helper/IasParameterMailbox.hpp"
 
 // disable conversion warnings for tbb
 #pragma GCC diagnostic push
@@ -106,6 +107,16 @@ struct IasMixerElementaryStreamParams
   IasMixerGainParams                     gainOffsetParams;     ///< Gain offset parameters.
   std::vector<float*>                    matrixGainVector;     ///< Vector [mNumOutputChannels] with pointers to the affected gain values within mMatrixVector
   IasMixerElementaryChannelMappingVector channelMappingVector; ///< Describes for each input channel in which bundle it can be found
+  std::vector<uint32_t>                  tileIndexVector;      ///< Indices (outputBundle*mNumberInputBundles+inputBundle) of all gain tiles written by this stream
+};
+
+/**
+ *  @brief Describes one gain tile that has to be processed, i.e. one pair of output and input bundle.
+ */
+struct IasMixerElementaryActiveTile
+{
+  uint32_t   outputBundleIndex;   ///< index of the output bundle
+  uint32_t   inputBundleIndex;    ///< index of the input bundle
 };
 
 /**
@@ -172,6 +183,7 @@ using IasMixerElementaryStreamParamsMap = std::map<int32_t,IasMixerElementaryStr
 using IasMixerElementaryStreamParamsPair = std::pair<int32_t,IasMixerElementaryStreamParams>;
 using IasMixerElementaryStreamParamsVector = std::vector<IasMixerElementaryStreamParams>;
 using IasMixerElementaryIndexMap = std::map<uint32_t,std::vector<float>>;
+using IasMixerElementaryActiveTileVector = std::vector<IasMixerElementaryActiveTile>;
 using IasEMixerDataVector = std::vector<float>;
 using IasEMixerList = std::list<int32_t>;
 using IasEMixerListIterator = IasEMixerList::iterator;
@@ -222,6 +234,11 @@ class IAS_AUDIO_PUBLIC IasMixerElementary
      */
     void run();
 
+    /**
+     *  @brief Get all output bundles written by run(), valid after init().
+     */
+    const std::vector<IasAudioChannelBundle*>& getOutputBundles() const { return mOutputBundles; }
+
     /**
      *  @brief Announce a call back object, which shall be executed if a
      *         balance/fader/gainoffset ramp is finished.
@@ -388,7 +405,17 @@ class IAS_AUDIO_PUBLIC IasMixerElementary
     void updateRampActiveStreams();
 
     /**
-     *  @brief check the cmd queues ( tbb cncurrent queues ) if there are new cmd to process
+     *  @brief Rebuild the list of gain tiles that have to be processed by run().
+     *
+     *  A tile is active if at least one of its gain values is not zero or if it is written by
+     *  a stream that is currently ramping. All other tiles do not contribute to the output and are skipped,
+     *  unless the property "skipZeroGainTiles" is 0.
+     *  Called by the real-time thread, the list has been preallocated by init().
+     */
+    void updateActiveTiles();
+
+    /**
+     *  @brief check the cmd mailboxes if there are new cmds to process, only the latest cmd per stream is applied
      */
     void checkQueues();
 
@@ -433,10 +460,16 @@ class IAS_AUDIO_PUBLIC IasMixerElementary
     IasMixerElementaryChannelMappingVector               mOutputChannelMappingVector; //!< describes for each output channel in which bundle it can be found
     std::list<IasAudioChannelBundle*>                    mInputBundlesList;     //!< List of all input bundles
     std::list<IasAudioChannelBundle*>                    mOutputBundlesList;    //!< List of all output bundles
+    std::vector<IasAudioChannelBundle*>                  mInputBundles;         //!< All input bundles, indexed like the columns of mGainTileMatrix
+    std::vector<IasAudioChannelBundle*>                  mOutputBundles;        //!< All output bundles, indexed like the rows of mGainTileMatrix
+    IasMixerElementaryActiveTileVector                   mActiveTiles;          //!< Compact list of the gain tiles that are processed by run()
+    std::vector<uint8_t>                                 mRampTileFlags;        //!< Marks the tiles written by ramping streams [mNumberOutputBundles*mNumberInputBundles]
+    bool                                                 mActiveTilesDirty;     //!< True if mActiveTiles has to be rebuilt before the next frame
+    bool                                                 mSkipZeroGainTiles;    //!< False if all tiles are processed, see property "skipZeroGainTiles"
     bool                                                 multiChannelInputPresent; //!< flag to indicate if mixer has a multichannel (5.1) input.
-    tbb::concurrent_queue<IasMixerBalanceQueueEntry>     mBalanceQueue; //!< queue for balance commands
-    tbb::concurrent_queue<IasMixerFaderQueueEntry>       mFaderQueue;   //!< queue for fader commands
-    tbb::concurrent_queue<IasMixerGainOffsetQueueEntry>  mGainOffsetQueue; //!< queue for gain offset commands
+    IasParameterMailboxMap<int32_t, IasMixerBalanceQueueEntry>    mBalanceMailboxes;    //!< latest balance command per stream
+    IasParameterMailboxMap<int32_t, IasMixerFaderQueueEntry>      mFaderMailboxes;      //!< latest fader command per stream
+    IasParameterMailboxMap<int32_t, IasMixerGainOffsetQueueEntry> mGainOffsetMailboxes; //!< latest gain offset command per stream
     const IasIGenericAudioCompConfig                    *mConfig;              //!< mConfig needed for events
     std::string                                          mTypeName;            //!< Name of the module type
     std::string                                          mInstanceName;        //!< Name of the module instance
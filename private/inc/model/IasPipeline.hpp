@@ -12,12 +12,16 @@
 #ifndef IASPIPELINE_HPP_
 #define IASPIPELINE_HPP_
 
+#include <set>
+#include <atomic>
 
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "audio/smartx/rtprocessingfwx/IasBaseAudioStream.hpp"
 #include "smartx/IasAudioTypedefs.hpp"
 #include "model/IasProcessingModule.hpp"
+#include "helper/IasParameterMailbox.hpp"
+#include "smartx/IasProbeSlots.hpp"
 
 /*!
  * @brief namespace IasAudio
@@ -27,6 +31,7 @@ namespace IasAudio {
 class IasAudioRingBuffer;
 class IasAudioStream;
 class IasAudioPort;
+class IasGenericAudioCompCore;
 
 /*!
  * @brief Documentation for class IasPipeline
@@ -218,8 +223,12 @@ class IAS_AUDIO_PUBLIC IasPipeline
      *
      * @param[in] outputPin Audio output or combined input/output pin
      * @param[in] inputPin Audio input or combined input/output pin
+     *
+     * @return The result of the method call
+     * @retval eIasOk Method succeeded.
+     * @retval eIasFailed The output pin is not linked to the input pin. Details can be found in the log.
      */
-    void unlink(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin);
+    IasResult unlink(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin);
 
     /**
      * @brief Link an input port with a pipeline pin
@@ -287,6 +296,50 @@ class IAS_AUDIO_PUBLIC IasPipeline
      */
     IasResult initAudioChain();
 
+    /**
+     * @brief Enable or disable relinking the audio pins while the pipeline is running.
+     *
+     * If enabled, each audio pin gets an audio stream of its own and the audio components of all
+     * processing modules are created, even if they are not linked yet. The audio chain is then executed
+     * by a program of copy and process steps, which can be replaced at a period boundary by #commitPinLinks.
+     * The additional copies between the audio streams make a relinkable pipeline somewhat slower than a
+     * static one.
+     *
+     * @param[in] enable  true to enable runtime relinking
+     *
+     * @return The result of the method call
+     * @retval eIasOk     Method succeeded.
+     * @retval eIasFailed The audio chain has already been initialized.
+     */
+    IasResult setRuntimeRelinking(bool enable);
+
+    /**
+     * @brief Check whether runtime relinking is enabled
+     */
+    bool isRuntimeRelinkingEnabled() const { return mRuntimeRelinking; }
+
+    /**
+     * @brief Check whether the audio chain has been initialized
+     */
+    bool isAudioChainInitialized() const { return mAudioChain != nullptr; }
+
+    /**
+     * @brief Apply the current links of the audio pins to the running pipeline.
+     *
+     * A new processing program is built from the current links and handed over to the real-time thread,
+     * which switches to it at the next period boundary. All audio pins whose source changed are faded out
+     * at the end of the last period of the old program and faded in at the start of the first period of the
+     * new program. All other audio pins are not affected.
+     *
+     * @param[in] crossfadeLength  Length of the fade-out and of the fade-in in frames, 0 switches without fading.
+     *                             The length is limited to one period.
+     *
+     * @return The result of the method call
+     * @retval eIasOk     Method succeeded.
+     * @retval eIasFailed Runtime relinking is not enabled or the audio chain has not been initialized yet.
+     */
+    IasResult commitPinLinks(uint32_t crossfadeLength);
+
     /**
      * @brief Provide input data for the pipeline.
      *
@@ -380,6 +433,80 @@ class IAS_AUDIO_PUBLIC IasPipeline
      */
     void stopPinProbing(IasAudioPinPtr pin);
 
+    /**
+     * @brief Start scanning the audio stream of a pin for the marker of a latency probe
+     *
+     * The audio stream is scanned after the audio chain has been processed.
+     *
+     * @param[in] pin        pointer to the audio pin where the marker shall be detected
+     * @param[in] probe      the latency probe
+     *
+     * @return               Result of the function call
+     */
+    IasResult startLatencyProbe(IasAudioPinPtr pin, IasLatencyProbePtr probe);
+
+    /**
+     * @brief Stop scanning for the marker of a latency probe
+     */
+    void stopLatencyProbe();
+
+    /**
+     * @brief Attach a stream tap to the audio stream of a pin
+     *
+     * The audio stream is passed to the tap at the position of the pin in the processing sequence:
+     * @li the data of a pipeline input pin before the first module is processed,
+     * @li the data of a module input pin right before its module is processed,
+     * @li the data of a module output pin or of an in-place pin right after its module is processed,
+     * @li the data of a pipeline output pin after the last module has been processed.
+     *
+     * So two pins around a module show the effect of the module, even if they share one audio stream.
+     * Several pins of the pipeline can be tapped at the same time, but only one tap per pin. The pipeline
+     * has to be initialized before.
+     *
+     * @param[in] pin        pointer to the audio pin that shall be recorded
+     * @param[in] probe      the stream tap
+     *
+     * @return               Result of the function call
+     */
+    IasResult startStreamProbe(IasAudioPinPtr pin, IasStreamTapPtr probe);
+
+    /**
+     * @brief Detach the stream tap from the audio stream of a pin
+     *
+     * @param[in] pin        pointer to the audio pin
+     */
+    void stopStreamProbe(IasAudioPinPtr pin);
+
+    /**
+     * @brief Type definition for the processing time of one processing module, used by IasPipeline::getModuleTimes.
+     */
+    using IasModuleTime = std::pair<std::string, uint64_t>;
+
+    /**
+     * @brief Type definition for a vector of processing times, used by IasPipeline::getModuleTimes.
+     */
+    using IasModuleTimeVector = std::vector<IasModuleTime>;
+
+    /**
+     * @brief Enable or disable measuring the processing time of each processing module
+     *
+     * Enabling resets the accumulated processing times. This method must be called from the thread
+     * that calls #process, i.e. it is meant for the benchmark mode of the test framework.
+     *
+     * @param[in] enable     true to enable the measurement, false to disable it
+     *
+     * @return               Result of the function call
+     * @retval eIasFailed    audio chain of the pipeline has not been initialized yet
+     */
+    IasResult enableModuleTiming(bool enable);
+
+    /**
+     * @brief Get the accumulated processing time of each processing module
+     *
+     * @param[out] moduleTimes  instance names and processing times in nanoseconds, in the order of execution
+     */
+    void getModuleTimes(IasModuleTimeVector *moduleTimes) const;
+
     /*
      * @brief Get a vector to pipeline input pins.
      *
@@ -431,6 +558,17 @@ class IAS_AUDIO_PUBLIC IasPipeline
      */
     void identifyProcessingSequence();
 
+    /*!
+     * @brief Private method: get the audio data of an audio stream for a latency probe or stream tap.
+     *
+     * @param[in]  audioStreamId  id of the probed audio stream
+     * @param[out] audioFrame     pointers to the channel buffers of the audio stream
+     * @param[out] stride         distance between two samples of one channel
+     *
+     * @return                    True if the audio stream exists and has audio data
+     */
+    bool getProbedAudioData(uint32_t audioStreamId, IasAudioFrame **audioFrame, uint32_t *stride) const;
+
     /*!
      * @brief Private method: Identify all required audio streams and initialize them.
      *
@@ -458,6 +596,9 @@ class IAS_AUDIO_PUBLIC IasPipeline
     //! Constant number representing an undefined audioStreamId.
     static const uint32_t cAudioStreamIdUndefined = 0xFFFFFFFF;
 
+    //! Constant number representing a pin without stream tap position.
+    static const uint32_t cStreamTapKeyUndefined = 0xFFFFFFFF;
+
 
     /*!
      * @brief Parameters describing how an audio pin is connected with its neighbors.
@@ -561,6 +702,66 @@ class IAS_AUDIO_PUBLIC IasPipeline
 
     using IasAudioStreamVector = std::vector<IasAudioStreamConnectionParams>;
 
+    /**
+     * @brief One step of the program that executes a relinkable pipeline.
+     */
+    struct IasRelinkStep
+    {
+      /**
+       * @brief The type of the step
+       */
+      enum IasType
+      {
+        eIasCopy,     //!< Copy the source stream via the channel buffers of the destination pin into the destination stream
+        eIasZero,     //!< Feed zeros into the destination stream, because its pin is not linked to an active source
+        eIasProcess,  //!< Execute the processing core of a module
+      };
+
+      IasType                   type;                   //!< Type of the step
+      IasAudioStream*           sourceStream;           //!< Source stream of a copy step
+      uint32_t                  sourceStreamId;         //!< Id of the source stream of a copy step
+      bool                      isSourcePipelineInput;  //!< The source stream belongs to a pipeline input pin
+      IasAudioStream*           destinStream;           //!< Destination stream of a copy or zero step
+      uint32_t                  destinStreamId;         //!< Id of the destination stream
+      bool                      isDestinPipelineOutput; //!< The destination stream belongs to a pipeline output pin
+      const std::vector<float*>* channelBuffers;        //!< Channel buffers of the destination pin
+      IasGenericAudioCompCore*  core;                   //!< Processing core of a process step
+      uint32_t                  componentIdx;           //!< Index of the audio component in the audio chain
+      std::vector<uint32_t>     inputStreamIds;         //!< Ids of the streams of the module input pins of a process step
+      std::vector<uint32_t>     outputStreamIds;        //!< Ids of the streams of the module output pins of a process step
+    };
+
+    /**
+     * @brief Program that executes a relinkable pipeline for one period.
+     */
+    struct IasRelinkProgram
+    {
+      std::vector<IasRelinkStep> steps;                 //!< Steps in execution order
+      std::vector<uint8_t>       changedStreams;        //!< Per destination stream id: 1 if the source of its pin changed
+      uint32_t                   crossfadeLength;       //!< Length of the fade-out and the fade-in in frames
+      uint32_t                   sequenceNumber;        //!< Number of the commit that built the program
+    };
+
+    /**
+     * @brief Type definition for the source of a linked audio pin, together with the flag for a delayed link.
+     */
+    using IasPinSource = std::pair<IasAudioPinPtr, bool>;
+
+    /**
+     * @brief Type definition for the sources of all linked audio pins.
+     */
+    using IasPinSourceMap = std::map<IasAudioPinPtr, IasPinSource>;
+
+    /**
+     * @brief State of the switch from one relink program to the next one.
+     */
+    enum IasRelinkState
+    {
+      eIasRelinkIdle,       //!< The active program is executed as is
+      eIasRelinkFadeOut,    //!< The changed pins are faded out, the next program is activated at the end of the period
+      eIasRelinkFadeIn,     //!< The changed pins are faded in
+    };
+
 
     /*!
      * @brief Private method: createAudioChannelBuffers
@@ -593,6 +794,35 @@ class IAS_AUDIO_PUBLIC IasPipeline
      */
     void eraseAudioChannelBuffers(IasAudioPinPtr audioPin);
 
+    /*!
+     * @brief Private method: build the program of a relinkable pipeline from the current links of the audio pins.
+     *
+     * The method does not modify any member that is used by the real-time thread.
+     *
+     * @param[out] program      The new program
+     * @param[out] pinSources   The sources of all linked audio pins the program is based on
+     */
+    void buildRelinkProgram(IasRelinkProgram *program, IasPinSourceMap *pinSources) const;
+
+    /*!
+     * @brief Private method: execute the program of a relinkable pipeline, called by #process.
+     */
+    void processRelinkProgram();
+
+    /*!
+     * @brief Private method: execute one program and fade the changed destination streams.
+     *
+     * A changed destination stream is not faded again if its source has already been faded
+     * during this period, e.g. by a changed link in front of an inserted module.
+     *
+     * @param[in] program         The program
+     * @param[in] changedStreams  The changed destination streams, nullptr if no stream shall be faded
+     * @param[in] fadeLength      Length of the fade in frames
+     * @param[in] fadeIn          true for a fade-in at the start of the period, false for a fade-out at its end
+     */
+    void executeRelinkProgram(const IasRelinkProgram &program, const std::vector<uint8_t> *changedStreams,
+                              uint32_t fadeLength, bool fadeIn);
+
     /**
      * @brief Retrieve output data from a given pin of the pipeline.
      *
@@ -627,6 +857,35 @@ class IAS_AUDIO_PUBLIC IasPipeline
      **/
     const IasAudioPinConnectionParamsPtr getPinConnectionParams(IasAudioPinPtr pin) const;
 
+    /*!
+     * @brief Private method: get the key of the stream tap of a pin.
+     *
+     * The key combines the position of the pin in the processing sequence with the id of its audio stream,
+     * see #startStreamProbe.
+     *
+     * @param[in] pin     The tapped audio pin
+     * @param[in] params  The connection parameters of the pin
+     *
+     * @return            The key, cStreamTapKeyUndefined if the pin has no position in the processing sequence
+     */
+    uint32_t getStreamTapKey(const IasAudioPinPtr &pin, const IasAudioPinConnectionParamsPtr &params) const;
+
+    /*!
+     * @brief Private method: pass the audio streams to all stream taps at one position of the processing sequence.
+     *
+     * @param[in] position  The position: 0 before the first module, 2*i+1 before and 2*i+2 after
+     *                      the module with component index i, 2*n+1 after all n modules
+     */
+    void processStreamTaps(uint32_t position);
+
+    /*!
+     * @brief Private method: process one audio component and measure its processing time if module timing is enabled.
+     *
+     * @param[in] componentIdx  Index of the component in the audio chain
+     * @param[in] core          The core of the component
+     */
+    void processAudioComponent(uint32_t componentIdx, IasGenericAudioCompCore *core);
+
     /*
      * Member Variables
      */
@@ -642,6 +901,21 @@ class IAS_AUDIO_PUBLIC IasPipeline
     IasSinkPinMap          mSinkPinMap;          //!< Map with all pins linked to a sink device.
     IasAudioPinVector      mPipelineInputPins;   //!< Vector with pipeline input pins
     IasAudioPinVector      mPipelineOutputPins;  //!< Vector with pipeline output pins
+    IasLatencyProbeSlots   mLatencyProbeSlots;   //!< Latency probe scanning an audio stream, keyed by the id of the audio stream
+    IasStreamTapSlots      mStreamTapSlots;      //!< Stream taps recording audio pins, keyed by position and audio stream id
+    bool                   mModuleTimingEnabled; //!< Flag indicating whether the processing time of each module is measured
+    std::vector<uint64_t>  mModuleTimes;         //!< Accumulated processing time of each module in nanoseconds
+    IasProcessingModuleSchedulingList mComponentModules; //!< List with all modules whose audio component has been created
+    bool                   mRuntimeRelinking;    //!< Flag indicating whether the audio pins can be relinked while running
+    IasPinSourceMap        mCommittedPinSources; //!< Sources of the linked audio pins of the last committed program
+    IasRelinkProgram       mRelinkProgram;       //!< Active program of a relinkable pipeline, used by the real-time thread
+    IasParameterMailbox<IasRelinkProgram> mRelinkProgramMailbox; //!< Mailbox to pass a new program to the real-time thread
+    IasRelinkProgram*      mNextRelinkProgram;   //!< Program fetched from the mailbox, activated after the fade-out
+    IasRelinkState         mRelinkState;         //!< State of the switch to the next program
+    uint32_t               mPostedRelinkSequence; //!< Sequence number of the last posted program
+    std::vector<uint8_t>   mPostedChangedStreams; //!< Changed streams of the last posted program
+    std::atomic<uint32_t>  mFetchedRelinkSequence; //!< Sequence number of the last program fetched by the real-time thread
+    std::vector<uint8_t>   mFadedStreams;        //!< Per stream id: 1 if the stream has been faded in the current period
 };
 
 
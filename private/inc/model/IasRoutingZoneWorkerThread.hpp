@@ -16,6 +16,10 @@
 
 #include "avbaudiomodules/internal/audio/common/helper/IasIRunnable.hpp"
 #include "IasAudioTypedefs.hpp"
+#include "audio/smartx/IasISetup.hpp"
+#include "helper/IasParameterMailbox.hpp"
+#include "model/IasSinkFillController.hpp"
+#include "smartx/IasProbeSlots.hpp"
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
@@ -337,6 +341,16 @@ class IAS_AUDIO_PUBLIC IasRoutingZoneWorkerThread : public IasIRunnable
      */
     void stopProbing();
 
+    /**
+     * @brief Get the slot of the latency probe that scans the data written to the sink device for its marker
+     */
+    IasLatencyProbeSlots& getLatencyProbeSlots() { return mLatencyProbeSlots; }
+
+    /**
+     * @brief Get the slot of the stream tap that receives the data written to the sink device
+     */
+    IasStreamTapSlots& getStreamTapSlots() { return mStreamTapSlots; }
+
     IasResult start();
     IasResult stop();
 
@@ -398,6 +412,23 @@ class IAS_AUDIO_PUBLIC IasRoutingZoneWorkerThread : public IasIRunnable
      */
     IasPipelinePtr getPipeline() const { return mPipeline; }
 
+    /**
+     * @brief Set the prefill parameters of the sink device buffer
+     *
+     * The parameters are used the next time the zone is started. If the zone is active, they are
+     * passed to the real-time thread, which approaches the new fill level period by period.
+     *
+     * @param[in] params The prefill parameters
+     */
+    void setSinkPrefill(const IasISetup::IasSinkPrefillParams &params);
+
+    /**
+     * @brief Get the prefill parameters of the sink device buffer
+     *
+     * @returns The prefill parameters
+     */
+    IasISetup::IasSinkPrefillParams getSinkPrefill() const;
+
   private:
     /**
      * @brief Copy constructor, private unimplemented to prevent misuse.
@@ -426,22 +457,22 @@ class IAS_AUDIO_PUBLIC IasRoutingZoneWorkerThread : public IasIRunnable
     /**
      * @brief Prefill the sink ringbuffer with zeros
      *
-     * This will fill the sink ringbuffer with (bufferSize - periodSize) zeros, to have
-     * a defined startup fill level for the sink devices linked to a derived zone.
+     * This will fill the sink ringbuffer with the configured prefill depth, by default (bufferSize - periodSize) zeros,
+     * to have a defined startup fill level for the sink devices linked to a derived zone.
      * The base zone worker thread then waits until the device has removed one period from this
      * buffer before activating the processing for this derived zone. After the derived zone
      * is activated the free space is then filled with the first valid samples if a source
      * port is already connected, or again with zeros if nothing is connected. This keeps the buffer
-     * always at a fill level of (bufferSize - periodSize).
+     * always at the prefill level.
      */
     void prefillSinkBuffer();
 
     /**
      * @brief Check if a sink device is serviced
      *
-     * The sink device ringbuffer is filled with (bufferSize - periodSize) or periodSize zeros. If during
-     * a check it is detected that the current buffer fill level is suddenly <= (bufferSize - 2*periodSize) or < periodSize,
-     * then the sink device was serviced and there is space to fill one or more periods.
+     * The sink device ringbuffer is prefilled with zeros, by default with (bufferSize - periodSize) or periodSize zeros. If
+     * during a check it is detected that the current buffer fill level is suddenly <= (prefill - periodSize) for an ALSA handler
+     * or < prefill for a SmartXbar plugin, then the sink device was serviced and there is space to fill one or more periods.
      *
      * @return True if the sink was serviced, or false if the sink device wasn't serviced yet.
      */
@@ -454,6 +485,19 @@ class IAS_AUDIO_PUBLIC IasRoutingZoneWorkerThread : public IasIRunnable
      */
     void clearConversionBuffers();
 
+    /**
+     * @brief Keep the fill level of the sink device buffer at the target of the fill controller
+     *
+     * Only used by derived zones whose sink device is an ALSA handler that is not clocked asynchronously.
+     * Either writes a period of zeros into the sink device buffer or signals that the current period shall
+     * be dropped.
+     *
+     * @param[in,out] numFramesAvailable Free space of the sink device buffer, updated if a period was inserted
+     *
+     * @returns True if the current period shall be written, false if it shall be dropped
+     */
+    bool controlSinkFillLevel(uint32_t *numFramesAvailable);
+
 
     DltContext                                 *mLog;                       //!< The DLT log context
     IasRoutingZoneParamsPtr                     mParams;                    //!< The params of the routing zone
@@ -472,6 +516,8 @@ class IAS_AUDIO_PUBLIC IasRoutingZoneWorkerThread : public IasIRunnable
     IasDataProbePtr                             mDataProbe;                 //!< Data probing object. Only exists when data probing is activated
     tbb::concurrent_queue<IasProbingQueueEntry> mProbingQueue;              //!< Queue to pass probing actions from non-real-time to real-time thread
     std::atomic<bool>                           mProbingActive;             //!< Flag to signal whether probing is active
+    IasLatencyProbeSlots                        mLatencyProbeSlots;         //!< Latency probe scanning the sink device data, if active
+    IasStreamTapSlots                           mStreamTapSlots;            //!< Stream tap receiving the sink device data, if active
     bool                                        mIsDerivedZone;             //!< True, if this zone is a derived zone
     std::mutex                                  mMutexDerivedZones;         //!< Mutex to protect read vs. erase accesses to mDerivedZoneParamsMap
     std::mutex                                  mMutexConversionBuffers;    //!< Mutex to protect read vs. erase accesses to mConversionBufferParamsMap
@@ -488,6 +534,11 @@ class IAS_AUDIO_PUBLIC IasRoutingZoneWorkerThread : public IasIRunnable
     uint32_t                                    mLogInterval;               //!< The log intervall to provide important logs that should not "spam" everything
     uint32_t                                    mTimeoutCnt;                //!< The timeout counter used to control the amount of logs. This also uses the mLogInterval for throtteling.
     uint32_t                                    mLogOkCnt;                  //!< This count is used to reset the mLogCnt, whenever the buffer fill level is ok for a certain number of times.
+    IasISetup::IasSinkPrefillParams             mSinkPrefillParams;         //!< The prefill parameters of the sink device buffer
+    mutable std::mutex                          mMutexSinkPrefill;          //!< Mutex to protect the prefill parameters
+    IasParameterMailbox<IasISetup::IasSinkPrefillParams> mSinkPrefillMailbox; //!< Mailbox to pass new prefill parameters to the real-time thread
+    IasSinkFillController                       mSinkFillController;        //!< Controller of the fill level of the sink device buffer
+    bool                                        mSinkFillControlEnabled;    //!< True, if the fill level of the sink device buffer is controlled at runtime
 };
 
 
@@ -554,6 +605,17 @@ class IasRunnerThread final : public IasIRunnable
     bool isProcessing() const;
     uint32_t getPeriodSizeMultiple() const;
 
+    /**
+     * @brief Get the name of the runner thread
+     *
+     * The name is composed of the name of the parent zone and the period size multiple, e.g. MainZone.psm4.
+     * It identifies the runner thread independent of the derived zones it serves and is used to look up the
+     * scheduling parameters of the section [scheduling.rt.runner.<name>].
+     *
+     * @return The name of the runner thread
+     */
+    const std::string& getName() const;
+
   private:
     /**
      * @brief Copy constructor, not required.
@@ -574,6 +636,7 @@ class IasRunnerThread final : public IasIRunnable
     IasThread                     *mThread;                  //!< The thread object of the runner thread
     std::atomic_bool               mIsProcessing;            //!< Flag to indicate whether the runner thread is currently active and processing
     std::string                    mParentZoneName;          //!< Name of the parent routing zone for logging purposes
+    std::string                    mName;                    //!< Name of the runner thread, used to look up the scheduling params
 };
 
 /**
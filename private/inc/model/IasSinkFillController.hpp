@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasSinkFillController.hpp
+ * @date   2018
+ * @brief  Control of the fill level of the sink device buffer of a derived routing zone.
+ */
+
+#ifndef IASSINKFILLCONTROLLER_HPP_
+#define IASSINKFILLCONTROLLER_HPP_
+
+#include "audio/smartx/IasISetup.hpp"
+
+namespace IasAudio {
+
+/**
+ * @brief Controls the fill level of the sink device buffer of a derived routing zone.
+ *
+ * The target fill level is the fill level directly after the prefill, respectively after a period was written.
+ * The routing zone reports the fill level of the sink device buffer before it writes a period, which is the
+ * margin left against an underrun. At the end of each measurement window, the controller compares the highest
+ * fill level after writing with the target fill level and asks the routing zone to insert a period of zeros
+ * or to drop a period if the difference is at least three quarters of a period. In adaptive mode, the target is raised by one period when the lowest fill level of a window was less
+ * than half a period, and lowered by one period when the lowest fill level was at least one and a half periods
+ * for several windows in a row.
+ *
+ * The controller is used by the real-time thread of the routing zone only.
+ */
+class IAS_AUDIO_PUBLIC IasSinkFillController
+{
+  public:
+    /**
+     * @brief The action the routing zone has to take for the current period
+     */
+    enum IasAction
+    {
+      eIasKeep,             //!< Write the period as usual
+      eIasInsertPeriod,     //!< Write a period of zeros in addition to the period
+      eIasDropPeriod,       //!< Do not write the period
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    IasSinkFillController();
+
+    /**
+     * @brief Destructor.
+     */
+    ~IasSinkFillController();
+
+    /**
+     * @brief Initialize the controller for a sink device.
+     *
+     * @param[in] periodSize The period size of the routing zone in frames
+     * @param[in] bufferSize The size of the sink device buffer in frames
+     * @param[in] defaultFill The fill level used if the parameters do not specify one
+     * @param[in] windowLength The number of periods of one measurement window
+     */
+    void init(uint32_t periodSize, uint32_t bufferSize, uint32_t defaultFill, uint32_t windowLength);
+
+    /**
+     * @brief Set new prefill parameters, the target fill level is reset to the configured fill level.
+     *
+     * All fill levels are rounded down to a multiple of the period size.
+     *
+     * @param[in] params The prefill parameters
+     */
+    void setParams(const IasISetup::IasSinkPrefillParams &params);
+
+    /**
+     * @brief Report the fill level of the sink device buffer before the period is written.
+     *
+     * @param[in] fillLevel Number of frames in the sink device buffer
+     *
+     * @return The action for the current period
+     */
+    IasAction update(uint32_t fillLevel);
+
+    /**
+     * @brief Get the current target fill level in frames.
+     */
+    uint32_t getTarget() const { return mTarget; }
+
+    /**
+     * @brief Get the number of periods of zeros inserted since the last call of #init.
+     */
+    uint32_t getNumInsertedPeriods() const { return mNumInsertedPeriods; }
+
+    /**
+     * @brief Get the number of periods dropped since the last call of #init.
+     */
+    uint32_t getNumDroppedPeriods() const { return mNumDroppedPeriods; }
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasSinkFillController(IasSinkFillController const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasSinkFillController& operator=(IasSinkFillController const &other);
+
+    /**
+     * @brief Reset the measurements of the current window
+     */
+    void resetWindow();
+
+    /**
+     * @brief Round a number of frames down to a multiple of the period size
+     */
+    uint32_t roundToPeriods(uint32_t numFrames) const;
+
+    uint32_t     mPeriodSize;            //!< Period size in frames
+    uint32_t     mMaxFill;               //!< Highest possible fill level, one period has to remain free for writing
+    uint32_t     mDefaultFill;           //!< Fill level used if the parameters do not specify one
+    uint32_t     mWindowLength;          //!< Number of periods of one measurement window
+    bool         mAdaptive;              //!< Adapt the target to the observed underrun margin
+    uint32_t     mTargetMin;             //!< Lowest target of the adaptation
+    uint32_t     mTargetMax;             //!< Highest target of the adaptation
+    uint32_t     mTarget;                //!< Current target fill level
+    uint32_t     mNumMeasurements;       //!< Number of fill levels reported in the current window
+    uint32_t     mLowestFill;            //!< Lowest fill level of the current window
+    uint32_t     mHighestFill;           //!< Highest fill level of the current window
+    uint32_t     mNumSafeWindows;        //!< Number of consecutive windows with a large underrun margin
+    uint32_t     mNumInsertedPeriods;    //!< Number of periods of zeros inserted
+    uint32_t     mNumDroppedPeriods;     //!< Number of periods dropped
+};
+
+} //namespace IasAudio
+
+#endif /* IASSINKFILLCONTROLLER_HPP_ */
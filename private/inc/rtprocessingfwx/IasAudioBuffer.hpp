@@ -62,6 +62,22 @@ class IasAudioBuffer
      */
     inline void setHomePool(IasAudioBufferPool* const homePool);
 
+    /**
+     * @brief Retrieve the index of the buffer in its home pool.
+     *
+     * @returns The index, cInvalidPoolIndex if the buffer was not created by a pool
+     */
+    inline uint32_t getPoolIndex() const;
+
+    /**
+     * @brief Sets the index of the buffer in its home pool. Only called by the home pool.
+     *
+     * @param[in] poolIndex The index
+     */
+    inline void setPoolIndex(uint32_t poolIndex);
+
+    static const uint32_t cInvalidPoolIndex = 0xFFFFFFFFu;    //!< Pool index of a buffer that was not created by a pool
+
   private:
     /**
      * @brief Copy constructor, private unimplemented to prevent misuse.
@@ -78,6 +94,7 @@ class IasAudioBuffer
     // Member variables
     uint32_t             mBufferSize;        //!< Size of the buffers in Float32
     IasAudioBufferPool*     mHome;              //!< Pointer to the home pool
+    uint32_t                mPoolIndex;         //!< Index of the buffer in the home pool
     float*           mData;              //!< Pointer to the audio buffer data
 };
 
@@ -101,6 +118,17 @@ inline void IasAudioBuffer::setHomePool(IasAudioBufferPool* const homePool)
 }
 
 
+inline uint32_t IasAudioBuffer::getPoolIndex() const
+{
+  return mPoolIndex;
+}
+
+inline void IasAudioBuffer::setPoolIndex(uint32_t poolIndex)
+{
+  mPoolIndex = poolIndex;
+}
+
+
 } //namespace IasAudio
 
 #endif /* IASAUDIOBUFFER_HPP_ */
@@ -12,11 +12,28 @@
 #ifndef IASAUDIOBUFFERPOOL_HPP_
 #define IASAUDIOBUFFERPOOL_HPP_
 
+#include <atomic>
+#include <mutex>
 #include "IasAudioBuffer.hpp"
+#include "audio/smartx/IasIDebug.hpp"
+#include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 
 
 namespace IasAudio {
 
+/**
+ * @brief Pool of audio buffers of one size.
+ *
+ * The buffers are preallocated with #reserve while the topology is set up. #getBuffer and #returnBuffer
+ * take the buffers from and put them back to a lock-free free list, so that they can be called from
+ * real-time threads. Only if the pool is exhausted, #getBuffer allocates a new buffer. Such exhaustion
+ * events are counted and reported together with the high-water mark of the buffers in use. A pool holds
+ * at most #cMaxNumBuffers buffers, requests beyond that fail and are counted separately.
+ *
+ * The buffers are stored in chunks, which are never moved or freed while the pool exists. The head of the
+ * free list combines the index of the first free buffer with a tag that is incremented on every change,
+ * which prevents the ABA problem of the compare-and-swap.
+ */
 class IAS_AUDIO_PUBLIC IasAudioBufferPool
 {
   public:
@@ -35,22 +52,74 @@ class IAS_AUDIO_PUBLIC IasAudioBufferPool
     /**
      * @brief Get a buffer from the pool
      *
-     * @returns A pointer to a buffer from the buffer pool
+     * Lock-free and without allocation as long as the pool is not exhausted.
+     *
+     * @returns A pointer to a buffer from the buffer pool, nullptr if the maximum number of buffers is reached
      */
     IasAudioBuffer* getBuffer();
 
     /**
      * @brief Return the buffer to the pool
      *
+     * Lock-free, can be called from real-time threads. Buffers that were not created by their home pool
+     * are not taken back, which is logged as error.
+     *
      * @param[in] buffer Pointer to the buffer to be returned
      *
      * @returns eIasAudioProcOK in case of success or any other code in case of an error
      */
     inline static IasAudioProcessingResult returnBuffer(IasAudioBuffer* buffer);
 
+    /**
+     * @brief Reserve buffers for a user of the pool and preallocate them
+     *
+     * The reservations of all users are added up. The pool grows until it holds as many buffers as reserved.
+     * Must not be called from real-time threads.
+     *
+     * @param[in] numBuffers Number of buffers to reserve
+     */
+    void reserve(uint32_t numBuffers);
+
+    /**
+     * @brief Release a reservation made by #reserve
+     *
+     * The buffers stay in the pool, so that a following reservation does not allocate again.
+     *
+     * @param[in] numBuffers Number of buffers to release
+     */
+    void release(uint32_t numBuffers);
+
+    /**
+     * @brief Get the size of the buffers
+     *
+     * @returns Buffer size in number of float32
+     */
+    uint32_t getBufferSize() const { return mBufferSize; }
+
+    /**
+     * @brief Get the usage statistics of the pool
+     *
+     * @param[out] statistics The statistics
+     */
+    void getStatistics(IasIDebug::IasBufferPoolStatistics *statistics) const;
+
+    /**
+     * @brief Maximum number of buffers of one pool
+     */
+    static const uint32_t cMaxNumBuffers;
 
   private:
-    typedef std::list<IasAudioBuffer*> IasRingBufferList;
+    static const uint32_t cChunkSize = 64;      //!< Number of buffers per chunk
+    static const uint32_t cMaxNumChunks = 256;  //!< Maximum number of chunks
+
+    /**
+     * @brief A chunk of buffers together with the links of the free list
+     */
+    struct IasChunk
+    {
+      IasAudioBuffer*        buffers[cChunkSize];  //!< The buffers, written once before they are published
+      std::atomic<uint32_t>  next[cChunkSize];     //!< Index of the next free buffer
+    };
 
     /**
      * @brief Copy constructor, private unimplemented to prevent misuse.
@@ -69,9 +138,44 @@ class IAS_AUDIO_PUBLIC IasAudioBufferPool
      */
     void doReturnBuffer(IasAudioBuffer* buffer);
 
+    /**
+     * @brief Create a new buffer, mGrowMutex has to be locked
+     *
+     * @returns The index of the new buffer, IasAudioBuffer::cInvalidPoolIndex if the pool is full
+     */
+    uint32_t createBuffer();
+
+    /**
+     * @brief Take the first buffer from the free list
+     *
+     * @returns The index of the buffer, IasAudioBuffer::cInvalidPoolIndex if the free list is empty
+     */
+    uint32_t pop();
+
+    /**
+     * @brief Put a buffer at the beginning of the free list
+     *
+     * @param[in] index The index of the buffer
+     */
+    void push(uint32_t index);
+
+    /**
+     * @brief Get the chunk that contains a buffer
+     */
+    IasChunk* getChunk(uint32_t index) const { return mChunks[index / cChunkSize].load(std::memory_order_acquire); }
+
     // Member variables
-    uint32_t           mBufferSize;        //!< Size of the buffers in Float32
-    IasRingBufferList     mRingBuffers;       //!< List of currently unused audio buffers
+    uint32_t                  mBufferSize;                  //!< Size of the buffers in Float32
+    std::atomic<IasChunk*>    mChunks[cMaxNumChunks];       //!< The chunks of buffers
+    std::atomic<uint64_t>     mFreeHead;                    //!< Tag in the upper and index in the lower 32 bits
+    std::atomic<uint32_t>     mNumBuffers;                  //!< Number of buffers created
+    std::atomic<uint32_t>     mNumReserved;                 //!< Number of buffers reserved by all users
+    std::atomic<uint32_t>     mNumInUse;                    //!< Number of buffers currently handed out
+    std::atomic<uint32_t>     mHighWaterMark;               //!< Maximum number of buffers handed out at the same time
+    std::atomic<uint64_t>     mNumExhausted;                //!< Number of times getBuffer had to create a buffer
+    std::atomic<uint64_t>     mNumFailed;                   //!< Number of times getBuffer failed at cMaxNumBuffers
+    std::mutex                mGrowMutex;                   //!< Serializes the creation of buffers
+    DltContext               *mLogContext;                  //!< The log context
 };
 
 inline IasAudioProcessingResult IasAudioBufferPool::returnBuffer(IasAudioBuffer* buffer)
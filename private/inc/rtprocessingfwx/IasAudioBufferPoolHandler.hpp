@@ -12,12 +12,22 @@
 #ifndef IASAUDIOBUFFERPOOLHANDLER_HPP_
 #define IASAUDIOBUFFERPOOLHANDLER_HPP_
 
+#include <atomic>
+#include <mutex>
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "audio/smartx/IasIDebug.hpp"
+#include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 
 namespace IasAudio {
 
 class IasAudioBufferPool;
 
+/**
+ * @brief Provides one IasAudioBufferPool per buffer size.
+ *
+ * The lookup of an existing pool is lock-free. Only the creation of a new pool is serialized by a mutex.
+ * Pools are never deleted while the handler exists.
+ */
 class IAS_AUDIO_PUBLIC IasAudioBufferPoolHandler
 {
   public:
@@ -33,13 +43,41 @@ class IAS_AUDIO_PUBLIC IasAudioBufferPoolHandler
 
     static IasAudioBufferPoolHandler* getInstance();
 
+    /**
+     * @brief Get the pool for a buffer size, the pool is created if it does not exist yet
+     *
+     * @param[in] ringBufferSize Buffer size in number of float32
+     *
+     * @returns The pool, nullptr if the maximum number of pools is reached
+     */
     IasAudioBufferPool* getBufferPool(uint32_t ringBufferSize);
 
-  private:
     /**
-     * @brief Map the audio buffer size to a specific audio buffer pool
+     * @brief Reserve and preallocate buffers of a certain size, see IasAudioBufferPool::reserve
+     *
+     * @param[in] ringBufferSize Buffer size in number of float32
+     * @param[in] numBuffers Number of buffers to reserve
+     */
+    void reserveBuffers(uint32_t ringBufferSize, uint32_t numBuffers);
+
+    /**
+     * @brief Release buffers reserved by #reserveBuffers
+     *
+     * @param[in] ringBufferSize Buffer size in number of float32
+     * @param[in] numBuffers Number of buffers to release
      */
-    typedef std::map<uint32_t, IasAudioBufferPool*> IasSizePoolMap;
+    void releaseBuffers(uint32_t ringBufferSize, uint32_t numBuffers);
+
+    /**
+     * @brief Get the usage statistics of all pools
+     *
+     * @param[out] statistics The statistics, one entry per pool
+     */
+    void getStatistics(std::vector<IasIDebug::IasBufferPoolStatistics> *statistics) const;
+
+    static const uint32_t cMaxNumPools = 64;    //!< Maximum number of different buffer sizes
+
+  private:
 
     /**
      * @brief Copy constructor, private unimplemented to prevent misuse.
@@ -51,8 +89,18 @@ class IAS_AUDIO_PUBLIC IasAudioBufferPoolHandler
      */
     IasAudioBufferPoolHandler& operator=(IasAudioBufferPoolHandler const &other);
 
+    /**
+     * @brief Find the pool for a buffer size without locking
+     *
+     * @returns The pool, nullptr if no pool exists for that size
+     */
+    IasAudioBufferPool* findBufferPool(uint32_t ringBufferSize) const;
+
     // Member variables
-    IasSizePoolMap        mSizePoolMap;     //!< Map containing all required audio buffer pools for different buffer sizes
+    std::atomic<IasAudioBufferPool*>  mPools[cMaxNumPools];   //!< All pools, the first mNumPools entries are valid
+    std::atomic<uint32_t>             mNumPools;              //!< Number of pools
+    std::mutex                        mCreateMutex;           //!< Serializes the creation of pools
+    DltContext                       *mLogContext;            //!< The log context
 };
 
 } //namespace IasAudio
@@ -169,6 +169,18 @@ class IAS_AUDIO_PUBLIC IasAudioChain
      */
     void process() const;
 
+    /**
+     * @brief Execute the processing chain and measure the processing time of each component.
+     *
+     * Same as #process, but the processing time of each component is added to the corresponding
+     * entry of processTimesNs. The method does not allocate memory. It is used by the benchmark mode
+     * of the test framework.
+     *
+     * @param[in,out] processTimesNs Accumulated processing times in nanoseconds, one entry per component
+     *                               in the order of #getAudioComponents.
+     */
+    void process(std::vector<uint64_t> &processTimesNs) const;
+
     /**
      * @brief Clear the audio buffers of all output stream bundles.
      *
@@ -228,6 +240,16 @@ class IAS_AUDIO_PUBLIC IasAudioChain
      */
     IasAudioChain& operator=(IasAudioChain const &other);
 
+    /**
+     * @brief Preallocate the buffers of the simple stream representations of a new audio stream
+     *
+     * A stream gets a non-interleaved and an interleaved representation on demand, possibly from the real-time
+     * thread. Both buffers are reserved in the buffer pool here, so that the pool does not have to allocate them.
+     *
+     * @param[in] numberChannels Number of channels of the stream
+     */
+    void reserveStreamBuffers(int32_t numberChannels);
+
     // Member variables
     IasBundleSequencer              mInputBundleSequencer;              //!< The input bundle sequencer for all bundles in front of the mixer
     IasBundleSequencer              mOutputBundleSequencer;             //!< The output bundle sequencer for all bundles after the mixer
@@ -242,6 +264,7 @@ class IAS_AUDIO_PUBLIC IasAudioChain
     IasZoneIdOutputStreamMap        mZoneIdOutputStreamMap;             //!< Map with Zone ID -> Output Stream
     DltContext                     *mLog;                               //!< The log context for rtprocessingfw
     IasAudioChainEnvironmentPtr     mEnv;                               //!< The audio chain environment parameters
+    std::vector<uint32_t>           mReservedBufferSizes;               //!< Buffer sizes of the buffers reserved by reserveStreamBuffers
 };
 
 /**
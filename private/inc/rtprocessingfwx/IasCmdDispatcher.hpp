@@ -12,14 +12,40 @@
 #ifndef IASCMDDISPATCHER_HPP_
 #define IASCMDDISPATCHER_HPP_
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <dlt/dlt.h>
 #include "audio/smartx/rtprocessingfwx/IasICmdRegistration.hpp"
+#include "audio/smartx/IasIProcessing.hpp"
 
 namespace IasAudio {
 
+/**
+ * @brief Dispatches the commands of the processing interface to the command interfaces of the modules
+ *
+ * The dispatcher is thread-safe. Commands to the same module are serialized, commands to different modules
+ * do not wait for each other. Unregistering a module waits until a command currently processed by the
+ * module has been finished.
+ */
 class IAS_AUDIO_PUBLIC IasCmdDispatcher : public IasICmdRegistration
 {
   public:
+    /**
+     * @brief The registration of one module
+     */
+    struct IasCmdEntry
+    {
+      IasIModuleId  *interface;        //!< The command interface of the module
+      std::mutex     mutex;            //!< Serializes the commands to the module
+      bool           isRegistered;     //!< False as soon as the module was unregistered, protected by mutex
+      int32_t        fastCmdIndex;     //!< Index into mFastCmdModules or -1 if no command handle was resolved yet
+    };
+
+    using IasCmdEntryPtr = std::shared_ptr<IasCmdEntry>;
+    using IasCmdEntryVector = std::vector<IasCmdEntryPtr>;
+
     IasCmdDispatcher();
     virtual ~IasCmdDispatcher();
 
@@ -36,11 +62,62 @@ class IAS_AUDIO_PUBLIC IasCmdDispatcher : public IasICmdRegistration
 
     IasICmdRegistration::IasResult dispatchCmd(const std::string &instanceName, const IasProperties &cmdProperties, IasProperties &returnProperties);
 
+    /**
+     * @brief Resolve a command of a module and a pin into a handle for the fast command path.
+     *
+     * @param[in] instanceName The instance name of the module
+     * @param[in] cmdId The command id
+     * @param[in] pinName The name of the pin
+     * @param[out] handle The resolved command handle
+     *
+     * @returns The result of the method
+     */
+    IasICmdRegistration::IasResult resolveCmd(const std::string &instanceName, int32_t cmdId, const std::string &pinName, IasCmdHandle *handle);
+
+    /**
+     * @brief Dispatch a command via the fast command path.
+     *
+     * Neither looks up strings nor creates properties, the module is addressed by the index stored in the handle.
+     *
+     * @param[in] handle The command handle returned by #resolveCmd
+     * @param[in] value The value of the command
+     *
+     * @returns The result of the method
+     */
+    IasICmdRegistration::IasResult dispatchCmd(const IasCmdHandle &handle, float value);
+
+    /**
+     * @brief Block the commands to the given modules, e.g. while their audio chain is initialized.
+     *
+     * Only modules that are registered at the time of the call are blocked, unknown instance names are ignored.
+     * Has to be followed by #unlockModuleCmds with the returned registrations.
+     *
+     * @param[in] instanceNames The instance names of the modules
+     *
+     * @returns The registrations of the modules that were actually blocked
+     */
+    IasCmdEntryVector lockModuleCmds(const std::vector<std::string> &instanceNames);
+
+    /**
+     * @brief Unblock the commands to the given modules.
+     *
+     * @param[in] lockedEntries The registrations returned by #lockModuleCmds
+     */
+    void unlockModuleCmds(const IasCmdEntryVector &lockedEntries);
+
   private:
-    using IasCmdMap = std::map<std::string, IasIModuleId*>;
+    using IasCmdMap = std::map<std::string, IasCmdEntryPtr>;
+    using IasFastCmdModuleVector = std::vector<IasCmdEntryPtr>;
+
+    /**
+     * @brief Find the registration of a module.
+     */
+    IasCmdEntryPtr findEntry(const std::string &instanceName);
 
-    IasCmdMap     mCmdMap;    //!< The map storing the interface for a given instanceName
-    DltContext   *mLog;       //!< The DLT context
+    std::mutex                 mMapMutex;            //!< Protects mCmdMap and mFastCmdModules, not held while a command is processed
+    IasCmdMap                  mCmdMap;              //!< The map storing the interface for a given instanceName
+    IasFastCmdModuleVector     mFastCmdModules;      //!< The modules addressed by command handles, nullptr if unregistered
+    DltContext                *mLog;                 //!< The DLT context
 };
 
 } /* namespace IasAudio */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasSampleLayoutConverter.hpp
+ * @date   2018
+ * @brief  Conversion of 32-bit float samples between the non-interleaved, interleaved and bundled layouts.
+ */
+
+#ifndef IASSAMPLELAYOUTCONVERTER_HPP_
+#define IASSAMPLELAYOUTCONVERTER_HPP_
+
+#include "audio/smartx/rtprocessingfwx/IasProcessingTypes.hpp"
+
+namespace IasAudio {
+
+/**
+ * @class IasSampleLayoutConverter
+ *
+ * Copies the samples of a group of adjacent channels between the sample layouts of the audio streams.
+ * A strided layout stores the samples of one frame next to each other, the frame starts are stride samples
+ * apart. This covers the interleaved layout (stride = number of channels) as well as the bundled layout
+ * (stride = cIasNumChannelsPerBundle). A non-interleaved layout uses one buffer per channel.
+ *
+ * The conversions only move samples, so the result is bit-exact with a plain scalar copy. Blocks of four
+ * channels are transposed with SSE, or with AVX if the CPU supports it. None of the pointers have to be aligned.
+ */
+class IAS_AUDIO_PUBLIC IasSampleLayoutConverter
+{
+  public:
+    /**
+     * @brief Copy a group of adjacent channels from one strided layout into another one.
+     *
+     * @param[in] source Pointer to the first sample of the first channel in the source
+     * @param[in] sourceStride Distance in samples between two frames of the source
+     * @param[out] destination Pointer to the first sample of the first channel in the destination
+     * @param[in] destinationStride Distance in samples between two frames of the destination
+     * @param[in] numChannels Number of adjacent channels to copy
+     * @param[in] numFrames Number of frames to copy
+     */
+    static void copyStrided(const float *source, uint32_t sourceStride,
+                            float *destination, uint32_t destinationStride,
+                            uint32_t numChannels, uint32_t numFrames);
+
+    /**
+     * @brief Interleave non-interleaved channels into a strided layout.
+     *
+     * @param[in] channels The buffers of the non-interleaved channels
+     * @param[in] numChannels Number of channels
+     * @param[out] destination Pointer to the first sample of the first channel in the destination
+     * @param[in] destinationStride Distance in samples between two frames of the destination
+     * @param[in] numFrames Number of frames to copy
+     */
+    static void interleave(const float * const *channels, uint32_t numChannels,
+                           float *destination, uint32_t destinationStride,
+                           uint32_t numFrames);
+
+    /**
+     * @brief Deinterleave a group of adjacent channels of a strided layout into non-interleaved channels.
+     *
+     * @param[in] source Pointer to the first sample of the first channel in the source
+     * @param[in] sourceStride Distance in samples between two frames of the source
+     * @param[out] channels The buffers of the non-interleaved channels
+     * @param[in] numChannels Number of channels
+     * @param[in] numFrames Number of frames to copy
+     */
+    static void deinterleave(const float *source, uint32_t sourceStride,
+                             float * const *channels, uint32_t numChannels,
+                             uint32_t numFrames);
+};
+
+} //namespace IasAudio
+
+#endif /* IASSAMPLELAYOUTCONVERTER_HPP_ */
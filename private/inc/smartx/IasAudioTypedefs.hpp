@@ -89,6 +89,30 @@ class IasPluginEngine;
  */
 using IasPluginEnginePtr = std::shared_ptr<IasPluginEngine>;
 
+class IasLatencyProbe;
+/**
+ * @brief Shared ptr type for IasLatencyProbe
+ */
+using IasLatencyProbePtr = std::shared_ptr<IasLatencyProbe>;
+
+class IasStreamProbe;
+/**
+ * @brief Shared ptr type for IasStreamProbe
+ */
+using IasStreamProbePtr = std::shared_ptr<IasStreamProbe>;
+
+class IasIStreamTap;
+/**
+ * @brief Shared ptr type for IasIStreamTap
+ */
+using IasStreamTapPtr = std::shared_ptr<IasIStreamTap>;
+
+class IasMultiPointProbe;
+/**
+ * @brief Shared ptr type for IasMultiPointProbe
+ */
+using IasMultiPointProbePtr = std::shared_ptr<IasMultiPointProbe>;
+
 
 
 } //namespace IasAudio
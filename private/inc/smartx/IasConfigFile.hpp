@@ -53,6 +53,58 @@ class IAS_AUDIO_PUBLIC IasConfigFile
       std::uint32_t errorThreshold;       //!< The error trigger threshold after which the file is either copied or logged to DLT
     };
 
+    /**
+     * @brief The ASRC buffer params of an asynchronous ALSA handler
+     */
+    struct IasAlsaHandlerAsrcParams
+    {
+      IasAlsaHandlerAsrcParams()
+        :adaptive(false)      //!< Default: fixed target fill level in the middle of the ASRC buffer
+        ,minFill(0)           //!< Default: one and a half periods
+        ,maxFill(0)           //!< Default: ASRC buffer length minus one period
+      {};
+      bool adaptive;                      //!< Adapt the target fill level of the ASRC buffer to the observed jitter
+      std::uint32_t minFill;              //!< Lowest target fill level of the adaptation in frames
+      std::uint32_t maxFill;              //!< Highest target fill level of the adaptation in frames
+    };
+
+    /**
+     * @brief The role of a real-time thread
+     *
+     * The role determines which section of the config file is used to look up role specific
+     * scheduling parameters. The role specific parameters are identified by the role prefix
+     * followed by the name of the zone, device or pool, e.g. [scheduling.rt.basezone.MyZone].
+     */
+    enum IasThreadRole
+    {
+      eIasThreadRoleDefault,      //!< No specific role, the global [scheduling.rt] parameters are used
+      eIasThreadRoleBaseZone,     //!< Routing zone worker thread of a base zone, identified by the zone name
+      eIasThreadRoleRunner,       //!< Runner thread for derived zones, identified by the base zone name and the period size multiple
+      eIasThreadRoleAlsaHandler,  //!< ALSA handler worker thread, identified by the ALSA device name
+      eIasThreadRoleHelperPool,   //!< Real-time helper pool thread, identified by the pool name
+    };
+
+    /**
+     * @brief The scheduling parameters of one real-time thread
+     */
+    struct IasThreadSchedulingParams
+    {
+      IasThreadSchedulingParams()
+        :policy(SCHED_FIFO)
+        ,priority(20)
+        ,cpuAffinities()
+        ,hasPolicy(false)
+        ,hasPriority(false)
+        ,hasCpuAffinities(false)
+      {};
+      int32_t policy;                      //!< The scheduling policy
+      uint32_t priority;                   //!< The scheduling priority
+      std::vector<uint32_t> cpuAffinities; //!< The CPU affinities
+      bool hasPolicy;                      //!< True if the policy was explicitly configured for the role
+      bool hasPriority;                    //!< True if the priority was explicitly configured for the role
+      bool hasCpuAffinities;               //!< True if the CPU affinities were explicitly configured for the role
+    };
+
     /**
      * @brief Return a pointer to the IasConfigFile singleton
      *
@@ -71,6 +123,34 @@ class IAS_AUDIO_PUBLIC IasConfigFile
      */
     static void configureThreadSchedulingParameters(DltContext *logCtx, IasRunnerThreadSchedulePriority priorityConfig = eIasPriorityNormal);
 
+    /**
+     * @brief Set the real-time scheduling parameters of the current thread to the parameters configured for its role
+     *
+     * The parameters configured for the role and name, e.g. in the section [scheduling.rt.basezone.MyZone],
+     * take precedence. Each parameter that is not configured for the role falls back to the global
+     * parameters of the section [scheduling.rt]. The priorityConfig is only applied when the priority
+     * is taken from the global parameters.
+     *
+     * @param[in] logCtx The DLT log context of the calling process
+     * @param[in] role The role of the real-time thread being configured
+     * @param[in] name The name of the zone, device or pool the thread belongs to
+     * @param[in] priorityConfig The priority to use for the real-time thread being configured
+     */
+    static void configureThreadSchedulingParameters(DltContext *logCtx, IasThreadRole role, const std::string &name,
+                                                    IasRunnerThreadSchedulePriority priorityConfig = eIasPriorityNormal);
+
+    /**
+     * @brief Get the effective scheduling parameters for a real-time thread role
+     *
+     * @param[in] role The role of the real-time thread
+     * @param[in] name The name of the zone, device or pool the thread belongs to
+     * @param[in] priorityConfig The priority to use if the priority is taken from the global parameters
+     *
+     * @return The scheduling parameters with role specific values merged over the global values
+     */
+    IasThreadSchedulingParams getThreadSchedulingParams(IasThreadRole role, const std::string &name,
+                                                        IasRunnerThreadSchedulePriority priorityConfig = eIasPriorityNormal) const;
+
     /**
      * @brief Load the configuration from the configuration file
      *
@@ -151,6 +231,14 @@ class IAS_AUDIO_PUBLIC IasConfigFile
      */
     const IasAlsaHandlerDiagnosticParams* getAlsaHandlerDiagParams(const std::string& deviceName) const;
 
+    /**
+     * @brief Get the configured ASRC buffer parameters of an ALSA handler
+     *
+     * @param[in] deviceName The name of the ALSA device for which the ASRC parameters shall be queried
+     * @returns A pointer to the ASRC parameters for the device, or the nullptr in case they aren't configured
+     */
+    const IasAlsaHandlerAsrcParams* getAlsaHandlerAsrcParams(const std::string& deviceName) const;
+
     /**
      * @brief Get the log period time in ms
      *
@@ -165,6 +253,21 @@ class IAS_AUDIO_PUBLIC IasConfigFile
      */
     std::uint32_t getNumEntriesPerMsg() const;
 
+    /**
+     * @brief Get the number of threads used to start the routing zones and source devices
+     *
+     * @return The number of start-up threads, 0 if they are started one after another by the calling thread
+     */
+    uint32_t getStartupThreads() const { return mStartupThreads; }
+
+    /**
+     * @brief Get the configured plug-in preload state
+     *
+     * @retval eIasDisabled The plug-in libraries are loaded when the first pipeline is created.
+     * @retval eIasEnabled The plug-in libraries are loaded in the background directly after start-up.
+     */
+    IasOptionState getPreloadPlugins() const { return mPreloadPlugins; }
+
   private:
     /**
      * @brief Map of string pair for key, values that are not registered
@@ -183,6 +286,21 @@ class IAS_AUDIO_PUBLIC IasConfigFile
      */
     using IasAlsaHandlerDiagnosticParamsMap = std::map<std::string, IasAlsaHandlerDiagnosticParams>;
 
+    /**
+     * @brief Map to store the ASRC buffer params for each ALSA handler
+     *
+     * The key is equal to the key in the config file including the device name
+     */
+    using IasAlsaHandlerAsrcParamsMap = std::map<std::string, IasAlsaHandlerAsrcParams>;
+
+    /**
+     * @brief Map to store the role specific scheduling params
+     *
+     * The key is equal to the section in the config file including the role prefix and the name,
+     * e.g. scheduling.rt.basezone.MyZone
+     */
+    using IasThreadSchedulingParamsMap = std::map<std::string, IasThreadSchedulingParams>;
+
     /**
      * @brief Constructor.
      */
@@ -208,8 +326,13 @@ class IAS_AUDIO_PUBLIC IasConfigFile
     void setSchedPriority(po::variable_value value);
     void addCpuAffinity(po::variable_value value);
     void setShmGroupName(po::variable_value value);
+    void setStartupThreads(po::variable_value value);
+    void setPreloadPlugins(po::variable_value value);
     void addRunnerThreadState(const std::string& optionKey, const std::string& optionValue);
     void addAlsaHandlerDiagParam(const std::string& optionKey, const std::string& optionValue);
+    void addAlsaHandlerAsrcParam(const std::string& optionKey, const std::string& optionValue);
+    void addThreadSchedulingParam(const std::string& optionKey, const std::string& optionValue);
+    static std::string getThreadRoleKey(IasThreadRole role, const std::string &name);
 
     DltContext               *mLog;                 //!< The DLT log context
     int32_t                mSchedPolicy;         //!< The scheduling policy
@@ -222,6 +345,10 @@ class IAS_AUDIO_PUBLIC IasConfigFile
     IasAlsaHandlerDiagnosticParamsMap mAlsaHandlerDiagnosticParams;  //!< Map of all ALSA handler diagnostic params
     std::uint32_t             mNumEntriesPerMsg;    //!< Number of entries per msg for the ALSA handler diagnostics
     std::uint32_t             mLogPeriodTime;       //!< Log period time for the ALSA handler diagnostics in ms
+    IasAlsaHandlerAsrcParamsMap mAlsaHandlerAsrcParams;  //!< Map of all ALSA handler ASRC params
+    IasThreadSchedulingParamsMap mThreadSchedulingParams;  //!< Map of all role specific scheduling params
+    uint32_t                  mStartupThreads;      //!< Number of threads starting the routing zones and source devices
+    IasOptionState            mPreloadPlugins;      //!< Load the plug-in libraries in the background
 };
 
 } //namespace IasAudio
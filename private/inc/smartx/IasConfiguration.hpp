@@ -13,6 +13,8 @@
 #define IASCONFIGURATION_HPP
 
 
+#include <unordered_map>
+
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "IasAudioTypedefs.hpp"
@@ -60,8 +62,11 @@ using IasPinMap = std::map<std::string, IasAudioPinPtr>;
 using IasLogicalSourceMap = std::map<std::string,std::set<int32_t>>;
 
 /**
- * @brief
+ * @brief Central registry of the devices, routing zones, pipelines, ports and pins of the SmartXbar.
  *
+ * The ordered maps provide the objects sorted by name or id. Generated topologies can contain thousands
+ * of ports and pins, so ports and pins are additionally kept in hashed indices that are used for all lookups.
+ * The indices are updated together with the ordered maps whenever a port or pin is added or deleted.
  */
 class IAS_AUDIO_PUBLIC IasConfiguration
 {
@@ -149,6 +154,22 @@ class IAS_AUDIO_PUBLIC IasConfiguration
 
     using IasModulePropertiesMap = std::map<IasProcessingModulePtr, IasPropertiesPtr>;
 
+    /**
+     * @brief Hashed indices of the ports and pins, used for the lookups
+     */
+    using IasPortIndex   = std::unordered_map<std::string, IasAudioPortPtr>;
+    using IasIdPortIndex = std::unordered_map<int32_t, IasAudioPortPtr>;
+    using IasPinIndex    = std::unordered_map<std::string, IasAudioPinPtr>;
+
+    /**
+     * @brief Delete a port from the ordered map and from the hashed index of all ports.
+     *
+     * @param[in] name The name of the port
+     *
+     * @return The number of deleted ports
+     */
+    uint64_t erasePortName(const std::string &name);
+
     DltContext               *mLog;
     IasSourceDeviceMap        mSourceDeviceMap;
     IasSinkDeviceMap          mSinkDeviceMap;
@@ -160,6 +181,10 @@ class IAS_AUDIO_PUBLIC IasConfiguration
     IasPortMap                mPortMap;
     IasModulePropertiesMap    mModulePropertiesMap;
     IasPinMap                 mPinMap;
+    IasPortIndex              mPortIndex;         //!< Hashed index of mPortMap
+    IasIdPortIndex            mOutputPortIndex;   //!< Hashed index of mOutputPortMap
+    IasIdPortIndex            mInputPortIndex;    //!< Hashed index of mInputPortMap
+    IasPinIndex               mPinIndex;          //!< Hashed index of mPinMap
 };
 
 /**
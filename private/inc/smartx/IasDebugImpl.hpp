@@ -12,6 +12,8 @@
 #ifndef IASDEBUGIMPL_HPP
 #define IASDEBUGIMPL_HPP
 
+#include <map>
+#include <vector>
 
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
@@ -21,6 +23,8 @@
 #include "model/IasAudioPortOwner.hpp"
 #include "model/IasAudioPin.hpp"
 #include "model/IasPipeline.hpp"
+#include "smartx/IasProbeSlots.hpp"
+#include "smartx/IasStreamProbe.hpp"
 
 namespace IasAudio {
 
@@ -97,7 +101,142 @@ class IAS_AUDIO_PUBLIC IasDebugImpl : public IasIDebug
      */
     virtual IasResult stopProbing(const std::string &portName);
 
+    /**
+     * @brief Start measuring the latency between a source port and a sink port or pin
+     *
+     * @param[in] sourceName The name of the output port of a source device
+     * @param[in] sinkName The name of the input port or pipeline pin
+     * @param[in] numMeasurements The number of markers to send through the path
+     *
+     * @return The result of the start operation
+     */
+    virtual IasResult startLatencyProbe(const std::string &sourceName, const std::string &sinkName, uint32_t numMeasurements);
+
+    /**
+     * @brief Get the statistics of the current or the last latency measurement
+     *
+     * @param[out] result The statistics of the measurement
+     *
+     * @return The result of the operation
+     */
+    virtual IasResult getLatencyProbeResult(IasLatencyResult *result);
+
+    /**
+     * @brief Stop the latency measurement
+     *
+     * @return The result of the stop
+     */
+    virtual IasResult stopLatencyProbe();
+
+    /**
+     * @brief Record data of an audio port or pin continuously into a shared memory ring buffer
+     *
+     * @param[in] streamName The name of the stream, used to name the shared memory
+     * @param[in] name The name of the port or pin
+     *
+     * @return The result of the record operation
+     */
+    virtual IasResult startStreamRecord(const std::string &streamName, const std::string &name);
+
+    /**
+     * @brief Get the statistics of a stream recording
+     *
+     * @param[in] name The name of the port or pin
+     * @param[out] statistics The statistics of the stream recording
+     *
+     * @return The result of the operation
+     */
+    virtual IasResult getStreamRecordStatistics(const std::string &name, IasStreamProbeStatistics *statistics);
+
+    /**
+     * @brief Stop a stream recording
+     *
+     * @param[in] name The name of the port or pin
+     *
+     * @return The result of the stop
+     */
+    virtual IasResult stopStreamRecord(const std::string &name);
+
+    /**
+     * @brief Record several audio ports/pins at the same time into one interleaved stream
+     *
+     * @param[in] streamName The name of the stream, used to name the shared memory
+     * @param[in] names The names of the ports or pins
+     *
+     * @return The result of the record operation
+     */
+    virtual IasResult startMultiPointRecord(const std::string &streamName, const IasStringVector &names);
+
+    /**
+     * @brief Get the header of a multi-point recording
+     *
+     * @param[in] streamName The name of the stream
+     * @param[out] header The header of the recording
+     *
+     * @return The result of the operation
+     */
+    virtual IasResult getMultiPointRecordHeader(const std::string &streamName, IasMultiPointHeader *header);
+
+    /**
+     * @brief Get the statistics of a multi-point recording
+     *
+     * @param[in] streamName The name of the stream
+     * @param[out] statistics The statistics of the recording
+     *
+     * @return The result of the operation
+     */
+    virtual IasResult getMultiPointRecordStatistics(const std::string &streamName, IasStreamProbeStatistics *statistics);
+
+    /**
+     * @brief Stop a multi-point recording
+     *
+     * @param[in] streamName The name of the stream
+     *
+     * @return The result of the stop
+     */
+    virtual IasResult stopMultiPointRecord(const std::string &streamName);
+
+    /**
+     * @brief Get the statistics of the lock domains of the SmartXbar interfaces
+     *
+     * @param[out] statistics The statistics, one entry per lock domain
+     *
+     * @return The result of the operation
+     */
+    virtual IasResult getLockStatistics(std::vector<IasLockStatistics> *statistics);
+
+    /**
+     * @brief Get the usage statistics of the audio buffer pools
+     *
+     * @param[out] statistics The statistics, one entry per buffer size
+     *
+     * @return The result of the operation
+     */
+    virtual IasResult getBufferPoolStatistics(std::vector<IasBufferPoolStatistics> *statistics);
+
   private:
+    /**
+     * @brief A stream tap together with the location it is attached to
+     */
+    struct IasStreamProbeEntry
+    {
+      IasStreamTapPtr   tap;        //!< The stream tap attached to the location
+      IasStreamProbePtr probe;      //!< The stream probe of a single recording, nullptr for a multi-point recording
+      IasAudioPortPtr   port;       //!< The port the tap is attached to, if any
+      IasAudioPinPtr    pin;        //!< The pin the tap is attached to, if any
+      std::string       streamName; //!< The name of the recorded stream
+    };
+
+    /**
+     * @brief Map of all attached stream taps, the key is the name of the port or pin
+     */
+    using IasStreamProbeMap = std::map<std::string, IasStreamProbeEntry>;
+
+    /**
+     * @brief Map of all active multi-point recordings, the key is the name of the stream
+     */
+    using IasMultiPointProbeMap = std::map<std::string, IasMultiPointProbePtr>;
+
     /**
      * @brief Copy constructor, private unimplemented to prevent misuse.
      */
@@ -147,11 +286,91 @@ class IAS_AUDIO_PUBLIC IasDebugImpl : public IasIDebug
                            uint32_t numSeconds,
                            IasAudioPinPtr pin);
 
+    IasSwitchMatrixPtr getSwitchMatrix(IasAudioPortPtr port);
+
+    /**
+     * @brief Get the probe slots of the real-time thread that serves a port
+     *
+     * Exactly one of latencySlots and streamSlots has to be given.
+     *
+     * @param[in] port The port to be probed
+     * @param[out] latencySlots The slot for a latency probe
+     * @param[out] streamSlots The slot for a stream tap
+     *
+     * @return False if the port is not served by any real-time thread
+     */
+    bool getPortProbeSlots(IasAudioPortPtr port, IasLatencyProbeSlots **latencySlots, IasStreamTapSlots **streamSlots);
+
+    /**
+     * @brief Find the port or pin for a stream recording and derive the probe parameters from it
+     *
+     * @param[in] location The name of the port or pin
+     * @param[out] entry The entry with the port or pin set
+     * @param[out] params The probe parameters, except the name
+     */
+    IasResult resolveStreamProbe(const std::string &location, IasStreamProbeEntry *entry, IasStreamProbeParams *params);
+
+    /**
+     * @brief Check whether a stream name is used by any active stream recording
+     */
+    bool isStreamNameUsed(const std::string &streamName) const;
+
+    /**
+     * @brief Attach a stream tap to the real-time thread that serves its location
+     */
+    IasResult attachStreamProbe(const IasStreamProbeEntry &entry);
+
+    /**
+     * @brief Detach a stream tap from the real-time thread that serves its location
+     */
+    void detachStreamProbe(const IasStreamProbeEntry &entry);
+
+    /**
+     * @brief Get the object whose real-time thread delivers the data of a stream tap
+     *
+     * @return The pipeline of a pin, or the switch matrix or routing zone worker thread serving a port
+     */
+    const void* getProbeClockDomain(const IasStreamProbeEntry &entry);
+
+    /**
+     * @brief Write the header of a multi-point recording to RW_TMP_PATH/<streamName>.hdr
+     */
+    void writeMultiPointHeader(const IasMultiPointProbePtr &multiPointProbe);
+
+    /**
+     * @brief Destroy all stopped stream probes that are no longer referenced by a real-time thread
+     *
+     * The real-time threads drop their reference asynchronously. Destroying a stream probe joins the
+     * IPC thread of its SmartX client, which must not happen in a real-time thread.
+     */
+    void releaseStreamProbes();
+
+    /**
+     * @brief Move the current latency probe to the stopped latency probes before it is replaced
+     */
+    void retireLatencyProbe();
+
+    /**
+     * @brief Destroy all stopped latency probes that are no longer referenced by a real-time thread
+     *
+     * The real-time threads replace their reference asynchronously. Keeping the stopped probes here
+     * ensures that the last reference is never dropped by a real-time thread.
+     */
+    void releaseLatencyProbes();
+
     IasIDebug::IasResult translate(IasPipeline::IasResult result);
     IasIDebug::IasResult translate(IasConfiguration::IasResult result);
 
     DltContext          *mLog;          //!< DLT context
     IasConfigurationPtr  mConfig;       //!< Pointer to the configuration
+    IasLatencyProbePtr   mLatencyProbe; //!< The current or last latency probe
+    IasAudioPortPtr      mLatencyInjectPort;  //!< The port where the latency marker is injected
+    IasAudioPortPtr      mLatencyDetectPort;  //!< The port where the latency marker is detected, if any
+    IasAudioPinPtr       mLatencyDetectPin;   //!< The pin where the latency marker is detected, if any
+    IasStreamProbeMap    mStreamProbes;       //!< All attached stream taps
+    IasMultiPointProbeMap mMultiPointProbes;  //!< All active multi-point recordings
+    std::vector<IasStreamTapPtr> mStoppedStreamProbes; //!< Stopped stream taps waiting to be released
+    std::vector<IasLatencyProbePtr> mStoppedLatencyProbes; //!< Replaced latency probes waiting to be released
 };
 
 } //namespace IasAudio
@@ -19,7 +19,7 @@ namespace IasAudio {
 /**
  * @brief Decorator for the IasIDebug instance
  *
- * It adds a mutex around each method to make it safe while being accessed by multiple threads.
+ * Each method locks the debug domain and reads the topology and pipeline domains, see IasDecoratorGuard.
  */
 class IAS_AUDIO_PUBLIC IasDebugMutexDecorator : public IasIDebug
 {
@@ -48,6 +48,54 @@ class IAS_AUDIO_PUBLIC IasDebugMutexDecorator : public IasIDebug
      * @brief Inherited from IasIDebug.
      */
     IasResult stopProbing(const std::string &portName) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult startLatencyProbe(const std::string &sourceName, const std::string &sinkName, std::uint32_t numMeasurements) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult getLatencyProbeResult(IasLatencyResult *result) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult stopLatencyProbe() override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult startStreamRecord(const std::string &streamName, const std::string &name) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult getStreamRecordStatistics(const std::string &name, IasStreamProbeStatistics *statistics) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult stopStreamRecord(const std::string &name) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult startMultiPointRecord(const std::string &streamName, const IasStringVector &names) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult getMultiPointRecordHeader(const std::string &streamName, IasMultiPointHeader *header) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult getMultiPointRecordStatistics(const std::string &streamName, IasStreamProbeStatistics *statistics) override;
+    /**
+     * @brief Inherited from IasIDebug.
+     */
+    IasResult stopMultiPointRecord(const std::string &streamName) override;
+    /**
+     * @brief Inherited from IasIDebug, does not lock any domain.
+     */
+    IasResult getLockStatistics(std::vector<IasLockStatistics> *statistics) override;
+    /**
+     * @brief Inherited from IasIDebug, does not lock any domain.
+     */
+    IasResult getBufferPoolStatistics(std::vector<IasBufferPoolStatistics> *statistics) override;
 
   private:
     /**
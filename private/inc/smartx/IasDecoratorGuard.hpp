@@ -12,40 +12,101 @@
 #ifndef AUDIO_DAEMON2_PRIVATE_INC_SMARTX_IASDECORATORGUARD_HPP_
 #define AUDIO_DAEMON2_PRIVATE_INC_SMARTX_IASDECORATORGUARD_HPP_
 
-#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <pthread.h>
+
+#include "audio/smartx/IasIDebug.hpp"
 
 namespace IasAudio {
 
+/**
+ * @brief The lock domains of the SmartXbar interfaces
+ *
+ * The domains are always locked in the order of this enum, so guards locking several domains cannot deadlock.
+ */
+enum IasLockDomain
+{
+  eIasLockDomainTopology = 0,     //!< Audio devices, routing zones, audio ports and the links between them
+  eIasLockDomainPipeline,         //!< Pipelines, audio pins, processing modules and their properties
+  eIasLockDomainRouting,          //!< The connections of the routing zones
+  eIasLockDomainDebug,            //!< The probes of the debug interface
+  eIasLockDomainLast              //!< ATTENTION: Always has to be last entry
+};
+
+static const uint32_t cIasLockTopology = 1u << eIasLockDomainTopology;   //!< Mask of the topology domain
+static const uint32_t cIasLockPipeline = 1u << eIasLockDomainPipeline;   //!< Mask of the pipeline domain
+static const uint32_t cIasLockRouting  = 1u << eIasLockDomainRouting;    //!< Mask of the routing domain
+static const uint32_t cIasLockDebug    = 1u << eIasLockDomainDebug;      //!< Mask of the debug domain
 
 /**
  * @brief
  *
- * Lock guard for decorator pattern to make smartx thread-safety, the IasDecoratorGuard
- * class is wrapper for lock_guard with static mutex variable, then the same mutex
- * can be shared between IasRouting, IasSetup and IasProcessing
+ * Lock guard for decorator pattern to make smartx thread-safety. Instead of one mutex shared between
+ * IasRouting, IasSetup, IasProcessing and IasDebug, each domain has its own reader/writer lock. A method
+ * of a decorator locks the domains it reads as shared and the domains it modifies as exclusive, so e.g.
+ * the setup of a pipeline does not block a connect of the routing interface.
  *
+ * The guard collects the wait and hold times of each domain and logs a warning if a domain was held for
+ * longer than cIasLongLockHoldTimeNs.
  */
-class IasDecoratorGuard : public std::lock_guard<std::mutex>
+class IasDecoratorGuard
 {
   friend class IasDebugMutexDecorator;
   friend class IasProcessingMutexDecorator;
   friend class IasRoutingMutexDecorator;
   friend class IasSetupMutexDecorator;
+  friend class IasSmartXPriv;
+
+  public:
+    /**
+     * @brief Get the lock statistics of all domains.
+     *
+     * @param[out] statistics The statistics, one entry per domain
+     */
+    static void getStatistics(std::vector<IasIDebug::IasLockStatistics> *statistics);
+
+  private:
+    /**
+     * @brief Constructor, locks the domains.
+     *
+     * @param[in] sharedDomains Mask of the domains that are locked for reading
+     * @param[in] exclusiveDomains Mask of the domains that are locked for writing, takes precedence over sharedDomains
+     * @param[in] name The name of the guarded method, used for the log of long hold times
+     */
+    IasDecoratorGuard(uint32_t sharedDomains, uint32_t exclusiveDomains, const char *name);
+
+    /**
+     * @brief Destructor, unlocks the domains and updates the statistics.
+     */
+    ~IasDecoratorGuard();
+
+    IasDecoratorGuard(const IasDecoratorGuard&) = delete;
+    IasDecoratorGuard& operator=(const IasDecoratorGuard&) = delete;
 
-  /**
-   * @brief Constructor.
-   */
-  explicit IasDecoratorGuard();
+    /**
+     * @brief The lock and the statistics of one domain
+     */
+    struct IasDomainLock
+    {
+      IasDomainLock();
+      ~IasDomainLock();
 
-  /**
-   * @brief Destructor.
-   */
-  virtual ~IasDecoratorGuard();
+      pthread_rwlock_t          rwLock;             //!< The reader/writer lock of the domain
+      std::atomic<uint64_t>     numShared;          //!< Number of shared locks
+      std::atomic<uint64_t>     numExclusive;       //!< Number of exclusive locks
+      std::atomic<uint64_t>     totalWaitTimeNs;    //!< Accumulated time waited for the lock
+      std::atomic<uint64_t>     maxWaitTimeNs;      //!< Maximum time waited for the lock
+      std::atomic<uint64_t>     totalHoldTimeNs;    //!< Accumulated time the lock was held
+      std::atomic<uint64_t>     maxHoldTimeNs;      //!< Maximum time the lock was held
+    };
 
-  IasDecoratorGuard(const IasDecoratorGuard&) = delete;
-  IasDecoratorGuard& operator=(const IasDecoratorGuard&) = delete;
+    static IasDomainLock mDomainLocks[eIasLockDomainLast];
 
-  static std::mutex mMutexDecorator;
+    uint32_t        mLockedDomains;                     //!< Mask of the domains locked by this guard
+    uint64_t        mAcquiredNs[eIasLockDomainLast];    //!< Time at which each domain was acquired
+    const char     *mName;                              //!< The name of the guarded method
 };
 
 
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasEventPool.hpp
+ * @date   2018
+ * @brief  Pool of preallocated events for the event provider.
+ */
+
+#ifndef IASEVENTPOOL_HPP_
+#define IASEVENTPOOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace IasAudio {
+
+static const size_t cIasEventPoolCtrlBlockSize = 64;   //!< Space for the shared_ptr control block of one pooled event
+
+/** \class IasEventPool
+ *  Fixed number of preallocated events of type T, handed out as std::shared_ptr<T>.
+ *
+ *  The events and the storage for their shared_ptr control blocks are allocated by the constructor. #create
+ *  neither allocates memory nor takes a lock, so it can be called by the real-time threads. When the last
+ *  reference to a pooled event is dropped, the event is reset by the reset function given to the constructor
+ *  and its slot is returned to the pool. If all slots are in use, #create falls back to std::make_shared.
+ */
+template <typename T>
+class IasEventPool
+{
+  public:
+    /**
+     * @brief Function that resets an event to its initial state before it is returned to the pool
+     */
+    using IasResetFunction = void (*)(T &event);
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] numEvents Number of preallocated events
+     * @param[in] reset Function that resets a released event
+     */
+    IasEventPool(uint32_t numEvents, IasResetFunction reset)
+      :mSlots(new IasSlot[numEvents])
+      ,mNumSlots(numEvents)
+      ,mNextSlot(0)
+      ,mReset(reset)
+      ,mNumFallbacks(0)
+    {
+    }
+
+    /**
+     * @brief Destructor.
+     *
+     * Events that are still referenced by the application keep their slots, so the slots are not freed in that case.
+     */
+    ~IasEventPool()
+    {
+      for (uint32_t index = 0; index < mNumSlots; ++index)
+      {
+        if (mSlots[index].inUse.load(std::memory_order_acquire) == true)
+        {
+          mSlots.release();
+          break;
+        }
+      }
+    }
+
+    /**
+     * @brief Get an event from the pool.
+     *
+     * @return A pointer to an event in its initial state
+     */
+    std::shared_ptr<T> create()
+    {
+      uint32_t start = mNextSlot.fetch_add(1, std::memory_order_relaxed);
+      for (uint32_t count = 0; count < mNumSlots; ++count)
+      {
+        IasSlot &slot = mSlots[(start + count) % mNumSlots];
+        bool expected = false;
+        if ((slot.inUse.load(std::memory_order_relaxed) == false) &&
+            (slot.inUse.compare_exchange_strong(expected, true, std::memory_order_acquire) == true))
+        {
+          return std::shared_ptr<T>(&slot.event, IasDeleter(mReset), IasAllocator<T>(&slot));
+        }
+      }
+      mNumFallbacks.fetch_add(1, std::memory_order_relaxed);
+      return std::make_shared<T>();
+    }
+
+    /**
+     * @brief Get the number of events that were allocated because the pool was exhausted.
+     */
+    uint64_t getNumFallbacks() const { return mNumFallbacks.load(std::memory_order_relaxed); }
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasEventPool(IasEventPool const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasEventPool& operator=(IasEventPool const &other);
+
+    using IasCtrlBlockStorage = typename std::aligned_storage<cIasEventPoolCtrlBlockSize, alignof(std::max_align_t)>::type;
+
+    /**
+     * @brief One preallocated event together with the storage of its control block
+     */
+    struct IasSlot
+    {
+      IasSlot()
+        :event()
+        ,ctrlBlock()
+        ,inUse(false)
+      {
+      }
+
+      T                       event;        //!< The event
+      IasCtrlBlockStorage     ctrlBlock;    //!< Storage of the control block
+      std::atomic<bool>       inUse;        //!< True while the event is referenced
+    };
+
+    /**
+     * @brief Deleter of the shared_ptr, resets the event instead of deleting it
+     */
+    struct IasDeleter
+    {
+      explicit IasDeleter(IasResetFunction reset)
+        :mReset(reset)
+      {
+      }
+
+      void operator()(T *event) const
+      {
+        mReset(*event);
+      }
+
+      IasResetFunction mReset;    //!< The reset function of the pool
+    };
+
+    /**
+     * @brief Allocator of the shared_ptr control block
+     *
+     * Returns the control block storage of the slot. The slot is released when the control block is
+     * deallocated, which is after the event was reset and after the last weak reference was dropped.
+     */
+    template <typename U>
+    struct IasAllocator
+    {
+      using value_type = U;
+
+      template <typename V>
+      struct rebind
+      {
+        using other = IasAllocator<V>;
+      };
+
+      explicit IasAllocator(IasSlot *slot)
+        :mSlot(slot)
+      {
+      }
+
+      template <typename V>
+      IasAllocator(const IasAllocator<V> &other)
+        :mSlot(other.mSlot)
+      {
+      }
+
+      U* allocate(size_t n)
+      {
+        if ((n * sizeof(U) <= sizeof(mSlot->ctrlBlock)) && (alignof(U) <= alignof(std::max_align_t)))
+        {
+          return reinterpret_cast<U*>(&mSlot->ctrlBlock);
+        }
+        return static_cast<U*>(::operator new(n * sizeof(U)));
+      }
+
+      void deallocate(U *p, size_t)
+      {
+        if (static_cast<void*>(p) != static_cast<void*>(&mSlot->ctrlBlock))
+        {
+          ::operator delete(p);
+        }
+        mSlot->inUse.store(false, std::memory_order_release);
+      }
+
+      template <typename V>
+      bool operator==(const IasAllocator<V> &other) const { return mSlot == other.mSlot; }
+
+      template <typename V>
+      bool operator!=(const IasAllocator<V> &other) const { return mSlot != other.mSlot; }
+
+      IasSlot *mSlot;    //!< The slot of the event
+    };
+
+    std::unique_ptr<IasSlot[]>     mSlots;          //!< The preallocated slots
+    uint32_t                       mNumSlots;       //!< Number of slots
+    std::atomic<uint32_t>          mNextSlot;       //!< Slot where the search for a free slot starts
+    IasResetFunction               mReset;          //!< Function that resets a released event
+    std::atomic<uint64_t>          mNumFallbacks;   //!< Number of events allocated because the pool was exhausted
+};
+
+} //namespace IasAudio
+
+#endif /* IASEVENTPOOL_HPP_ */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasIStreamTap.hpp
+ * @date   2018
+ * @brief  Interface of a tap that receives the audio data of a port or pin in the real-time thread.
+ */
+
+#ifndef IASISTREAMTAP_HPP_
+#define IASISTREAMTAP_HPP_
+
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "audio/smartx/rtprocessingfwx/IasProcessingTypes.hpp"
+
+namespace IasAudio {
+
+/**
+ * @brief Interface of a stream tap
+ *
+ * A stream tap is attached to a port or pin and gets each block of audio data that passes this location.
+ * Both methods are called by the real-time thread that serves the location and have to be real-time safe.
+ */
+class IAS_AUDIO_PUBLIC IasIStreamTap
+{
+  public:
+    /**
+     * @brief Destructor, virtual by default.
+     */
+    virtual ~IasIStreamTap() {}
+
+    /**
+     * @brief Receive one block of the probed areas.
+     *
+     * @param[in] areas Areas of the probed buffer
+     * @param[in] dataFormat Data format of the probed buffer
+     * @param[in] offset Offset of the current block in the probed buffer
+     * @param[in] numFrames Number of frames of the current block
+     */
+    virtual void process(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t numFrames) = 0;
+
+    /**
+     * @brief Receive one block of a pipeline audio stream.
+     *
+     * @param[in] audioFrame Pointers to the channel buffers
+     * @param[in] stride Distance between two samples of one channel
+     * @param[in] numFrames Number of frames of the current block
+     */
+    virtual void process(const IasAudioFrame &audioFrame, uint32_t stride, uint32_t numFrames) = 0;
+};
+
+} // namespace IasAudio
+
+#endif // IASISTREAMTAP_HPP_
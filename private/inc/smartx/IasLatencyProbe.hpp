@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasLatencyProbe.hpp
+ * @date   2018
+ * @brief  Latency measurement by injection and detection of an in-band marker.
+ */
+
+#ifndef IASLATENCYPROBE_HPP_
+#define IASLATENCYPROBE_HPP_
+
+#include <atomic>
+#include <vector>
+
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "audio/smartx/IasIDebug.hpp"
+#include "audio/smartx/rtprocessingfwx/IasProcessingTypes.hpp"
+
+namespace IasAudio {
+
+/**
+ * @brief Parameters of a latency probe
+ */
+struct IasLatencyProbeParams
+{
+  /**
+   * @brief Constructor
+   */
+  IasLatencyProbeParams()
+    :numMeasurements(0)
+    ,injectIndex(0)
+    ,injectNumChannels(0)
+    ,injectSampleRate(0)
+    ,detectIndex(0)
+    ,detectNumChannels(0)
+    ,detectSampleRate(0)
+  {}
+
+  uint32_t numMeasurements;     //!< Number of markers that shall be sent through the path
+  uint32_t injectIndex;         //!< Index of the first channel of the inject port in its ring buffer
+  uint32_t injectNumChannels;   //!< Number of channels of the inject port
+  uint32_t injectSampleRate;    //!< Sample rate at the inject location
+  uint32_t detectIndex;         //!< Index of the first channel to be scanned at the detect location
+  uint32_t detectNumChannels;   //!< Number of channels to be scanned at the detect location
+  uint32_t detectSampleRate;    //!< Sample rate at the detect location
+};
+
+/**
+ * @brief Measures the latency of an audio path with an in-band marker
+ *
+ * The probe is shared between two real-time threads. The thread that serves the source port calls
+ * #inject, which writes a single full-scale impulse into all channels of the source port whenever no
+ * marker is in flight. The thread that serves the sink port or pipeline pin calls #detect, which scans
+ * the stream for the marker and stores one measurement per detected marker. Both sides take the
+ * fill level of the adjacent buffers into account, so the measured value covers the time from the
+ * marker entering the source buffer until it leaves the sink buffer.
+ *
+ * All memory is allocated in the constructor, #inject and #detect are real-time safe.
+ */
+class IAS_AUDIO_PUBLIC IasLatencyProbe
+{
+  public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] params The probe parameters
+     */
+    IasLatencyProbe(const IasLatencyProbeParams &params);
+
+    /**
+     * @brief Destructor, virtual by default.
+     */
+    virtual ~IasLatencyProbe();
+
+    /**
+     * @brief Inject the marker into the source stream, called by the real-time thread of the source port.
+     *
+     * @param[in] areas Areas of the source ring buffer
+     * @param[in] dataFormat Data format of the source ring buffer
+     * @param[in] offset Offset of the current block in the source ring buffer
+     * @param[in] numFrames Number of frames of the current block
+     * @param[in] numFramesAvailable Number of frames that were available in the source ring buffer
+     */
+    void inject(IasAudioArea *areas, IasAudioCommonDataFormat dataFormat,
+                uint32_t offset, uint32_t numFrames, uint32_t numFramesAvailable);
+
+    /**
+     * @brief Scan an interleaved or non-interleaved buffer for the marker.
+     *
+     * @param[in] areas Areas of the buffer to be scanned
+     * @param[in] dataFormat Data format of the buffer
+     * @param[in] offset Offset of the current block in the buffer
+     * @param[in] numFrames Number of frames of the current block
+     * @param[in] numFramesQueued Number of frames that will be played out before the current block
+     */
+    void detect(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat,
+                uint32_t offset, uint32_t numFrames, uint32_t numFramesQueued);
+
+    /**
+     * @brief Scan the channel buffers of a pipeline audio stream for the marker.
+     *
+     * @param[in] audioFrame Pointers to the channel buffers
+     * @param[in] stride Distance between two samples of one channel
+     * @param[in] numFrames Number of frames of the current block
+     */
+    void detect(const IasAudioFrame &audioFrame, uint32_t stride, uint32_t numFrames);
+
+    /**
+     * @brief Get the statistics of all measurements done so far.
+     *
+     * Can be called from any non-real-time thread while the probe is running.
+     *
+     * @param[out] result The statistics of the measurements
+     */
+    void getResult(IasIDebug::IasLatencyResult *result) const;
+
+    /**
+     * @brief Check whether all requested measurements are done.
+     */
+    bool isFinished() const;
+
+  protected:
+    /**
+     * @brief Get the current time of the monotonic clock in nanoseconds.
+     *
+     * Both sides of the measurement take their time stamps from here, a test can override it with a simulated clock.
+     */
+    virtual int64_t getTimeNs() const;
+
+  private:
+    /**
+     * @brief State of the marker
+     */
+    enum IasMarkerState
+    {
+      eIasMarkerIdle = 0,       //!< No marker in flight, waiting for the hold-off time to elapse
+      eIasMarkerInFlight,       //!< Marker was injected and not yet detected
+      eIasMarkerDetected,       //!< Marker was detected, injector has to start the hold-off time
+    };
+
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasLatencyProbe(IasLatencyProbe const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasLatencyProbe& operator=(IasLatencyProbe const &other);
+
+    /**
+     * @brief Store a measurement after the marker was found at frame position framePos.
+     */
+    void markerDetected(uint32_t framePos, uint32_t numFramesQueued);
+
+    IasLatencyProbeParams         mParams;            //!< The probe parameters
+    uint32_t                      mHoldOffFrames;     //!< Frames to wait after a detection before the next marker is injected
+    uint32_t                      mTimeoutFrames;     //!< Frames after which an undetected marker is counted as missed
+    uint32_t                      mFrameCounter;      //!< Frame counter of the injector for hold-off and timeout
+    int64_t                       mInjectTimeNs;      //!< Time at which the marker entered the source buffer
+    std::atomic<uint32_t>         mState;             //!< Current marker state, one of IasMarkerState
+    std::atomic<uint32_t>         mNumMissed;         //!< Number of markers that were not detected in time
+    std::atomic<uint32_t>         mNumMeasurements;   //!< Number of valid entries in mLatencies
+    std::vector<float>            mLatencies;         //!< Measured latencies in microseconds, preallocated
+};
+
+} // namespace IasAudio
+
+#endif // IASLATENCYPROBE_HPP_
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasMultiPointProbe.hpp
+ * @date   2018
+ * @brief  Simultaneous recording of several ports and pins into one sample aligned multi-channel stream.
+ */
+
+#ifndef IASMULTIPOINTPROBE_HPP_
+#define IASMULTIPOINTPROBE_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <dlt/dlt.h>
+
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "audio/smartx/IasIDebug.hpp"
+#include "smartx/IasAudioTypedefs.hpp"
+#include "smartx/IasIStreamTap.hpp"
+
+namespace IasAudio {
+
+/**
+ * @brief Common time base of all taps whose data is delivered period by period by the same real-time thread
+ */
+struct IasMultiPointClock
+{
+  IasMultiPointClock()
+    :startFrame(cStartFrameUndefined)
+  {}
+
+  static const int64_t cStartFrameUndefined = INT64_MIN;  //!< No tap of the clock domain has received data yet
+  std::atomic<int64_t> startFrame;                         //!< Capture frame of the first block of the clock domain
+};
+
+using IasMultiPointClockPtr = std::shared_ptr<IasMultiPointClock>;
+
+/**
+ * @brief Stream tap of a multi-point probe
+ *
+ * The real-time thread of the probed location writes each block into a lock-free single producer,
+ * single consumer FIFO owned by the tap. The merger thread of the multi-point probe reads the FIFO.
+ * The position of the first block in the capture is derived from the time at which it was received,
+ * afterwards the tap is continuous. Taps of the same clock domain are processed period by period in
+ * one thread, so their positions differ by whole blocks: the arrival time only selects the block and
+ * these taps are aligned sample by sample, as long as the jitter of the thread stays below half a block.
+ * If the FIFO is full, blocks are dropped and replaced by silence as soon as there is space again, so
+ * the tap never loses its alignment.
+ */
+class IAS_AUDIO_PUBLIC IasMultiPointTap : public IasIStreamTap
+{
+  public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] name The name of the probed port or pin
+     * @param[in] index Index of the first channel to be recorded in the probed areas
+     * @param[in] numChannels Number of channels to be recorded
+     * @param[in] capacity Capacity of the FIFO in frames
+     * @param[in] clock The time base shared with the other taps of the clock domain, nullptr if the tap has none
+     */
+    IasMultiPointTap(const std::string &name, uint32_t index, uint32_t numChannels, uint32_t capacity,
+                     IasMultiPointClockPtr clock);
+
+    /**
+     * @brief Destructor, virtual by default.
+     */
+    virtual ~IasMultiPointTap();
+
+    /**
+     * @brief Set the time of capture frame 0, must be called before the tap is attached.
+     *
+     * @param[in] startTimeNs The time of capture frame 0 in nanoseconds of the monotonic clock
+     * @param[in] sampleRate The sample rate of the capture
+     */
+    void setTimeBase(int64_t startTimeNs, uint32_t sampleRate);
+
+    /**
+     * @brief Inherited from IasIStreamTap.
+     */
+    virtual void process(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t numFrames);
+
+    /**
+     * @brief Inherited from IasIStreamTap.
+     */
+    virtual void process(const IasAudioFrame &audioFrame, uint32_t stride, uint32_t numFrames);
+
+    /**
+     * @brief Get the capture frame up to which the tap has delivered data, called by the merger thread.
+     *
+     * @param[out] horizon The first capture frame for which no data is available yet
+     *
+     * @return False if the tap did not receive any data yet
+     */
+    bool getHorizon(int64_t *horizon) const;
+
+    /**
+     * @brief Copy one block of the tap into the interleaved capture buffer, called by the merger thread.
+     *
+     * Frames for which the tap has no data are set to zero, data older than captureFrame is discarded.
+     *
+     * @param[in] dest The interleaved capture buffer
+     * @param[in] destNumChannels The number of channels of the capture buffer
+     * @param[in] destFirstChannel The first channel of the capture buffer that belongs to this tap
+     * @param[in] captureFrame The capture frame of the first frame of the block
+     * @param[in] numFrames The number of frames of the block
+     */
+    void read(float *dest, uint32_t destNumChannels, uint32_t destFirstChannel, int64_t captureFrame, uint32_t numFrames);
+
+    /**
+     * @brief Get the name of the probed port or pin.
+     */
+    const std::string& getName() const { return mName; }
+
+    /**
+     * @brief Get the number of recorded channels.
+     */
+    uint32_t getNumChannels() const { return mNumChannels; }
+
+    /**
+     * @brief Get the number of frames dropped because the FIFO was full.
+     */
+    uint64_t getNumFramesDropped() const { return mNumFramesDropped.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get the number of overrun events of the FIFO.
+     */
+    uint32_t getNumOverruns() const { return mNumOverruns.load(std::memory_order_relaxed); }
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasMultiPointTap(IasMultiPointTap const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasMultiPointTap& operator=(IasMultiPointTap const &other);
+
+    /**
+     * @brief Append one block to the FIFO or drop it if the FIFO is full, called by the real-time thread.
+     */
+    void append(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t firstChannel, uint32_t numFrames);
+
+    /**
+     * @brief Write frames into the FIFO at writePos, a nullptr for areas writes silence.
+     */
+    void write(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t firstChannel,
+               uint64_t writePos, uint32_t numFrames);
+
+    std::string                   mName;               //!< Name of the probed port or pin
+    uint32_t                      mIndex;              //!< Index of the first recorded channel in the probed areas
+    uint32_t                      mNumChannels;        //!< Number of recorded channels
+    uint32_t                      mCapacity;           //!< Capacity of the FIFO in frames
+    std::vector<float>            mFifo;               //!< Interleaved FIFO, preallocated
+    std::vector<IasAudioArea>     mFifoAreas;          //!< Areas describing the FIFO
+    std::vector<IasAudioArea>     mFrameAreas;         //!< Areas describing a pipeline audio stream, preallocated
+    IasMultiPointClockPtr         mClock;              //!< Time base of the clock domain, nullptr if the tap has none
+    int64_t                       mStartTimeNs;        //!< Time of capture frame 0
+    uint32_t                      mSampleRate;         //!< Sample rate of the capture
+    uint64_t                      mPendingGap;         //!< Dropped frames not yet replaced by silence, only used by the real-time thread
+    std::atomic<uint64_t>         mWritePos;           //!< Number of frames written to the FIFO
+    std::atomic<uint64_t>         mReadPos;            //!< Number of frames read from the FIFO
+    std::atomic<int64_t>          mStartFrame;         //!< Capture frame of the first frame of the tap
+    std::atomic<bool>             mIsStarted;          //!< True as soon as the first block was received
+    std::atomic<uint64_t>         mNumFramesDropped;   //!< Number of frames dropped because the FIFO was full
+    std::atomic<uint32_t>         mNumOverruns;        //!< Number of overrun events of the FIFO
+};
+
+/**
+ * @brief Records several ports and pins into one interleaved stream
+ *
+ * Each probed location gets an IasMultiPointTap. A merger thread, which is not a real-time thread, collects
+ * the data of all taps, aligns them sample by sample and writes the interleaved result into an IasStreamProbe.
+ * The channels of the taps follow each other in the order the taps were added. All probed locations must
+ * run at the sample rate of the capture. A tap that does not deliver data for more than half a second is
+ * filled with silence, so a stalled location does not stop the capture of the others.
+ */
+class IAS_AUDIO_PUBLIC IasMultiPointProbe
+{
+  public:
+    /**
+     * @brief The result type for the IasMultiPointProbe methods
+     */
+    enum IasResult
+    {
+      eIasOk,                     //!< Operation successful
+      eIasFailed,                 //!< Operation failed
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] streamName The name of the stream, used for the shared memory ring buffer
+     * @param[in] sampleRate The sample rate of the capture
+     * @param[in] blockSize The number of frames merged at once
+     */
+    IasMultiPointProbe(const std::string &streamName, uint32_t sampleRate, uint32_t blockSize);
+
+    /**
+     * @brief Destructor, virtual by default.
+     */
+    virtual ~IasMultiPointProbe();
+
+    /**
+     * @brief Add a tap for a port or pin, must be called before #start.
+     *
+     * @param[in] name The name of the probed port or pin
+     * @param[in] index Index of the first channel to be recorded in the probed areas
+     * @param[in] numChannels Number of channels to be recorded
+     * @param[in] clockDomain The object whose real-time thread delivers the data of the location, e.g. the
+     *                        pipeline of a pin. Taps of the same object are aligned sample by sample, nullptr
+     *                        aligns the tap by the arrival time of its data only.
+     *
+     * @return The new tap that has to be attached to the location
+     */
+    IasStreamTapPtr addTap(const std::string &name, uint32_t index, uint32_t numChannels, const void *clockDomain);
+
+    /**
+     * @brief Create the shared memory ring buffer and start the merger thread.
+     *
+     * Capture frame 0 is the time of this call.
+     *
+     * @return The result of the start call
+     */
+    IasResult start();
+
+    /**
+     * @brief Stop the merger thread.
+     */
+    void stop();
+
+    /**
+     * @brief Get the name of the stream.
+     */
+    const std::string& getName() const { return mStreamName; }
+
+    /**
+     * @brief Get the header describing the layout and the start time of the capture.
+     *
+     * @param[out] header The header of the capture
+     */
+    void getHeader(IasIDebug::IasMultiPointHeader *header) const;
+
+    /**
+     * @brief Get the statistics of the capture, including the frames dropped by the taps.
+     *
+     * @param[out] statistics The statistics of the capture
+     */
+    void getStatistics(IasIDebug::IasStreamProbeStatistics *statistics) const;
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasMultiPointProbe(IasMultiPointProbe const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasMultiPointProbe& operator=(IasMultiPointProbe const &other);
+
+    /**
+     * @brief The merger thread
+     */
+    void mergerThread();
+
+    using IasMultiPointTapPtr = std::shared_ptr<IasMultiPointTap>;
+
+    DltContext                        *mLog;             //!< DLT context
+    std::string                        mStreamName;      //!< Name of the stream
+    uint32_t                           mSampleRate;      //!< Sample rate of the capture
+    uint32_t                           mBlockSize;       //!< Number of frames merged at once
+    uint32_t                           mNumChannels;     //!< Total number of channels of all taps
+    std::vector<IasMultiPointTapPtr>   mTaps;            //!< All taps in the order of their channels
+    std::map<const void*, IasMultiPointClockPtr> mClocks; //!< Time bases of the clock domains, keyed by the object of the domain
+    IasStreamProbePtr                  mOutput;          //!< The shared memory output of the capture
+    std::vector<float>                 mBlockBuffer;     //!< Interleaved buffer for one merged block
+    std::vector<IasAudioArea>          mBlockAreas;      //!< Areas describing the merged block
+    int64_t                            mStartTimeNs;     //!< Time of capture frame 0
+    int64_t                            mCaptureFrame;    //!< Next capture frame to be merged
+    std::thread                       *mMergerThread;    //!< The merger thread
+    std::atomic<bool>                  mIsRunning;       //!< Exit condition of the merger thread
+};
+
+} // namespace IasAudio
+
+#endif // IASMULTIPOINTPROBE_HPP_
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasProbeSlots.hpp
+ * @date   2018
+ * @brief  Hand-over of stream taps and latency probes from the control thread to a real-time thread.
+ */
+
+#ifndef IASPROBESLOTS_HPP_
+#define IASPROBESLOTS_HPP_
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "tbb/concurrent_queue.h"
+
+namespace IasAudio {
+
+/**
+ * @brief Slots of the probes attached to the locations served by one real-time thread
+ *
+ * Each slot connects a probe, i.e., a stream tap or a latency probe, with a key that identifies the probed
+ * location, e.g. the id of a pipeline audio stream. Locations that can only be probed once use the default key 0.
+ *
+ * The control thread calls #attach and #detach, which pass the change to the real-time thread via a queue.
+ * The real-time thread calls #update once per period to apply the changes and afterwards iterates over
+ * #getSlots or uses #getProbe. The slots are reserved in the constructor, so #update never allocates.
+ *
+ * The real-time thread drops its reference to a detached or replaced probe in #update. The creator of the
+ * probes has to keep its own reference until it is the only one left, so that no probe is ever destroyed by
+ * the real-time thread.
+ */
+template <typename T>
+class IasProbeSlots
+{
+  public:
+    using IasProbePtr = std::shared_ptr<T>;
+
+    /**
+     * @brief One slot, a probe together with the key of its location
+     */
+    struct IasSlot
+    {
+      IasSlot()
+        :key(0)
+        ,probe(nullptr)
+      {}
+      IasSlot(uint32_t slotKey, const IasProbePtr &slotProbe)
+        :key(slotKey)
+        ,probe(slotProbe)
+      {}
+      uint32_t      key;        //!< The key of the probed location
+      IasProbePtr   probe;      //!< The probe, a nullptr in the queue detaches the probe of the location
+    };
+
+    using IasSlotVector = std::vector<IasSlot>;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] maxNumSlots The maximum number of locations that can be probed at the same time
+     */
+    explicit IasProbeSlots(uint32_t maxNumSlots = 1)
+      :mQueue()
+      ,mSlots()
+      ,mMaxNumSlots(maxNumSlots)
+      ,mKeys()
+    {
+      mSlots.reserve(maxNumSlots);
+    }
+
+    /**
+     * @brief Attach a probe to a location, called by the control thread.
+     *
+     * A probe that is already attached to the location is replaced.
+     *
+     * @param[in] probe The probe
+     * @param[in] key The key of the location
+     *
+     * @return False if the maximum number of slots is in use
+     */
+    bool attach(const IasProbePtr &probe, uint32_t key = 0)
+    {
+      if ((mKeys.size() >= mMaxNumSlots) && (mKeys.count(key) == 0))
+      {
+        return false;
+      }
+      mKeys.insert(key);
+      mQueue.push(IasSlot(key, probe));
+      return true;
+    }
+
+    /**
+     * @brief Detach the probe of a location, called by the control thread.
+     *
+     * @param[in] key The key of the location
+     */
+    void detach(uint32_t key = 0)
+    {
+      mKeys.erase(key);
+      mQueue.push(IasSlot(key, nullptr));
+    }
+
+    /**
+     * @brief Detach the probes of all locations, called by the control thread.
+     */
+    void detachAll()
+    {
+      mKeys.clear();
+      mQueue.push(IasSlot(cAllKeys, nullptr));
+    }
+
+    /**
+     * @brief Apply the changes of the control thread, called by the real-time thread.
+     */
+    void update()
+    {
+      IasSlot change;
+      while (mQueue.try_pop(change))
+      {
+        if (change.key == cAllKeys)
+        {
+          mSlots.clear();
+          continue;
+        }
+        auto slotIt = mSlots.begin();
+        while ((slotIt != mSlots.end()) && (slotIt->key != change.key))
+        {
+          ++slotIt;
+        }
+        if (slotIt != mSlots.end())
+        {
+          if (change.probe != nullptr)
+          {
+            slotIt->probe = change.probe;
+          }
+          else
+          {
+            mSlots.erase(slotIt);
+          }
+        }
+        else if ((change.probe != nullptr) && (mSlots.size() < mMaxNumSlots))
+        {
+          mSlots.push_back(change);
+        }
+      }
+    }
+
+    /**
+     * @brief Get all active slots, called by the real-time thread.
+     */
+    const IasSlotVector& getSlots() const { return mSlots; }
+
+    /**
+     * @brief Get the probe of the first active slot, called by the real-time thread.
+     *
+     * @return The probe, nullptr if no probe is attached
+     */
+    T* getProbe() const { return mSlots.empty() ? nullptr : mSlots.front().probe.get(); }
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasProbeSlots(IasProbeSlots const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasProbeSlots& operator=(IasProbeSlots const &other);
+
+    static const uint32_t cAllKeys = 0xFFFFFFFFu;   //!< Key of the queue entry that detaches all probes
+
+    tbb::concurrent_queue<IasSlot>  mQueue;         //!< Queue to pass the changes to the real-time thread
+    IasSlotVector                   mSlots;         //!< The active slots, only used by the real-time thread
+    uint32_t                        mMaxNumSlots;   //!< The maximum number of active slots
+    std::set<uint32_t>              mKeys;          //!< Keys of the attached locations, only used by the control thread
+};
+
+class IasLatencyProbe;
+/**
+ * @brief Slots of the latency probes served by one real-time thread
+ */
+using IasLatencyProbeSlots = IasProbeSlots<IasLatencyProbe>;
+
+class IasIStreamTap;
+/**
+ * @brief Slots of the stream taps served by one real-time thread
+ */
+using IasStreamTapSlots = IasProbeSlots<IasIStreamTap>;
+
+} // namespace IasAudio
+
+#endif // IASPROBESLOTS_HPP_
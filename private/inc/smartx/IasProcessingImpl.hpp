@@ -55,6 +55,15 @@ class IAS_AUDIO_PUBLIC IasProcessingImpl : public IasIProcessing
      */
     virtual IasIProcessing::IasResult sendCmd(const std::string &instanceName, const IasProperties &cmdProperties, IasProperties &returnProperties);
 
+    /**
+     * @brief Inherited from IasIProcessing.
+     */
+    virtual IasIProcessing::IasResult resolveCmd(const std::string &instanceName, int32_t cmdId, const std::string &pinName, IasCmdHandle *handle);
+
+    /**
+     * @brief Inherited from IasIProcessing.
+     */
+    virtual IasIProcessing::IasResult sendCmd(const IasCmdHandle &handle, float value);
 
   private:
     /**
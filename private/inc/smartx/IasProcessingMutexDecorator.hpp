@@ -19,7 +19,8 @@ namespace IasAudio {
 /**
  * @brief Decorator for the IasIProcessing instance
  *
- * It adds a mutex around each method to make it safe while being accessed by multiple threads.
+ * The command dispatcher itself is thread-safe and serializes the commands per module, so commands
+ * to different modules do not block each other and are not blocked by the setup or routing interfaces.
  */
 class IAS_AUDIO_PUBLIC IasProcessingMutexDecorator : public IasIProcessing
 {
@@ -41,6 +42,16 @@ class IAS_AUDIO_PUBLIC IasProcessingMutexDecorator : public IasIProcessing
      */
     IasResult sendCmd(const std::string &instanceName, const IasProperties &cmdProperties, IasProperties &returnProperties) override;
 
+    /**
+     * @brief Inherited from IasIProcessing.
+     */
+    IasResult resolveCmd(const std::string &instanceName, int32_t cmdId, const std::string &pinName, IasCmdHandle *handle) override;
+
+    /**
+     * @brief Inherited from IasIProcessing.
+     */
+    IasResult sendCmd(const IasCmdHandle &handle, float value) override;
+
   private:
       /**
        * @brief Copy constructor, private deleted to prevent misuse.
@@ -19,7 +19,8 @@ namespace IasAudio {
 /**
  * @brief Decorator for the IasIRouting instance
  *
- * It adds a mutex around each method to make it safe while being accessed by multiple threads.
+ * Each method locks the routing domain and reads the topology domain, see IasDecoratorGuard. So the
+ * routing is not blocked by the setup of pipelines or processing modules.
  */
 class IAS_AUDIO_PUBLIC IasRoutingMutexDecorator : public IasIRouting
 {
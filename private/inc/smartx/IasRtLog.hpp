@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasRtLog.hpp
+ * @date   2018
+ * @brief  Deferred logging for the real-time threads of the SmartXbar.
+ */
+
+#ifndef IASRTLOG_HPP_
+#define IASRTLOG_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <dlt/dlt.h>
+
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+
+namespace IasAudio {
+
+static const uint32_t cIasRtLogMaxArgs = 8;          //!< Maximum number of arguments of one log record
+static const uint32_t cIasRtLogTextSize = 96;        //!< Space for the text arguments of one log record, longer texts are truncated
+static const uint32_t cIasRtLogRingSize = 256;       //!< Number of log records per thread, has to be a power of two
+
+/**
+ * @brief One argument of a log record
+ */
+struct IasRtLogArg
+{
+  enum IasType
+  {
+    eIasInt,          //!< Signed integer or enum
+    eIasUInt,         //!< Unsigned integer
+    eIasDouble,       //!< Floating point value
+    eIasBool,         //!< Boolean value
+    eIasText,         //!< Text copied into the text buffer of the record
+  };
+
+  IasType type;                 //!< Type of the argument
+  union
+  {
+    int64_t  intValue;          //!< Value of eIasInt
+    uint64_t uintValue;         //!< Value of eIasUInt
+    double   doubleValue;       //!< Value of eIasDouble
+    bool     boolValue;         //!< Value of eIasBool
+    struct
+    {
+      uint16_t offset;          //!< Offset of the text in the text buffer of the record
+      uint16_t length;          //!< Length of the text
+    } text;                     //!< Value of eIasText
+  };
+};
+
+/**
+ * @brief Fixed-size binary log record, formatted by the log thread
+ */
+struct IasRtLogRecord
+{
+  DltContext          *context;                      //!< The DLT context to log to
+  DltLogLevelType      level;                        //!< The log level
+  const std::string   *className;                    //!< The class name used as prefix, has to be static
+  const char          *function;                     //!< The function name used as prefix
+  uint32_t             line;                         //!< The line number used as prefix
+  uint32_t             numArgs;                      //!< Number of valid arguments
+  uint32_t             textUsed;                     //!< Number of bytes used in the text buffer
+  IasRtLogArg          args[cIasRtLogMaxArgs];       //!< The arguments
+  char                 text[cIasRtLogTextSize];      //!< The text buffer for the text arguments
+};
+
+/**
+ * @brief Lock-free single producer, single consumer ring of log records of one thread
+ */
+struct IasRtLogRing
+{
+  IasRtLogRing(const std::string &name)
+    :threadName(name)
+    ,writeIndex(0)
+    ,readIndex(0)
+    ,numDropped(0)
+    ,numReportedDropped(0)
+  {
+  }
+
+  std::string             threadName;                     //!< Name of the thread owning the ring
+  IasRtLogRecord          records[cIasRtLogRingSize];     //!< The preallocated records
+  std::atomic<uint64_t>   writeIndex;                     //!< Number of records written by the owning thread
+  std::atomic<uint64_t>   readIndex;                      //!< Number of records read by the log thread
+  std::atomic<uint64_t>   numDropped;                     //!< Number of records dropped because the ring was full
+  uint64_t                numReportedDropped;             //!< Number of dropped records already reported, only used by the log thread
+};
+
+using IasRtLogRingPtr = std::shared_ptr<IasRtLogRing>;
+
+/**
+ * @brief Logging front-end for real-time threads
+ *
+ * Instead of formatting the message and calling DLT in the real-time thread, the arguments are stored as
+ * binary record in a lock-free ring of the calling thread. A non real-time log thread formats the records
+ * and forwards them to DLT. If the ring of a thread is full, the record is dropped and counted. The log
+ * thread reports the number of dropped records.
+ *
+ * Records are only created if the log level is enabled for the DLT context. Text arguments are copied
+ * into the record, so std::string arguments are allowed, but should not be created for the log call.
+ * Enums are logged as integer values.
+ *
+ * The ring of a thread is allocated by #registerThread, which IasThreadNames calls for all real-time
+ * threads. Log calls of threads that were not registered are formatted and forwarded to DLT immediately,
+ * so a log call never allocates a ring.
+ */
+class IAS_AUDIO_PUBLIC IasRtLog
+{
+  public:
+    /**
+     * @brief Allocate the ring of the calling thread and hand it over to the log thread.
+     *
+     * @param[in] threadName The name of the thread, used for the report of dropped records
+     */
+    static void registerThread(const std::string &threadName);
+
+    /**
+     * @brief Check whether the calling thread was registered by #registerThread.
+     */
+    static bool isThreadRegistered();
+
+    /**
+     * @brief Store a log record in the ring of the calling thread.
+     *
+     * Use the macro IAS_RT_LOG instead of calling this method directly.
+     */
+    template <typename... Args>
+    static void log(DltContext *context, DltLogLevelType level, const std::string &className, const char *function, uint32_t line, const Args&... args)
+    {
+      if (isEnabled(context, level) == false)
+      {
+        return;
+      }
+      IasRtLogRing *ring = getRing();
+      if (ring == nullptr)
+      {
+        IasRtLogRecord record;
+        fillRecord(record, context, level, className, function, line, args...);
+        forward(record);
+        return;
+      }
+      write(*ring, context, level, className, function, line, args...);
+    }
+
+    /**
+     * @brief Store a log record in a ring, called by the thread owning the ring.
+     *
+     * The log level is not checked.
+     *
+     * @returns False if the ring was full and the record was dropped
+     */
+    template <typename... Args>
+    static bool write(IasRtLogRing &ring, DltContext *context, DltLogLevelType level, const std::string &className, const char *function, uint32_t line, const Args&... args)
+    {
+      uint64_t writeIndex = ring.writeIndex.load(std::memory_order_relaxed);
+      if (writeIndex - ring.readIndex.load(std::memory_order_acquire) >= cIasRtLogRingSize)
+      {
+        ring.numDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      fillRecord(ring.records[writeIndex & (cIasRtLogRingSize - 1)], context, level, className, function, line, args...);
+      ring.writeIndex.store(writeIndex + 1, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief Forward all records of a ring to DLT and report the records dropped since the last call.
+     *
+     * Called by the log thread for the registered rings. Other callers may only drain rings that were
+     * not registered.
+     *
+     * @returns The number of forwarded records
+     */
+    static uint32_t drain(IasRtLogRing &ring);
+
+    /**
+     * @brief Format a record into the message that is forwarded to DLT.
+     */
+    static std::string format(const IasRtLogRecord &record);
+
+    /**
+     * @brief Get the number of records dropped by all threads since start.
+     */
+    static uint64_t getNumDropped();
+
+  private:
+    /**
+     * @brief Check whether the log level is enabled for the DLT context
+     */
+    static bool isEnabled(DltContext *context, DltLogLevelType level)
+    {
+      return (context != nullptr) && (context->log_level_ptr != nullptr) && (static_cast<int>(level) <= static_cast<int>(*context->log_level_ptr));
+    }
+
+    /**
+     * @brief Get the ring of the calling thread, nullptr if the thread was not registered
+     */
+    static IasRtLogRing* getRing();
+
+    /**
+     * @brief Format a record and log it to DLT
+     */
+    static void forward(const IasRtLogRecord &record);
+
+    template <typename... Args>
+    static void fillRecord(IasRtLogRecord &record, DltContext *context, DltLogLevelType level, const std::string &className, const char *function, uint32_t line, const Args&... args)
+    {
+      record.context = context;
+      record.level = level;
+      record.className = &className;
+      record.function = function;
+      record.line = line;
+      record.numArgs = 0;
+      record.textUsed = 0;
+      addArgs(record, args...);
+    }
+
+    static void addArgs(IasRtLogRecord &)
+    {
+    }
+
+    template <typename First, typename... Rest>
+    static void addArgs(IasRtLogRecord &record, const First &first, const Rest&... rest)
+    {
+      if (record.numArgs < cIasRtLogMaxArgs)
+      {
+        addArg(record, record.args[record.numArgs], first);
+        record.numArgs++;
+      }
+      addArgs(record, rest...);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type addArg(IasRtLogRecord &, IasRtLogArg &arg, const T &value)
+    {
+      arg.type = IasRtLogArg::eIasInt;
+      arg.intValue = static_cast<int64_t>(value);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type addArg(IasRtLogRecord &, IasRtLogArg &arg, const T &value)
+    {
+      arg.type = IasRtLogArg::eIasUInt;
+      arg.uintValue = static_cast<uint64_t>(value);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_enum<T>::value>::type addArg(IasRtLogRecord &, IasRtLogArg &arg, const T &value)
+    {
+      arg.type = IasRtLogArg::eIasInt;
+      arg.intValue = static_cast<int64_t>(value);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_floating_point<T>::value>::type addArg(IasRtLogRecord &, IasRtLogArg &arg, const T &value)
+    {
+      arg.type = IasRtLogArg::eIasDouble;
+      arg.doubleValue = static_cast<double>(value);
+    }
+
+    static void addArg(IasRtLogRecord &, IasRtLogArg &arg, const bool &value)
+    {
+      arg.type = IasRtLogArg::eIasBool;
+      arg.boolValue = value;
+    }
+
+    static void addArg(IasRtLogRecord &record, IasRtLogArg &arg, const std::string &value)
+    {
+      addText(record, arg, value.c_str(), value.size());
+    }
+
+    static void addArg(IasRtLogRecord &record, IasRtLogArg &arg, const char *value)
+    {
+      addText(record, arg, value, (value != nullptr) ? strlen(value) : 0);
+    }
+
+    template <size_t N>
+    static void addArg(IasRtLogRecord &record, IasRtLogArg &arg, const char (&value)[N])
+    {
+      addText(record, arg, value, strnlen(value, N));
+    }
+
+    static void addText(IasRtLogRecord &record, IasRtLogArg &arg, const char *value, size_t length)
+    {
+      size_t available = cIasRtLogTextSize - record.textUsed;
+      if (length > available)
+      {
+        length = available;
+      }
+      if (length > 0)
+      {
+        memcpy(&record.text[record.textUsed], value, length);
+      }
+      arg.type = IasRtLogArg::eIasText;
+      arg.text.offset = static_cast<uint16_t>(record.textUsed);
+      arg.text.length = static_cast<uint16_t>(length);
+      record.textUsed += static_cast<uint32_t>(length);
+    }
+};
+
+} //namespace IasAudio
+
+/**
+ * @brief Log from a real-time thread, the arguments are the same as for DLT_LOG_CXX without the LOG_PREFIX.
+ *
+ * Requires the static std::string cClassName that is also used for the LOG_PREFIX.
+ */
+#define IAS_RT_LOG(context, level, ...) IasAudio::IasRtLog::log(&(context), level, cClassName, __func__, __LINE__, __VA_ARGS__)
+
+#endif /* IASRTLOG_HPP_ */
@@ -13,6 +13,7 @@
 #define IASSETUPIMPL_HPP
 
 
+#include <thread>
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "audio/smartx/IasISetup.hpp"
 #include "smartx/IasAudioTypedefs.hpp"
@@ -119,6 +120,18 @@ public:
     virtual void setProperties(IasProcessingModulePtr module, const IasProperties &properties);
     virtual IasPropertiesPtr getProperties(IasProcessingModulePtr module);
     virtual IasResult initPipelineAudioChain(IasPipelinePtr pipeline);
+    virtual IasResult setRuntimeRelinking(IasPipelinePtr pipeline, bool enable);
+    virtual IasResult commitPinLinks(IasPipelinePtr pipeline, uint32_t crossfadeLength);
+    virtual IasResult setSinkPrefill(IasRoutingZonePtr routingZone, const IasSinkPrefillParams &params);
+
+    /**
+     * @brief Load the plug-in libraries in a background thread.
+     *
+     * Loading the plug-in libraries takes a considerable part of the start-up time. With this method, they
+     * are loaded while the topology is set up. The first call of createPipeline waits for the background
+     * thread. The method has no effect if the plug-in libraries are already loaded.
+     */
+    void preloadPluginLibraries();
 
 private:
     /**
@@ -144,6 +157,8 @@ private:
     DltContext             *mLog;
     unsigned int            mMaxDataBuffSize;
     IasIRouting            *mRouting;
+    std::thread             mPluginLoader;        //!< Background thread loading the plug-in libraries
+    bool                    mPluginLoadFailed;    //!< True if the background thread did not find any plug-in library
 };
 
 } //namespace IasAudio
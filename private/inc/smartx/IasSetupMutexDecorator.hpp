@@ -19,7 +19,10 @@ namespace IasAudio {
 /**
  * @brief Decorator for the IasISetup instance
  *
- * It adds a mutex around each method to make it safe while being accessed by multiple threads.
+ * Each method locks the topology and/or pipeline domain, see IasDecoratorGuard. Getters only lock them for reading.
+ * The maps of the configuration belong to the topology domain, so pipeline methods that look up the routing zone
+ * of a pipeline or the pins of the configuration lock it for reading and those that add or remove entries of the
+ * configuration lock it for writing.
  */
 class IAS_AUDIO_PUBLIC IasSetupMutexDecorator : public IasISetup
 {
@@ -347,6 +350,21 @@ class IAS_AUDIO_PUBLIC IasSetupMutexDecorator : public IasISetup
         */
       IasResult initPipelineAudioChain(IasPipelinePtr pipeline) override;
 
+      /**
+        * @brief Inherited from IasISetup.
+        */
+      IasResult setRuntimeRelinking(IasPipelinePtr pipeline, bool enable) override;
+
+      /**
+        * @brief Inherited from IasISetup.
+        */
+      IasResult commitPinLinks(IasPipelinePtr pipeline, uint32_t crossfadeLength) override;
+
+      /**
+        * @brief Inherited from IasISetup.
+        */
+      IasResult setSinkPrefill(IasRoutingZonePtr routingZone, const IasSinkPrefillParams &params) override;
+
   private:
       /**
        * @brief Copy constructor, private deleted to prevent misuse.
@@ -87,6 +87,20 @@ class IAS_AUDIO_PUBLIC IasSmartXClient
      */
     IasAudioDevice::IasEventType getNextEventType();
 
+    /**
+     * @brief Stop the IPC thread and wait until it has ended.
+     *
+     * The thread is woken up by a shutdown package in the incoming queue instead of being canceled, because
+     * canceling could leave the mutex of the shared memory queue locked while the thread waits for the
+     * condition variable. The thread is only canceled if the package cannot be queued. The destructor
+     * calls this method as well, calling it again is harmless.
+     *
+     * @return The result of the call
+     * @retval IasResult::eIasOk The IPC thread has been stopped by the shutdown package or was not running
+     * @retval IasResult::eIasFailed The shutdown package could not be queued, the IPC thread has been canceled
+     */
+    IasResult stopIpcThread();
+
   private:
     /**
      * @brief The device state
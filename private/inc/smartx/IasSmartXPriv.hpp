@@ -22,6 +22,7 @@ namespace IasAudio {
 
 class IasConfiguration;
 class IasISetup;
+class IasSetupImpl;
 
 /**
  * @brief The SmartXBar private implementation class
@@ -57,6 +58,10 @@ class IasSmartXPriv
     /**
      * @brief Start data processing thread(s) of the SmartXbar
      *
+     * The routing zones and source devices are independent of each other. If the option startup.threads
+     * of the config file is set, they are started by that number of threads in parallel, so that the
+     * ALSA devices are opened and configured concurrently.
+     *
      * @return The status of the start call
      * @retval IasSmartX::eIasOk SmartXbar data processing successfully started
      * @retval IasSmartX::eIasFailed SmartXbar data processing couldn't be started
@@ -145,10 +150,23 @@ class IasSmartXPriv
      */
     IasSmartXPriv& operator=(IasSmartXPriv const &other);
 
+    /**
+     * @brief Start the routing zones and source devices in parallel
+     *
+     * @param[in] routingZones The routing zones to be started
+     * @param[in] sourceDevices The source devices to be started
+     * @param[in] numThreads The number of threads starting them
+     *
+     * @return True if all of them were started successfully
+     */
+    bool startParallel(const std::vector<IasRoutingZonePtr> &routingZones,
+                       const std::vector<IasAudioSourceDevicePtr> &sourceDevices, uint32_t numThreads);
+
     // Member variables
     DltContext           *mLog;
     IasConfigurationPtr   mConfig;
     IasISetup            *mSetup;
+    IasSetupImpl         *mSetupImpl;     //!< The setup implementation without decorators, owned via mSetup
     IasIRouting          *mRouting;
     IasIProcessing       *mProcessing;
     IasIDebug            *mDebug;
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasStreamProbe.hpp
+ * @date   2018
+ * @brief  Unbounded recording of an audio port or pin into a shared memory ring buffer.
+ */
+
+#ifndef IASSTREAMPROBE_HPP_
+#define IASSTREAMPROBE_HPP_
+
+#include <atomic>
+#include <vector>
+#include <dlt/dlt.h>
+
+#include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "audio/smartx/IasIDebug.hpp"
+#include "smartx/IasAudioTypedefs.hpp"
+#include "smartx/IasIStreamTap.hpp"
+
+namespace IasAudio {
+
+class IasAudioRingBuffer;
+
+/**
+ * @brief Parameters of a stream probe
+ */
+struct IasStreamProbeParams
+{
+  /**
+   * @brief Constructor
+   */
+  IasStreamProbeParams()
+    :name()
+    ,index(0)
+    ,numChannels(0)
+    ,sampleRate(0)
+    ,periodSize(0)
+    ,dataFormat(eIasFormatFloat32)
+  {}
+
+  std::string              name;          //!< Name of the stream, the shm ring buffer is called smartx_<name>_c
+  uint32_t                 index;         //!< Index of the first channel to be recorded in the probed areas
+  uint32_t                 numChannels;   //!< Number of channels to be recorded
+  uint32_t                 sampleRate;    //!< Sample rate at the probe location
+  uint32_t                 periodSize;    //!< Period size at the probe location
+  IasAudioCommonDataFormat dataFormat;    //!< Data format of the shm ring buffer
+};
+
+/**
+ * @brief Streams the data of a port or pin into a shared memory ring buffer
+ *
+ * The ring buffer is created by an IasSmartXClient in the same way as for a SmartX sink device, so an
+ * external analyser can attach to it with the alsa-smartx-plugin, e.g. with "arecord -D smartx:<name>".
+ * The probe never blocks: if the reader does not keep up, the current block is dropped and counted as overrun.
+ * In contrast to the data probes, there is no limit for the recording time.
+ *
+ * #process is real-time safe, all memory is allocated in #init.
+ */
+class IAS_AUDIO_PUBLIC IasStreamProbe : public IasIStreamTap
+{
+  public:
+    /**
+     * @brief The result type for the IasStreamProbe methods
+     */
+    enum IasResult
+    {
+      eIasOk,                     //!< Operation successful
+      eIasFailed,                 //!< Operation failed
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] params The probe parameters
+     */
+    IasStreamProbe(const IasStreamProbeParams &params);
+
+    /**
+     * @brief Destructor, virtual by default.
+     */
+    virtual ~IasStreamProbe();
+
+    /**
+     * @brief Create the shared memory ring buffer.
+     *
+     * @return The result of the init call
+     */
+    IasResult init();
+
+    /**
+     * @brief Write one block of the probed areas into the shared memory ring buffer.
+     *
+     * @param[in] areas Areas of the probed buffer
+     * @param[in] dataFormat Data format of the probed buffer
+     * @param[in] offset Offset of the current block in the probed buffer
+     * @param[in] numFrames Number of frames of the current block
+     */
+    virtual void process(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t numFrames);
+
+    /**
+     * @brief Write one block of a pipeline audio stream into the shared memory ring buffer.
+     *
+     * @param[in] audioFrame Pointers to the channel buffers
+     * @param[in] stride Distance between two samples of one channel
+     * @param[in] numFrames Number of frames of the current block
+     */
+    virtual void process(const IasAudioFrame &audioFrame, uint32_t stride, uint32_t numFrames);
+
+    /**
+     * @brief Get the statistics of the stream.
+     *
+     * Can be called from any non-real-time thread while the probe is running.
+     *
+     * @param[out] statistics The statistics of the stream
+     */
+    void getStatistics(IasIDebug::IasStreamProbeStatistics *statistics) const;
+
+    /**
+     * @brief Get the probe parameters.
+     */
+    const IasStreamProbeParams& getParameters() const { return mParams; }
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasStreamProbe(IasStreamProbe const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasStreamProbe& operator=(IasStreamProbe const &other);
+
+    /**
+     * @brief Reset the ring buffer if the reader was stopped, called by the real-time thread.
+     */
+    void handleClientEvents();
+
+    DltContext                   *mLog;                //!< DLT context
+    IasStreamProbeParams          mParams;             //!< The probe parameters
+    IasAudioDeviceParamsPtr       mDeviceParams;       //!< Parameters of the shm ring buffer
+    IasSmartXClientPtr            mSmartXClient;       //!< Client that owns the shm ring buffer and serves the alsa-smartx-plugin
+    IasAudioRingBuffer           *mRingBuffer;         //!< The shm ring buffer
+    std::vector<IasAudioArea>     mFrameAreas;         //!< Areas describing a pipeline audio stream, preallocated
+    bool                          mIsOverrun;          //!< True while blocks are dropped, used to count overrun events
+    std::atomic<uint64_t>         mNumFramesWritten;   //!< Number of frames written to the ring buffer
+    std::atomic<uint64_t>         mNumFramesDropped;   //!< Number of frames dropped because the ring buffer was full
+    std::atomic<uint32_t>         mNumOverruns;        //!< Number of overrun events
+};
+
+} // namespace IasAudio
+
+#endif // IASSTREAMPROBE_HPP_
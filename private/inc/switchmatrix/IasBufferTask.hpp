@@ -13,6 +13,7 @@
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "smartx/IasAudioTypedefs.hpp"
+#include "smartx/IasProbeSlots.hpp"
 #include "tbb/concurrent_queue.h"
 #include <set>
 #include <atomic>
@@ -118,6 +119,16 @@ class IAS_AUDIO_PUBLIC IasBufferTask
 
     void stopProbing();
 
+    /**
+     * @brief Get the slot of the latency probe that injects its marker into the source buffer
+     */
+    IasLatencyProbeSlots& getLatencyProbeSlots() { return mLatencyProbeSlots; }
+
+    /**
+     * @brief Get the slot of the stream tap that receives the data read from the source buffer
+     */
+    IasStreamTapSlots& getStreamTapSlots() { return mStreamTapSlots; }
+
     /**
      * @brief Unlock all jobs to provide data
      */
@@ -174,6 +185,8 @@ class IAS_AUDIO_PUBLIC IasBufferTask
     bool                                             mIsDummy;
     IasDataProbePtr                                  mDataProbe;
     std::atomic<bool>                                mProbingActive;
+    IasLatencyProbeSlots                             mLatencyProbeSlots;
+    IasStreamTapSlots                                mStreamTapSlots;
     IasSourceState                                   mSourceState;
 };
 
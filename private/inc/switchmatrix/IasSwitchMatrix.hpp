@@ -18,6 +18,7 @@
 #include <boost/pool/singleton_pool.hpp>
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "smartx/IasAudioTypedefs.hpp"
+#include "smartx/IasProbeSlots.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 
 
@@ -73,6 +74,30 @@ class IAS_AUDIO_PUBLIC IasSwitchMatrix
 
     void stopProbing(IasAudioPortPtr port);
 
+    /**
+     * @brief Get the slot for a latency probe at a port
+     *
+     * For an output port the marker is injected into the source buffer, for an input port the data
+     * written to the sink buffer is scanned for the marker.
+     *
+     * @param[in] port The port to be probed
+     *
+     * @return The slot of the buffer task or switch matrix job serving the port, nullptr if the port is not connected
+     */
+    IasLatencyProbeSlots* getLatencyProbeSlots(IasAudioPortPtr port);
+
+    /**
+     * @brief Get the slot for a stream tap at a port
+     *
+     * For an output port the data read from the source buffer is passed to the tap, for an input port the
+     * data written to the sink buffer is passed to the tap.
+     *
+     * @param[in] port The port to be probed
+     *
+     * @return The slot of the buffer task or switch matrix job serving the port, nullptr if the port is not connected
+     */
+    IasStreamTapSlots* getStreamTapSlots(IasAudioPortPtr port);
+
     /**
      * @brief unlock all switchmatrix jobs so that they get executed
      *
@@ -117,6 +142,20 @@ class IAS_AUDIO_PUBLIC IasSwitchMatrix
 
     IasResult findBufferTask(IasAudioRingBuffer* srcBuffer,IasBufferTaskPtr* task);
 
+    /**
+     * @brief Find the real-time object that serves a port for probing
+     *
+     * An input port is served by the switch matrix job that writes into its ring buffer, an output port
+     * is served by the buffer task that reads from its ring buffer.
+     *
+     * @param[in] port The port to be probed
+     * @param[out] job The switch matrix job serving an input port, nullptr for an output port
+     * @param[out] task The buffer task serving an output port, nullptr for an input port
+     *
+     * @return False if the port is not connected
+     */
+    bool findProbeLocation(IasAudioPortPtr port, std::shared_ptr<IasSwitchMatrixJob> *job, IasBufferTaskPtr *task);
+
     /**
      * @brief Remove the buffer task associated with the given source ringbuffer
      *
@@ -15,6 +15,7 @@
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "model/IasAudioPort.hpp"
+#include "smartx/IasProbeSlots.hpp"
 #include <atomic>
 
 namespace IasAudio {
@@ -157,6 +158,16 @@ class IAS_AUDIO_PUBLIC IasSwitchMatrixJob
      */
     void stopProbe();
 
+    /**
+     * @brief Get the slot of the latency probe that scans the data written to the sink port for its marker
+     */
+    IasLatencyProbeSlots& getLatencyProbeSlots() { return mLatencyProbeSlots; }
+
+    /**
+     * @brief Get the slot of the stream tap that receives the data written to the sink port
+     */
+    IasStreamTapSlots& getStreamTapSlots() { return mStreamTapSlots; }
+
     void unlock();
 
     void lock(){mLocked = true;}
@@ -200,6 +211,14 @@ class IAS_AUDIO_PUBLIC IasSwitchMatrixJob
      */
     IasResult sampleRateConvert(uint32_t srcOffset, uint32_t framesToRead, uint32_t *framesConsumed,uint32_t *framesStillToConsume);
 
+    /**
+     * @brief Pass the frames written to the sink buffer to the attached latency probe and stream tap
+     *
+     * @param[in] sinkOffset The offset of the written frames in the sink buffer
+     * @param[in] numFrames The number of written frames
+     */
+    void processProbeSlots(uint32_t sinkOffset, uint32_t numFrames);
+
     DltContext*                                 mLog;                     //!< The log object
     const IasAudioPortPtr                       mSrc;                     //!< The source port
     const IasAudioPortPtr                       mSink;                    //!< The sink port
@@ -215,6 +234,8 @@ class IAS_AUDIO_PUBLIC IasSwitchMatrixJob
     IasJobTask                                  mJobTask;                 //!< The task the job has to do
     tbb::concurrent_queue<IasProbingQueueEntry> mProbingQueue;            //!< The queue for the probing
     std::atomic<bool>                           mProbingActive;           //!< flag to indicate if probing is active
+    IasLatencyProbeSlots                        mLatencyProbeSlots;       //!< The latency probe scanning the sink data, if active
+    IasStreamTapSlots                           mStreamTapSlots;          //!< The stream tap receiving the sink data, if active
     IasSwitchMatrixJobConversions               mSampleFormatConv;        //!< marks which format convertion should be applied
     bool                                        mLocked;                  //!< flag to indicate if the jobs are currently locked
     float                                       mSizeFactor;              //!< factor needed for copy size calculations
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/**
+ * @file   IasTestFrameworkAllocationCounter.hpp
+ * @date   2018
+ * @brief  Counting of heap allocations for the benchmark mode of the test framework.
+ */
+
+#ifndef IASTESTFRAMEWORKALLOCATIONCOUNTER_HPP_
+#define IASTESTFRAMEWORKALLOCATIONCOUNTER_HPP_
+
+#include <cstdint>
+
+
+namespace IasAudio {
+
+/**
+ * @brief Get the number of heap allocations done via operator new by the calling thread so far.
+ *
+ * The test framework library does not replace the global operators new and delete itself, because that would
+ * affect every application linking it. An executable that wants the benchmark mode to count allocations opts in
+ * by linking private/tst/testfwxTest/src/IasTestFrameworkAllocationCounter.cpp, which replaces the operators with
+ * a thread local counter and defines this function.
+ *
+ * The function is declared weak, so its address is a nullptr if the executable did not opt in.
+ *
+ * @return The number of allocations of the calling thread
+ */
+uint64_t getNumThreadAllocations() __attribute__((weak));
+
+} // namespace IasAudio
+
+#endif // IASTESTFRAMEWORKALLOCATIONCOUNTER_HPP_
@@ -96,6 +96,26 @@ class IasTestFrameworkPriv
      */
     IasResult process(uint32_t numPeriods);
 
+    /**
+     * @brief Prepare the benchmark mode by reading the input wave files into memory
+     *
+     * @param[in] numPeriods Number of periods that will be processed by #runBenchmark
+     * @return The status of the call
+     */
+    IasResult prepareBenchmark(uint32_t numPeriods);
+
+    /**
+     * @brief Process a number of periods as fast as possible from the preloaded input data
+     *
+     * The processing time, the processing time of each module and the heap allocations of the calling
+     * thread are measured. The output data is discarded.
+     *
+     * @param[in] numPeriods Number of periods to be processed
+     * @param[out] result The measured values of this instance
+     * @return The status of the call
+     */
+    IasResult runBenchmark(uint32_t numPeriods, IasBenchmarkResult *result);
+
     /**
      * @brief Get a pointer to the IasTestFrameworkSetup interface
      *
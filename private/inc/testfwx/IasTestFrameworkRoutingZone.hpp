@@ -186,6 +186,23 @@ class IasTestFrameworkRoutingZone
      */
     IasResult processPeriods(uint32_t numPeriods);
 
+    /**
+     * @brief Read the input wave files into memory for the benchmark mode
+     *
+     * @param[in] numPeriods Number of periods to be read from each input file, shorter files are played in a loop
+     */
+    IasResult preloadInputs(uint32_t numPeriods);
+
+    /**
+     * @brief Process a number of periods from the data read by #preloadInputs
+     *
+     * Neither the input nor the output wave files are accessed, the output data is discarded.
+     * This is the timed loop of the benchmark mode.
+     *
+     * @param[in] numPeriods Number of periods to be processed
+     */
+    IasResult processPreloadedPeriods(uint32_t numPeriods);
+
     /*!
      *  @brief Get test framework routing zone parameters.
      */
@@ -228,6 +245,10 @@ class IasTestFrameworkRoutingZone
      */
     IasResult writeDataIntoWaveFile(IasTestFrameworkWaveFilePtr waveFile, IasAudioRingBuffer* buffer, uint32_t numFrames, uint32_t& numFramesWritten);
 
+    IasResult readPreloadedData(IasTestFrameworkWaveFilePtr waveFile, IasAudioRingBuffer* buffer, uint32_t numFrames);
+
+    IasResult discardOutputData(IasAudioRingBuffer* buffer);
+
     DltContext                            *mLog;
     IasTestFrameworkRoutingZoneParamsPtr  mParams;
     IasRingBufferParamsMap                mInputBufferParamsMap;
@@ -12,6 +12,7 @@
 #define IAS_TEST_FRAMEWORK_WAVE_FILE_HPP_
 
 #include <sndfile.h>
+#include <vector>
 
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "testfwx/IasTestFrameworkTypes.hpp"
@@ -89,6 +90,31 @@ class IasTestFrameworkWaveFile
      */
     IasResult readFrames(IasAudioArea* area, uint32_t offset, uint32_t numFrames, uint32_t& numFramesRead);
 
+    /**
+     * @brief Read data from the current file position into memory
+     *
+     * Used by the benchmark mode to keep the file access out of the timed processing loop.
+     *
+     * @param[in] maxNumFrames Maximum number of frames to be read
+     *
+     * @returns error code
+     * @retval eIasFailed   operation failed, e.g. the file does not contain any frames
+     * @retval eIasOk       everything went well
+     */
+    IasResult preload(uint32_t maxNumFrames);
+
+    /**
+     * @brief Read data from the memory filled by #preload
+     *
+     * The preloaded data is played in a loop, i.e. the method always provides numFrames frames.
+     * The method neither allocates memory nor accesses the file.
+     *
+     * @param[in] area      Area where the data should be written
+     * @param[in] offset    Offset for the area
+     * @param[in] numFrames Number of frames to be read
+     */
+    void readPreloadedFrames(IasAudioArea* area, uint32_t offset, uint32_t numFrames);
+
     /**
      * @brief Write data into wave file
      *
@@ -173,6 +199,10 @@ class IasTestFrameworkWaveFile
     IasAudioSourceDevicePtr            mDummySourceDevice;  //!< dummy source device
     IasAudioSinkDevicePtr              mDummySinkDevice;    //!< dummy sink device
     IasAudioPinPtr                     mAudioPin;           //!< linked audio pin
+    std::vector<float>                 mPreloadBuffer;      //!< interleaved frames filled by preload
+    std::vector<IasAudioArea>          mPreloadArea;        //!< areas describing the current position in mPreloadBuffer
+    uint32_t                           mPreloadNumFrames;   //!< number of frames in mPreloadBuffer
+    uint32_t                           mPreloadPosition;    //!< read position in mPreloadBuffer
 };
 
 
@@ -56,6 +56,19 @@ class IAS_AUDIO_PUBLIC IasVolumeCmdInterface : public IasIModuleId
      */
     virtual IasIModuleId::IasResult processCmd(const IasProperties &cmdProperties, IasProperties &returnProperties);
 
+    /**
+     * @brief The volume can be sent via the fast command path.
+     */
+    virtual bool isFastCmd(int32_t cmdId) const;
+
+    /**
+     * @brief Process a volume command, the value is given in dB/10.
+     *
+     * The volume is ramped with the ramp parameters of the handle. With the ramp time 0, the volume is
+     * ramped linearly within cFastCmdVolumeRampTime.
+     */
+    virtual IasIModuleId::IasResult processFastCmd(const IasCmdHandle &handle, float value);
+
   private:
     /*!
      *  @brief Copy constructor, private unimplemented to prevent misuse.
@@ -91,6 +104,8 @@ class IAS_AUDIO_PUBLIC IasVolumeCmdInterface : public IasIModuleId
     IasIModuleId::IasResult getLoudnessFilter(const IasProperties &cmdProperties, IasProperties &returnProperties);
     IasIModuleId::IasResult setSdvTable(const IasProperties &cmdProperties, IasProperties &returnProperties);
     IasIModuleId::IasResult getSdvTable(const IasProperties &cmdProperties, IasProperties &returnProperties);
+    IasIModuleId::IasResult checkRampParams(int32_t rampTime, IasRampShapes rampShape);
+    IasIModuleId::IasResult applyVolume(int32_t streamId, float volumedb, int32_t rampTime, IasRampShapes rampShape);
     IasIModuleId::IasResult getParameters(const IasProperties &cmdProperties, IasProperties &returnProperties);
     IasIModuleId::IasResult setParameters(const IasProperties &cmdProperties, IasProperties &returnProperties);
 
@@ -12,6 +12,7 @@
 #ifndef IASVOLUMEHELPER_HPP_
 #define IASVOLUMEHELPER_HPP_
 
+#include <vector>
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 
 namespace IasAudio {
@@ -20,6 +21,8 @@ class IasProperties;
 struct IasVolumeLoudnessTable;
 struct IasAudioFilterConfigParams;
 struct IasVolumeSDVTable;
+struct IasVolumeLoudnessGainTable;
+struct IasVolumeSDVGainTable;
 
 namespace IasVolumeHelper {
 
@@ -33,6 +36,41 @@ IAS_AUDIO_PUBLIC bool getSDVTableFromProperties(const IasProperties &properties,
 IAS_AUDIO_PUBLIC void getDefaultSDVTable(IasVolumeSDVTable &sdvTable);
 IAS_AUDIO_PUBLIC void setSDVTableInProperties(const IasVolumeSDVTable &sdvTable, IasProperties &properties);
 IAS_AUDIO_PUBLIC bool checkLoudnessFilterParams(IasAudioFilterConfigParams &params);
+
+/**
+ * @brief Convert a linear volume into [dB/10], limited to cIasMinLoudnessVolume.
+ */
+IAS_AUDIO_PUBLIC float convertVolumeToDb(float volume);
+
+/**
+ * @brief Interpolate the linear loudness gain of a volume in [dB/10] from a loudness table.
+ */
+IAS_AUDIO_PUBLIC float interpolateLoudnessGain(int32_t volume, const IasVolumeLoudnessTable &table);
+
+/**
+ * @brief Precompute the loudness gains of a loudness table, called before the table is passed to the real-time thread.
+ */
+IAS_AUDIO_PUBLIC void buildLoudnessGainTable(const IasVolumeLoudnessTable &table, IasVolumeLoudnessGainTable *gainTable);
+
+/**
+ * @brief Read the linear loudness gain of a volume in [dB/10] from the precomputed gains of a loudness table.
+ */
+IAS_AUDIO_PUBLIC float getLoudnessGain(int32_t volume, const IasVolumeLoudnessGainTable &gainTable);
+
+/**
+ * @brief Interpolate the sdv gain in [dB/10] of a speed in km/h from the gains for increasing or decreasing speed.
+ */
+IAS_AUDIO_PUBLIC float interpolateSDV_GainDb(uint32_t speed, const IasVolumeSDVTable &table, const std::vector<uint32_t> &gainVec);
+
+/**
+ * @brief Precompute the gains of a sdv table, called before the table is passed to the real-time thread.
+ */
+IAS_AUDIO_PUBLIC void buildSDVGainTable(const IasVolumeSDVTable &table, IasVolumeSDVGainTable *gainTable);
+
+/**
+ * @brief Convert a sdv gain in [dB/10] into a linear gain with the precomputed gains of a sdv table.
+ */
+IAS_AUDIO_PUBLIC float getSDV_LinearGain(float gainDb, const IasVolumeSDVGainTable &gainTable);
 } // namespace IasVolumeHelper
 
 } // namespace IasAudio
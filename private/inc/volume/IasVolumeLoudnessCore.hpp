@@ -16,6 +16,7 @@
 #include "audio/smartx/rtprocessingfwx/IasAudioStream.hpp"
 #include "audio/smartx/rtprocessingfwx/IasGenericAudioCompCore.hpp"
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "helper/IasParameterMailbox.hpp"
 
 // disable conversion warnings for tbb
 #pragma GCC diagnostic push
@@ -29,6 +30,11 @@ namespace IasAudio{
 const uint32_t cIasAudioLoudnessTableDefaultLength = 10;
 const uint32_t cIasAudioMaxSDVTableLength = 40;
 
+const int32_t cIasMinLoudnessVolume = -1440;                     //!< lowest volume in [dB/10] used for the loudness tables
+const int32_t cIasInvalidLoudnessVolume = INT32_MIN;             //!< marks that the loudness filters have to be updated
+const uint32_t cIasMaxSDVGainTableSpeed = 1000;                  //!< highest speed in km/h with a precomputed sdv gain
+const float cIasSDVGainTableStep = 0.1f;                          //!< step in [dB/10] of the precomputed linear sdv gains
+
 const uint32_t cMinLoudnessFilterFreq = 10;
 const uint32_t cMaxLoudnessFilterFreq = 20000;
 
@@ -40,6 +46,7 @@ const uint32_t cMinLoudnessFilterOrder = 1;
 
 const int32_t cMinRampTime = 1;
 const int32_t cMaxRampTime = 10000;
+const int32_t cFastCmdVolumeRampTime = 20;  // ramp time in ms of volume changes sent via the fast command path
 
 const std::list<IasAudioFilterTypes> cLoudnessFilterAllowedTypes = {eIasFilterTypePeak,eIasFilterTypeLowShelving,eIasFilterTypeHighShelving};
 
@@ -64,6 +71,18 @@ struct IasVolumeLoudnessTable
     std::vector<int32_t>  volumes;        //!< Volume, expressed linear
 };
 
+/**
+ * @brief Precomputed linear gains of a loudness table, one entry per volume step of 0.1 dB
+ *
+ * Entry i holds the loudness gain for the volume maxVolume-i [dB/10]. Louder volumes use the
+ * first entry, quieter volumes use the last entry.
+ */
+struct IasVolumeLoudnessGainTable
+{
+    int32_t               maxVolume;      //!< Volume of the first entry in [dB/10]
+    std::vector<float>    gains;          //!< Loudness gains, expressed linear
+};
+
 /**
  * @brief struct defining the table for speed dependent volume
  *
@@ -77,12 +96,31 @@ struct IasVolumeSDVTable
     std::vector<uint32_t> gain_dec;  //!< the gain values for decreasing speed
 };
 
+/**
+ * @brief Precomputed gains of a sdv table, one entry per km/h
+ *
+ * The entries cover the speeds up to the last data point of the table, limited to cIasMaxSDVGainTableSpeed.
+ * The gains in [dB/10] and the conversion table linearGains are used if the sdv gain is reduced because of
+ * a high user volume, and for speeds beyond the precomputed range. Entry i of linearGains holds the linear
+ * gain of i*cIasSDVGainTableStep [dB/10], up to the highest gain of the table.
+ */
+struct IasVolumeSDVGainTable
+{
+    std::vector<float>    gain_inc;      //!< the gains for increasing speed, expressed linear
+    std::vector<float>    gain_dec;      //!< the gains for decreasing speed, expressed linear
+    std::vector<float>    gainDb_inc;    //!< the gains for increasing speed in [dB/10]
+    std::vector<float>    gainDb_dec;    //!< the gains for decreasing speed in [dB/10]
+    std::vector<float>    linearGains;   //!< linear gains in steps of cIasSDVGainTableStep [dB/10]
+    float                 criticalVolumeDb;  //!< user volume in [dB/10] above which the sdv gain is reduced
+};
+
 /**
  *  @brief Struct defining an element of the queue for setVolume commands
  */
 struct IasVolumeQueueEntry
 {
   float         volume;
+  float         volumeDb;       //!< the volume in [dB/10], computed by the command thread
   uint32_t      rampTime;
   IasRampShapes rampShape;
   int32_t       streamId;
@@ -124,6 +162,16 @@ struct IasLoudnessTableQueueEntry
 {
   uint32_t band;
   IasVolumeLoudnessTable table;
+  IasVolumeLoudnessGainTable gainTable;
+};
+
+/**
+ *  @brief Struct defining an element of the queue for setSDVTable commands
+ */
+struct IasSDVTableQueueEntry
+{
+  IasVolumeSDVTable table;
+  IasVolumeSDVGainTable gainTable;
 };
 
 struct IasLoudnessFilterQueueEntry
@@ -199,6 +247,7 @@ struct IasVolumeParams
   float                         currentVolume;
   float                         muteVolume;
   float                         destinationVolume;
+  float                         destinationVolumeDb;  //!< destinationVolume in [dB/10]
   float                         currentSDVGain;
   float                         currentMuteGain;
   uint32_t                      numSamplesLeftToRamp;
@@ -213,6 +262,7 @@ struct IasVolumeParams
   bool                          lastRunSDV;
   bool                          lastRunMute;
   bool                          activeLoudness;
+  int32_t                       loudnessVolume;   //!< volume in [dB/10] the loudness filters were updated for
   std::vector<IasVolumeRampParams>    mVolumeRampParamsVector;
   std::vector<IasAudioFilter**> filters;
 };
@@ -510,21 +560,27 @@ class IAS_AUDIO_PUBLIC IasVolumeLoudnessCore : public IasGenericAudioCompCore
     void updateLoudness(int32_t streamId, float volume);
 
     /*!
-     * @brief internal function to read the current loudness gain from a loudness table that fits to input parameter
-     *        volume
+     * @brief internal function to convert a linear volume into the [dB/10] steps of the loudness tables
+     *
      * @param volume the volume as linear value
-     * @param table the table from where the loudness gain should be read
-     * @return gain the loudness gain as linear value
+     * @return the volume in [dB/10], limited to -1440
      */
-    float getLoudnessGain(float volume, IasVolumeLoudnessTable* table);
+    static int32_t convertVolumeToLoudnessVolume(float volume);
 
     /*!
-     * @brief internal function to read the current sdv gain from the table that fits to input parameter
-     *        speed
+     * @brief internal function to read the current sdv gain from the precomputed gains that fits to input parameter
+     *        speed, reduced by mSDVReduction
+     *
      * @param speed the speed as linear value in km/h
+     * @param increasing true for the gains for increasing speed, false for the gains for decreasing speed
      * @return gain the sdv gain as linear value
      */
-    float getSDV_Gain(uint32_t speed,std::vector<uint32_t> *gainVec);
+    float getSDV_Gain(uint32_t speed, bool increasing) const;
+
+    /*!
+     * @brief internal function to update mSDVReduction after the maximum user volume or the sdv table changed
+     */
+    void updateSDVReduction();
 
     /*!
      * @brief internally used to calculate new sdv gain
@@ -550,11 +606,12 @@ class IAS_AUDIO_PUBLIC IasVolumeLoudnessCore : public IasGenericAudioCompCore
      *
      * @param[in] streamId the id of the stream
      * @param[in] volume the new desired volume
+     * @param[in] volumeDb the new desired volume in [dB/10]
      * @param[in] rampTime the length of the ramp
      * @param[in] rampShape the shape of the ramp
      *
      */
-    void updateVolume( int32_t streamId, float volume, uint32_t rampTime, IasRampShapes rampShape);
+    void updateVolume( int32_t streamId, float volume, float volumeDb, uint32_t rampTime, IasRampShapes rampShape);
 
     /*!
      * @brief function to trigger the new loudness state
@@ -582,18 +639,24 @@ class IAS_AUDIO_PUBLIC IasVolumeLoudnessCore : public IasGenericAudioCompCore
     /*!
      * @brief function to update sdv table
      *
-     * @param[in] table the new sdv value
+     * The content of the new table and its precomputed gains is swapped with the current table,
+     * so no memory is allocated.
+     *
+     * @param[in,out] entry the new sdv table, contains the previous table afterwards
      */
-    void updateSDVTable(IasVolumeSDVTable table);
+    void updateSDVTable(IasSDVTableQueueEntry &entry);
 
     /*!
      * @brief function to update loudness table
      *
-     * @param[in] streamId the id of the stream
-     * @param[in] table the new loudness value
+     * The content of the new table and its precomputed gains is swapped with the current table,
+     * so no memory is allocated.
+     *
+     * @param[in] band the filter band
+     * @param[in,out] entry the new loudness table, contains the previous table afterwards
      *
      */
-    void updateLoudnessTable(uint32_t band, IasVolumeLoudnessTable table);
+    void updateLoudnessTable(uint32_t band, IasLoudnessTableQueueEntry &entry);
 
     /*!
      * @brief function to update loudness filter
@@ -605,7 +668,7 @@ class IAS_AUDIO_PUBLIC IasVolumeLoudnessCore : public IasGenericAudioCompCore
     void updateLoudnessFilter(uint32_t band, IasAudioFilterConfigParams params);
 
     /*!
-     * @brief function to check if there are entries in the command queues
+     * @brief function to apply the latest values of the command mailboxes
      */
     void checkQueues();
 
@@ -674,19 +737,22 @@ class IAS_AUDIO_PUBLIC IasVolumeLoudnessCore : public IasGenericAudioCompCore
     IasAudioStreamVector                               mStreams;                //!< vector carrying the pointers to the announced streams;
     IasBundleIndexMap                                  mBundleIndexMap;         //!< map used for addressing correct bundle
     std::vector<IasVolumeLoudnessTable>                mLoudnessTableVector;    //!< the loudness tables for the different filter bands
+    std::vector<IasVolumeLoudnessGainTable>            mLoudnessGainTables;     //!< the precomputed gains of the loudness tables
     IasVolumeCallbackMap                               mCallbackMap;            //!< parameter map used for sending ufipc events
     IasVolumeSDVTable                                  mSDVTable;               //!< the sdv table structure
+    IasVolumeSDVGainTable                              mSDVGainTable;           //!< the precomputed gains of the sdv table
     float                                              mMaxVolume;              //!< maximum user volume currently set
-    float                                              mVolumeSDV_Critical;     //!< user volume, where sdv gain MUST be 1.0 to avoid overflow
+    float                                              mMaxVolumeDb;            //!< mMaxVolume in [dB/10]
+    float                                              mSDVReduction;           //!< factor for the sdv gains in [dB/10], 1.0 if the maximum user volume is not above the critical volume
     std::vector<IasAudioFilterConfigParams>            mLoudnessFilterParams;   //!< vector carrying the filter parameters for the loudness bands
-    tbb::concurrent_queue<IasVolumeQueueEntry>         mVolumeQueue;            //!< queue for volume commands>
-    tbb::concurrent_queue<IasMuteQueueEntry>           mMuteQueue;              //!< queue for mute commands>
-    tbb::concurrent_queue<IasLoudnessStateQueueEntry>  mLoudnessStateQueue;     //!< queue for loudness on/off commands>
-    tbb::concurrent_queue<uint32_t>                    mSpeedQueue;             //!< queue for speed commands>
-    tbb::concurrent_queue<IasSDVStateQueueEntry>       mSDVStateQueue;          //!< queue for sdv state change commands>
-    tbb::concurrent_queue<IasVolumeSDVTable>           mSDVTableQueue;          //!< queue for sdv table commands>
-    tbb::concurrent_queue<IasLoudnessTableQueueEntry>  mLoudnessTableQueue;     //!< queue for loudness table commands>
-    tbb::concurrent_queue<IasLoudnessFilterQueueEntry> mLoudnessFilterQueue;    //!< queue for loudness filter commands>
+    IasParameterMailboxMap<int32_t, IasVolumeQueueEntry>          mVolumeMailboxes;        //!< latest volume command per stream
+    IasParameterMailboxMap<int32_t, IasMuteQueueEntry>            mMuteMailboxes;          //!< latest mute command per stream
+    IasParameterMailboxMap<int32_t, IasLoudnessStateQueueEntry>   mLoudnessStateMailboxes; //!< latest loudness on/off command per stream
+    IasParameterMailbox<uint32_t>                                 mSpeedMailbox;           //!< latest speed command
+    IasParameterMailboxMap<int32_t, IasSDVStateQueueEntry>        mSDVStateMailboxes;      //!< latest sdv state change command per stream
+    IasParameterMailbox<IasSDVTableQueueEntry>                    mSDVTableMailbox;        //!< latest sdv table command
+    IasParameterMailboxMap<uint32_t, IasLoudnessTableQueueEntry>  mLoudnessTableMailboxes; //!< latest loudness table command per filter band
+    IasParameterMailboxMap<uint32_t, IasLoudnessFilterQueueEntry> mLoudnessFilterMailboxes;//!< latest loudness filter command per filter band
     std::string                                        mTypeName;               //!< Name of the module type
     std::string                                        mInstanceName;           //!< Name of the module instance
     DltContext                                        *mLogContext;             //!< The log context for the volume component.
@@ -45,6 +45,10 @@ IasAlsaHandlerWorkerThread::IasAlsaHandlerWorkerThread(IasAlsaHandlerWorkerThrea
   ,mThreadIsRunning(false)
   ,mSrc(nullptr)
   ,mSrcController(nullptr)
+  ,mAsrcFillController()
+  ,mAsrcAdaptive(false)
+  ,mAsrcMinFill(0)
+  ,mAsrcMaxFill(0)
   ,mSrcInputBuffersFloat32(nullptr)
   ,mSrcInputBuffersInt32(nullptr)
   ,mSrcInputBuffersInt16(nullptr)
@@ -112,6 +116,16 @@ IasAlsaHandlerWorkerThread::IasResult IasAlsaHandlerWorkerThread::init(IasDevice
     }
   }
 
+  const IasConfigFile::IasAlsaHandlerAsrcParams* asrcParams = IasConfigFile::getInstance()->getAlsaHandlerAsrcParams(mParams->name);
+  if (asrcParams != nullptr)
+  {
+    mAsrcAdaptive = asrcParams->adaptive;
+    mAsrcMinFill = asrcParams->minFill;
+    mAsrcMaxFill = asrcParams->maxFill;
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "ASRC buffer target fill level adaptive:", mAsrcAdaptive,
+                "minFill:", mAsrcMinFill, "maxFill:", mAsrcMaxFill);
+  }
+
   if (mThread == nullptr)
   {
     mThread = new IasThread(this, mParams->name);
@@ -208,7 +222,7 @@ IasAudioCommonResult IasAlsaHandlerWorkerThread::beforeRun()
 IasAudioCommonResult IasAlsaHandlerWorkerThread::run()
 {
   IasThreadNames::getInstance()->setThreadName(IasThreadNames::eIasRealTime, "ALSA handler worker thread for ALSA device " + mParams->name);
-  IasConfigFile::configureThreadSchedulingParameters(mLog);
+  IasConfigFile::configureThreadSchedulingParameters(mLog, IasConfigFile::eIasThreadRoleAlsaHandler, mParams->name);
 
   IasAudioRingBufferResult result;
   IasAudioRingBuffer*      deviceBufferHandle = mParams->deviceBufferParams.ringBuffer;
@@ -238,6 +252,12 @@ IasAudioCommonResult IasAlsaHandlerWorkerThread::run()
   // since the number of virtual samples is somewhere between 0 and periodSize.
   uint32_t asrcBufferTargetLevel = (asrcBufferLength + mParams->asrcBufferParams.periodSize) >> 1;
 
+  // If configured, the target level is adapted to the observed jitter. The adaptation starts at the fixed
+  // target level, limited to the configured bounds, and evaluates the fill level four times per second.
+  mAsrcFillController.init(mParams->asrcBufferParams.periodSize, asrcBufferLength, asrcBufferTargetLevel,
+                            mAsrcAdaptive, mAsrcMinFill, mAsrcMaxFill, std::max(mLogInterval >> 2, 1u));
+  asrcBufferTargetLevel = mAsrcFillController.getTarget();
+
   IasSrcController::IasResult srcControllerResult = mSrcController->setJitterBufferParams(asrcBufferLength, asrcBufferTargetLevel);
   IAS_ASSERT(srcControllerResult == IasSrcController::eIasOk);
   (void)srcControllerResult;
@@ -394,6 +414,7 @@ IasAudioCommonResult IasAlsaHandlerWorkerThread::run()
       while (asrcBufferNumFramesAvailable >= asrcBufferTargetLevel);
       reset();
       mSrcController->reset();
+      mAsrcFillController.resetWindow();
     }
 
     IasAudioTimestamp  audioTimestampDeviceBuffer;
@@ -467,6 +488,15 @@ IasAudioCommonResult IasAlsaHandlerWorkerThread::run()
         IasSrcController::IasResult srcControllerResult = mSrcController->process(&ratioAdaptive, &outputActive, numTotalFrames);
         IAS_ASSERT(srcControllerResult == IasSrcController::eIasOk);
         (void)srcControllerResult;
+
+        if (mAsrcFillController.update(numTotalFrames))
+        {
+          asrcBufferTargetLevel = mAsrcFillController.getTarget();
+          srcControllerResult = mSrcController->setJitterBufferParams(asrcBufferLength, asrcBufferTargetLevel);
+          IAS_ASSERT(srcControllerResult == IasSrcController::eIasOk);
+          DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE,
+                      "New ASRC buffer target level:", asrcBufferTargetLevel, "frames, jitter:", mAsrcFillController.getJitter(), "frames");
+        }
       }
       else
       {
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasAsrcFillController.cpp
+ * @date   2018
+ * @brief  Adaptation of the target fill level of the ASRC buffer of an asynchronous ALSA handler.
+ */
+
+#include <algorithm>
+#include <limits>
+#include "alsahandler/IasAsrcFillController.hpp"
+
+namespace IasAudio {
+
+/**
+ * @brief Number of consecutive windows that allow a lower target before the target is lowered by one step.
+ */
+static const uint32_t cNumLowerWindowsToLower = 8;
+
+/**
+ * @brief The jitter envelope decays by 1/2^cJitterDecayShift per window.
+ */
+static const uint32_t cJitterDecayShift = 6;
+
+
+IasAsrcFillController::IasAsrcFillController()
+  :mPeriodSize(0)
+  ,mWindowLength(1)
+  ,mAdaptive(false)
+  ,mTargetMin(0)
+  ,mTargetMax(0)
+  ,mTarget(0)
+  ,mJitter(0)
+  ,mNumMeasurements(0)
+  ,mSumFill(0)
+  ,mLowestFill(0)
+  ,mNumLowerWindows(0)
+{
+  resetWindow();
+}
+
+IasAsrcFillController::~IasAsrcFillController()
+{
+}
+
+void IasAsrcFillController::init(uint32_t periodSize, uint32_t bufferLength, uint32_t defaultTarget,
+                                 bool adaptive, uint32_t minTarget, uint32_t maxTarget, uint32_t windowLength)
+{
+  mPeriodSize = periodSize;
+  mWindowLength = std::max(windowLength, 1u);
+  mAdaptive = adaptive;
+  const uint32_t highestTarget = (bufferLength > periodSize) ? bufferLength - periodSize : bufferLength;
+  mTargetMax = (maxTarget != 0) ? std::min(maxTarget, bufferLength) : highestTarget;
+  mTargetMin = (minTarget != 0) ? minTarget : periodSize + (periodSize >> 1);
+  mTargetMin = std::min(mTargetMin, mTargetMax);
+  mTarget = defaultTarget;
+  if (mAdaptive == true)
+  {
+    mTarget = std::max(mTargetMin, std::min(mTarget, mTargetMax));
+  }
+  mJitter = 0;
+  mNumLowerWindows = 0;
+  resetWindow();
+}
+
+bool IasAsrcFillController::update(uint32_t numTotalFrames)
+{
+  if (mAdaptive == false)
+  {
+    return false;
+  }
+  mSumFill += numTotalFrames;
+  mLowestFill = std::min(mLowestFill, numTotalFrames);
+  mNumMeasurements++;
+  if (mNumMeasurements < mWindowLength)
+  {
+    return false;
+  }
+
+  // The deviation below the mean of the window is caused by jitter, while the mean itself follows the
+  // target of the closed-loop controller. Therefore, moving the target does not feed back into the jitter.
+  const uint32_t meanFill = static_cast<uint32_t>(mSumFill / mNumMeasurements);
+  const uint32_t windowJitter = (meanFill > mLowestFill) ? meanFill - mLowestFill : 0;
+  const uint32_t decayedJitter = mJitter - ((mJitter + (1u << cJitterDecayShift) - 1) >> cJitterDecayShift);
+  mJitter = std::max(windowJitter, decayedJitter);
+
+  uint32_t requiredTarget = mPeriodSize + mJitter + (mJitter >> 1);
+  requiredTarget = std::max(mTargetMin, std::min(requiredTarget, mTargetMax));
+
+  // The target is only lowered if it is at least one step above the required target. Therefore, the target
+  // settles up to one step above the required target and small variations of the jitter do not move it.
+  const uint32_t step = std::max(mPeriodSize >> 3, 1u);
+  bool targetChanged = false;
+  if (requiredTarget > mTarget)
+  {
+    mTarget = requiredTarget;
+    mNumLowerWindows = 0;
+    targetChanged = true;
+  }
+  else if (requiredTarget + step <= mTarget)
+  {
+    mNumLowerWindows++;
+    if (mNumLowerWindows >= cNumLowerWindowsToLower)
+    {
+      mTarget -= step;
+      mNumLowerWindows = 0;
+      targetChanged = true;
+    }
+  }
+  else
+  {
+    mNumLowerWindows = 0;
+  }
+  resetWindow();
+  return targetChanged;
+}
+
+void IasAsrcFillController::resetWindow()
+{
+  mNumMeasurements = 0;
+  mSumFill = 0;
+  mLowestFill = std::numeric_limits<uint32_t>::max();
+}
+
+} //namespace IasAudio
@@ -149,6 +149,14 @@ IasConfigParserResult parseSinkDevices(IasISetup *setup, const xmlNodePtr rootNo
                return IasConfigParserResult::eIasFailed;
              }
 
+             //Set the optional sink prefill of the routing zone
+             result = sinkDeviceList.at(numSinkDevices).setRoutingZonePrefill(setup, sink_rz_node);
+             if (result != IasConfigSinkDevice::eIasOk)
+             {
+               DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "setRoutingZonePrefill Failed");
+               return IasConfigParserResult::eIasFailed;
+             }
+
              //Parse routing zone ports
              xmlNodePtr cur_rz_port = nullptr;
              for (cur_rz_port = sink_rz_node->children; cur_rz_port != nullptr ; cur_rz_port = cur_rz_port->next)
@@ -172,6 +172,56 @@ IasConfigSinkDevice::IasResult IasConfigSinkDevice::createLinkRoutingZone(IasISe
   return IasResult::eIasOk;
 }
 
+IasConfigSinkDevice::IasResult IasConfigSinkDevice::setRoutingZonePrefill(IasISetup *setup, xmlNodePtr routingZoneNode)
+{
+  if (setup == nullptr || routingZoneNode == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: setup == nullptr || routingZoneNode == nullptr");
+    return IasResult::eIasFailed;
+  }
+  std::string prefill_frames = getXmlAttributePtr(routingZoneNode, "prefill_frames");
+  std::string prefill_adaptive = getXmlAttributePtr(routingZoneNode, "prefill_adaptive");
+  std::string prefill_min_frames = getXmlAttributePtr(routingZoneNode, "prefill_min_frames");
+  std::string prefill_max_frames = getXmlAttributePtr(routingZoneNode, "prefill_max_frames");
+  if (prefill_frames.empty() && prefill_adaptive.empty() && prefill_min_frames.empty() && prefill_max_frames.empty())
+  {
+    return IasResult::eIasOk;
+  }
+
+  IasISetup::IasSinkPrefillParams prefillParams;
+  try
+  {
+    if (!prefill_frames.empty())
+    {
+      prefillParams.numFrames = stoi(prefill_frames);
+    }
+    if (!prefill_min_frames.empty())
+    {
+      prefillParams.minFrames = stoi(prefill_min_frames);
+    }
+    if (!prefill_max_frames.empty())
+    {
+      prefillParams.maxFrames = stoi(prefill_max_frames);
+    }
+  }
+  catch(...)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error in setRoutingZonePrefill");
+    return IasResult::eIasFailed;
+  }
+  prefillParams.adaptive = (prefill_adaptive == "true");
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "prefill_frames: ", prefillParams.numFrames, "prefill_adaptive: ", prefillParams.adaptive,
+              "prefill_min_frames: ", prefillParams.minFrames, "prefill_max_frames: ", prefillParams.maxFrames);
+
+  IasISetup::IasResult result = setup->setSinkPrefill(mRoutingZone, prefillParams);
+  if (result != IasISetup::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error setting sink prefill of routing zone: ", mRoutingZoneParams.name, ": ",  toString(result));
+    return IasResult::eIasFailed;
+  }
+  return IasResult::eIasOk;
+}
+
 
 IasConfigSinkDevice::IasResult IasConfigSinkDevice::setZonePortParams(IasISetup *setup, xmlNodePtr routingZonePortNode, xmlNodePtr setupLinksNode)
 {
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasRoutingRecorder.cpp
+ * @date   2018
+ * @brief  smartXConfigParser: Decorator for the IasIRouting instance that records the connections for the IasTopologyCache
+ */
+
+#include "configparser/IasRoutingRecorder.hpp"
+
+namespace IasAudio {
+
+IasRoutingRecorder::IasRoutingRecorder(IasIRouting *routing, IasTopologyCache *cache)
+  :mRouting(routing)
+  ,mCache(cache)
+{
+  IAS_ASSERT(mRouting != nullptr);
+  IAS_ASSERT(mCache != nullptr);
+}
+
+IasRoutingRecorder::~IasRoutingRecorder()
+{
+}
+
+IasRoutingRecorder::IasResult IasRoutingRecorder::connect(std::int32_t sourceId, std::int32_t sinkId)
+{
+  IasResult result = mRouting->connect(sourceId, sinkId);
+  if (result == eIasOk)
+  {
+    mCache->addConnection(sourceId, sinkId);
+  }
+  return result;
+}
+
+IasRoutingRecorder::IasResult IasRoutingRecorder::disconnect(std::int32_t sourceId, std::int32_t sinkId)
+{
+  mCache->invalidate(__func__);
+  return mRouting->disconnect(sourceId, sinkId);
+}
+
+IasConnectionVector IasRoutingRecorder::getActiveConnections() const
+{
+  return mRouting->getActiveConnections();
+}
+
+IasDummySourcesSet IasRoutingRecorder::getDummySources() const
+{
+  return mRouting->getDummySources();
+}
+
+} //namespace IasAudio
@@ -0,0 +1,580 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasSetupRecorder.cpp
+ * @date   2018
+ * @brief  smartXConfigParser: Decorator for the IasISetup instance that records the topology for the IasTopologyCache
+ */
+
+#include "configparser/IasSetupRecorder.hpp"
+
+namespace IasAudio {
+
+IasSetupRecorder::IasSetupRecorder(IasISetup *setup, IasTopologyCache *cache)
+  :mSetup(setup)
+  ,mCache(cache)
+  ,mHandles()
+  ,mNextHandle(0)
+{
+  IAS_ASSERT(mSetup != nullptr);
+  IAS_ASSERT(mCache != nullptr);
+}
+
+IasSetupRecorder::~IasSetupRecorder()
+{
+}
+
+void IasSetupRecorder::addHandle(const void *object)
+{
+  mHandles[object] = mNextHandle++;
+}
+
+bool IasSetupRecorder::appendHandle(const void *object, IasTopologyCache::IasOp *op)
+{
+  auto it = mHandles.find(object);
+  if (it == mHandles.end())
+  {
+    mCache->invalidate("object not created via the recorder");
+    return false;
+  }
+  op->handles.push_back(it->second);
+  return true;
+}
+
+void IasSetupRecorder::record(IasResult result, IasTopologyCache::IasOpType type, const void *first, const void *second)
+{
+  if (result != eIasOk)
+  {
+    return;
+  }
+  IasTopologyCache::IasOp op(type);
+  if (appendHandle(first, &op) && appendHandle(second, &op))
+  {
+    mCache->addOp(op);
+  }
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::createRoutingZone(const IasRoutingZoneParams &params, IasRoutingZonePtr *routingZone)
+{
+  IasResult result = mSetup->createRoutingZone(params, routingZone);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpCreateRoutingZone);
+    op.strings.push_back(params.name);
+    mCache->addOp(op);
+    addHandle(routingZone->get());
+  }
+  return result;
+}
+
+void IasSetupRecorder::destroyRoutingZone(IasRoutingZonePtr routingZone)
+{
+  mCache->invalidate(__func__);
+  mSetup->destroyRoutingZone(routingZone);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::startRoutingZone(IasRoutingZonePtr routingZone)
+{
+  return mSetup->startRoutingZone(routingZone);
+}
+
+void IasSetupRecorder::stopRoutingZone(IasRoutingZonePtr routingZone)
+{
+  mCache->invalidate(__func__);
+  mSetup->stopRoutingZone(routingZone);
+}
+
+/**
+ * @brief Create the operation that records the creation of an audio device
+ */
+static IasTopologyCache::IasOp deviceOp(IasTopologyCache::IasOpType type, const IasAudioDeviceParams &params)
+{
+  IasTopologyCache::IasOp op(type);
+  op.strings.push_back(params.name);
+  op.values.push_back(params.numChannels);
+  op.values.push_back(params.samplerate);
+  op.values.push_back(params.dataFormat);
+  op.values.push_back(params.clockType);
+  op.values.push_back(params.periodSize);
+  op.values.push_back(params.numPeriods);
+  op.values.push_back(params.numPeriodsAsrcBuffer);
+  return op;
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::createAudioSourceDevice(const IasAudioDeviceParams &params, IasAudioSourceDevicePtr *audioSourceDevice)
+{
+  IasResult result = mSetup->createAudioSourceDevice(params, audioSourceDevice);
+  if (result == eIasOk)
+  {
+    mCache->addOp(deviceOp(IasTopologyCache::eIasOpCreateSourceDevice, params));
+    addHandle(audioSourceDevice->get());
+  }
+  return result;
+}
+
+void IasSetupRecorder::destroyAudioSourceDevice(IasAudioSourceDevicePtr audioSourceDevice)
+{
+  mCache->invalidate(__func__);
+  mSetup->destroyAudioSourceDevice(audioSourceDevice);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::startAudioSourceDevice(IasAudioSourceDevicePtr audioSourceDevice)
+{
+  return mSetup->startAudioSourceDevice(audioSourceDevice);
+}
+
+void IasSetupRecorder::stopAudioSourceDevice(IasAudioSourceDevicePtr audioSourceDevice)
+{
+  mCache->invalidate(__func__);
+  mSetup->stopAudioSourceDevice(audioSourceDevice);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::createAudioSinkDevice(const IasAudioDeviceParams &params, IasAudioSinkDevicePtr *audioSinkDevice)
+{
+  IasResult result = mSetup->createAudioSinkDevice(params, audioSinkDevice);
+  if (result == eIasOk)
+  {
+    mCache->addOp(deviceOp(IasTopologyCache::eIasOpCreateSinkDevice, params));
+    addHandle(audioSinkDevice->get());
+  }
+  return result;
+}
+
+void IasSetupRecorder::destroyAudioSinkDevice(IasAudioSinkDevicePtr audioSinkDevice)
+{
+  mCache->invalidate(__func__);
+  mSetup->destroyAudioSinkDevice(audioSinkDevice);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::createAudioPort(const IasAudioPortParams &params, IasAudioPortPtr *audioPort)
+{
+  IasResult result = mSetup->createAudioPort(params, audioPort);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpCreateAudioPort);
+    op.strings.push_back(params.name);
+    op.values.push_back(params.numChannels);
+    op.values.push_back(params.id);
+    op.values.push_back(params.direction);
+    op.values.push_back(params.index);
+    mCache->addOp(op);
+    addHandle(audioPort->get());
+  }
+  return result;
+}
+
+void IasSetupRecorder::destroyAudioPort(IasAudioPortPtr audioPort)
+{
+  mCache->invalidate(__func__);
+  mSetup->destroyAudioPort(audioPort);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addDerivedZone(IasRoutingZonePtr baseZone, IasRoutingZonePtr derivedZone)
+{
+  IasResult result = mSetup->addDerivedZone(baseZone, derivedZone);
+  record(result, IasTopologyCache::eIasOpAddDerivedZone, baseZone.get(), derivedZone.get());
+  return result;
+}
+
+void IasSetupRecorder::deleteDerivedZone(IasRoutingZonePtr baseZone, IasRoutingZonePtr derivedZone)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteDerivedZone(baseZone, derivedZone);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::link(IasRoutingZonePtr routingZone, IasAudioSinkDevicePtr audioSinkDevice)
+{
+  IasResult result = mSetup->link(routingZone, audioSinkDevice);
+  record(result, IasTopologyCache::eIasOpLinkZoneToSink, routingZone.get(), audioSinkDevice.get());
+  return result;
+}
+
+void IasSetupRecorder::unlink(IasRoutingZonePtr routingZone, IasAudioSinkDevicePtr audioSinkDevice)
+{
+  mCache->invalidate(__func__);
+  mSetup->unlink(routingZone, audioSinkDevice);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addAudioOutputPort(IasAudioSourceDevicePtr audioSourceDevice, IasAudioPortPtr audioPort)
+{
+  IasResult result = mSetup->addAudioOutputPort(audioSourceDevice, audioPort);
+  record(result, IasTopologyCache::eIasOpAddSourceOutputPort, audioSourceDevice.get(), audioPort.get());
+  return result;
+}
+
+void IasSetupRecorder::deleteAudioOutputPort(IasAudioSourceDevicePtr audioSourceDevice, IasAudioPortPtr audioPort)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteAudioOutputPort(audioSourceDevice, audioPort);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addAudioInputPort(IasAudioSinkDevicePtr audioSinkDevice, IasAudioPortPtr audioPort)
+{
+  IasResult result = mSetup->addAudioInputPort(audioSinkDevice, audioPort);
+  record(result, IasTopologyCache::eIasOpAddSinkInputPort, audioSinkDevice.get(), audioPort.get());
+  return result;
+}
+
+void IasSetupRecorder::deleteAudioInputPort(IasAudioSinkDevicePtr audioSinkDevice, IasAudioPortPtr audioPort)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteAudioInputPort(audioSinkDevice, audioPort);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addAudioInputPort(IasRoutingZonePtr routingZone, IasAudioPortPtr audioPort)
+{
+  IasResult result = mSetup->addAudioInputPort(routingZone, audioPort);
+  record(result, IasTopologyCache::eIasOpAddZoneInputPort, routingZone.get(), audioPort.get());
+  return result;
+}
+
+void IasSetupRecorder::deleteAudioInputPort(IasRoutingZonePtr routingZone, IasAudioPortPtr audioPort)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteAudioInputPort(routingZone, audioPort);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::link(IasAudioPortPtr zoneInputPort, IasAudioPortPtr sinkDeviceInputPort)
+{
+  IasResult result = mSetup->link(zoneInputPort, sinkDeviceInputPort);
+  record(result, IasTopologyCache::eIasOpLinkPorts, zoneInputPort.get(), sinkDeviceInputPort.get());
+  return result;
+}
+
+void IasSetupRecorder::unlink(IasAudioPortPtr zoneInputPort, IasAudioPortPtr sinkDeviceInputPort)
+{
+  mCache->invalidate(__func__);
+  mSetup->unlink(zoneInputPort, sinkDeviceInputPort);
+}
+
+IasAudioPortVector IasSetupRecorder::getAudioInputPorts() const
+{
+  return mSetup->getAudioInputPorts();
+}
+
+IasAudioPortVector IasSetupRecorder::getAudioOutputPorts() const
+{
+  return mSetup->getAudioOutputPorts();
+}
+
+IasAudioPortVector IasSetupRecorder::getAudioPorts() const
+{
+  return mSetup->getAudioPorts();
+}
+
+IasAudioPinVector IasSetupRecorder::getAudioPins() const
+{
+  return mSetup->getAudioPins();
+}
+
+IasRoutingZoneVector IasSetupRecorder::getRoutingZones() const
+{
+  return mSetup->getRoutingZones();
+}
+
+IasAudioSourceDeviceVector IasSetupRecorder::getAudioSourceDevices() const
+{
+  return mSetup->getAudioSourceDevices();
+}
+
+IasAudioSinkDeviceVector IasSetupRecorder::getAudioSinkDevices() const
+{
+  return mSetup->getAudioSinkDevices();
+}
+
+IasRoutingZonePtr IasSetupRecorder::getRoutingZone(const std::string &name)
+{
+  return mSetup->getRoutingZone(name);
+}
+
+IasAudioSourceDevicePtr IasSetupRecorder::getAudioSourceDevice(const std::string &name)
+{
+  return mSetup->getAudioSourceDevice(name);
+}
+
+IasAudioSinkDevicePtr IasSetupRecorder::getAudioSinkDevice(const std::string &name)
+{
+  return mSetup->getAudioSinkDevice(name);
+}
+
+IasPipelinePtr IasSetupRecorder::getPipeline(const std::string &name)
+{
+  return mSetup->getPipeline(name);
+}
+
+void IasSetupRecorder::addSourceGroup(const std::string &name, int32_t id)
+{
+  mSetup->addSourceGroup(name, id);
+  IasTopologyCache::IasOp op(IasTopologyCache::eIasOpAddSourceGroup);
+  op.strings.push_back(name);
+  op.values.push_back(id);
+  mCache->addOp(op);
+}
+
+IasSourceGroupMap IasSetupRecorder::getSourceGroups()
+{
+  return mSetup->getSourceGroups();
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::createPipeline(const IasPipelineParams &params, IasPipelinePtr *pipeline)
+{
+  IasResult result = mSetup->createPipeline(params, pipeline);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpCreatePipeline);
+    op.strings.push_back(params.name);
+    op.values.push_back(params.samplerate);
+    op.values.push_back(params.periodSize);
+    mCache->addOp(op);
+    addHandle(pipeline->get());
+  }
+  return result;
+}
+
+void IasSetupRecorder::destroyPipeline(IasPipelinePtr *pipeline)
+{
+  mCache->invalidate(__func__);
+  mSetup->destroyPipeline(pipeline);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addPipeline(IasRoutingZonePtr routingZone, IasPipelinePtr pipeline)
+{
+  IasResult result = mSetup->addPipeline(routingZone, pipeline);
+  record(result, IasTopologyCache::eIasOpAddPipeline, routingZone.get(), pipeline.get());
+  return result;
+}
+
+void IasSetupRecorder::deletePipeline(IasRoutingZonePtr routingZone)
+{
+  mCache->invalidate(__func__);
+  mSetup->deletePipeline(routingZone);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::createAudioPin(const IasAudioPinParams &params, IasAudioPinPtr *pin)
+{
+  IasResult result = mSetup->createAudioPin(params, pin);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpCreateAudioPin);
+    op.strings.push_back(params.name);
+    op.values.push_back(params.numChannels);
+    mCache->addOp(op);
+    addHandle(pin->get());
+  }
+  return result;
+}
+
+void IasSetupRecorder::destroyAudioPin(IasAudioPinPtr *pin)
+{
+  mCache->invalidate(__func__);
+  mSetup->destroyAudioPin(pin);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addAudioInputPin(IasPipelinePtr pipeline, IasAudioPinPtr pipelineInputPin)
+{
+  IasResult result = mSetup->addAudioInputPin(pipeline, pipelineInputPin);
+  record(result, IasTopologyCache::eIasOpAddInputPin, pipeline.get(), pipelineInputPin.get());
+  return result;
+}
+
+void IasSetupRecorder::deleteAudioInputPin(IasPipelinePtr pipeline, IasAudioPinPtr pipelineInputPin)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteAudioInputPin(pipeline, pipelineInputPin);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addAudioOutputPin(IasPipelinePtr pipeline, IasAudioPinPtr pipelineOutputPin)
+{
+  IasResult result = mSetup->addAudioOutputPin(pipeline, pipelineOutputPin);
+  record(result, IasTopologyCache::eIasOpAddOutputPin, pipeline.get(), pipelineOutputPin.get());
+  return result;
+}
+
+void IasSetupRecorder::deleteAudioOutputPin(IasPipelinePtr pipeline, IasAudioPinPtr pipelineOutputPin)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteAudioOutputPin(pipeline, pipelineOutputPin);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addAudioInOutPin(IasProcessingModulePtr module, IasAudioPinPtr inOutPin)
+{
+  IasResult result = mSetup->addAudioInOutPin(module, inOutPin);
+  record(result, IasTopologyCache::eIasOpAddInOutPin, module.get(), inOutPin.get());
+  return result;
+}
+
+void IasSetupRecorder::deleteAudioInOutPin(IasProcessingModulePtr module, IasAudioPinPtr inOutPin)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteAudioInOutPin(module, inOutPin);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addAudioPinMapping(IasProcessingModulePtr module, IasAudioPinPtr inputPin, IasAudioPinPtr outputPin)
+{
+  IasResult result = mSetup->addAudioPinMapping(module, inputPin, outputPin);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpAddPinMapping);
+    if (appendHandle(module.get(), &op) && appendHandle(inputPin.get(), &op) && appendHandle(outputPin.get(), &op))
+    {
+      mCache->addOp(op);
+    }
+  }
+  return result;
+}
+
+void IasSetupRecorder::deleteAudioPinMapping(IasProcessingModulePtr module, IasAudioPinPtr inputPin, IasAudioPinPtr outputPin)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteAudioPinMapping(module, inputPin, outputPin);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::createProcessingModule(const IasProcessingModuleParams &params, IasProcessingModulePtr *module)
+{
+  IasResult result = mSetup->createProcessingModule(params, module);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpCreateProcessingModule);
+    op.strings.push_back(params.typeName);
+    op.strings.push_back(params.instanceName);
+    mCache->addOp(op);
+    addHandle(module->get());
+  }
+  return result;
+}
+
+void IasSetupRecorder::destroyProcessingModule(IasProcessingModulePtr *module)
+{
+  mCache->invalidate(__func__);
+  mSetup->destroyProcessingModule(module);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::addProcessingModule(IasPipelinePtr pipeline, IasProcessingModulePtr module)
+{
+  IasResult result = mSetup->addProcessingModule(pipeline, module);
+  record(result, IasTopologyCache::eIasOpAddProcessingModule, pipeline.get(), module.get());
+  return result;
+}
+
+void IasSetupRecorder::deleteProcessingModule(IasPipelinePtr pipeline, IasProcessingModulePtr module)
+{
+  mCache->invalidate(__func__);
+  mSetup->deleteProcessingModule(pipeline, module);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::link(IasAudioPortPtr inputPort, IasAudioPinPtr inputPin)
+{
+  IasResult result = mSetup->link(inputPort, inputPin);
+  record(result, IasTopologyCache::eIasOpLinkPortToPin, inputPort.get(), inputPin.get());
+  return result;
+}
+
+void IasSetupRecorder::unlink(IasAudioPortPtr inputPort, IasAudioPinPtr inputPin)
+{
+  mCache->invalidate(__func__);
+  mSetup->unlink(inputPort, inputPin);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::link(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin, IasAudioPinLinkType linkType)
+{
+  IasResult result = mSetup->link(outputPin, inputPin, linkType);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpLinkPins);
+    op.values.push_back(linkType);
+    if (appendHandle(outputPin.get(), &op) && appendHandle(inputPin.get(), &op))
+    {
+      mCache->addOp(op);
+    }
+  }
+  return result;
+}
+
+void IasSetupRecorder::unlink(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin)
+{
+  mCache->invalidate(__func__);
+  mSetup->unlink(outputPin, inputPin);
+}
+
+void IasSetupRecorder::setProperties(IasProcessingModulePtr module, const IasProperties &properties)
+{
+  mSetup->setProperties(module, properties);
+  IasTopologyCache::IasOp op(IasTopologyCache::eIasOpSetProperties);
+  if (appendHandle(module.get(), &op))
+  {
+    op.properties = std::make_shared<IasProperties>(properties);
+    mCache->addOp(op);
+  }
+}
+
+IasPropertiesPtr IasSetupRecorder::getProperties(IasProcessingModulePtr module)
+{
+  return mSetup->getProperties(module);
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::initPipelineAudioChain(IasPipelinePtr pipeline)
+{
+  IasResult result = mSetup->initPipelineAudioChain(pipeline);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpInitPipelineAudioChain);
+    if (appendHandle(pipeline.get(), &op))
+    {
+      mCache->addOp(op);
+    }
+  }
+  return result;
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::setRuntimeRelinking(IasPipelinePtr pipeline, bool enable)
+{
+  IasResult result = mSetup->setRuntimeRelinking(pipeline, enable);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpSetRuntimeRelinking);
+    op.values.push_back(enable);
+    if (appendHandle(pipeline.get(), &op))
+    {
+      mCache->addOp(op);
+    }
+  }
+  return result;
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::commitPinLinks(IasPipelinePtr pipeline, uint32_t crossfadeLength)
+{
+  IasResult result = mSetup->commitPinLinks(pipeline, crossfadeLength);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpCommitPinLinks);
+    op.values.push_back(crossfadeLength);
+    if (appendHandle(pipeline.get(), &op))
+    {
+      mCache->addOp(op);
+    }
+  }
+  return result;
+}
+
+IasSetupRecorder::IasResult IasSetupRecorder::setSinkPrefill(IasRoutingZonePtr routingZone, const IasSinkPrefillParams &params)
+{
+  IasResult result = mSetup->setSinkPrefill(routingZone, params);
+  if (result == eIasOk)
+  {
+    IasTopologyCache::IasOp op(IasTopologyCache::eIasOpSetSinkPrefill);
+    op.values.push_back(params.numFrames);
+    op.values.push_back(params.adaptive);
+    op.values.push_back(params.minFrames);
+    op.values.push_back(params.maxFrames);
+    if (appendHandle(routingZone.get(), &op))
+    {
+      mCache->addOp(op);
+    }
+  }
+  return result;
+}
+
+} //namespace IasAudio
@@ -22,6 +22,7 @@
 #include "model/IasAudioPin.hpp"
 #include "model/IasAudioPortOwner.hpp"
 #include "model/IasRoutingZone.hpp"
+#include "model/IasRoutingZoneWorkerThread.hpp"
 #include "model/IasPipeline.hpp"
 #include "model/IasProcessingModule.hpp"
 #include "audio/smartx/IasProperties.hpp"
@@ -1058,6 +1059,28 @@ IasSmartXDebugFacade::IasResult IasSmartXDebugFacade::getSmartxRoutingZones(xmlN
       std::string baseRzName =  baseRz->getRoutingZoneParams()->name;
       DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Base routing zone name: ", baseRzName);
       xmlSetProp(routingzone, BAD_CAST"derived_from", reinterpret_cast<const unsigned char *>(baseRzName.c_str()));
+
+      IasRoutingZoneWorkerThreadPtr rzWorkerThread = routingZone->getWorkerThread();
+      if (rzWorkerThread != nullptr)
+      {
+        IasISetup::IasSinkPrefillParams prefillParams = rzWorkerThread->getSinkPrefill();
+        if (prefillParams.numFrames != 0)
+        {
+          xmlSetProp(routingzone, BAD_CAST"prefill_frames", reinterpret_cast<const unsigned char *>(to_string(prefillParams.numFrames).c_str()));
+        }
+        if (prefillParams.adaptive)
+        {
+          xmlSetProp(routingzone, BAD_CAST"prefill_adaptive", BAD_CAST"true");
+        }
+        if (prefillParams.minFrames != 0)
+        {
+          xmlSetProp(routingzone, BAD_CAST"prefill_min_frames", reinterpret_cast<const unsigned char *>(to_string(prefillParams.minFrames).c_str()));
+        }
+        if (prefillParams.maxFrames != 0)
+        {
+          xmlSetProp(routingzone, BAD_CAST"prefill_max_frames", reinterpret_cast<const unsigned char *>(to_string(prefillParams.maxFrames).c_str()));
+        }
+      }
     }
 
     //add child routingzone to routingZones
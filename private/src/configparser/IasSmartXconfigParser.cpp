@@ -13,6 +13,7 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <cstdio>
 #include <string>
 #include "audio/smartx/IasSmartX.hpp"
 #include "audio/smartx/IasIRouting.hpp"
@@ -27,6 +28,9 @@
 #include "audio/configparser/IasSmartXconfigParser.hpp"
 #include "configparser/IasConfigParser.hpp"
 #include "configparser/IasParseHelper.hpp"
+#include "configparser/IasTopologyCache.hpp"
+#include "configparser/IasSetupRecorder.hpp"
+#include "configparser/IasRoutingRecorder.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 
 using namespace std;
@@ -36,13 +40,11 @@ static const std::string fFunction = "XMLCONFIGPARSER::";
 
 namespace IasAudio{
 
-bool parseConfig(IasAudio::IasSmartX *smartx, const char * xmlFileName)
+/**
+ * @brief Check the parameters of parseConfig
+ */
+static bool checkParameters(DltContext *mLog, IasAudio::IasSmartX *smartx, const char * xmlFileName)
 {
-  DltContext *mLog(IasAudioLogging::registerDltContext("PAR", "XML CONF"));
-  DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, "starting XML parser");
-
-  DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, "Inside the SmartXConfigParser WP2 Library");
-
   if (xmlFileName == nullptr )
   {
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid Condition: xmlFileName is nullptr");
@@ -71,12 +73,15 @@ bool parseConfig(IasAudio::IasSmartX *smartx, const char * xmlFileName)
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "SmartX API version does not match");
     return false;
   }
+  return true;
+}
 
-  IasAudio::IasISetup *setup = smartx->setup();
-  IAS_ASSERT(setup != nullptr);
-  IasAudio::IasIRouting *routing = smartx->routing();
-  IAS_ASSERT(routing != nullptr);
-
+/**
+ * @brief Parse the XML file and create the topology via the given setup and routing interfaces
+ */
+static bool parseXml(DltContext *mLog, IasAudio::IasSmartX *smartx, IasAudio::IasISetup *setup,
+                     IasAudio::IasIRouting *routing, const char * xmlFileName)
+{
   xmlDocPtr doc = xmlReadFile(xmlFileName, NULL, XML_PARSE_NOBLANKS);
   if (doc == nullptr )
   {
@@ -122,15 +127,100 @@ bool parseConfig(IasAudio::IasSmartX *smartx, const char * xmlFileName)
   DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, "Parsing routing links");
   //parse routing links
   result = parseRoutingLinks(routing, rootNode);
+  xmlFreeDoc(doc);
   if (result != IasConfigParserResult::eIasOk)
   {
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Parsing routing links Failed: ", toString(result));
-    xmlFreeDoc(doc);
     return false;
   }
 
   return true;
+}
+
+bool parseConfig(IasAudio::IasSmartX *smartx, const char * xmlFileName)
+{
+  DltContext *mLog(IasAudioLogging::registerDltContext("PAR", "XML CONF"));
+  DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, "starting XML parser");
+
+  DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, "Inside the SmartXConfigParser WP2 Library");
+
+  if (checkParameters(mLog, smartx, xmlFileName) == false)
+  {
+    return false;
+  }
+
+  IasAudio::IasISetup *setup = smartx->setup();
+  IAS_ASSERT(setup != nullptr);
+  IasAudio::IasIRouting *routing = smartx->routing();
+  IAS_ASSERT(routing != nullptr);
 
+  return parseXml(mLog, smartx, setup, routing, xmlFileName);
 }
+
+bool parseConfig(IasAudio::IasSmartX *smartx, const char * xmlFileName, const char * cacheFileName)
+{
+  if (cacheFileName == nullptr)
+  {
+    return parseConfig(smartx, xmlFileName);
+  }
+
+  DltContext *mLog(IasAudioLogging::registerDltContext("PAR", "XML CONF"));
+  DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, "starting XML parser with topology cache", cacheFileName);
+
+  if (checkParameters(mLog, smartx, xmlFileName) == false)
+  {
+    return false;
+  }
+
+  IasAudio::IasISetup *setup = smartx->setup();
+  IAS_ASSERT(setup != nullptr);
+  IasAudio::IasIRouting *routing = smartx->routing();
+  IAS_ASSERT(routing != nullptr);
+
+  uint64_t xmlHash = 0;
+  uint64_t xmlSize = 0;
+  if (IasTopologyCache::hashFile(xmlFileName, &xmlHash, &xmlSize) != IasTopologyCache::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cannot read XML file", xmlFileName);
+    return false;
+  }
+
+  IasTopologyCache cache;
+  if (cache.load(cacheFileName, xmlHash, xmlSize) == IasTopologyCache::eIasOk)
+  {
+    // Once the replay has started, the topology is partially created and the XML file cannot be parsed anymore.
+    // Remove the cache file in this case, so that the next start parses the XML file again.
+    if (cache.replaySetup(setup) != IasTopologyCache::eIasOk)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Replay of the topology cache failed");
+      std::remove(cacheFileName);
+      return false;
+    }
+    IasAudio::IasSmartX::IasResult smxres = smartx->start();
+    // See parseXml, the result of the start is not of interest here
+    (void)smxres;
+    if (cache.replayConnections(routing) != IasTopologyCache::eIasOk)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Replay of the connections of the topology cache failed");
+      std::remove(cacheFileName);
+      return false;
+    }
+    return true;
+  }
+
+  cache.clear();
+  IasSetupRecorder setupRecorder(setup, &cache);
+  IasRoutingRecorder routingRecorder(routing, &cache);
+  if (parseXml(mLog, smartx, &setupRecorder, &routingRecorder, xmlFileName) == false)
+  {
+    return false;
+  }
+  if (cache.isValid() == true)
+  {
+    // A cache file that cannot be written only costs the startup time of the next boot
+    (void)cache.save(cacheFileName, xmlHash, xmlSize);
+  }
+  return true;
 }
 
+}
@@ -0,0 +1,801 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/**
+ * @file   IasTopologyCache.cpp
+ * @date   2018
+ * @brief  Binary cache of the topology created from an XML file.
+ */
+
+#include <cstdio>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include "configparser/IasTopologyCache.hpp"
+#include "audio/smartx/IasSmartX.hpp"
+#include "audio/smartx/IasISetup.hpp"
+#include "audio/smartx/IasIRouting.hpp"
+
+namespace IasAudio {
+
+static const std::string cClassName = "IasTopologyCache::";
+#define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
+
+namespace {
+
+const uint32_t cCacheMagic = 0x43545853;       // "SXTC"
+const uint32_t cCacheFormatVersion = 1;
+const uint64_t cFnvOffsetBasis = 14695981039346656037ull;
+const uint64_t cFnvPrime = 1099511628211ull;
+const uint32_t cMaxHandlesPerOp = 3;
+
+/**
+ * @brief The type of the object a handle refers to
+ */
+enum IasHandleKind
+{
+  eIasKindNone = 0,
+  eIasKindZone,
+  eIasKindSource,
+  eIasKindSink,
+  eIasKindPort,
+  eIasKindPipeline,
+  eIasKindPin,
+  eIasKindModule,
+};
+
+/**
+ * @brief The signature of a recorded operation, used to validate a cache file
+ */
+struct IasOpSignature
+{
+  IasHandleKind creates;                          // Kind of the created object or eIasKindNone
+  uint32_t      numHandles;                       // Number of referenced objects
+  IasHandleKind handleKinds[cMaxHandlesPerOp];    // Kinds of the referenced objects
+  uint32_t      numValues;                        // Number of numeric parameters
+  uint32_t      numStrings;                       // Number of string parameters
+};
+
+// Indexed by IasTopologyCache::IasOpType
+const IasOpSignature cOpSignatures[IasTopologyCache::eIasOpLast] =
+{
+  { eIasKindNone,     0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 0, 0 },  // eIasOpUndef
+  { eIasKindZone,     0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 0, 1 },  // eIasOpCreateRoutingZone
+  { eIasKindSource,   0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 7, 1 },  // eIasOpCreateSourceDevice
+  { eIasKindSink,     0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 7, 1 },  // eIasOpCreateSinkDevice
+  { eIasKindPort,     0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 4, 1 },  // eIasOpCreateAudioPort
+  { eIasKindPipeline, 0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 2, 1 },  // eIasOpCreatePipeline
+  { eIasKindPin,      0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 1, 1 },  // eIasOpCreateAudioPin
+  { eIasKindModule,   0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 0, 2 },  // eIasOpCreateProcessingModule
+  { eIasKindNone,     2, { eIasKindZone,     eIasKindZone,   eIasKindNone }, 0, 0 },  // eIasOpAddDerivedZone
+  { eIasKindNone,     2, { eIasKindZone,     eIasKindSink,   eIasKindNone }, 0, 0 },  // eIasOpLinkZoneToSink
+  { eIasKindNone,     2, { eIasKindSource,   eIasKindPort,   eIasKindNone }, 0, 0 },  // eIasOpAddSourceOutputPort
+  { eIasKindNone,     2, { eIasKindSink,     eIasKindPort,   eIasKindNone }, 0, 0 },  // eIasOpAddSinkInputPort
+  { eIasKindNone,     2, { eIasKindZone,     eIasKindPort,   eIasKindNone }, 0, 0 },  // eIasOpAddZoneInputPort
+  { eIasKindNone,     2, { eIasKindPort,     eIasKindPort,   eIasKindNone }, 0, 0 },  // eIasOpLinkPorts
+  { eIasKindNone,     0, { eIasKindNone,     eIasKindNone,   eIasKindNone }, 1, 1 },  // eIasOpAddSourceGroup
+  { eIasKindNone,     2, { eIasKindZone,     eIasKindPipeline, eIasKindNone }, 0, 0 },  // eIasOpAddPipeline
+  { eIasKindNone,     2, { eIasKindPipeline, eIasKindPin,    eIasKindNone }, 0, 0 },  // eIasOpAddInputPin
+  { eIasKindNone,     2, { eIasKindPipeline, eIasKindPin,    eIasKindNone }, 0, 0 },  // eIasOpAddOutputPin
+  { eIasKindNone,     2, { eIasKindModule,   eIasKindPin,    eIasKindNone }, 0, 0 },  // eIasOpAddInOutPin
+  { eIasKindNone,     3, { eIasKindModule,   eIasKindPin,    eIasKindPin  }, 0, 0 },  // eIasOpAddPinMapping
+  { eIasKindNone,     2, { eIasKindPipeline, eIasKindModule, eIasKindNone }, 0, 0 },  // eIasOpAddProcessingModule
+  { eIasKindNone,     2, { eIasKindPort,     eIasKindPin,    eIasKindNone }, 0, 0 },  // eIasOpLinkPortToPin
+  { eIasKindNone,     2, { eIasKindPin,      eIasKindPin,    eIasKindNone }, 1, 0 },  // eIasOpLinkPins
+  { eIasKindNone,     1, { eIasKindModule,   eIasKindNone,   eIasKindNone }, 0, 0 },  // eIasOpSetProperties
+  { eIasKindNone,     1, { eIasKindPipeline, eIasKindNone,   eIasKindNone }, 0, 0 },  // eIasOpInitPipelineAudioChain
+  { eIasKindNone,     1, { eIasKindPipeline, eIasKindNone,   eIasKindNone }, 1, 0 },  // eIasOpSetRuntimeRelinking
+  { eIasKindNone,     1, { eIasKindPipeline, eIasKindNone,   eIasKindNone }, 1, 0 },  // eIasOpCommitPinLinks
+  { eIasKindNone,     1, { eIasKindZone,     eIasKindNone,   eIasKindNone }, 4, 0 },  // eIasOpSetSinkPrefill
+};
+
+/**
+ * @brief The type tags of the serialized properties
+ */
+enum IasPropertyTag
+{
+  eIasTagInt64 = 1,
+  eIasTagInt32,
+  eIasTagFloat64,
+  eIasTagFloat32,
+  eIasTagString,
+  eIasTagInt64Vector,
+  eIasTagInt32Vector,
+  eIasTagFloat64Vector,
+  eIasTagFloat32Vector,
+  eIasTagStringVector,
+};
+
+uint64_t fnv1a(uint64_t hash, const char *data, size_t size)
+{
+  for (size_t index = 0; index < size; ++index)
+  {
+    hash ^= static_cast<uint8_t>(data[index]);
+    hash *= cFnvPrime;
+  }
+  return hash;
+}
+
+/**
+ * @brief Serializes values in host byte order, the cache file is specific to the target it was created on
+ */
+class IasCacheWriter
+{
+  public:
+    template <typename T>
+    void write(const T &value)
+    {
+      mData.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    void write(const std::string &value)
+    {
+      write(static_cast<uint32_t>(value.size()));
+      mData.append(value);
+    }
+    template <typename T>
+    void write(const std::vector<T> &values)
+    {
+      write(static_cast<uint32_t>(values.size()));
+      for (const auto &value : values)
+      {
+        write(value);
+      }
+    }
+    const std::string& getData() const { return mData; }
+
+  private:
+    std::string mData;
+};
+
+/**
+ * @brief Deserializes values, every read is checked against the end of the data
+ */
+class IasCacheReader
+{
+  public:
+    IasCacheReader(const std::string &data, size_t offset)
+      :mData(data)
+      ,mOffset(offset)
+    {}
+    template <typename T>
+    bool read(T *value)
+    {
+      if (mData.size() - mOffset < sizeof(T))
+      {
+        return false;
+      }
+      memcpy(value, mData.data() + mOffset, sizeof(T));
+      mOffset += sizeof(T);
+      return true;
+    }
+    bool read(std::string *value)
+    {
+      uint32_t size = 0;
+      if (read(&size) == false || mData.size() - mOffset < size)
+      {
+        return false;
+      }
+      value->assign(mData, mOffset, size);
+      mOffset += size;
+      return true;
+    }
+    template <typename T>
+    bool read(std::vector<T> *values)
+    {
+      uint32_t size = 0;
+      // Each element takes at least one byte, which limits the allocation for a corrupt size
+      if (read(&size) == false || mData.size() - mOffset < size)
+      {
+        return false;
+      }
+      values->resize(size);
+      for (auto &value : *values)
+      {
+        if (read(&value) == false)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+    bool atEnd() const { return mOffset == mData.size(); }
+
+  private:
+    const std::string  &mData;
+    size_t              mOffset;
+};
+
+template <typename T>
+void writeProperty(IasCacheWriter &writer, const IasProperties &properties, const std::string &key, uint8_t tag)
+{
+  T value;
+  properties.get(key, &value);
+  writer.write(key);
+  writer.write(tag);
+  writer.write(value);
+}
+
+void writeProperties(IasCacheWriter &writer, const IasProperties &properties)
+{
+  const IasKeyList &keys = properties.getPropertyKeys();
+  writer.write(static_cast<uint32_t>(keys.size()));
+  for (const auto &key : keys)
+  {
+    std::string dataType;
+    properties.getKeyDataType(key, dataType);
+    // The vector types have to be checked first, because their names contain the names of the scalar types
+    if (dataType.find("Int64Vector") != std::string::npos)
+    {
+      writeProperty<IasInt64Vector>(writer, properties, key, eIasTagInt64Vector);
+    }
+    else if (dataType.find("Int32Vector") != std::string::npos)
+    {
+      writeProperty<IasInt32Vector>(writer, properties, key, eIasTagInt32Vector);
+    }
+    else if (dataType.find("Float64Vector") != std::string::npos)
+    {
+      writeProperty<IasFloat64Vector>(writer, properties, key, eIasTagFloat64Vector);
+    }
+    else if (dataType.find("Float32Vector") != std::string::npos)
+    {
+      writeProperty<IasFloat32Vector>(writer, properties, key, eIasTagFloat32Vector);
+    }
+    else if (dataType.find("StringVector") != std::string::npos)
+    {
+      writeProperty<IasStringVector>(writer, properties, key, eIasTagStringVector);
+    }
+    else if (dataType.find("int64") != std::string::npos)
+    {
+      writeProperty<int64_t>(writer, properties, key, eIasTagInt64);
+    }
+    else if (dataType.find("int32") != std::string::npos)
+    {
+      writeProperty<int32_t>(writer, properties, key, eIasTagInt32);
+    }
+    else if (dataType.find("float64") != std::string::npos)
+    {
+      writeProperty<float64>(writer, properties, key, eIasTagFloat64);
+    }
+    else if (dataType.find("float32") != std::string::npos)
+    {
+      writeProperty<float32>(writer, properties, key, eIasTagFloat32);
+    }
+    else
+    {
+      writeProperty<std::string>(writer, properties, key, eIasTagString);
+    }
+  }
+}
+
+template <typename T>
+bool readProperty(IasCacheReader &reader, IasProperties *properties, const std::string &key)
+{
+  T value;
+  if (reader.read(&value) == false)
+  {
+    return false;
+  }
+  properties->set(key, value);
+  return true;
+}
+
+bool readProperties(IasCacheReader &reader, IasProperties *properties)
+{
+  uint32_t numKeys = 0;
+  if (reader.read(&numKeys) == false)
+  {
+    return false;
+  }
+  for (uint32_t count = 0; count < numKeys; ++count)
+  {
+    std::string key;
+    uint8_t tag = 0;
+    if (reader.read(&key) == false || reader.read(&tag) == false)
+    {
+      return false;
+    }
+    bool ok = false;
+    switch (tag)
+    {
+      case eIasTagInt64:          ok = readProperty<int64_t>(reader, properties, key); break;
+      case eIasTagInt32:          ok = readProperty<int32_t>(reader, properties, key); break;
+      case eIasTagFloat64:        ok = readProperty<float64>(reader, properties, key); break;
+      case eIasTagFloat32:        ok = readProperty<float32>(reader, properties, key); break;
+      case eIasTagString:         ok = readProperty<std::string>(reader, properties, key); break;
+      case eIasTagInt64Vector:    ok = readProperty<IasInt64Vector>(reader, properties, key); break;
+      case eIasTagInt32Vector:    ok = readProperty<IasInt32Vector>(reader, properties, key); break;
+      case eIasTagFloat64Vector:  ok = readProperty<IasFloat64Vector>(reader, properties, key); break;
+      case eIasTagFloat32Vector:  ok = readProperty<IasFloat32Vector>(reader, properties, key); break;
+      case eIasTagStringVector:   ok = readProperty<IasStringVector>(reader, properties, key); break;
+      default:                    ok = false; break;
+    }
+    if (ok == false)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+
+IasTopologyCache::IasTopologyCache()
+  :mLog(IasAudioLogging::registerDltContext("PAR", "XML TOPOLOGY CACHE"))
+  ,mOps()
+  ,mConnections()
+  ,mValid(true)
+{
+}
+
+IasTopologyCache::~IasTopologyCache()
+{
+}
+
+void IasTopologyCache::clear()
+{
+  mOps.clear();
+  mConnections.clear();
+  mValid = true;
+}
+
+void IasTopologyCache::addOp(const IasOp &op)
+{
+  mOps.push_back(op);
+}
+
+void IasTopologyCache::addConnection(int32_t sourceId, int32_t sinkId)
+{
+  mConnections.push_back(std::make_pair(sourceId, sinkId));
+}
+
+void IasTopologyCache::invalidate(const std::string &reason)
+{
+  if (mValid == true)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_WARN, LOG_PREFIX, "Topology cannot be cached:", reason);
+  }
+  mValid = false;
+}
+
+bool IasTopologyCache::createsHandle(IasOpType type)
+{
+  return (type > eIasOpUndef) && (type < eIasOpLast) && (cOpSignatures[type].creates != eIasKindNone);
+}
+
+IasTopologyCache::IasResult IasTopologyCache::save(const std::string &fileName, uint64_t xmlHash, uint64_t xmlSize) const
+{
+  if (mValid == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Recording is invalid, cache file", fileName, "not written");
+    return eIasFailed;
+  }
+
+  IasCacheWriter payload;
+  payload.write(static_cast<uint32_t>(mOps.size()));
+  for (const auto &op : mOps)
+  {
+    payload.write(static_cast<uint32_t>(op.type));
+    payload.write(op.handles);
+    payload.write(op.values);
+    payload.write(op.strings);
+    payload.write(static_cast<uint8_t>(op.properties != nullptr));
+    if (op.properties != nullptr)
+    {
+      writeProperties(payload, *op.properties);
+    }
+  }
+  payload.write(static_cast<uint32_t>(mConnections.size()));
+  for (const auto &connection : mConnections)
+  {
+    payload.write(connection.first);
+    payload.write(connection.second);
+  }
+
+  IasCacheWriter header;
+  header.write(cCacheMagic);
+  header.write(cCacheFormatVersion);
+  header.write(static_cast<uint32_t>(SMARTX_API_MAJOR));
+  header.write(static_cast<uint32_t>(SMARTX_API_MINOR));
+  header.write(static_cast<uint32_t>(SMARTX_API_PATCH));
+  header.write(xmlHash);
+  header.write(xmlSize);
+  header.write(static_cast<uint64_t>(payload.getData().size()));
+  header.write(fnv1a(cFnvOffsetBasis, payload.getData().data(), payload.getData().size()));
+
+  const std::string tmpFileName = fileName + ".tmp";
+  std::ofstream file(tmpFileName.c_str(), std::ios::binary | std::ios::trunc);
+  if (file.is_open() == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cannot open cache file", tmpFileName);
+    return eIasFailed;
+  }
+  file.write(header.getData().data(), header.getData().size());
+  file.write(payload.getData().data(), payload.getData().size());
+  file.close();
+  if (file.fail() || std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error writing cache file", fileName);
+    std::remove(tmpFileName.c_str());
+    return eIasFailed;
+  }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Cache file", fileName, "written with", mOps.size(), "operations and",
+              mConnections.size(), "connections");
+  return eIasOk;
+}
+
+IasTopologyCache::IasResult IasTopologyCache::load(const std::string &fileName, uint64_t xmlHash, uint64_t xmlSize)
+{
+  clear();
+  std::ifstream file(fileName.c_str(), std::ios::binary);
+  if (file.is_open() == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Cache file", fileName, "not found");
+    return eIasNotFound;
+  }
+  const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  IasCacheReader header(data, 0);
+  uint32_t magic = 0;
+  uint32_t formatVersion = 0;
+  uint32_t apiMajor = 0;
+  uint32_t apiMinor = 0;
+  uint32_t apiPatch = 0;
+  uint64_t cachedXmlHash = 0;
+  uint64_t cachedXmlSize = 0;
+  uint64_t payloadSize = 0;
+  uint64_t payloadChecksum = 0;
+  if (header.read(&magic) == false || magic != cCacheMagic ||
+      header.read(&formatVersion) == false || header.read(&apiMajor) == false ||
+      header.read(&apiMinor) == false || header.read(&apiPatch) == false ||
+      header.read(&cachedXmlHash) == false || header.read(&cachedXmlSize) == false ||
+      header.read(&payloadSize) == false || header.read(&payloadChecksum) == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cache file", fileName, "has no valid header");
+    return eIasInvalid;
+  }
+  if (formatVersion != cCacheFormatVersion || apiMajor != SMARTX_API_MAJOR || apiMinor != SMARTX_API_MINOR ||
+      apiPatch != SMARTX_API_PATCH || cachedXmlHash != xmlHash || cachedXmlSize != xmlSize)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Cache file", fileName, "does not match the XML file or the SmartX API version");
+    return eIasOutdated;
+  }
+  const size_t payloadOffset = data.size() - static_cast<size_t>(std::min<uint64_t>(payloadSize, data.size()));
+  if (payloadOffset == 0 || payloadSize != data.size() - payloadOffset ||
+      fnv1a(cFnvOffsetBasis, data.data() + payloadOffset, static_cast<size_t>(payloadSize)) != payloadChecksum)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cache file", fileName, "is truncated or corrupt");
+    return eIasInvalid;
+  }
+
+  IasCacheReader payload(data, payloadOffset);
+  uint32_t numOps = 0;
+  bool ok = payload.read(&numOps);
+  for (uint32_t count = 0; ok && count < numOps; ++count)
+  {
+    IasOp op;
+    uint32_t type = 0;
+    uint8_t hasProperties = 0;
+    ok = payload.read(&type) && payload.read(&op.handles) && payload.read(&op.values) &&
+         payload.read(&op.strings) && payload.read(&hasProperties);
+    op.type = static_cast<IasOpType>(type);
+    if (ok && hasProperties != 0)
+    {
+      op.properties = std::make_shared<IasProperties>();
+      ok = readProperties(payload, op.properties.get());
+    }
+    if (ok)
+    {
+      mOps.push_back(op);
+    }
+  }
+  uint32_t numConnections = 0;
+  ok = ok && payload.read(&numConnections);
+  for (uint32_t count = 0; ok && count < numConnections; ++count)
+  {
+    int32_t sourceId = 0;
+    int32_t sinkId = 0;
+    ok = payload.read(&sourceId) && payload.read(&sinkId);
+    if (ok)
+    {
+      addConnection(sourceId, sinkId);
+    }
+  }
+  if (ok == false || payload.atEnd() == false || validate() == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cache file", fileName, "contains invalid operations");
+    clear();
+    return eIasInvalid;
+  }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Cache file", fileName, "loaded with", mOps.size(), "operations and",
+              mConnections.size(), "connections");
+  return eIasOk;
+}
+
+bool IasTopologyCache::validate() const
+{
+  std::vector<IasHandleKind> kinds;
+  for (const auto &op : mOps)
+  {
+    if (op.type <= eIasOpUndef || op.type >= eIasOpLast)
+    {
+      return false;
+    }
+    const IasOpSignature &signature = cOpSignatures[op.type];
+    if (op.handles.size() != signature.numHandles || op.values.size() != signature.numValues ||
+        op.strings.size() != signature.numStrings || (op.type == eIasOpSetProperties) != (op.properties != nullptr))
+    {
+      return false;
+    }
+    for (uint32_t index = 0; index < signature.numHandles; ++index)
+    {
+      if (op.handles[index] >= kinds.size() || kinds[op.handles[index]] != signature.handleKinds[index])
+      {
+        return false;
+      }
+    }
+    if (signature.creates != eIasKindNone)
+    {
+      kinds.push_back(signature.creates);
+    }
+  }
+  return true;
+}
+
+IasTopologyCache::IasResult IasTopologyCache::replaySetup(IasISetup *setup) const
+{
+  if (setup == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "setup == nullptr");
+    return eIasFailed;
+  }
+
+  // The objects created so far, indexed by their handle. The type is given by the operation that created them.
+  std::vector<std::shared_ptr<void>> objects;
+  objects.reserve(mOps.size());
+  IasISetup::IasResult result = IasISetup::eIasOk;
+  for (const auto &op : mOps)
+  {
+    auto object = [&objects, &op](uint32_t index) { return objects[op.handles[index]]; };
+    switch (op.type)
+    {
+      case eIasOpCreateRoutingZone:
+      {
+        IasRoutingZoneParams params;
+        params.name = op.strings[0];
+        IasRoutingZonePtr routingZone = nullptr;
+        result = setup->createRoutingZone(params, &routingZone);
+        objects.push_back(routingZone);
+        break;
+      }
+      case eIasOpCreateSourceDevice:
+      case eIasOpCreateSinkDevice:
+      {
+        IasAudioDeviceParams params;
+        params.name = op.strings[0];
+        params.numChannels = static_cast<uint32_t>(op.values[0]);
+        params.samplerate = static_cast<uint32_t>(op.values[1]);
+        params.dataFormat = static_cast<IasAudioCommonDataFormat>(op.values[2]);
+        params.clockType = static_cast<IasClockType>(op.values[3]);
+        params.periodSize = static_cast<uint32_t>(op.values[4]);
+        params.numPeriods = static_cast<uint32_t>(op.values[5]);
+        params.numPeriodsAsrcBuffer = static_cast<uint32_t>(op.values[6]);
+        if (op.type == eIasOpCreateSourceDevice)
+        {
+          IasAudioSourceDevicePtr sourceDevice = nullptr;
+          result = setup->createAudioSourceDevice(params, &sourceDevice);
+          objects.push_back(sourceDevice);
+        }
+        else
+        {
+          IasAudioSinkDevicePtr sinkDevice = nullptr;
+          result = setup->createAudioSinkDevice(params, &sinkDevice);
+          objects.push_back(sinkDevice);
+        }
+        break;
+      }
+      case eIasOpCreateAudioPort:
+      {
+        IasAudioPortParams params;
+        params.name = op.strings[0];
+        params.numChannels = static_cast<uint32_t>(op.values[0]);
+        params.id = static_cast<int32_t>(op.values[1]);
+        params.direction = static_cast<IasPortDirection>(op.values[2]);
+        params.index = static_cast<uint32_t>(op.values[3]);
+        IasAudioPortPtr audioPort = nullptr;
+        result = setup->createAudioPort(params, &audioPort);
+        objects.push_back(audioPort);
+        break;
+      }
+      case eIasOpCreatePipeline:
+      {
+        IasPipelineParams params;
+        params.name = op.strings[0];
+        params.samplerate = static_cast<uint32_t>(op.values[0]);
+        params.periodSize = static_cast<uint32_t>(op.values[1]);
+        IasPipelinePtr pipeline = nullptr;
+        result = setup->createPipeline(params, &pipeline);
+        objects.push_back(pipeline);
+        break;
+      }
+      case eIasOpCreateAudioPin:
+      {
+        IasAudioPinParams params;
+        params.name = op.strings[0];
+        params.numChannels = static_cast<uint32_t>(op.values[0]);
+        IasAudioPinPtr pin = nullptr;
+        result = setup->createAudioPin(params, &pin);
+        objects.push_back(pin);
+        break;
+      }
+      case eIasOpCreateProcessingModule:
+      {
+        IasProcessingModuleParams params;
+        params.typeName = op.strings[0];
+        params.instanceName = op.strings[1];
+        IasProcessingModulePtr module = nullptr;
+        result = setup->createProcessingModule(params, &module);
+        objects.push_back(module);
+        break;
+      }
+      case eIasOpAddDerivedZone:
+        result = setup->addDerivedZone(std::static_pointer_cast<IasRoutingZone>(object(0)),
+                                       std::static_pointer_cast<IasRoutingZone>(object(1)));
+        break;
+      case eIasOpLinkZoneToSink:
+        result = setup->link(std::static_pointer_cast<IasRoutingZone>(object(0)),
+                             std::static_pointer_cast<IasAudioSinkDevice>(object(1)));
+        break;
+      case eIasOpAddSourceOutputPort:
+        result = setup->addAudioOutputPort(std::static_pointer_cast<IasAudioSourceDevice>(object(0)),
+                                           std::static_pointer_cast<IasAudioPort>(object(1)));
+        break;
+      case eIasOpAddSinkInputPort:
+        result = setup->addAudioInputPort(std::static_pointer_cast<IasAudioSinkDevice>(object(0)),
+                                          std::static_pointer_cast<IasAudioPort>(object(1)));
+        break;
+      case eIasOpAddZoneInputPort:
+        result = setup->addAudioInputPort(std::static_pointer_cast<IasRoutingZone>(object(0)),
+                                          std::static_pointer_cast<IasAudioPort>(object(1)));
+        break;
+      case eIasOpLinkPorts:
+        result = setup->link(std::static_pointer_cast<IasAudioPort>(object(0)),
+                             std::static_pointer_cast<IasAudioPort>(object(1)));
+        break;
+      case eIasOpAddSourceGroup:
+        setup->addSourceGroup(op.strings[0], static_cast<int32_t>(op.values[0]));
+        result = IasISetup::eIasOk;
+        break;
+      case eIasOpAddPipeline:
+        result = setup->addPipeline(std::static_pointer_cast<IasRoutingZone>(object(0)),
+                                    std::static_pointer_cast<IasPipeline>(object(1)));
+        break;
+      case eIasOpAddInputPin:
+        result = setup->addAudioInputPin(std::static_pointer_cast<IasPipeline>(object(0)),
+                                         std::static_pointer_cast<IasAudioPin>(object(1)));
+        break;
+      case eIasOpAddOutputPin:
+        result = setup->addAudioOutputPin(std::static_pointer_cast<IasPipeline>(object(0)),
+                                          std::static_pointer_cast<IasAudioPin>(object(1)));
+        break;
+      case eIasOpAddInOutPin:
+        result = setup->addAudioInOutPin(std::static_pointer_cast<IasProcessingModule>(object(0)),
+                                         std::static_pointer_cast<IasAudioPin>(object(1)));
+        break;
+      case eIasOpAddPinMapping:
+        result = setup->addAudioPinMapping(std::static_pointer_cast<IasProcessingModule>(object(0)),
+                                           std::static_pointer_cast<IasAudioPin>(object(1)),
+                                           std::static_pointer_cast<IasAudioPin>(object(2)));
+        break;
+      case eIasOpAddProcessingModule:
+        result = setup->addProcessingModule(std::static_pointer_cast<IasPipeline>(object(0)),
+                                            std::static_pointer_cast<IasProcessingModule>(object(1)));
+        break;
+      case eIasOpLinkPortToPin:
+        result = setup->link(std::static_pointer_cast<IasAudioPort>(object(0)),
+                             std::static_pointer_cast<IasAudioPin>(object(1)));
+        break;
+      case eIasOpLinkPins:
+        result = setup->link(std::static_pointer_cast<IasAudioPin>(object(0)),
+                             std::static_pointer_cast<IasAudioPin>(object(1)),
+                             static_cast<IasAudioPinLinkType>(op.values[0]));
+        break;
+      case eIasOpSetProperties:
+        setup->setProperties(std::static_pointer_cast<IasProcessingModule>(object(0)), *op.properties);
+        result = IasISetup::eIasOk;
+        break;
+      case eIasOpInitPipelineAudioChain:
+        result = setup->initPipelineAudioChain(std::static_pointer_cast<IasPipeline>(object(0)));
+        break;
+      case eIasOpSetRuntimeRelinking:
+        result = setup->setRuntimeRelinking(std::static_pointer_cast<IasPipeline>(object(0)), op.values[0] != 0);
+        break;
+      case eIasOpCommitPinLinks:
+        result = setup->commitPinLinks(std::static_pointer_cast<IasPipeline>(object(0)),
+                                       static_cast<uint32_t>(op.values[0]));
+        break;
+      case eIasOpSetSinkPrefill:
+      {
+        IasISetup::IasSinkPrefillParams params;
+        params.numFrames = static_cast<uint32_t>(op.values[0]);
+        params.adaptive = (op.values[1] != 0);
+        params.minFrames = static_cast<uint32_t>(op.values[2]);
+        params.maxFrames = static_cast<uint32_t>(op.values[3]);
+        result = setup->setSinkPrefill(std::static_pointer_cast<IasRoutingZone>(object(0)), params);
+        break;
+      }
+      default:
+        // Already excluded by validate()
+        result = IasISetup::eIasFailed;
+        break;
+    }
+    if (result != IasISetup::eIasOk)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Replay of operation", static_cast<uint32_t>(op.type), "failed");
+      return eIasFailed;
+    }
+  }
+  return eIasOk;
+}
+
+IasTopologyCache::IasResult IasTopologyCache::replayConnections(IasIRouting *routing) const
+{
+  if (routing == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "routing == nullptr");
+    return eIasFailed;
+  }
+  for (const auto &connection : mConnections)
+  {
+    if (routing->connect(connection.first, connection.second) != IasIRouting::eIasOk)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Failed to connect source:", connection.first, "to sink:", connection.second);
+      return eIasFailed;
+    }
+  }
+  return eIasOk;
+}
+
+IasTopologyCache::IasResult IasTopologyCache::hashFile(const std::string &fileName, uint64_t *hash, uint64_t *size)
+{
+  IAS_ASSERT(hash != nullptr);
+  IAS_ASSERT(size != nullptr);
+  std::ifstream file(fileName.c_str(), std::ios::binary);
+  if (file.is_open() == false)
+  {
+    return eIasNotFound;
+  }
+  *hash = cFnvOffsetBasis;
+  *size = 0;
+  char buffer[4096];
+  while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+  {
+    const size_t numBytes = static_cast<size_t>(file.gcount());
+    *hash = fnv1a(*hash, buffer, numBytes);
+    *size += numBytes;
+  }
+  return eIasOk;
+}
+
+/*
+ * Function to get a IasTopologyCache::IasResult as string.
+ */
+#define STRING_RETURN_CASE(name) case name: return std::string(#name); break
+#define DEFAULT_STRING(name) default: return std::string(name)
+std::string toString(const IasTopologyCache::IasResult& type)
+{
+  switch(type)
+  {
+    STRING_RETURN_CASE(IasTopologyCache::eIasOk);
+    STRING_RETURN_CASE(IasTopologyCache::eIasFailed);
+    STRING_RETURN_CASE(IasTopologyCache::eIasNotFound);
+    STRING_RETURN_CASE(IasTopologyCache::eIasOutdated);
+    STRING_RETURN_CASE(IasTopologyCache::eIasInvalid);
+    DEFAULT_STRING("Invalid IasTopologyCache::IasResult => " + std::to_string(type));
+  }
+}
+
+} // namespace IasAudio
@@ -10,6 +10,7 @@
  *
  */
 
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 #include <math.h>
@@ -509,6 +510,15 @@ IasAudioProcessingResult IasEqualizerCore::getNumFiltersForChannel(int32_t strea
 
 
 IasAudioProcessingResult IasEqualizerCore::setFiltersSingleStream(int32_t streamId,std::vector<uint32_t> const &channelIdTable, std::vector<IasAudioFilterParams> const &filterParamsTable)
+{
+  return setFiltersSingleStream(streamId, channelIdTable, filterParamsTable, nullptr);
+}
+
+
+IasAudioProcessingResult IasEqualizerCore::setFiltersSingleStream(int32_t streamId,
+                                                                  std::vector<uint32_t> const &channelIdTable,
+                                                                  std::vector<IasAudioFilterParams> const &filterParamsTable,
+                                                                  IasEqualizerSnapshot *snapshot)
 {
   DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, ": setting parameters for stream with streamId=", streamId);
   const IasStreamParamsMultimap &streamParams = mConfig->getStreamParams();
@@ -518,6 +528,21 @@ IasAudioProcessingResult IasEqualizerCore::setFiltersSingleStream(int32_t stream
   int32_t  status = 0;
   uint32_t cntChannelsOfThisStream = 0;                                      // This counter might span over several bundles.
   uint32_t const numFilters = static_cast<uint32_t>(filterParamsTable.size());  // Number of filters that are part of the cascade.
+  // Either pass the update to the filter stage, or add it to the snapshot.
+  auto setChannelFilter = [this, snapshot](uint32_t bundleIndex, uint32_t stageIndex, uint32_t channel, IasAudioFilterParams const &params)
+  {
+    IasAudioFilter *filter = mFilters[bundleIndex][stageIndex];
+    if (snapshot == nullptr)
+    {
+      return filter->setChannelFilter(channel, &params);
+    }
+    IasEqualizerSnapshot::IasPreparedUpdate update;
+    update.bundleIndex = bundleIndex;
+    update.stageIndex  = stageIndex;
+    int32_t result = filter->prepareChannelFilter(channel, &params, &update.updateEntry);
+    snapshot->mPreparedUpdates.push_back(update);
+    return result;
+  };
   // Check whether the streamId is known.
   IasEqualizerCoreStreamStatusMap::const_iterator streamStatusIt = mStreamStatusMap.find(streamId);
 
@@ -545,7 +570,6 @@ IasAudioProcessingResult IasEqualizerCore::setFiltersSingleStream(int32_t stream
     uint32_t const bundleIndex    = streamParamsIt->second->getBundleIndex();
     uint32_t const channelIndex   = streamParamsIt->second->getChannelIndex();
     uint32_t const numberChannels = streamParamsIt->second->getNumberChannels();
-    IasAudioFilter** filters   = mFilters[bundleIndex];
     // Loop over all channels within this bundle, which belong to this stream.
     for (uint32_t cntChannels=0; cntChannels < numberChannels; cntChannels++)
     {
@@ -555,6 +579,7 @@ IasAudioProcessingResult IasEqualizerCore::setFiltersSingleStream(int32_t stream
       if ((channelIdTable.size() == 0) ||
           (std::find(channelIdTable.begin(), channelIdTable.end(), cntChannelsOfThisStream) != channelIdTable.end()))
       {
+        IasEqualizerCoreChannelParams &channelParams = getChannelParams(bundleIndex, channelIndex+cntChannels, snapshot);
         // Loop over all filters that are part of the cascade.
         uint32_t cntFilterStages = 0;
         for (uint32_t cntFilters=0; cntFilters < numFilters; cntFilters++)
@@ -562,8 +587,8 @@ IasAudioProcessingResult IasEqualizerCore::setFiltersSingleStream(int32_t stream
           IasAudioFilterParams tempFilterParams = filterParamsTable[cntFilters];
 
           uint32_t          numSections      = (tempFilterParams.order+1)>>1;
-          mChannelParams[bundleIndex][channelIndex+cntChannels].filterStageIndexTab[cntFilters] = cntFilterStages;
-          mChannelParams[bundleIndex][channelIndex+cntChannels].filterParamsTab[cntFilters]     = tempFilterParams;
+          channelParams.filterStageIndexTab[cntFilters] = cntFilterStages;
+          channelParams.filterParamsTab[cntFilters]     = tempFilterParams;
           // One filter can consist of several sections (namely, if the filter order is > 2).
           // This is the loop over the filter sections, which all belong to one filter.
           for (uint32_t cntSections = 0; cntSections < numSections; cntSections++)
@@ -575,23 +600,24 @@ IasAudioProcessingResult IasEqualizerCore::setFiltersSingleStream(int32_t stream
             }
             tempFilterParams.section = cntSections+1;
 
-            status |= filters[cntFilterStages]->setChannelFilter(channelIndex+cntChannels, &tempFilterParams);
+            status |= setChannelFilter(bundleIndex, cntFilterStages, channelIndex+cntChannels, tempFilterParams);
             cntFilterStages++;
           }
         }
-        mChannelParams[bundleIndex][channelIndex+cntChannels].numActiveFilterStages = cntFilterStages;
-        mChannelParams[bundleIndex][channelIndex+cntChannels].numActiveFilters      = numFilters;
+        channelParams.numActiveFilterStages = cntFilterStages;
+        channelParams.numActiveFilters      = numFilters;
         // Loop over all remaining filter stages (inactive stages)
         for (  ; cntFilterStages < mNumFilterStagesMax; cntFilterStages++)
         {
-          filters[cntFilterStages]->setChannelFilter(channelIndex+cntChannels, &flatFilterParams);
+          setChannelFilter(bundleIndex, cntFilterStages, channelIndex+cntChannels, flatFilterParams);
         }
       }
       cntChannelsOfThisStream++;
     }
   }
   // Now we have to update for each bundle the number of active filter stages.
-  for (uint32_t cntBundles = 0; cntBundles < mNumBundles; cntBundles++)
+  // A snapshot updates them when all of its streams have been prepared.
+  for (uint32_t cntBundles = 0; (cntBundles < mNumBundles) && (snapshot == nullptr); cntBundles++)
   {
     uint32_t numActiveFilterStages = 0;
     for (uint32_t cntChannels = 0; cntChannels < cIasNumChannelsPerBundle; cntChannels++)
@@ -613,6 +639,126 @@ IasAudioProcessingResult IasEqualizerCore::setFiltersSingleStream(int32_t stream
 }
 
 
+IasAudioProcessingResult IasEqualizerCore::prepareParameterSnapshot(IasParameterSnapshot &snapshot)
+{
+  IasEqualizerSnapshot *equalizerSnapshot = dynamic_cast<IasEqualizerSnapshot*>(&snapshot);
+  if (equalizerSnapshot == nullptr)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "snapshot is not an IasEqualizerSnapshot");
+    return eIasAudioProcInvalidParam;
+  }
+  // The streams are prepared on a copy of the channel parameters, so the equalizer is not changed by an invalid snapshot.
+  uint32_t const numChannels = mNumBundles * cIasNumChannelsPerBundle;
+  equalizerSnapshot->mPreparedUpdates.clear();
+  equalizerSnapshot->mChannelParams.resize(numChannels);
+  equalizerSnapshot->mFilterParamsTabs.resize(numChannels * mNumFilterStagesMax);
+  equalizerSnapshot->mFilterStageIndexTabs.resize(numChannels * mNumFilterStagesMax);
+  for (uint32_t cntBundles = 0; cntBundles < mNumBundles; cntBundles++)
+  {
+    for (uint32_t cntChannels = 0; cntChannels < cIasNumChannelsPerBundle; cntChannels++)
+    {
+      uint32_t const index = cntBundles * cIasNumChannelsPerBundle + cntChannels;
+      IasEqualizerCoreChannelParams &channelParams = equalizerSnapshot->mChannelParams[index];
+      channelParams.filterParamsTab     = &equalizerSnapshot->mFilterParamsTabs[index * mNumFilterStagesMax];
+      channelParams.filterStageIndexTab = &equalizerSnapshot->mFilterStageIndexTabs[index * mNumFilterStagesMax];
+      copyChannelParams(mChannelParams[cntBundles][cntChannels], channelParams);
+    }
+  }
+  for (auto &stream : equalizerSnapshot->mStreams)
+  {
+    IasAudioProcessingResult result = setFiltersSingleStream(stream.streamId, stream.channelIdTable, stream.filterParamsTable, equalizerSnapshot);
+    if (result != eIasAudioProcOK)
+    {
+      return result;
+    }
+  }
+  // The number of active filter stages of each bundle is taken from the copy, because
+  // mBundleParams is owned by the processing thread while snapshots are applied.
+  equalizerSnapshot->mNumActiveFilterStages.assign(mNumBundles, 0);
+  for (uint32_t cntBundles = 0; cntBundles < mNumBundles; cntBundles++)
+  {
+    for (uint32_t cntChannels = 0; cntChannels < cIasNumChannelsPerBundle; cntChannels++)
+    {
+      uint32_t const numActiveFilterStages = getChannelParams(cntBundles, cntChannels, equalizerSnapshot).numActiveFilterStages;
+      if (equalizerSnapshot->mNumActiveFilterStages[cntBundles] < numActiveFilterStages)
+      {
+        equalizerSnapshot->mNumActiveFilterStages[cntBundles] = numActiveFilterStages;
+      }
+    }
+  }
+  // The snapshot is valid, so the equalizer adopts the channel parameters of the snapshot.
+  for (uint32_t cntBundles = 0; cntBundles < mNumBundles; cntBundles++)
+  {
+    for (uint32_t cntChannels = 0; cntChannels < cIasNumChannelsPerBundle; cntChannels++)
+    {
+      copyChannelParams(getChannelParams(cntBundles, cntChannels, equalizerSnapshot), mChannelParams[cntBundles][cntChannels]);
+    }
+  }
+  DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Prepared snapshot with", equalizerSnapshot->mPreparedUpdates.size(), "filter stage updates");
+  return eIasAudioProcOK;
+}
+
+
+IasEqualizerCoreChannelParams& IasEqualizerCore::getChannelParams(uint32_t bundleIndex, uint32_t channel, IasEqualizerSnapshot *snapshot)
+{
+  if (snapshot != nullptr)
+  {
+    return snapshot->mChannelParams[bundleIndex * cIasNumChannelsPerBundle + channel];
+  }
+  return mChannelParams[bundleIndex][channel];
+}
+
+
+void IasEqualizerCore::copyChannelParams(IasEqualizerCoreChannelParams const &source, IasEqualizerCoreChannelParams &destination) const
+{
+  destination.numActiveFilters      = source.numActiveFilters;
+  destination.numActiveFilterStages = source.numActiveFilterStages;
+  std::copy(source.filterParamsTab, source.filterParamsTab + mNumFilterStagesMax, destination.filterParamsTab);
+  std::copy(source.filterStageIndexTab, source.filterStageIndexTab + mNumFilterStagesMax, destination.filterStageIndexTab);
+}
+
+
+void IasEqualizerCore::applyParameterSnapshot(const IasParameterSnapshot &snapshot)
+{
+  // The type has been verified by prepareParameterSnapshot().
+  const IasEqualizerSnapshot &equalizerSnapshot = static_cast<const IasEqualizerSnapshot&>(snapshot);
+  for (auto &update : equalizerSnapshot.mPreparedUpdates)
+  {
+    mFilters[update.bundleIndex][update.stageIndex]->applyPreparedUpdate(update.updateEntry);
+  }
+  for (uint32_t cntBundles = 0; cntBundles < mNumBundles; cntBundles++)
+  {
+    mBundleParams[cntBundles].numActiveFilterStages = equalizerSnapshot.mNumActiveFilterStages[cntBundles];
+  }
+}
+
+
+IasEqualizerSnapshot::IasEqualizerSnapshot()
+  :IasParameterSnapshot()
+  ,mStreams()
+  ,mPreparedUpdates()
+  ,mNumActiveFilterStages()
+{
+}
+
+
+IasEqualizerSnapshot::~IasEqualizerSnapshot()
+{
+}
+
+
+void IasEqualizerSnapshot::addStream(int32_t streamId,
+                                     std::vector<uint32_t> const &channelIdTable,
+                                     std::vector<IasAudioFilterParams> const &filterParamsTable)
+{
+  IasStreamFilters streamFilters;
+  streamFilters.streamId          = streamId;
+  streamFilters.channelIdTable    = channelIdTable;
+  streamFilters.filterParamsTable = filterParamsTable;
+  mStreams.push_back(streamFilters);
+}
+
+
 void IasEqualizerCore::gainRampingFinished(uint32_t channel, float gain, uint64_t callbackUserData)
 {
   (void) channel;
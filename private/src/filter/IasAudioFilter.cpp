@@ -15,6 +15,7 @@
 #include <iostream>
 #include <xmmintrin.h>
 #include <emmintrin.h>
+#include <immintrin.h>
 #include <malloc.h>
 #include <string.h>
 
@@ -29,6 +30,12 @@
  */
 #define USE_SSE          1
 
+/*
+ *  Switch for the AVX kernel of the double-precision path. The kernel is only
+ *  used if the CPU supports AVX, otherwise the SSE2 kernels are used.
+ */
+#define USE_AVX          1
+
 /*
  *  Switches for overriding the automatic decision what precision shall be used.
  */
@@ -47,6 +54,8 @@ const uint32_t cIasShelvFilterFreqBorder = 200;  //Shelving filter with f <= 200
 const uint32_t cIasHPFilterFreqBorder    = 200;  //Highpass filter with f < 200 Hz need double precision
 const uint32_t cIasLPFilterFreqBorder    = 200;  //Lowpass filter with f < 200 Hz need double precision
 
+const uint32_t cIasAllChannelsMask = (1u << cIasNumChannelsPerBundle) - 1; //Precision mask if all channels need double precision
+
 
 /*
  * Define minimum and maximum values for the filter parameters.
@@ -482,6 +491,66 @@ static int32_t calculateBiquadCoeff(float        *coeffs,
 }
 
 
+#if USE_SSE && USE_AVX
+
+/*!
+ * @brief Internal helper function that executes the filter for one frame in double precision
+ *        using AVX.
+ *
+ * In contrast to the SSE2 variant, which processes two channels per register, all four
+ * channels of the bundle are processed within one AVX register. The coefficients and
+ * state variables have the same layout as for the SSE2 variant. Must only be called if
+ * the CPU supports AVX.
+ *
+ * @param[in,out] bundleData  Interleaved audio data of the bundle.
+ * @param[in]     frameLength Number of samples per channel.
+ * @param[in]     coeffs64    Double-precision coefficients of the bundle.
+ * @param[in,out] vars64      Double-precision state variables of the bundle.
+ */
+__attribute__((target("avx")))
+static void calculateBundleAvx(float *bundleData, uint32_t frameLength,
+                               double const *coeffs64, double *vars64)
+{
+  // Coefficients
+  __m256d const b0 = _mm256_load_pd(coeffs64);
+  __m256d const b1 = _mm256_load_pd(coeffs64 +   cIasNumChannelsPerBundle);
+  __m256d const b2 = _mm256_load_pd(coeffs64 + 2*cIasNumChannelsPerBundle);
+  __m256d const a1 = _mm256_load_pd(coeffs64 + 3*cIasNumChannelsPerBundle);
+  __m256d const a2 = _mm256_load_pd(coeffs64 + 4*cIasNumChannelsPerBundle);
+
+  // States
+  __m256d x1 = _mm256_load_pd(vars64); // x(n-1)
+  __m256d x2 = _mm256_load_pd(vars64 +   cIasNumChannelsPerBundle); // x(n-2)
+  __m256d y1 = _mm256_load_pd(vars64 + 2*cIasNumChannelsPerBundle); // y(n-1)
+  __m256d y2 = _mm256_load_pd(vars64 + 3*cIasNumChannelsPerBundle); // y(n-2)
+
+  for (uint32_t i=0; i < frameLength; i++)
+  {
+    // Convert the four single-precision (SP) input samples to double precision (DP).
+    __m256d const input  = _mm256_cvtps_pd(_mm_load_ps(bundleData));
+    __m256d const output = (_mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(input, b0),    // x(n)*b0
+                                                        _mm256_add_pd(_mm256_mul_pd(x1, b1),    // x(n-1)*b1
+                                                                      _mm256_mul_pd(x2, b2))),  // x(n-2)*b2
+                                          _mm256_add_pd(              _mm256_mul_pd(y1, a1),    // y(n-1)*a1
+                                                                      _mm256_mul_pd(y2, a2)))); // y(n-2)*a2
+    x2 = x1;     //x(n-2) = x(n-1)
+    x1 = input;  //x(n-1) = x(n)
+    y2 = y1;     //y(n-2) = y(n-1)
+    y1 = output; //y(n-1) = y(n)
+    _mm_store_ps(bundleData, _mm256_cvtpd_ps(output));
+    bundleData += cIasNumChannelsPerBundle;
+  }
+
+  // Save states for the next frame to be processed.
+  _mm256_store_pd(vars64,                              x1);
+  _mm256_store_pd(vars64 +   cIasNumChannelsPerBundle, x2);
+  _mm256_store_pd(vars64 + 2*cIasNumChannelsPerBundle, y1);
+  _mm256_store_pd(vars64 + 3*cIasNumChannelsPerBundle, y2);
+}
+
+#endif // USE_SSE && USE_AVX
+
+
 /*
  * ===================================
  * Methods of the class IasAudioFilter
@@ -500,10 +569,23 @@ IasAudioFilter::IasAudioFilter(uint32_t sampleFreq,uint32_t frameLength)
   ,mStateVars64(NULL)
   ,mCoeffsBundle64(NULL)
   ,mCoeffs64(NULL)
+  ,mCoeffsStartBundle(NULL)
+  ,mCoeffsDeltaBundle(NULL)
+  ,mCoeffsStartBundle64(NULL)
+  ,mCoeffsDeltaBundle64(NULL)
   ,mBundle(NULL)
   ,mCallback(NULL)
+  ,mUseAvx(false)
+  ,mUpdateSequenceNumber(0)
   ,mLogContext(IasAudioLogging::registerDltContext("_FIL", "Log of Audio Filter Module"))
 {
+  setUseAvx(true);
+  for (uint32_t channel=0; channel<cIasNumChannelsPerBundle; channel++)
+  {
+    mClearStatesPending[channel] = false;
+    // The first update has the sequence number 0, so it is newer than the initial value.
+    mAppliedSequenceNumber[channel] = static_cast<uint32_t>(-1);
+  }
 }
 
 // Destructor
@@ -525,6 +607,14 @@ IasAudioFilter::~IasAudioFilter()
   mCoeffs = NULL;
   free(mCoeffs64);
   mCoeffs64 = NULL;
+  free(mCoeffsStartBundle);
+  mCoeffsStartBundle = NULL;
+  free(mCoeffsDeltaBundle);
+  mCoeffsDeltaBundle = NULL;
+  free(mCoeffsStartBundle64);
+  mCoeffsStartBundle64 = NULL;
+  free(mCoeffsDeltaBundle64);
+  mCoeffsDeltaBundle64 = NULL;
   DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, "IasAudioFilter::~IasAudioFilter: Deleted");
 }
 
@@ -561,6 +651,7 @@ int32_t IasAudioFilter::updateGain(uint32_t channel, float gain)
   updateEntry.gainNew            = gain;
   updateEntry.useDoublePrecision = mFilterParamsInternal[channel].useDoublePrecision;
   updateEntry.clearStates        = false;
+  updateEntry.sequenceNumber     = mUpdateSequenceNumber++;
 
   status = calculateBiquadCoeff(updateEntry.biquadCoeffs32,
                                 updateEntry.biquadCoeffs64,
@@ -571,7 +662,7 @@ int32_t IasAudioFilter::updateGain(uint32_t channel, float gain)
                                 mFilterParams[channel].type,
                                 mFilterParams[channel].order,
                                 mFilterParams[channel].section);
-  filterUpdateQueue.push(updateEntry);
+  mImmediateUpdateMailboxes[channel].post(updateEntry);
 
   return status;
 }
@@ -616,7 +707,8 @@ int32_t IasAudioFilter::rampGain(uint32_t  channel,
   updateEntry.factorRampUp     = mFilterParamsInternal[channel].factorRampUp;
   updateEntry.factorRampDown   = mFilterParamsInternal[channel].factorRampDown;
   updateEntry.callbackUserData = callbackUserData;
-  filterUpdateQueue.push(updateEntry);
+  updateEntry.sequenceNumber   = mUpdateSequenceNumber++;
+  mRampedUpdateMailboxes[channel].post(updateEntry);
 
   return 0;
 }
@@ -624,8 +716,42 @@ int32_t IasAudioFilter::rampGain(uint32_t  channel,
 
 int32_t IasAudioFilter::setChannelFilter(uint32_t channel, IasAudioFilterParams const * params )
 {
-  int32_t status = 0;
+  IasAudioFilterQueueEntry updateEntry;
+  int32_t status = prepareChannelFilter(channel, params, &updateEntry);
+  if (status != 0)
+  {
+    return status;
+  }
+  storeChannelParams(updateEntry);
+  // A later gain update of the same channel may replace this update in the mailbox
+  // before it is adopted, so the request to clear the states is kept separately.
+  mClearStatesPending[channel] = true;
+  mImmediateUpdateMailboxes[channel].post(updateEntry);
+
+  return status;
+}
+
+
+bool IasAudioFilter::setUseAvx(bool useAvx)
+{
+  mUseAvx = false;
+#if USE_AVX
+  mUseAvx = useAvx && (__builtin_cpu_supports("avx") != 0);
+#else
+  (void)useAvx;
+#endif
+  return mUseAvx;
+}
+
 
+int32_t IasAudioFilter::prepareChannelFilter(uint32_t channel, IasAudioFilterParams const * params, IasAudioFilterQueueEntry *updateEntry)
+{
+  if (updateEntry == NULL)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR,
+                    "IasAudioFilter::prepareChannelFilter: Error: updateEntry pointer is NULL");
+    return -1;
+  }
   if (params == NULL)
   {
     DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR,
@@ -697,31 +823,55 @@ int32_t IasAudioFilter::setChannelFilter(uint32_t channel, IasAudioFilterParams
 
   DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, "Double precision for channel ", channel," is ", useDoublePrecision);
 
-  // Store the new filter parameters.
-  mFilterParams[channel] = *params;
-  mFilterParamsInternal[channel].preWarpedFreq = preWarpedFreq;
-  mFilterParamsInternal[channel].useDoublePrecision = useDoublePrecision;
+  // Prepare the update entry. The filter parameters of the channel are stored
+  // only when the update is adopted.
+  memset(updateEntry, 0, sizeof(*updateEntry));
+  updateEntry->channel            = channel;
+  updateEntry->rampedUpdate       = false;
+  updateEntry->gainNew            = params->gain;
+  updateEntry->preWarpedFreq      = preWarpedFreq;
+  updateEntry->quality            = params->quality;
+  updateEntry->type               = params->type;
+  updateEntry->order              = params->order;
+  updateEntry->section            = params->section;
+  updateEntry->freq               = params->freq;
+  updateEntry->useDoublePrecision = useDoublePrecision;
+  updateEntry->clearStates        = true;
+  updateEntry->sequenceNumber     = mUpdateSequenceNumber++;
+  return calculateBiquadCoeff(updateEntry->biquadCoeffs32,
+                              updateEntry->biquadCoeffs64,
+                              1,
+                              preWarpedFreq,
+                              params->gain,
+                              params->quality,
+                              params->type,
+                              params->order,
+                              params->section);
+}
 
-  // Prepare the update entry and push it into the queue.
-  IasAudioFilterQueueEntry updateEntry;
-  memset(&updateEntry, 0, sizeof(updateEntry));
-  updateEntry.channel            = channel;
-  updateEntry.rampedUpdate       = false;
-  updateEntry.gainNew            = params->gain;
-  updateEntry.useDoublePrecision = useDoublePrecision;
-  updateEntry.clearStates        = true;
-  status = calculateBiquadCoeff(updateEntry.biquadCoeffs32,
-                                updateEntry.biquadCoeffs64,
-                                1,
-                                mFilterParamsInternal[channel].preWarpedFreq,
-                                mFilterParams[channel].gain,
-                                mFilterParams[channel].quality,
-                                mFilterParams[channel].type,
-                                mFilterParams[channel].order,
-                                mFilterParams[channel].section);
-  filterUpdateQueue.push(updateEntry);
 
-  return status;
+void IasAudioFilter::applyPreparedUpdate(IasAudioFilterQueueEntry const &updateEntry)
+{
+  // Skip the prepared update if a later update has already been adopted.
+  if (static_cast<int32_t>(updateEntry.sequenceNumber - mAppliedSequenceNumber[updateEntry.channel]) > 0)
+  {
+    storeChannelParams(updateEntry);
+    applyImmediateUpdate(updateEntry);
+  }
+}
+
+
+void IasAudioFilter::storeChannelParams(IasAudioFilterQueueEntry const &updateEntry)
+{
+  uint32_t channel = updateEntry.channel;
+  mFilterParams[channel].freq    = updateEntry.freq;
+  mFilterParams[channel].gain    = updateEntry.gainNew;
+  mFilterParams[channel].quality = updateEntry.quality;
+  mFilterParams[channel].type    = updateEntry.type;
+  mFilterParams[channel].order   = updateEntry.order;
+  mFilterParams[channel].section = updateEntry.section;
+  mFilterParamsInternal[channel].preWarpedFreq      = updateEntry.preWarpedFreq;
+  mFilterParamsInternal[channel].useDoublePrecision = updateEntry.useDoublePrecision;
 }
 
 
@@ -749,84 +899,125 @@ int32_t IasAudioFilter::setRampGradient(uint32_t channel, float gradient)
 }
 
 
+void IasAudioFilter::applyRampedUpdate(IasAudioFilterQueueEntry const &updateEntry)
+{
+  uint32_t channel = updateEntry.channel;
+  mAppliedSequenceNumber[channel] = updateEntry.sequenceNumber;
+  // Ramped update: adopt all parameters that are required for ramping the filter gain.
+  mProcessingParams[channel].gainTarget       = updateEntry.gainNew;
+  mProcessingParams[channel].preWarpedFreq    = updateEntry.preWarpedFreq;
+  mProcessingParams[channel].quality          = updateEntry.quality;
+  mProcessingParams[channel].type             = updateEntry.type;
+  mProcessingParams[channel].order            = updateEntry.order;
+  mProcessingParams[channel].section          = updateEntry.section;
+  mProcessingParams[channel].factorRampUp     = updateEntry.factorRampUp;
+  mProcessingParams[channel].factorRampDown   = updateEntry.factorRampDown;
+  mProcessingParams[channel].callbackUserData = updateEntry.callbackUserData;
+  mProcessingParams[channel].isRamping        = true;
+}
+
+
+void IasAudioFilter::applyImmediateUpdate(IasAudioFilterQueueEntry const &updateEntry)
+{
+  uint32_t channel = updateEntry.channel;
+  mAppliedSequenceNumber[channel] = updateEntry.sequenceNumber;
+  // Immediate update: copy the new filter coefficients into the working coefficient set.
+  const float* coeffsNew      = updateEntry.biquadCoeffs32;
+  const double* coeffsNew64    = updateEntry.biquadCoeffs64;
+  float* coeffsActual   = mCoeffsBundle+channel;
+  double* coeffsActual64 = mCoeffsBundle64+channel;
+  for (uint32_t cnt=0; cnt<cIasNumCoeffsBiquad; cnt++)
+  {
+    *coeffsActual   = *coeffsNew;
+    *coeffsActual64 = *coeffsNew64;
+    coeffsNew      += 1;
+    coeffsActual   += cIasNumChannelsPerBundle;
+    coeffsNew64    += 1;
+    coeffsActual64 += cIasNumChannelsPerBundle;
+  }
+
+  // If requested: reset the state variables for this channel to zero. The request might
+  // belong to an update that has been replaced by a later one before it was adopted.
+  if (mClearStatesPending[channel].exchange(false) || updateEntry.clearStates)
+  {
+    float* stateVars      = mStateVarsBundle+channel;
+    double* stateVars64    = mStateVarsBundle64+channel;
+    for (uint32_t cnt=0; cnt<cIasNumStateVarsBiquad; cnt++)
+    {
+      *stateVars   = 0.0f;
+      *stateVars64 = 0.0;
+      stateVars   += cIasNumChannelsPerBundle;
+      stateVars64 += cIasNumChannelsPerBundle;
+    }
+  }
+
+  // If the ramp generator for this channel was still active, execute the
+  // callback function with the updated gain setting so that the software
+  // alyer above knows that the ramp has been finished now.
+  if (mProcessingParams[channel].isRamping && mCallback)
+  {
+    mCallback->gainRampingFinished(channel, updateEntry.gainNew, mProcessingParams[channel].callbackUserData);
+  }
+
+  // Store the updated params.
+  mProcessingParams[channel].gainCurrent = updateEntry.gainNew;
+  mProcessingParams[channel].useDoublePrecision = updateEntry.useDoublePrecision;
+  mProcessingParams[channel].isRamping   = false;
+}
+
+
 /*
  *  This is the process() function.
  */
 void IasAudioFilter::calculate()
 {
-  uint32_t channel;
-  IasAudioFilterQueueEntry updateEntry;
-  memset(&updateEntry, 0, sizeof(updateEntry));
-
-  // Process all updates from the queue.
-  while(filterUpdateQueue.try_pop(updateEntry))
+  // Adopt the latest updates of each channel. If both an immediate and a ramped
+  // update are pending, they are adopted in the order they have been requested.
+  for (uint32_t channel=0; channel<cIasNumChannelsPerBundle; channel++)
   {
-    channel = updateEntry.channel;
-    if (updateEntry.rampedUpdate)
+    IasAudioFilterQueueEntry *immediateUpdate = mImmediateUpdateMailboxes[channel].fetch();
+    IasAudioFilterQueueEntry *rampedUpdate    = mRampedUpdateMailboxes[channel].fetch();
+    // Discard updates that have been overtaken by a prepared update adopted via applyPreparedUpdate().
+    if ((immediateUpdate != NULL) &&
+        (static_cast<int32_t>(immediateUpdate->sequenceNumber - mAppliedSequenceNumber[channel]) <= 0))
     {
-      // Ramped update: adopt all parameters that are required for ramping the filter gain.
-      mProcessingParams[channel].gainTarget       = updateEntry.gainNew;
-      mProcessingParams[channel].preWarpedFreq    = updateEntry.preWarpedFreq;
-      mProcessingParams[channel].quality          = updateEntry.quality;
-      mProcessingParams[channel].type             = updateEntry.type;
-      mProcessingParams[channel].order            = updateEntry.order;
-      mProcessingParams[channel].section          = updateEntry.section;
-      mProcessingParams[channel].factorRampUp     = updateEntry.factorRampUp;
-      mProcessingParams[channel].factorRampDown   = updateEntry.factorRampDown;
-      mProcessingParams[channel].callbackUserData = updateEntry.callbackUserData;
-      mProcessingParams[channel].isRamping        = true;
+      immediateUpdate = NULL;
     }
-    else
+    if ((rampedUpdate != NULL) &&
+        (static_cast<int32_t>(rampedUpdate->sequenceNumber - mAppliedSequenceNumber[channel]) <= 0))
     {
-      // Immediate update: copy the new filter coefficients into the working coefficient set.
-      float* coeffsNew      = updateEntry.biquadCoeffs32;
-      double* coeffsNew64    = updateEntry.biquadCoeffs64;
-      float* coeffsActual   = mCoeffsBundle+channel;
-      double* coeffsActual64 = mCoeffsBundle64+channel;
-      for (uint32_t cnt=0; cnt<cIasNumCoeffsBiquad; cnt++)
-      {
-        *coeffsActual   = *coeffsNew;
-        *coeffsActual64 = *coeffsNew64;
-        coeffsNew      += 1;
-        coeffsActual   += cIasNumChannelsPerBundle;
-        coeffsNew64    += 1;
-        coeffsActual64 += cIasNumChannelsPerBundle;
-      }
-
-      // If requested: reset the state variables for this channel to zero.
-      if (updateEntry.clearStates)
-      {
-        float* stateVars      = mStateVarsBundle+channel;
-        double* stateVars64    = mStateVarsBundle64+channel;
-        for (uint32_t cnt=0; cnt<cIasNumStateVarsBiquad; cnt++)
-        {
-          *stateVars   = 0.0f;
-          *stateVars64 = 0.0;
-          stateVars   += cIasNumChannelsPerBundle;
-          stateVars64 += cIasNumChannelsPerBundle;
-        }
-      }
-
-      // If the ramp generator for this channel was still active, execute the
-      // callback function with the updated gain setting so that the software
-      // alyer above knows that the ramp has been finished now.
-      if (mProcessingParams[channel].isRamping && mCallback)
-      {
-        mCallback->gainRampingFinished(channel, updateEntry.gainNew, mProcessingParams[channel].callbackUserData);
-      }
-
-      // Store the updated params.
-      mProcessingParams[channel].gainCurrent = updateEntry.gainNew;
-      mProcessingParams[channel].useDoublePrecision = updateEntry.useDoublePrecision;
-      mProcessingParams[channel].isRamping   = false;
+      rampedUpdate = NULL;
+    }
+    if ((immediateUpdate != NULL) && (rampedUpdate != NULL) &&
+        (static_cast<int32_t>(rampedUpdate->sequenceNumber - immediateUpdate->sequenceNumber) > 0))
+    {
+      applyImmediateUpdate(*immediateUpdate);
+      immediateUpdate = NULL;
+    }
+    if (rampedUpdate != NULL)
+    {
+      applyRampedUpdate(*rampedUpdate);
+    }
+    if (immediateUpdate != NULL)
+    {
+      applyImmediateUpdate(*immediateUpdate);
     }
   }
 
   // Check for each channel, whether the filter gain has to be ramped up/down.
+  // While ramping, the coefficients are interpolated within the frame from their
+  // current values to the values of the new gain, see calculateInterpolated().
+  bool interpolateCoeffs = false;
   for (uint32_t channel=0; channel<cIasNumChannelsPerBundle; channel++)
   {
     if (mProcessingParams[channel].isRamping)
     {
+      if (!interpolateCoeffs)
+      {
+        memcpy(mCoeffsStartBundle,   mCoeffsBundle,   cIasNumCoeffsBiquad*cIasNumChannelsPerBundle*sizeof(float));
+        memcpy(mCoeffsStartBundle64, mCoeffsBundle64, cIasNumCoeffsBiquad*cIasNumChannelsPerBundle*sizeof(double));
+        interpolateCoeffs = true;
+      }
       float gainTarget  = mProcessingParams[channel].gainTarget;
 
       if (mProcessingParams[channel].gainCurrent <= gainTarget)
@@ -876,21 +1067,45 @@ void IasAudioFilter::calculate()
     }
   }
 
-  bool useDoublePrecision = ( mProcessingParams[0].useDoublePrecision ||
-                                   mProcessingParams[1].useDoublePrecision ||
-                                   mProcessingParams[2].useDoublePrecision ||
-                                   mProcessingParams[3].useDoublePrecision);
+  // One bit per channel that needs double precision. The generic implementation selects the
+  // precision per channel. The SIMD implementations process the whole bundle in double precision
+  // if at least one channel needs it, because the four channels share one register. With AVX,
+  // the double-precision kernel is about as fast as the single-precision kernel, since the
+  // filter recursion is bound by latency rather than by the number of channels per register.
+  uint32_t doublePrecisionMask = 0;
+  for (uint32_t channel=0; channel<cIasNumChannelsPerBundle; channel++)
+  {
+    if (mProcessingParams[channel].useDoublePrecision)
+    {
+      doublePrecisionMask |= (1u << channel);
+    }
+  }
 
 #if ENFORCE_FLOAT32
-  useDoublePrecision = false;
+  doublePrecisionMask = 0;
 #endif
 #if ENFORCE_FLOAT64
-  useDoublePrecision = true;
+  doublePrecisionMask = cIasAllChannelsMask;
 #endif
 
+  bool useDoublePrecision = (doublePrecisionMask != 0);
+
+  if (interpolateCoeffs)
+  {
+    float  const cInvFrameLength   = 1.0f / static_cast<float>(mFrameLength);
+    double const cInvFrameLength64 = 1.0  / static_cast<double>(mFrameLength);
+    for (uint32_t cnt=0; cnt<cIasNumCoeffsBiquad*cIasNumChannelsPerBundle; cnt++)
+    {
+      mCoeffsDeltaBundle[cnt]   = (mCoeffsBundle[cnt]   - mCoeffsStartBundle[cnt])   * cInvFrameLength;
+      mCoeffsDeltaBundle64[cnt] = (mCoeffsBundle64[cnt] - mCoeffsStartBundle64[cnt]) * cInvFrameLength64;
+    }
+    calculateInterpolated(useDoublePrecision);
+    return;
+  }
+
 #if USE_SSE
 
-  if(!useDoublePrecision)
+  if (!useDoublePrecision)
   {
     /*
      * Variables that are required for both SSE-implmentation (Intel and Gnu compiler)
@@ -1016,6 +1231,12 @@ void IasAudioFilter::calculate()
     vars[3] = y2;
 #endif
   }
+#if USE_AVX
+  else if (mUseAvx) // doublePrecision -> AVX, all four channels within one register
+  {
+    calculateBundleAvx(mBundle->getAudioDataPointer(), mFrameLength, mCoeffsBundle64, mStateVarsBundle64);
+  }
+#endif
   else // doublePrecision -> SSE2
   {
     /*
@@ -1166,7 +1387,6 @@ void IasAudioFilter::calculate()
 
 #else // USE_SSE
 
-  if (!useDoublePrecision)
   {
     /*
      * Generic C++ implementation (without SSE optimizations) using single precision
@@ -1175,9 +1395,13 @@ void IasAudioFilter::calculate()
     float       *vars       = mStateVarsBundle;
     float        output;
 
-    // Loop over all channels that belong to this bundle.
+    // Loop over all channels that belong to this bundle and that do not need double precision.
     for (uint32_t chan=0; chan < cIasNumChannelsPerBundle; chan++)
     {
+      if (doublePrecisionMask & (1u << chan))
+      {
+        continue;
+      }
       float       * __restrict bundleData = mBundle->getAudioDataPointer() + chan;
 
       // Coefficients
@@ -1213,7 +1437,6 @@ void IasAudioFilter::calculate()
       vars[chan + 3*cIasNumChannelsPerBundle] = y2;
     }
   }
-  else
   {
     /*
      * Generic C++ implementation (without SSE optimizations) using double precision
@@ -1223,9 +1446,13 @@ void IasAudioFilter::calculate()
     double        output;
     double        input;
 
-    // Loop over all channels that belong to this bundle.
+    // Loop over all channels that belong to this bundle and that need double precision.
     for (uint32_t chan=0; chan < cIasNumChannelsPerBundle; chan++)
     {
+      if ((doublePrecisionMask & (1u << chan)) == 0)
+      {
+        continue;
+      }
       float       * __restrict bundleData = mBundle->getAudioDataPointer() + chan;
 
       // Coefficients
@@ -1266,6 +1493,344 @@ void IasAudioFilter::calculate()
 }
 
 
+/*
+ *  Variant of calculate() for frames during which the coefficients are ramped.
+ *
+ *  The filter is implemented in Direct Form 1, whose state variables are the past input
+ *  and output samples. In contrast to the Direct Form 2 variants, the states do not depend
+ *  on the coefficients, so the coefficients can be changed from one sample to the next
+ *  without causing transients. Since the stability region of (a1, a2) is a triangle, the
+ *  linear interpolation between two stable coefficient sets is stable as well.
+ *
+ *  Channels that are not ramped have a coefficient increment of zero.
+ */
+void IasAudioFilter::calculateInterpolated(bool useDoublePrecision)
+{
+#if USE_SSE
+
+  if (!useDoublePrecision)
+  {
+    __m128       *bundleData = (__m128*)(mBundle->getAudioDataPointer());
+    __m128 const *coeffs     = (__m128*)mCoeffsStartBundle;
+    __m128 const *deltas     = (__m128*)mCoeffsDeltaBundle;
+    __m128 const *targets    = (__m128*)mCoeffsBundle;
+    __m128       *vars       = (__m128*)mStateVarsBundle;
+    __m128        output;
+
+    // Coefficients and their per-sample increments
+    __m128 b0 = coeffs[0];
+    __m128 b1 = coeffs[1];
+    __m128 b2 = coeffs[2];
+    __m128 a1 = coeffs[3];
+    __m128 a2 = coeffs[4];
+    __m128 const db0 = deltas[0];
+    __m128 const db1 = deltas[1];
+    __m128 const db2 = deltas[2];
+    __m128 const da1 = deltas[3];
+    __m128 const da2 = deltas[4];
+
+    // States
+    __m128 x1 = vars[0]; // x(n-1)
+    __m128 x2 = vars[1]; // x(n-2)
+    __m128 y1 = vars[2]; // y(n-1)
+    __m128 y2 = vars[3]; // y(n-2)
+
+    for(uint32_t i=0; i < mFrameLength; i++)
+    {
+      // The last sample of the frame is calculated with the target coefficients. They are
+      // assigned, because the accumulated increments do not hit the targets exactly.
+      if (i + 1 < mFrameLength)
+      {
+        b0 = _mm_add_ps(b0, db0);
+        b1 = _mm_add_ps(b1, db1);
+        b2 = _mm_add_ps(b2, db2);
+        a1 = _mm_add_ps(a1, da1);
+        a2 = _mm_add_ps(a2, da2);
+      }
+      else
+      {
+        b0 = targets[0];
+        b1 = targets[1];
+        b2 = targets[2];
+        a1 = targets[3];
+        a2 = targets[4];
+      }
+
+      output =  (_mm_sub_ps(_mm_add_ps(_mm_mul_ps(*bundleData,   b0),    // x(n)*b0
+                                       _mm_add_ps(_mm_mul_ps(x1, b1),    // x(n-1)*b1
+                                                  _mm_mul_ps(x2, b2))),  // x(n-2)*b2
+                                                  _mm_add_ps(           _mm_mul_ps(y1, a1),    // y(n-1)*a1
+                                                                        _mm_mul_ps(y2, a2)))); // y(n-2)*a2
+
+      x2 = x1;                //x(n-2) = x(n-1)
+      x1 = *bundleData;       //x(n-1) = x(n)
+      y2 = y1;                //y(n-2) = y(n-1)
+      y1 = output;            //y(n-1) = y(n)
+      *bundleData = output;
+      bundleData++;
+    }
+
+    // Save states for the next frame to be processed.
+    vars[0] = x1;
+    vars[1] = x2;
+    vars[2] = y1;
+    vars[3] = y2;
+  }
+  else // doublePrecision -> SSE2, two channels per register like in calculate()
+  {
+    __m128        *bundleData   = (__m128*)(mBundle->getAudioDataPointer());
+    __m128d        bundleDataDP;
+    __m128d const *coeffs       = (__m128d*)mCoeffsStartBundle64;
+    __m128d const *deltas       = (__m128d*)mCoeffsDeltaBundle64;
+    __m128d const *targets      = (__m128d*)mCoeffsBundle64;
+    __m128d       *vars         = (__m128d*)mStateVarsBundle64;
+    __m128d        outputDP;
+    __m128         outputSP_1;
+    __m128         outputSP_2;
+
+    // Coefficients and their per-sample increments
+    __m128d b0_0 = coeffs[0];
+    __m128d b0_1 = coeffs[1];
+    __m128d b1_0 = coeffs[2];
+    __m128d b1_1 = coeffs[3];
+    __m128d b2_0 = coeffs[4];
+    __m128d b2_1 = coeffs[5];
+    __m128d a1_0 = coeffs[6];
+    __m128d a1_1 = coeffs[7];
+    __m128d a2_0 = coeffs[8];
+    __m128d a2_1 = coeffs[9];
+    __m128d const db0_0 = deltas[0];
+    __m128d const db0_1 = deltas[1];
+    __m128d const db1_0 = deltas[2];
+    __m128d const db1_1 = deltas[3];
+    __m128d const db2_0 = deltas[4];
+    __m128d const db2_1 = deltas[5];
+    __m128d const da1_0 = deltas[6];
+    __m128d const da1_1 = deltas[7];
+    __m128d const da2_0 = deltas[8];
+    __m128d const da2_1 = deltas[9];
+
+    // States
+    __m128d x1_0 = vars[0]; // x(n-1)
+    __m128d x1_1 = vars[1]; // x(n-1)
+    __m128d x2_0 = vars[2]; // x(n-2)
+    __m128d x2_1 = vars[3]; // x(n-2)
+    __m128d y1_0 = vars[4]; // y(n-1)
+    __m128d y1_1 = vars[5]; // y(n-1)
+    __m128d y2_0 = vars[6]; // y(n-2)
+    __m128d y2_1 = vars[7]; // y(n-2)
+
+    for(uint32_t i=0; i< mFrameLength; i++)
+    {
+      if (i + 1 < mFrameLength)
+      {
+        b0_0 = _mm_add_pd(b0_0, db0_0);
+        b0_1 = _mm_add_pd(b0_1, db0_1);
+        b1_0 = _mm_add_pd(b1_0, db1_0);
+        b1_1 = _mm_add_pd(b1_1, db1_1);
+        b2_0 = _mm_add_pd(b2_0, db2_0);
+        b2_1 = _mm_add_pd(b2_1, db2_1);
+        a1_0 = _mm_add_pd(a1_0, da1_0);
+        a1_1 = _mm_add_pd(a1_1, da1_1);
+        a2_0 = _mm_add_pd(a2_0, da2_0);
+        a2_1 = _mm_add_pd(a2_1, da2_1);
+      }
+      else
+      {
+        b0_0 = targets[0];
+        b0_1 = targets[1];
+        b1_0 = targets[2];
+        b1_1 = targets[3];
+        b2_0 = targets[4];
+        b2_1 = targets[5];
+        a1_0 = targets[6];
+        a1_1 = targets[7];
+        a2_0 = targets[8];
+        a2_1 = targets[9];
+      }
+
+      // 1st and 2nd channel.
+      bundleDataDP = _mm_cvtps_pd(*bundleData);
+
+      outputDP =  (_mm_sub_pd(_mm_add_pd(_mm_mul_pd(bundleDataDP,    b0_0),    // x(n)*b0
+                                         _mm_add_pd(_mm_mul_pd(x1_0, b1_0),    // x(n-1)*b1
+                                                    _mm_mul_pd(x2_0, b2_0))),  // x(n-2)*b2
+                              _mm_add_pd(           _mm_mul_pd(y1_0, a1_0),    // y(n-1)*a1
+                                                    _mm_mul_pd(y2_0, a2_0)))); // y(n-2)*a2
+
+      x2_0 = x1_0;         //x(n-2) = x(n-1)
+      x1_0 = bundleDataDP; //x(n-1) = x(n)
+      y2_0 = y1_0;         //y(n-2) = y(n-1)
+      y1_0 = outputDP;     //y(n-1) = y(n)
+
+      outputSP_1 = _mm_cvtpd_ps(outputDP);
+
+      // 3rd and 4th channel.
+      bundleDataDP = _mm_cvtps_pd((__m128)(_mm_srli_si128((__m128i)(*bundleData),8)));
+
+      outputDP =  (_mm_sub_pd(_mm_add_pd(_mm_mul_pd(bundleDataDP,    b0_1),    // x(n)*b0
+                                         _mm_add_pd(_mm_mul_pd(x1_1, b1_1),    // x(n-1)*b1
+                                                    _mm_mul_pd(x2_1, b2_1))),  // x(n-2)*b2
+                              _mm_add_pd(           _mm_mul_pd(y1_1, a1_1),    // y(n-1)*a1
+                                                    _mm_mul_pd(y2_1, a2_1)))); // y(n-2)*a2
+
+      x2_1 = x1_1;         //x(n-2) = x(n-1)
+      x1_1 = bundleDataDP; //x(n-1) = x(n)
+      y2_1 = y1_1;         //y(n-2) = y(n-1)
+      y1_1 = outputDP;     //y(n-1) = y(n)
+
+      outputSP_2 = (__m128)(_mm_slli_si128((__m128i)_mm_cvtpd_ps(outputDP),8));
+
+      // Collect all four SP results and store them into the output buffer.
+      *bundleData = _mm_add_ps(outputSP_1, outputSP_2);
+      bundleData++;
+    }
+
+    // Save states for the next frame to be processed.
+    vars[0] = x1_0;
+    vars[1] = x1_1;
+    vars[2] = x2_0;
+    vars[3] = x2_1;
+    vars[4] = y1_0;
+    vars[5] = y1_1;
+    vars[6] = y2_0;
+    vars[7] = y2_1;
+  }
+
+#else // USE_SSE
+
+  // Loop over all channels that belong to this bundle.
+  for (uint32_t chan=0; chan < cIasNumChannelsPerBundle; chan++)
+  {
+    float       * __restrict bundleData = mBundle->getAudioDataPointer() + chan;
+
+    if (!useDoublePrecision)
+    {
+      float const *coeffs = mCoeffsStartBundle;
+      float const *deltas = mCoeffsDeltaBundle;
+      float const *targets = mCoeffsBundle;
+      float       *vars   = mStateVarsBundle;
+      float        output;
+
+      // Coefficients and their per-sample increments
+      float b0 = coeffs[chan];
+      float b1 = coeffs[chan + 1*cIasNumChannelsPerBundle];
+      float b2 = coeffs[chan + 2*cIasNumChannelsPerBundle];
+      float a1 = coeffs[chan + 3*cIasNumChannelsPerBundle];
+      float a2 = coeffs[chan + 4*cIasNumChannelsPerBundle];
+      float const db0 = deltas[chan];
+      float const db1 = deltas[chan + 1*cIasNumChannelsPerBundle];
+      float const db2 = deltas[chan + 2*cIasNumChannelsPerBundle];
+      float const da1 = deltas[chan + 3*cIasNumChannelsPerBundle];
+      float const da2 = deltas[chan + 4*cIasNumChannelsPerBundle];
+
+      // States
+      float x1 = vars[chan]; // x(n-1)
+      float x2 = vars[chan + 1*cIasNumChannelsPerBundle]; // x(n-2)
+      float y1 = vars[chan + 2*cIasNumChannelsPerBundle]; // y(n-1)
+      float y2 = vars[chan + 3*cIasNumChannelsPerBundle]; // y(n-2)
+
+      for (uint32_t i=0; i < mFrameLength; i++)
+      {
+        if (i + 1 < mFrameLength)
+        {
+          b0 += db0;
+          b1 += db1;
+          b2 += db2;
+          a1 += da1;
+          a2 += da2;
+        }
+        else
+        {
+          b0 = targets[chan];
+          b1 = targets[chan + 1*cIasNumChannelsPerBundle];
+          b2 = targets[chan + 2*cIasNumChannelsPerBundle];
+          a1 = targets[chan + 3*cIasNumChannelsPerBundle];
+          a2 = targets[chan + 4*cIasNumChannelsPerBundle];
+        }
+        output = *bundleData*b0 + x1*b1 + x2*b2 - (y1*a1 + y2*a2);
+
+        x2 = x1;                //x(n-2) = x(n-1)
+        x1 = *bundleData;       //x(n-1) = x(n)
+        y2 = y1;                //y(n-2) = y(n-1)
+        y1 = output;            //y(n-1) = y(n)
+        *bundleData = output;
+        bundleData+=4;
+      }
+
+      // Save states for the next frame to be processed.
+      vars[chan] = x1;
+      vars[chan + 1*cIasNumChannelsPerBundle] = x2;
+      vars[chan + 2*cIasNumChannelsPerBundle] = y1;
+      vars[chan + 3*cIasNumChannelsPerBundle] = y2;
+    }
+    else
+    {
+      double const *coeffs = mCoeffsStartBundle64;
+      double const *deltas = mCoeffsDeltaBundle64;
+      double const *targets = mCoeffsBundle64;
+      double       *vars   = mStateVarsBundle64;
+      double        output;
+      double        input;
+
+      // Coefficients and their per-sample increments
+      double b0 = coeffs[chan];
+      double b1 = coeffs[chan + 1*cIasNumChannelsPerBundle];
+      double b2 = coeffs[chan + 2*cIasNumChannelsPerBundle];
+      double a1 = coeffs[chan + 3*cIasNumChannelsPerBundle];
+      double a2 = coeffs[chan + 4*cIasNumChannelsPerBundle];
+      double const db0 = deltas[chan];
+      double const db1 = deltas[chan + 1*cIasNumChannelsPerBundle];
+      double const db2 = deltas[chan + 2*cIasNumChannelsPerBundle];
+      double const da1 = deltas[chan + 3*cIasNumChannelsPerBundle];
+      double const da2 = deltas[chan + 4*cIasNumChannelsPerBundle];
+
+      // States
+      double x1 = vars[chan]; // x(n-1)
+      double x2 = vars[chan + 1*cIasNumChannelsPerBundle]; // x(n-2)
+      double y1 = vars[chan + 2*cIasNumChannelsPerBundle]; // y(n-1)
+      double y2 = vars[chan + 3*cIasNumChannelsPerBundle]; // y(n-2)
+
+      for (uint32_t i=0; i < mFrameLength; i++)
+      {
+        if (i + 1 < mFrameLength)
+        {
+          b0 += db0;
+          b1 += db1;
+          b2 += db2;
+          a1 += da1;
+          a2 += da2;
+        }
+        else
+        {
+          b0 = targets[chan];
+          b1 = targets[chan + 1*cIasNumChannelsPerBundle];
+          b2 = targets[chan + 2*cIasNumChannelsPerBundle];
+          a1 = targets[chan + 3*cIasNumChannelsPerBundle];
+          a2 = targets[chan + 4*cIasNumChannelsPerBundle];
+        }
+        input  = static_cast<double>(*bundleData);
+        output = input*b0 + x1*b1 + x2*b2 - (y1*a1 + y2*a2);
+
+        x2 = x1;                //x(n-2) = x(n-1)
+        x1 = input;             //x(n-1) = x(n)
+        y2 = y1;                //y(n-2) = y(n-1)
+        y1 = output;            //y(n-1) = y(n)
+        *bundleData = static_cast<float>(output);
+        bundleData+=4;
+      }
+
+      // Save states for the next frame to be processed.
+      vars[chan] = x1;
+      vars[chan + 1*cIasNumChannelsPerBundle] = x2;
+      vars[chan + 2*cIasNumChannelsPerBundle] = y1;
+      vars[chan + 3*cIasNumChannelsPerBundle] = y2;
+    }
+  }
+#endif // USE_SSE
+}
+
+
 void IasAudioFilter::announceCallback(IasAudioFilterCallback* callback)
 {
   mCallback = callback;
@@ -1299,6 +1864,17 @@ IasAudioProcessingResult IasAudioFilter::init()
     return eIasAudioProcNotEnoughMemory;
   }
 
+  mCoeffsStartBundle   = (float*)memalign(128,cIasNumCoeffsBiquad*cIasNumChannelsPerBundle*sizeof(float));
+  mCoeffsDeltaBundle   = (float*)memalign(128,cIasNumCoeffsBiquad*cIasNumChannelsPerBundle*sizeof(float));
+  mCoeffsStartBundle64 = (double*)memalign(128,cIasNumCoeffsBiquad*cIasNumChannelsPerBundle*sizeof(double));
+  mCoeffsDeltaBundle64 = (double*)memalign(128,cIasNumCoeffsBiquad*cIasNumChannelsPerBundle*sizeof(double));
+  if ((mCoeffsStartBundle == NULL) || (mCoeffsDeltaBundle == NULL) ||
+      (mCoeffsStartBundle64 == NULL) || (mCoeffsDeltaBundle64 == NULL))
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, "IasAudioFilter::init: not enough memory for memalign()");
+    return eIasAudioProcNotEnoughMemory;
+  }
+
   mCoeffs   = (float**)memalign(128, cIasNumCoeffsBiquad*sizeof(float*));
   mCoeffs64 = (double**)memalign(128, cIasNumCoeffsBiquad*sizeof(double*));
   if ((mCoeffs == NULL) || (mCoeffs64 == NULL))
@@ -9,7 +9,10 @@
  * @brief the implementation of the ramp generator
  */
 
+#include <algorithm>
+#include <cfloat>
 #include <math.h>
+#include <xmmintrin.h>
 #include "helper/IasRamp.hpp"
 #include <stdio.h>
 
@@ -29,6 +32,10 @@ IasRamp::IasRamp(uint32_t sampleFreq, uint32_t frameSize)
   mNumRampValues = 0;
   mRampSetActive = false;
   mRampLinear    = true;
+  mSettledData   = nullptr;
+  mSettledChannelIndex = 0;
+  mSettledNumChannels  = 0;
+  setLanePowers();
 }
 
 IasRamp::~IasRamp()
@@ -86,6 +93,7 @@ void IasRamp::setTimedRampLinear(float startValue, float endValue, uint32_t ramp
   mIncrementMult = 1.0f;
   mRampLinear = true;
   mRampSetActive = true;
+  setLanePowers();
 
 }
 
@@ -147,10 +155,74 @@ void IasRamp::setTimedRampExponential(float startValue, float endValue, uint32_t
   mRampLinear = false;
   mRampSetActive = true;
   mIncrementAdd = 0.0f;
+  setLanePowers();
 }
 
 
 
+void IasRamp::setLanePowers()
+{
+  double power = 1.0;
+  for (uint32_t lane = 0; lane < cIasRampBlockSize; ++lane)
+  {
+    power *= mIncrementMult;
+    mMultPowers[lane] = power;
+    mMultPowersFloat[lane] = static_cast<float>(power);
+  }
+  mSettledData = nullptr;
+}
+
+template <typename Store>
+void IasRamp::computeRampValues(uint32_t numValues, Store store)
+{
+  // Ramp value k of the block is (base + k*add) * mult^k, which covers the linear ramp (mult = 1)
+  // and the exponential ramp (add = 0). The base is only advanced once per block in double precision,
+  // so no rounding error accumulates over the ramp.
+  const __m128 addLow   = _mm_mul_ps(_mm_set1_ps(mIncrementAdd), _mm_setr_ps(1.0f, 2.0f, 3.0f, 4.0f));
+  const __m128 addHigh  = _mm_mul_ps(_mm_set1_ps(mIncrementAdd), _mm_setr_ps(5.0f, 6.0f, 7.0f, 8.0f));
+  const __m128 multLow  = _mm_loadu_ps(&mMultPowersFloat[0]);
+  const __m128 multHigh = _mm_loadu_ps(&mMultPowersFloat[4]);
+  float lowerLimit = -FLT_MAX;
+  float upperLimit = FLT_MAX;
+  if (mStartValue < mEndValue)
+  {
+    upperLimit = mEndValue;
+  }
+  else if (mStartValue > mEndValue)
+  {
+    lowerLimit = mEndValue;
+  }
+  const __m128 lower = _mm_set1_ps(lowerLimit);
+  const __m128 upper = _mm_set1_ps(upperLimit);
+  alignas(16) float block[cIasRampBlockSize];
+
+  uint32_t index = 0;
+  while (index < numValues)
+  {
+    uint32_t count = std::min(cIasRampBlockSize, numValues - index);
+    __m128 base = _mm_set1_ps(static_cast<float>(mCurrentValue));
+    __m128 valuesLow  = _mm_mul_ps(_mm_add_ps(base, addLow), multLow);
+    __m128 valuesHigh = _mm_mul_ps(_mm_add_ps(base, addHigh), multHigh);
+    _mm_store_ps(&block[0], _mm_min_ps(_mm_max_ps(valuesLow, lower), upper));
+    _mm_store_ps(&block[4], _mm_min_ps(_mm_max_ps(valuesHigh, lower), upper));
+
+    mCurrentValue = (mCurrentValue + static_cast<double>(mIncrementAdd) * count) * mMultPowers[count-1];
+    if ((mCurrentValue > mEndValue && mStartValue < mEndValue) ||
+        (mCurrentValue < mEndValue && mStartValue > mEndValue))
+    {
+      mCurrentValue = mEndValue;
+    }
+    mNumRampValues -= count;
+    if (mNumRampValues == 0)
+    {
+      mCurrentValue = mEndValue;
+      block[count-1] = mEndValue;
+    }
+    store(index, block, count);
+    index += count;
+  }
+}
+
 IasRampErrors IasRamp::getRampValues(float* data, uint32_t channelIndex,
                                      uint32_t numChannels, uint32_t* numValuesLeftToRamp)
 {
@@ -163,87 +235,70 @@ IasRampErrors IasRamp::getRampValues(float* data, uint32_t channelIndex,
     if( mRampSetActive == true)
     {
       float* work_data = & (data[channelIndex]);
-      uint32_t i = 0;
-      uint32_t loopSize = 0;
+      uint32_t loopSize = std::min(mNumRampValues, mFrameSize);
 
-      if(mNumRampValues >= mFrameSize)
+      // The settled end value has already been written to exactly these channels by the previous call.
+      if ((loopSize == 0) && (mSettledData == data) &&
+          (mSettledChannelIndex == channelIndex) && (mSettledNumChannels == numChannels))
       {
-        loopSize = mFrameSize;
+        *numValuesLeftToRamp = 0;
+        return eIasRampErrorNoError;
       }
-      else
-      {
-        loopSize = mNumRampValues;
-      }
-      i= 0;
 
       //writing the increments to the bundle
-      if(loopSize != 0)
+      computeRampValues(loopSize, [work_data, numChannels](uint32_t index, const float *values, uint32_t count)
       {
-        while(i < (loopSize-1))
+        float *frame = work_data + index*cIasNumChannelsPerBundle;
+        if (numChannels == cIasNumChannelsPerBundle)
         {
-          mCurrentValue += mIncrementAdd;
-          mCurrentValue *= mIncrementMult;
-          if((mCurrentValue > mEndValue) && (mStartValue < mEndValue))
-          {
-            mCurrentValue = mEndValue;
-          }
-          else if((mCurrentValue < mEndValue) && (mStartValue > mEndValue))
+          for (uint32_t k = 0; k < count; ++k)
           {
-            mCurrentValue = mEndValue;
+            _mm_storeu_ps(frame, _mm_set1_ps(values[k]));
+            frame += cIasNumChannelsPerBundle;
           }
-          for(uint32_t j=0;j<numChannels;j++)
-          {
-            *work_data++ = static_cast<float>( mCurrentValue);
-          }
-          work_data += (4-numChannels);
-          mNumRampValues--;
-          i++;
         }
-        //last steps
-        mNumRampValues--;
-        mCurrentValue += mIncrementAdd;
-        mCurrentValue *= mIncrementMult;
-        if((mCurrentValue > mEndValue) && (mStartValue < mEndValue))
+        else
         {
-          mCurrentValue = mEndValue;
-        }
-        else if((mCurrentValue < mEndValue) && (mStartValue > mEndValue))
-        {
-          mCurrentValue = mEndValue;
-        }
-        if(mNumRampValues == 0)
-        {
-          if(mCurrentValue != mEndValue)
+          for (uint32_t k = 0; k < count; ++k)
           {
-            mCurrentValue = mEndValue;
+            for (uint32_t j = 0; j < numChannels; j++)
+            {
+              frame[j] = values[k];
+            }
+            frame += cIasNumChannelsPerBundle;
           }
         }
-        for(uint32_t j=0;j<numChannels;j++)
-        {
-          *work_data++ = static_cast<float>(mCurrentValue);
-        }
-        work_data += (4-numChannels);
-        i++;
-      }
+      });
 
       //if there are still some bundle values to fill, check if the desired value was reached
       //if not, set to desired value
-      if(i< mFrameSize)
+      if(loopSize < mFrameSize)
       {
-        if (mCurrentValue != mEndValue)
+        mCurrentValue = mEndValue;
+        //fill up the rest of the bundle
+        float *frame = work_data + loopSize*cIasNumChannelsPerBundle;
+        const float endValue = static_cast<float>(mCurrentValue);
+        for (uint32_t i = loopSize; i < mFrameSize; ++i)
         {
-          mCurrentValue = mEndValue;
+          if (numChannels == cIasNumChannelsPerBundle)
+          {
+            _mm_storeu_ps(frame, _mm_set1_ps(endValue));
+          }
+          else
+          {
+            for (uint32_t j = 0; j < numChannels; j++)
+            {
+              frame[j] = endValue;
+            }
+          }
+          frame += cIasNumChannelsPerBundle;
         }
       }
-      //fill up the rest of the bundle
-      while(i < mFrameSize)
+      if (loopSize == 0)
       {
-        for(uint32_t j=0;j<numChannels;j++)
-        {
-          *work_data++ = static_cast<float>(mCurrentValue);
-        }
-        work_data += (4-numChannels);
-        i++;
+        mSettledData = data;
+        mSettledChannelIndex = channelIndex;
+        mSettledNumChannels = numChannels;
       }
       *numValuesLeftToRamp = mNumRampValues;
 
@@ -272,48 +327,33 @@ IasRampErrors IasRamp::getRampValues(float* data)
     return eIasRampErrorRampNotSet;
   }
 
-  uint32_t i = 0;
-  uint32_t loopSize = mNumRampValues;
+  uint32_t loopSize = std::min(mNumRampValues, mFrameSize);
 
-  if(mNumRampValues >= mFrameSize)
+  // The settled end value has already been written to this buffer by the previous call.
+  // The channel index cIasNumChannelsPerBundle marks the frame layout, the bundle variant never uses it.
+  if ((loopSize == 0) && (mSettledData == data) && (mSettledChannelIndex == cIasNumChannelsPerBundle))
   {
-    loopSize = mFrameSize;
+    return eIasRampErrorNoError;
   }
 
-  //writing the increments to the bundle
-  if(loopSize > 0)
+  //writing the increments to the buffer
+  computeRampValues(loopSize, [data](uint32_t index, const float *values, uint32_t count)
   {
-    while(i < loopSize)
-    {
-      mCurrentValue += mIncrementAdd;
-      mCurrentValue *= mIncrementMult;
-      mNumRampValues--;
+    std::copy(values, values + count, data + index);
+  });
 
-      if((mCurrentValue > mEndValue && mStartValue < mEndValue) ||
-         (mCurrentValue < mEndValue && mStartValue > mEndValue) ||
-         (mNumRampValues == 0 && mCurrentValue != mEndValue))
-      {
-        mCurrentValue = mEndValue;
-      }
-      *data++ = static_cast<float>( mCurrentValue);
-      i++;
-    }
-  }
-
-  //if there are still some bundle values to fill, check if the desired value was reached
+  //if there are still some values to fill, check if the desired value was reached
   //if not, set to desired value
-  if(i < mFrameSize)
+  if(loopSize < mFrameSize)
   {
-    if (mCurrentValue != mEndValue)
-    {
-      mCurrentValue = mEndValue;
-    }
+    mCurrentValue = mEndValue;
+    std::fill(data + loopSize, data + mFrameSize, static_cast<float>(mCurrentValue));
   }
-  //fill up the rest of the bundle
-  while(i < mFrameSize)
+  if (loopSize == 0)
   {
-    *data++ = static_cast<float>(mCurrentValue);
-    i++;
+    mSettledData = data;
+    mSettledChannelIndex = cIasNumChannelsPerBundle;
+    mSettledNumChannels = 1;
   }
 
   return eIasRampErrorNoError;
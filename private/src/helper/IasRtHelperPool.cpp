@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/**
+ * @file IasRtHelperPool.cpp
+ * @date 2018
+ * @brief Small pool of real-time helper threads that execute independent jobs of one processing period.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include "helper/IasRtHelperPool.hpp"
+#include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
+#include "smartx/IasConfigFile.hpp"
+#include "smartx/IasThreadNames.hpp"
+
+namespace IasAudio {
+
+static const std::string cClassName = "IasRtHelperPool::";
+#define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
+
+IasRtHelperPool::IasRtHelperPool(const std::string &name, uint32_t numThreads)
+  :mLog(IasAudioLogging::registerDltContext("HLP", "RT Helper Pool"))
+  ,mName(name)
+  ,mNumThreads(numThreads)
+  ,mThreads()
+  ,mStartSems()
+  ,mDoneSem()
+  ,mJob(nullptr)
+  ,mNumJobs(0)
+  ,mNextJob(0)
+  ,mIsRunning(false)
+{
+}
+
+IasRtHelperPool::~IasRtHelperPool()
+{
+  if (mIsRunning == true)
+  {
+    mIsRunning = false;
+    for (auto &startSem : mStartSems)
+    {
+      sem_post(&startSem);
+    }
+    for (auto &thread : mThreads)
+    {
+      thread.join();
+    }
+    for (auto &startSem : mStartSems)
+    {
+      sem_destroy(&startSem);
+    }
+    sem_destroy(&mDoneSem);
+  }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Deleted helper pool", mName);
+}
+
+IasRtHelperPool::IasResult IasRtHelperPool::init()
+{
+  if (mIsRunning == true)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Helper pool", mName, "already initialized");
+    return eIasFailed;
+  }
+  // The semaphores must not be moved after sem_init, so the vector is sized only once.
+  mStartSems.resize(mNumThreads);
+  for (auto &startSem : mStartSems)
+  {
+    sem_init(&startSem, 0, 0);
+  }
+  sem_init(&mDoneSem, 0, 0);
+  mIsRunning = true;
+  mThreads.reserve(mNumThreads);
+  for (uint32_t index = 0; index < mNumThreads; ++index)
+  {
+    mThreads.emplace_back(&IasRtHelperPool::helperThread, this, index);
+  }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Started helper pool", mName, "with", mNumThreads, "threads");
+  return eIasOk;
+}
+
+void IasRtHelperPool::execute(uint32_t numJobs, const IasJobFunction &job)
+{
+  // Only wake up as many helper threads as there are jobs left for them.
+  uint32_t numHelpers = 0;
+  if (numJobs > 1 && mIsRunning == true)
+  {
+    numHelpers = std::min(mNumThreads, numJobs - 1);
+  }
+  mJob = &job;
+  mNumJobs = numJobs;
+  mNextJob.store(0, std::memory_order_relaxed);
+  // sem_post is a full memory barrier, so the helpers see the job set up above.
+  for (uint32_t index = 0; index < numHelpers; ++index)
+  {
+    sem_post(&mStartSems[index]);
+  }
+  executeJobs();
+  for (uint32_t index = 0; index < numHelpers; ++index)
+  {
+    while (sem_wait(&mDoneSem) != 0 && errno == EINTR)
+    {
+    }
+  }
+  mJob = nullptr;
+}
+
+void IasRtHelperPool::executeJobs()
+{
+  uint32_t jobIndex = mNextJob.fetch_add(1, std::memory_order_relaxed);
+  while (jobIndex < mNumJobs)
+  {
+    (*mJob)(jobIndex);
+    jobIndex = mNextJob.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void IasRtHelperPool::helperThread(uint32_t index)
+{
+  IasThreadNames::getInstance()->setThreadName(IasThreadNames::eIasRealTime, "Helper thread " + std::to_string(index) + " of helper pool " + mName);
+  IasConfigFile::configureThreadSchedulingParameters(mLog, IasConfigFile::eIasThreadRoleHelperPool, mName);
+  while (true)
+  {
+    if (sem_wait(&mStartSems[index]) != 0)
+    {
+      continue;
+    }
+    if (mIsRunning == false)
+    {
+      break;
+    }
+    executeJobs();
+    sem_post(&mDoneSem);
+  }
+}
+
+} // namespace IasAudio
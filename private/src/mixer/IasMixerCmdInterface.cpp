@@ -15,6 +15,7 @@
 #include "mixer/IasMixerCmdInterface.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "audio/mixerx/IasMixerCmd.hpp"
+#include "audio/smartx/IasIProcessing.hpp"
 #include "mixer/IasMixerCore.hpp"
 
 namespace IasAudio {
@@ -79,6 +80,36 @@ IasIModuleId::IasResult IasMixerCmdInterface::processCmd(const IasProperties& cm
 }
 
 
+bool IasMixerCmdInterface::isFastCmd(int32_t cmdId) const
+{
+  return (cmdId == IasMixer::IasMixerCmdIds::eIasSetBalance) ||
+         (cmdId == IasMixer::IasMixerCmdIds::eIasSetFader) ||
+         (cmdId == IasMixer::IasMixerCmdIds::eIasSetInputGainOffset);
+}
+
+
+IasIModuleId::IasResult IasMixerCmdInterface::processFastCmd(const IasCmdHandle &handle, float value)
+{
+  if (handle.rampTime != 0)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "Ramp time of", handle.rampTime, "[ms] not supported, the mixer uses a fixed ramp");
+    return IasIModuleId::eIasFailed;
+  }
+  switch (handle.cmdId)
+  {
+    case IasMixer::IasMixerCmdIds::eIasSetBalance:
+      return applyBalance(handle.streamId, value);
+    case IasMixer::IasMixerCmdIds::eIasSetFader:
+      return applyFader(handle.streamId, value);
+    case IasMixer::IasMixerCmdIds::eIasSetInputGainOffset:
+      return applyInputGainOffset(handle.streamId, value);
+    default:
+      DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "Cmd with cmdId", handle.cmdId, "does not support command handles");
+      return IasIModuleId::eIasFailed;
+  }
+}
+
+
 IasIModuleId::IasResult IasMixerCmdInterface::setModuleState(const IasProperties& cmdProperties, IasProperties& returnProperties)
 {
   DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "called");
@@ -161,14 +192,20 @@ IasIModuleId::IasResult IasMixerCmdInterface::setBalance(const IasProperties& cm
     return IasIModuleId::eIasFailed;
   }
 
+  return applyBalance(streamId, static_cast<float>(balance));
+}
+
+
+IasIModuleId::IasResult IasMixerCmdInterface::applyBalance(int32_t streamId, float balance)
+{
   float balanceRight;
   float balanceLeft;
 
-  const float balanceLog = 0.1f * static_cast<float>(balance);
+  const float balanceLog = 0.1f * balance;
 
-  if(balance < 0)
+  if(balance < 0.0f)
   {
-    if(balance <= -cCutOffValue)
+    if(balance <= -static_cast<float>(cCutOffValue))
     {
       balanceRight = 0.0f;
     }
@@ -181,7 +218,7 @@ IasIModuleId::IasResult IasMixerCmdInterface::setBalance(const IasProperties& cm
 
   else
   {
-    if(balance >= cCutOffValue)
+    if(balance >= static_cast<float>(cCutOffValue))
     {
       balanceLeft = 0.0f;
     }
@@ -218,14 +255,20 @@ IasIModuleId::IasResult IasMixerCmdInterface::setFader(const IasProperties& cmdP
     return IasIModuleId::eIasFailed;
   }
 
+  return applyFader(streamId, static_cast<float>(fader));
+}
+
+
+IasIModuleId::IasResult IasMixerCmdInterface::applyFader(int32_t streamId, float fader)
+{
   float faderFront;
   float faderRear;
 
-  const float faderLog = 0.1f * static_cast<float>(fader);
+  const float faderLog = 0.1f * fader;
 
-  if(fader < 0)
+  if(fader < 0.0f)
   {
-    if(fader <= -cCutOffValue)
+    if(fader <= -static_cast<float>(cCutOffValue))
     {
       faderFront = 0.0f;
     }
@@ -238,7 +281,7 @@ IasIModuleId::IasResult IasMixerCmdInterface::setFader(const IasProperties& cmdP
 
   else
   {
-    if(fader >= cCutOffValue)
+    if(fader >= static_cast<float>(cCutOffValue))
     {
       faderRear = 0.0f;
     }
@@ -268,18 +311,24 @@ IasIModuleId::IasResult IasMixerCmdInterface::setInputGainOffset(const IasProper
 
   int32_t gain;
   const auto propres = cmdProperties.get("gain", &gain);
-  if(gain > cMaxInputGainOffset || gain < cMinInputGainOffset)
+  if(propres != IasProperties::eIasOk)
   {
-    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "Error, parameter InputGainOffset was set to",gain,", which is out of valid range");
     return IasIModuleId::eIasFailed;
   }
 
-  if(propres != IasProperties::eIasOk)
+  return applyInputGainOffset(streamId, static_cast<float>(gain));
+}
+
+
+IasIModuleId::IasResult IasMixerCmdInterface::applyInputGainOffset(int32_t streamId, float gain)
+{
+  if(gain > static_cast<float>(cMaxInputGainOffset) || gain < static_cast<float>(cMinInputGainOffset))
   {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "Error, parameter InputGainOffset was set to",gain,", which is out of valid range");
     return IasIModuleId::eIasFailed;
   }
 
-  const float gainLog = 0.1f * static_cast<float>(gain);
+  const float gainLog = 0.1f * gain;
   const float gainLin = std::pow(10.0f, 0.05f * gainLog);
 
   return translate(mCore->setInputGainOffset(streamId, gainLin));
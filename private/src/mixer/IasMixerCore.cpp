@@ -12,7 +12,9 @@
  *  is able to generate all required output streams (output zones).
  */
 
+#include <algorithm>
 #include <cstring>
+#include <map>
 
 #include "mixer/IasMixerCore.hpp"
 #include "mixer/IasMixerElementary.hpp"
@@ -32,6 +34,9 @@ IasMixerCore::IasMixerCore(const IasIGenericAudioCompConfig* config, const std::
   ,mElementaryMixers{}
   ,mCoreStreamMap{}
   ,mOutputBundlesList{}
+  ,mHelperPool{nullptr}
+  ,mElementaryMixerGroups{}
+  ,mRunElementaryMixerGroup{}
   ,mLogContext{IasAudioLogging::getDltContext("_MIX")}
 {
 }
@@ -101,6 +106,90 @@ IasAudioProcessingResult IasMixerCore::init()
   mOutputBundlesList.sort();
   mOutputBundlesList.unique();
 
+  return initHelperPool();
+}
+
+
+IasAudioProcessingResult IasMixerCore::initHelperPool()
+{
+  // The elementary mixers share the input bundles read-only. Output streams with less than
+  // four channels can share a bundle though, and the elementary mixers add their samples to
+  // the bundle content, so mixers with a common output bundle must not run in parallel.
+  const IasProperties &properties = mConfig->getProperties();
+  int32_t numHelperThreads = 0;
+  if (properties.get<int32_t>("numHelperThreads", &numHelperThreads) != IasProperties::eIasOk || numHelperThreads <= 0)
+  {
+    return eIasAudioProcOK;
+  }
+
+  // Label each elementary mixer with the group of the first mixer it shares an output bundle with.
+  std::vector<uint32_t> groupLabels(mElementaryMixers.size());
+  std::map<IasAudioChannelBundle*, uint32_t> bundleLabels;
+  for (uint32_t mixerIdx = 0; mixerIdx < mElementaryMixers.size(); ++mixerIdx)
+  {
+    groupLabels[mixerIdx] = mixerIdx;
+    for (auto *bundle : mElementaryMixers[mixerIdx]->getOutputBundles())
+    {
+      auto bundleIt = bundleLabels.find(bundle);
+      if (bundleIt == bundleLabels.end())
+      {
+        bundleLabels.emplace(bundle, groupLabels[mixerIdx]);
+      }
+      else if (bundleIt->second != groupLabels[mixerIdx])
+      {
+        // Merge the group of this mixer into the group of the bundle.
+        const uint32_t oldLabel = groupLabels[mixerIdx];
+        const uint32_t newLabel = bundleIt->second;
+        std::replace(groupLabels.begin(), groupLabels.end(), oldLabel, newLabel);
+        for (auto &bundleLabel : bundleLabels)
+        {
+          if (bundleLabel.second == oldLabel)
+          {
+            bundleLabel.second = newLabel;
+          }
+        }
+      }
+    }
+  }
+  mElementaryMixerGroups.clear();
+  std::map<uint32_t, uint32_t> groupIndices;
+  for (uint32_t mixerIdx = 0; mixerIdx < mElementaryMixers.size(); ++mixerIdx)
+  {
+    auto groupIt = groupIndices.find(groupLabels[mixerIdx]);
+    if (groupIt == groupIndices.end())
+    {
+      groupIt = groupIndices.emplace(groupLabels[mixerIdx], static_cast<uint32_t>(mElementaryMixerGroups.size())).first;
+      mElementaryMixerGroups.push_back(IasMixerElementaryVector());
+    }
+    mElementaryMixerGroups[groupIt->second].push_back(mElementaryMixers[mixerIdx]);
+  }
+  if (mElementaryMixerGroups.size() < 2)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "no elementary mixers with disjoint output bundles, numHelperThreads is ignored");
+    mElementaryMixerGroups.clear();
+    return eIasAudioProcOK;
+  }
+  // The calling thread executes elementary mixers as well, so more helpers are of no use.
+  uint32_t numThreads = std::min(static_cast<uint32_t>(numHelperThreads), static_cast<uint32_t>(mElementaryMixerGroups.size() - 1));
+  std::string poolName = getComponentName();
+  properties.get<std::string>("instanceName", &poolName);
+
+  mHelperPool.reset(new IasRtHelperPool(poolName, numThreads));
+  if (mHelperPool->init() != IasRtHelperPool::eIasOk)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "error while starting the helper pool", poolName);
+    mHelperPool.reset();
+    return eIasAudioProcInitializationFailed;
+  }
+  mRunElementaryMixerGroup = [this](uint32_t index)
+  {
+    for (auto &elementaryMixer : mElementaryMixerGroups[index])
+    {
+      elementaryMixer->run();
+    }
+  };
+  DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "running", mElementaryMixers.size(), "elementary mixers in",
+              mElementaryMixerGroups.size(), "groups on", numThreads, "helper threads of pool", poolName);
   return eIasAudioProcOK;
 }
 
@@ -138,9 +227,18 @@ IasAudioProcessingResult IasMixerCore::processChild()
   }
 
   // Execute all elementary mixers (one elementary mixer for each output stream).
-  for(auto& elementaryMixer : mElementaryMixers)
+  // With a helper pool, execute() returns only after all of them have finished,
+  // so the next module always sees the complete output bundles.
+  if (mHelperPool != nullptr)
+  {
+    mHelperPool->execute(static_cast<uint32_t>(mElementaryMixerGroups.size()), mRunElementaryMixerGroup);
+  }
+  else
   {
-    elementaryMixer->run();
+    for(auto& elementaryMixer : mElementaryMixers)
+    {
+      elementaryMixer->run();
+    }
   }
 
   return eIasAudioProcOK;
@@ -11,6 +11,7 @@
  *  For each output zone, we need an own elementary mixer.
  */
 
+#include <algorithm>
 #include <cstring>
 #include <cmath>
 #include "mixer/IasMixerElementary.hpp"
@@ -160,9 +161,16 @@ IasMixerElementary::IasMixerElementary(const IasIGenericAudioCompConfig* config,
   ,mOutputChannelMappingVector{}
   ,mInputBundlesList{}
   ,mOutputBundlesList{}
+  ,mInputBundles{}
+  ,mOutputBundles{}
+  ,mActiveTiles{}
+  ,mRampTileFlags{}
+  ,mActiveTilesDirty{true}
+  ,mSkipZeroGainTiles{true}
   ,multiChannelInputPresent{false}
-  ,mBalanceQueue{}
-  ,mGainOffsetQueue{}
+  ,mBalanceMailboxes{}
+  ,mFaderMailboxes{}
+  ,mGainOffsetMailboxes{}
   ,mConfig{config}
   ,mTypeName{""}
   ,mInstanceName{""}
@@ -222,6 +230,11 @@ IasAudioProcessingResult IasMixerElementary::init()
     return eIasAudioProcInitializationFailed;
   }
 
+  // Skipping the zero gain tiles can be switched off to compare with the dense processing.
+  int32_t skipZeroGainTiles = 1;
+  properties.get<int32_t>("skipZeroGainTiles", &skipZeroGainTiles);
+  mSkipZeroGainTiles = (skipZeroGainTiles != 0);
+
   // Create the sorted+unique list of output bundles
   // Loop over all bundles that belong to the output stream.
   for(auto& bundleAssignment : outputBundleAssignmentVector)
@@ -336,6 +349,13 @@ IasAudioProcessingResult IasMixerElementary::init()
   }
   // Now we are ready to use our new  hyper-matrix in a way like mGainTileMatrix[0][0][1][2] = 0.25f;
 
+  // Index the bundles like the matrix and preallocate the list of active tiles,
+  // so that run() can rebuild it without any memory allocation.
+  mInputBundles.assign(mInputBundlesList.begin(), mInputBundlesList.end());
+  mOutputBundles.assign(mOutputBundlesList.begin(), mOutputBundlesList.end());
+  mActiveTiles.reserve(mNumberOutputBundles*mNumberInputBundles);
+  mRampTileFlags.resize(mNumberOutputBundles*mNumberInputBundles, 0);
+
 
   mNumberOutputChannels = (mStreamPair.first)->getNumberChannels();
   if (mNumberOutputChannels > 6)
@@ -404,6 +424,9 @@ IasAudioProcessingResult IasMixerElementary::init()
     }
     IasMixerElementaryStreamParamsPair streamParamsPair((*inStreamIt)->getId(), streamParams);
     mStreamParamsMap.insert(streamParamsPair);
+    mBalanceMailboxes.add((*inStreamIt)->getId());
+    mFaderMailboxes.add((*inStreamIt)->getId());
+    mGainOffsetMailboxes.add((*inStreamIt)->getId());
   }
 
 
@@ -438,6 +461,7 @@ IasAudioProcessingResult IasMixerElementary::setupModeMain()
     IasMixerElementaryStreamParams* streamParams = &(streamParamsMapIt.second);
     const uint32_t nChannels = streamParams->nChannels;
     uint32_t tempRowIdx = 0;
+    streamParams->tileIndexVector.clear();
 
     for (uint32_t j = 0; j < mNumberOutputChannels; j++)
     {
@@ -445,6 +469,11 @@ IasAudioProcessingResult IasMixerElementary::setupModeMain()
       uint32_t outputChannel = mOutputChannelMappingVector[j].channelIndex;
       uint32_t inputBundle   = streamParams->channelMappingVector[tempRowIdx].bundleIndex;
       uint32_t inputChannel  = streamParams->channelMappingVector[tempRowIdx].channelIndex;
+      uint32_t tileIndex     = outputBundle*mNumberInputBundles + inputBundle;
+      if (std::find(streamParams->tileIndexVector.begin(), streamParams->tileIndexVector.end(), tileIndex) == streamParams->tileIndexVector.end())
+      {
+        streamParams->tileIndexVector.push_back(tileIndex);
+      }
 
 #if DO_DEBUG_PRINTING
       printf("outputBundle = %d, outputChannel = %d, inputBundle =%d, inputChannel = %d\n",
@@ -520,6 +549,7 @@ IasAudioProcessingResult IasMixerElementary::setupModeMain()
 #if DO_DEBUG_PRINTING
   printMatrix();
 #endif
+  mActiveTilesDirty = true;
   return eIasAudioProcOK;
 }
 
@@ -616,6 +646,8 @@ void IasMixerElementary::updateRampActiveStreams()
         DLT_LOG_CXX(*mLogContext, DLT_LOG_VERBOSE, LOG_PREFIX, "balance right =",params->balanceParams.balanceRight[mFrameLength-1]);
       }
       listIt = mRampActiveStreams.erase(listIt);
+      // The final gains of this stream may have removed or added tiles.
+      mActiveTilesDirty = true;
     }
     else
     {
@@ -625,6 +657,44 @@ void IasMixerElementary::updateRampActiveStreams()
 }
 
 
+void IasMixerElementary::updateActiveTiles()
+{
+  std::fill(mRampTileFlags.begin(), mRampTileFlags.end(), 0);
+  for (auto streamId : mRampActiveStreams)
+  {
+    auto streamParamsMapIt = mStreamParamsMap.find(streamId);
+    if (streamParamsMapIt != mStreamParamsMap.end())
+    {
+      for (auto tileIndex : streamParamsMapIt->second.tileIndexVector)
+      {
+        mRampTileFlags[tileIndex] = 1;
+      }
+    }
+  }
+
+  mActiveTiles.clear();
+  for (uint32_t cntOutputBundle = 0; cntOutputBundle < mNumberOutputBundles; cntOutputBundle++)
+  {
+    for (uint32_t cntInputBundle = 0; cntInputBundle < mNumberInputBundles; cntInputBundle++)
+    {
+      bool isActive = (mSkipZeroGainTiles == false) ||
+                      (mRampTileFlags[cntOutputBundle*mNumberInputBundles + cntInputBundle] != 0);
+      const float *gains = mGainTileMatrix[cntOutputBundle][cntInputBundle][0];
+      for (uint32_t cntGain = 0; (isActive == false) && (cntGain < cIasNumChannelsPerBundle*cIasNumChannelsPerBundle); cntGain++)
+      {
+        isActive = (gains[cntGain] != 0.0f);
+      }
+      if (isActive)
+      {
+        // Keep the order output bundle by output bundle, so the sums are formed like before.
+        mActiveTiles.push_back({cntOutputBundle, cntInputBundle});
+      }
+    }
+  }
+  mActiveTilesDirty = false;
+}
+
+
 void IasMixerElementary::run()
 {
   IasEMixerListIterator listIt;
@@ -665,57 +735,51 @@ void IasMixerElementary::run()
     }
   }
 
-  // Now we apply the core processing: calculate the output bundles
-  // by multiplying the input bundles with the gain tiles.
-  std::list<IasAudioChannelBundle*>::iterator outputBundlesListIt;
-  std::list<IasAudioChannelBundle*>::iterator inputBundlesListIt;
-  outputBundlesListIt = mOutputBundlesList.begin();
+  // A new ramp may write tiles that have been zero so far.
+  if (mActiveTilesDirty)
+  {
+    updateActiveTiles();
+  }
 
-  for (uint32_t cntOutputBundle = 0; cntOutputBundle < mNumberOutputBundles; cntOutputBundle++)
+  // Now we apply the core processing: calculate the output bundles
+  // by multiplying the input bundles with the gain tiles. Only the
+  // tiles in mActiveTiles contribute to the output, all others are zero.
+  for (const auto &activeTile : mActiveTiles)
   {
-    IAS_ASSERT(outputBundlesListIt != mOutputBundlesList.end());
-    IasAudioChannelBundle *outputBundle = *outputBundlesListIt;
-    float *outputData = outputBundle->getAudioDataPointer();
+    const uint32_t cntOutputBundle = activeTile.outputBundleIndex;
+    const uint32_t cntInputBundle  = activeTile.inputBundleIndex;
+    float *outputData = mOutputBundles[cntOutputBundle]->getAudioDataPointer();
+    float *inputData  = mInputBundles[cntInputBundle]->getAudioDataPointer();
 
-    inputBundlesListIt = mInputBundlesList.begin();
-    for (uint32_t cntInputBundle = 0; cntInputBundle < mNumberInputBundles; cntInputBundle++)
+    for (uint32_t sampleIdx = 0; sampleIdx < mFrameLength; sampleIdx++)
     {
-      IAS_ASSERT(inputBundlesListIt != mInputBundlesList.end());
-      IasAudioChannelBundle *inputBundle = *inputBundlesListIt;
-      float *inputData = inputBundle->getAudioDataPointer();
-
-      for (uint32_t sampleIdx = 0; sampleIdx < mFrameLength; sampleIdx++)
-      {
-        updateGainTileMatrix(sampleIdx);
+      updateGainTileMatrix(sampleIdx);
 #if SSE
-        __m128 s0 = _mm_mul_ps(*(__m128 *)(&inputData[4*sampleIdx]), *(__m128 *)(mGainTileMatrix[cntOutputBundle][cntInputBundle][0]));
-        __m128 s1 = _mm_mul_ps(*(__m128 *)(&inputData[4*sampleIdx]), *(__m128 *)(mGainTileMatrix[cntOutputBundle][cntInputBundle][1]));
-        __m128 s2 = _mm_mul_ps(*(__m128 *)(&inputData[4*sampleIdx]), *(__m128 *)(mGainTileMatrix[cntOutputBundle][cntInputBundle][2]));
-        __m128 s3 = _mm_mul_ps(*(__m128 *)(&inputData[4*sampleIdx]), *(__m128 *)(mGainTileMatrix[cntOutputBundle][cntInputBundle][3]));
+      __m128 s0 = _mm_mul_ps(*(__m128 *)(&inputData[4*sampleIdx]), *(__m128 *)(mGainTileMatrix[cntOutputBundle][cntInputBundle][0]));
+      __m128 s1 = _mm_mul_ps(*(__m128 *)(&inputData[4*sampleIdx]), *(__m128 *)(mGainTileMatrix[cntOutputBundle][cntInputBundle][1]));
+      __m128 s2 = _mm_mul_ps(*(__m128 *)(&inputData[4*sampleIdx]), *(__m128 *)(mGainTileMatrix[cntOutputBundle][cntInputBundle][2]));
+      __m128 s3 = _mm_mul_ps(*(__m128 *)(&inputData[4*sampleIdx]), *(__m128 *)(mGainTileMatrix[cntOutputBundle][cntInputBundle][3]));
 
-        __m128 t0 =_mm_add_ps (_mm_unpacklo_ps(s0, s1), _mm_unpackhi_ps(s0, s1));
-        __m128 t1 =_mm_add_ps (_mm_unpacklo_ps(s2, s3), _mm_unpackhi_ps(s2, s3));
-        __m128 s = _mm_add_ps (_mm_movelh_ps(t0, t1), _mm_movehl_ps(t1, t0));
+      __m128 t0 =_mm_add_ps (_mm_unpacklo_ps(s0, s1), _mm_unpackhi_ps(s0, s1));
+      __m128 t1 =_mm_add_ps (_mm_unpacklo_ps(s2, s3), _mm_unpackhi_ps(s2, s3));
+      __m128 s = _mm_add_ps (_mm_movelh_ps(t0, t1), _mm_movehl_ps(t1, t0));
 
-        __m128 sum = _mm_add_ps(*(__m128 *)(&outputData[4*sampleIdx]), s);
-        _mm_store_ps(&outputData[4*sampleIdx], sum);
+      __m128 sum = _mm_add_ps(*(__m128 *)(&outputData[4*sampleIdx]), s);
+      _mm_store_ps(&outputData[4*sampleIdx], sum);
 #else
-        for (uint32_t outputChan = 0; outputChan < cIasNumChannelsPerBundle; outputChan++)
+      for (uint32_t outputChan = 0; outputChan < cIasNumChannelsPerBundle; outputChan++)
+      {
+        float sum = outputData[4*sampleIdx+outputChan];
+        for (uint32_t inputChan = 0; inputChan < cIasNumChannelsPerBundle; inputChan++)
         {
-          float sum = outputData[4*sampleIdx+outputChan];
-          for (uint32_t inputChan = 0; inputChan < cIasNumChannelsPerBundle; inputChan++)
-          {
-            sum += inputData[4*sampleIdx+inputChan] * mGainTileMatrix[cntOutputBundle][cntInputBundle][outputChan][inputChan];
-          }
-          outputData[4*sampleIdx+outputChan] = sum;
+          sum += inputData[4*sampleIdx+inputChan] * mGainTileMatrix[cntOutputBundle][cntInputBundle][outputChan][inputChan];
         }
-#endif
+        outputData[4*sampleIdx+outputChan] = sum;
       }
-      inputBundlesListIt++;
+#endif
     }
-    outputBundlesListIt++;
   }
-  
+
   updateRampActiveStreams();
 }
 
@@ -735,7 +799,11 @@ IasAudioProcessingResult IasMixerElementary::setBalance(int32_t   streamId,
   queueEntry.streamId = streamId;
   queueEntry.left = balanceLeft;
   queueEntry.right = balanceRight;
-  mBalanceQueue.push(queueEntry);
+  if (mBalanceMailboxes.post(streamId, queueEntry) == false)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no balance mailbox for streamId: streamId=", streamId);
+    return eIasAudioProcInvalidParam;
+  }
 
   return eIasAudioProcOK;
 }
@@ -756,7 +824,11 @@ IasAudioProcessingResult IasMixerElementary::setFader(int32_t   streamId,
   queueEntry.streamId = streamId;
   queueEntry.front = faderFront;
   queueEntry.rear = faderRear;
-  mFaderQueue.push(queueEntry);
+  if (mFaderMailboxes.post(streamId, queueEntry) == false)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no fader mailbox for streamId: streamId=", streamId);
+    return eIasAudioProcInvalidParam;
+  }
 
   return eIasAudioProcOK;
 }
@@ -774,7 +846,11 @@ IasAudioProcessingResult IasMixerElementary::setInputGainOffset(int32_t streamId
   IasMixerGainOffsetQueueEntry queueEntry;
   queueEntry.gainOffset = gainOffset;
   queueEntry.streamId = streamId;
-  mGainOffsetQueue.push(queueEntry);
+  if (mGainOffsetMailboxes.post(streamId, queueEntry) == false)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no gain offset mailbox for streamId: streamId=", streamId);
+    return eIasAudioProcInvalidParam;
+  }
 
   return eIasAudioProcOK;
 }
@@ -1042,31 +1118,20 @@ void IasMixerElementary::updateMatrix_6Channels(IasMixerElementaryStreamParams*
 
 void IasMixerElementary::checkQueues()
 {
-  IasMixerBalanceQueueEntry balanceQueueEntry;
-  balanceQueueEntry.streamId = 0;
-  balanceQueueEntry.left = 0.0f;
-  balanceQueueEntry.right= 0.0f;
-  while(mBalanceQueue.try_pop(balanceQueueEntry))
+  mBalanceMailboxes.fetchAll([this](int32_t streamId, IasMixerBalanceQueueEntry &entry)
   {
-    updateBalance(balanceQueueEntry.streamId, balanceQueueEntry.left, balanceQueueEntry.right);
-  }
+    updateBalance(streamId, entry.left, entry.right);
+  });
 
-  IasMixerFaderQueueEntry faderQueueEntry;
-  faderQueueEntry.streamId = 0;
-  faderQueueEntry.front = 0.0f;
-  faderQueueEntry.rear= 0.0f;
-  while(mFaderQueue.try_pop(faderQueueEntry))
+  mFaderMailboxes.fetchAll([this](int32_t streamId, IasMixerFaderQueueEntry &entry)
   {
-    updateFader(faderQueueEntry.streamId, faderQueueEntry.front, faderQueueEntry.rear);
-  }
+    updateFader(streamId, entry.front, entry.rear);
+  });
 
-  IasMixerGainOffsetQueueEntry gainOffsetQueueEntry;
-  gainOffsetQueueEntry.streamId = 0;
-  gainOffsetQueueEntry.gainOffset = 0.0f;
-  while(mGainOffsetQueue.try_pop(gainOffsetQueueEntry))
+  mGainOffsetMailboxes.fetchAll([this](int32_t streamId, IasMixerGainOffsetQueueEntry &entry)
   {
-    updateGainOffset(gainOffsetQueueEntry.streamId, gainOffsetQueueEntry.gainOffset);
-  }
+    updateGainOffset(streamId, entry.gainOffset);
+  });
 }
 
 void IasMixerElementary::updateBalance(int32_t streamId, float left, float right)
@@ -1091,6 +1156,7 @@ void IasMixerElementary::updateBalance(int32_t streamId, float left, float right
                   "balanceRight=", right);
   params->balanceParams.active = true;
   mRampActiveStreams.push_back(streamId);
+  mActiveTilesDirty = true;
 }
 
 void IasMixerElementary::updateFader(int32_t streamId, float front, float rear)
@@ -1115,6 +1181,7 @@ void IasMixerElementary::updateFader(int32_t streamId, float front, float rear)
                   "faderRear=",  rear);
   params->fadeParams.active = true;
   mRampActiveStreams.push_back(streamId);
+  mActiveTilesDirty = true;
 }
 
 void IasMixerElementary::updateGainOffset(int32_t streamId, float gainOffset)
@@ -1133,6 +1200,7 @@ void IasMixerElementary::updateGainOffset(int32_t streamId, float gainOffset)
                   "gainOffset=", gainOffset);
   params->gainOffsetParams.active = true;
   mRampActiveStreams.push_back(streamId);
+  mActiveTilesDirty = true;
 }
 
 
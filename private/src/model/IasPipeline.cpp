@@ -13,10 +13,16 @@
 #include <sstream>
 #include <iomanip>
 #include <vector>
+#include <algorithm>
+#include <chrono>
+#include <set>
 
 #include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBuffer.hpp"
 #include "avbaudiomodules/internal/audio/common/helper/IasCopyAudioAreaBuffers.hpp"
 #include "audio/smartx/rtprocessingfwx/IasIGenericAudioCompConfig.hpp"
+#include "audio/smartx/rtprocessingfwx/IasGenericAudioComp.hpp"
+#include "audio/smartx/rtprocessingfwx/IasGenericAudioCompCore.hpp"
+#include "audio/smartx/rtprocessingfwx/IasAudioStream.hpp"
 #include "rtprocessingfwx/IasAudioChain.hpp"
 #include "rtprocessingfwx/IasPluginEngine.hpp"
 #include "model/IasAudioPort.hpp"
@@ -26,6 +32,8 @@
 #include "model/IasAudioPortOwner.hpp"
 #include "model/IasAudioSinkDevice.hpp"
 #include "smartx/IasConfiguration.hpp"
+#include "smartx/IasLatencyProbe.hpp"
+#include "smartx/IasIStreamTap.hpp"
 
 namespace IasAudio {
 
@@ -34,12 +42,49 @@ static const std::string cClassName = "IasPipeline::";
 #define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
 #define LOG_PIPELINE "pipeline=" + mParams->name + ":"
 
+static const uint32_t cMaxNumStreamProbes = 32;   //!< Maximum number of pins of one pipeline that can be tapped at the same time
+static const uint32_t cStreamTapPositionShift = 16;   //!< The key of a stream tap holds the position in the processing sequence above this bit
+static const uint32_t cStreamTapStreamIdMask = 0xFFFF; //!< The key of a stream tap holds the audio stream id in these bits
+
+
+/**
+ * @brief Fade the channel buffers of a relinked pin in at the start or out at the end of the period.
+ */
+static void applyRelinkFade(const std::vector<float*> &channelBuffers, uint32_t periodSize, uint32_t fadeLength, bool fadeIn)
+{
+  const float rampStep = 1.0f / static_cast<float>(fadeLength);
+  const uint32_t firstFrame = fadeIn ? 0 : periodSize - fadeLength;
+  for (float* channelBuffer : channelBuffers)
+  {
+    for (uint32_t frame = 0; frame < fadeLength; frame++)
+    {
+      const float ramp = static_cast<float>(frame) * rampStep;
+      channelBuffer[firstFrame + frame] *= fadeIn ? ramp : (1.0f - rampStep - ramp);
+    }
+  }
+}
+
 
 IasPipeline::IasPipeline(IasPipelineParamsPtr params, IasPluginEnginePtr pluginEngine, IasConfigurationPtr configuration)
   :mLog(IasAudioLogging::registerDltContext("MDL", "SmartX Model"))
   ,mParams(params)
   ,mPluginEngine(pluginEngine)
   ,mConfiguration(configuration)
+  ,mLatencyProbeSlots()
+  ,mStreamTapSlots(cMaxNumStreamProbes)
+  ,mModuleTimingEnabled(false)
+  ,mModuleTimes()
+  ,mComponentModules()
+  ,mRuntimeRelinking(false)
+  ,mCommittedPinSources()
+  ,mRelinkProgram()
+  ,mRelinkProgramMailbox()
+  ,mNextRelinkProgram(nullptr)
+  ,mRelinkState(eIasRelinkIdle)
+  ,mPostedRelinkSequence(0)
+  ,mPostedChangedStreams()
+  ,mFetchedRelinkSequence(0)
+  ,mFadedStreams()
 {
   IAS_ASSERT(params != nullptr);
   IAS_ASSERT(pluginEngine != nullptr);
@@ -53,7 +98,7 @@ IasPipeline::~IasPipeline()
   IAS_ASSERT(mPluginEngine != nullptr); // already checked in constructor of IasPipeline
 
   // Call the destroy method of all audio components that are hosted by the pipeline.
-  for (IasProcessingModulePtr module :mProcessingModuleSchedulingList)
+  for (IasProcessingModulePtr module :mComponentModules)
   {
     IasGenericAudioComp *audioComponent = module->getGenericAudioComponent();
     mPluginEngine->destroyModule(audioComponent);
@@ -549,7 +594,7 @@ void IasPipeline::getPinConnectionInfo(IasAudioPinPtr audioPin, std::vector<std:
   }
 }
 
-void IasPipeline::unlink(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin)
+IasPipeline::IasResult IasPipeline::unlink(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin)
 {
   IAS_ASSERT(inputPin  != nullptr); // already checked in IasSetupImpl::link
   IAS_ASSERT(outputPin != nullptr); // already checked in IasSetupImpl::link
@@ -561,14 +606,22 @@ void IasPipeline::unlink(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin)
               "Unlinking pin", outputPin->getParameters()->name,
               "from pin",       inputPin->getParameters()->name);
 
-  if (mapItInputPin != mAudioPinMap.end())
-  {
-    mapItInputPin->second->sourcePin = nullptr;
-  }
-  if (mapItOutputPin != mAudioPinMap.end())
+  // Only a link between exactly these two pins can be removed. Otherwise, the link of
+  // one of the pins to a third pin would be broken on one side only.
+  if ((mapItInputPin == mAudioPinMap.end()) || (mapItOutputPin == mAudioPinMap.end()) ||
+      (mapItOutputPin->second->sinkPin != inputPin) || (mapItInputPin->second->sourcePin != outputPin))
   {
-    mapItOutputPin->second->sinkPin = nullptr;
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,
+                "Cannot unlink pin", outputPin->getParameters()->name,
+                "from pin", inputPin->getParameters()->name,
+                "because the pins are not linked to each other");
+    return eIasFailed;
   }
+
+  mapItInputPin->second->sourcePin = nullptr;
+  mapItInputPin->second->isInputDataDelayed = false;
+  mapItOutputPin->second->sinkPin = nullptr;
+  return eIasOk;
 }
 
 
@@ -825,6 +878,88 @@ IasPipeline::IasResult IasPipeline::initAudioChain()
     return eIasFailed;
   }
 
+  if (mRuntimeRelinking)
+  {
+    // The real-time thread is not running yet, so the initial program can be installed directly.
+    buildRelinkProgram(&mRelinkProgram, &mCommittedPinSources);
+    mFadedStreams.assign(mAudioStreams.size(), 0);
+  }
+
+  return eIasOk;
+}
+
+
+IasPipeline::IasResult IasPipeline::setRuntimeRelinking(bool enable)
+{
+  if (mAudioChain != nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,
+                "Runtime relinking has to be configured before the audio chain is initialized");
+    return eIasFailed;
+  }
+  mRuntimeRelinking = enable;
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_PIPELINE, "Runtime relinking enabled:", enable);
+  return eIasOk;
+}
+
+
+IasPipeline::IasResult IasPipeline::commitPinLinks(uint32_t crossfadeLength)
+{
+  if (!mRuntimeRelinking)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE, "Runtime relinking is not enabled");
+    return eIasFailed;
+  }
+  if (mAudioChain == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE, "audio chain not initialized yet");
+    return eIasFailed;
+  }
+
+  IasRelinkProgram program;
+  IasPinSourceMap pinSources;
+  buildRelinkProgram(&program, &pinSources);
+  program.crossfadeLength = std::min(crossfadeLength, mParams->periodSize);
+
+  // Mark all destination streams whose pin got a new source or lost its source.
+  uint32_t numChangedPins = 0;
+  for (const auto &entry : mAudioPinMap)
+  {
+    const uint32_t streamId = entry.second->audioStreamId;
+    if (streamId >= program.changedStreams.size())
+    {
+      continue;
+    }
+    auto newIt = pinSources.find(entry.first);
+    auto oldIt = mCommittedPinSources.find(entry.first);
+    const bool hasNewSource = (newIt != pinSources.end());
+    const bool hasOldSource = (oldIt != mCommittedPinSources.end());
+    if ((hasNewSource != hasOldSource) || (hasNewSource && (newIt->second != oldIt->second)))
+    {
+      program.changedStreams[streamId] = 1;
+      numChangedPins++;
+      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_PIPELINE, "Source of pin", entry.first->getParameters()->name, "changed");
+    }
+  }
+
+  // The mailbox keeps only the latest program. If the real-time thread has not fetched the previous
+  // program yet, it switches directly from an older program to this one, so the pins changed by the
+  // previous program have to be faded as well.
+  if ((mFetchedRelinkSequence.load(std::memory_order_acquire) != mPostedRelinkSequence) &&
+      (mPostedChangedStreams.size() == program.changedStreams.size()))
+  {
+    for (uint32_t streamId = 0; streamId < program.changedStreams.size(); streamId++)
+    {
+      program.changedStreams[streamId] |= mPostedChangedStreams[streamId];
+    }
+  }
+  program.sequenceNumber = ++mPostedRelinkSequence;
+  mPostedChangedStreams = program.changedStreams;
+
+  mCommittedPinSources.swap(pinSources);
+  mRelinkProgramMailbox.post(program);
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_PIPELINE, "Committed new pin links, number of changed pins:", numChangedPins,
+              "crossfade length:", program.crossfadeLength);
   return eIasOk;
 }
 
@@ -968,7 +1103,60 @@ void IasPipeline::process()
     }
   }
   mAudioChain->clearOutputBundleBuffers();
-  mAudioChain->process();
+
+  // The replaced probes are never freed here, IasDebugImpl keeps a reference until they were dropped.
+  mStreamTapSlots.update();
+  const bool hasStreamTaps = (mStreamTapSlots.getSlots().empty() == false);
+  const uint32_t numComponents = static_cast<uint32_t>(mAudioChain->getAudioComponents().size());
+  if (hasStreamTaps)
+  {
+    processStreamTaps(0);
+  }
+  if (mRuntimeRelinking)
+  {
+    processRelinkProgram();
+  }
+  else if (hasStreamTaps)
+  {
+    // The taps of the module pins have to see the streams between the modules, so run the chain step by step.
+    const IasGenericAudioCompVector &components = mAudioChain->getAudioComponents();
+    for (uint32_t compIdx = 0; compIdx < numComponents; ++compIdx)
+    {
+      processStreamTaps(2 * compIdx + 1);
+      processAudioComponent(compIdx, components[compIdx]->getCore());
+      processStreamTaps(2 * compIdx + 2);
+    }
+  }
+  else if (mModuleTimingEnabled)
+  {
+    mAudioChain->process(mModuleTimes);
+  }
+  else
+  {
+    mAudioChain->process();
+  }
+  if (hasStreamTaps)
+  {
+    processStreamTaps(2 * numComponents + 1);
+  }
+
+  mLatencyProbeSlots.update();
+  for (auto &slot : mLatencyProbeSlots.getSlots())
+  {
+    IasAudioFrame* audioFrame = nullptr;
+    uint32_t    stride = 0;
+    if (getProbedAudioData(slot.key, &audioFrame, &stride) == true)
+    {
+      slot.probe->detect(*audioFrame, stride, mParams->periodSize);
+    }
+  }
+
+  // The program of a relinkable pipeline already contains the transfers via delay elements. Besides,
+  // the links of a relinkable pipeline can be modified by the control thread, so we must not read them here.
+  if (mRuntimeRelinking)
+  {
+    return;
+  }
 
   // Now we transfer the PCM frames between all audio pins that are linked via delay elements.
   //
@@ -1011,6 +1199,312 @@ void IasPipeline::process()
   }
 }
 
+/*
+ * @brief Private method: execute the program of a relinkable pipeline.
+ */
+void IasPipeline::processRelinkProgram()
+{
+  auto activateNextProgram = [this](IasRelinkProgram *nextProgram) {
+    // Swapping the vectors neither allocates nor frees memory in the real-time thread.
+    mRelinkProgram.steps.swap(nextProgram->steps);
+    mRelinkProgram.changedStreams.swap(nextProgram->changedStreams);
+    std::swap(mRelinkProgram.crossfadeLength, nextProgram->crossfadeLength);
+  };
+
+  if (mRelinkState == eIasRelinkIdle)
+  {
+    IasRelinkProgram *nextProgram = mRelinkProgramMailbox.fetch();
+    if (nextProgram != nullptr)
+    {
+      mFetchedRelinkSequence.store(nextProgram->sequenceNumber, std::memory_order_release);
+      if (nextProgram->crossfadeLength == 0)
+      {
+        activateNextProgram(nextProgram);
+      }
+      else
+      {
+        mNextRelinkProgram = nextProgram;
+        mRelinkState = eIasRelinkFadeOut;
+      }
+    }
+  }
+
+  switch (mRelinkState)
+  {
+    case eIasRelinkFadeOut:
+      // Fade out the pins whose source changes with the old program, then switch at the end of the period.
+      executeRelinkProgram(mRelinkProgram, &mNextRelinkProgram->changedStreams, mNextRelinkProgram->crossfadeLength, false);
+      activateNextProgram(mNextRelinkProgram);
+      mNextRelinkProgram = nullptr;
+      mRelinkState = eIasRelinkFadeIn;
+      break;
+    case eIasRelinkFadeIn:
+      executeRelinkProgram(mRelinkProgram, &mRelinkProgram.changedStreams, mRelinkProgram.crossfadeLength, true);
+      mRelinkState = eIasRelinkIdle;
+      break;
+    default:
+      executeRelinkProgram(mRelinkProgram, nullptr, 0, false);
+      break;
+  }
+}
+
+
+/*
+ * @brief Private method: execute one program of a relinkable pipeline.
+ */
+void IasPipeline::executeRelinkProgram(const IasRelinkProgram &program, const std::vector<uint8_t> *changedStreams,
+                                       uint32_t fadeLength, bool fadeIn)
+{
+  const uint32_t periodSize = mParams->periodSize;
+  const bool isFading = (changedStreams != nullptr) && (fadeLength > 0);
+  if (isFading)
+  {
+    std::fill(mFadedStreams.begin(), mFadedStreams.end(), 0);
+  }
+  auto isFaded = [this](uint32_t streamId) {
+    return (streamId < mFadedStreams.size()) && (mFadedStreams[streamId] != 0);
+  };
+
+  for (const IasRelinkStep &step : program.steps)
+  {
+    if (step.type == IasRelinkStep::eIasProcess)
+    {
+      processStreamTaps(2 * step.componentIdx + 1);
+      processAudioComponent(step.componentIdx, step.core);
+      processStreamTaps(2 * step.componentIdx + 2);
+      // The output of a module is faded if one of its inputs has been faded.
+      if (isFading && std::any_of(step.inputStreamIds.begin(), step.inputStreamIds.end(), isFaded))
+      {
+        for (uint32_t streamId : step.outputStreamIds)
+        {
+          mFadedStreams[streamId] = 1;
+        }
+      }
+      continue;
+    }
+
+    const std::vector<float*> &channelBuffers = *step.channelBuffers;
+    const uint32_t numChannels = static_cast<uint32_t>(channelBuffers.size());
+    IasAudioFrame* destinAudioFrame = step.destinStream->getInputAudioFrame();
+    IAS_ASSERT(destinAudioFrame->size() == numChannels);
+
+    if (step.type == IasRelinkStep::eIasCopy)
+    {
+      // The data of a pipeline input pin is still in its input channels, so let the stream read it first.
+      if (step.isSourcePipelineInput)
+      {
+        (void)step.sourceStream->asBundledStream();
+      }
+      IasAudioFrame* sourceAudioFrame = step.sourceStream->getOutputAudioFrame();
+      IAS_ASSERT(sourceAudioFrame->size() == numChannels);
+      for (uint32_t cntChannels = 0; cntChannels < numChannels; cntChannels++)
+      {
+        (*sourceAudioFrame)[cntChannels] = channelBuffers[cntChannels];
+      }
+      step.sourceStream->copyToOutputAudioChannels();
+
+      if (isFading && (step.destinStreamId < mFadedStreams.size()))
+      {
+        if (isFaded(step.sourceStreamId))
+        {
+          mFadedStreams[step.destinStreamId] = 1;
+        }
+        else if ((step.destinStreamId < changedStreams->size()) && ((*changedStreams)[step.destinStreamId] != 0))
+        {
+          applyRelinkFade(channelBuffers, periodSize, fadeLength, fadeIn);
+          mFadedStreams[step.destinStreamId] = 1;
+        }
+      }
+    }
+    else
+    {
+      for (float* channelBuffer : channelBuffers)
+      {
+        std::fill(channelBuffer, channelBuffer + periodSize, 0.0f);
+      }
+    }
+
+    for (uint32_t cntChannels = 0; cntChannels < numChannels; cntChannels++)
+    {
+      (*destinAudioFrame)[cntChannels] = channelBuffers[cntChannels];
+    }
+    step.destinStream->copyFromInputAudioChannels();
+
+    // The data of a pipeline output pin is read by retrieveOutputData, which expects it in the stream.
+    if (step.isDestinPipelineOutput)
+    {
+      (void)step.destinStream->asBundledStream();
+    }
+  }
+}
+
+
+/*
+ * @brief Private method: build the program of a relinkable pipeline.
+ */
+void IasPipeline::buildRelinkProgram(IasRelinkProgram *program, IasPinSourceMap *pinSources) const
+{
+  IAS_ASSERT(program != nullptr);
+  IAS_ASSERT(pinSources != nullptr);
+  IAS_ASSERT(mAudioChain != nullptr);
+
+  program->steps.clear();
+  program->changedStreams.assign(mAudioStreams.size(), 0);
+  program->crossfadeLength = 0;
+  program->sequenceNumber = 0;
+  pinSources->clear();
+
+  auto hasStream = [this](const IasAudioPinConnectionParamsPtr &params) {
+    return (params != nullptr) && (params->audioStreamId < mAudioStreams.size());
+  };
+  auto isInputPin = [](const IasAudioPinPtr &pin) {
+    return ((pin->getDirection() == IasAudioPin::eIasPinDirectionModuleInput) ||
+            (pin->getDirection() == IasAudioPin::eIasPinDirectionModuleInputOutput));
+  };
+  auto isOutputPin = [](const IasAudioPinPtr &pin) {
+    return ((pin->getDirection() == IasAudioPin::eIasPinDirectionModuleOutput) ||
+            (pin->getDirection() == IasAudioPin::eIasPinDirectionModuleInputOutput));
+  };
+
+  // Pins whose audio stream carries valid data in the current period. Initially, these are the pipeline input pins.
+  std::set<IasAudioPinPtr> activePins;
+  for (const auto &entry : mAudioPinMap)
+  {
+    if ((entry.first->getDirection() == IasAudioPin::eIasPinDirectionPipelineInput) && hasStream(entry.second))
+    {
+      activePins.insert(entry.first);
+    }
+    if (entry.second->sourcePin != nullptr)
+    {
+      (*pinSources)[entry.first] = IasPinSource(entry.second->sourcePin, entry.second->isInputDataDelayed);
+    }
+  }
+
+  // Add a step that feeds the destination pin, either with the data of its source pin or with zeros.
+  auto addTransferStep = [this, program, &hasStream](const IasAudioPinConnectionParamsPtr &destin, const IasAudioPinPtr &sourcePin) {
+    const IasAudioPinConnectionParamsPtr source = (sourcePin != nullptr) ? getPinConnectionParams(sourcePin) : nullptr;
+    IasRelinkStep step;
+    step.type = hasStream(source) ? IasRelinkStep::eIasCopy : IasRelinkStep::eIasZero;
+    step.sourceStream = hasStream(source) ? mAudioStreams[source->audioStreamId].audioStream : nullptr;
+    step.sourceStreamId = hasStream(source) ? source->audioStreamId : cAudioStreamIdUndefined;
+    step.isSourcePipelineInput = hasStream(source) && (source->thisPin->getDirection() == IasAudioPin::eIasPinDirectionPipelineInput);
+    step.destinStream = mAudioStreams[destin->audioStreamId].audioStream;
+    step.destinStreamId = destin->audioStreamId;
+    step.isDestinPipelineOutput = (destin->thisPin->getDirection() == IasAudioPin::eIasPinDirectionPipelineOutput);
+    step.channelBuffers = &destin->audioChannelBuffers;
+    step.core = nullptr;
+    step.componentIdx = 0;
+    program->steps.push_back(step);
+  };
+
+  // Schedule all modules whose input pins receive valid data, in the same way as identifyProcessingSequence.
+  const IasGenericAudioCompVector &components = mAudioChain->getAudioComponents();
+  std::set<IasProcessingModulePtr> scheduledModules;
+  bool isModuleScheduled = true;
+  while (isModuleScheduled)
+  {
+    isModuleScheduled = false;
+    for (const auto &entry : mProcessingModuleMap)
+    {
+      const IasProcessingModulePtr &module = entry.first;
+      IasGenericAudioComp *audioComponent = module->getGenericAudioComponent();
+      if ((audioComponent == nullptr) || (scheduledModules.count(module) != 0))
+      {
+        continue;
+      }
+      IasAudioPinSetPtr audioPinSet = module->getAudioPinSet();
+      bool isDataAvailableAllInputPins = true;
+      for (const IasAudioPinPtr &audioPin : (*audioPinSet))
+      {
+        if (isInputPin(audioPin))
+        {
+          const IasAudioPinConnectionParamsPtr params = getPinConnectionParams(audioPin);
+          if (!hasStream(params) || (params->sourcePin == nullptr) ||
+              (!params->isInputDataDelayed && (activePins.count(params->sourcePin) == 0)))
+          {
+            isDataAvailableAllInputPins = false;
+          }
+        }
+      }
+      if (!isDataAvailableAllInputPins)
+      {
+        continue;
+      }
+
+      for (const IasAudioPinPtr &audioPin : (*audioPinSet))
+      {
+        const IasAudioPinConnectionParamsPtr params = getPinConnectionParams(audioPin);
+        if (isInputPin(audioPin) && !params->isInputDataDelayed)
+        {
+          addTransferStep(params, params->sourcePin);
+        }
+      }
+
+      IasRelinkStep step;
+      step.type = IasRelinkStep::eIasProcess;
+      step.sourceStream = nullptr;
+      step.sourceStreamId = cAudioStreamIdUndefined;
+      step.isSourcePipelineInput = false;
+      step.destinStream = nullptr;
+      step.destinStreamId = cAudioStreamIdUndefined;
+      step.isDestinPipelineOutput = false;
+      step.channelBuffers = nullptr;
+      step.core = audioComponent->getCore();
+      step.componentIdx = static_cast<uint32_t>(std::find(components.begin(), components.end(), audioComponent) - components.begin());
+      for (const IasAudioPinPtr &audioPin : (*audioPinSet))
+      {
+        const IasAudioPinConnectionParamsPtr params = getPinConnectionParams(audioPin);
+        if (hasStream(params) && isInputPin(audioPin))
+        {
+          step.inputStreamIds.push_back(params->audioStreamId);
+        }
+        if (hasStream(params) && isOutputPin(audioPin))
+        {
+          step.outputStreamIds.push_back(params->audioStreamId);
+        }
+      }
+      program->steps.push_back(step);
+
+      for (const IasAudioPinPtr &audioPin : (*audioPinSet))
+      {
+        if (isOutputPin(audioPin) && hasStream(getPinConnectionParams(audioPin)))
+        {
+          activePins.insert(audioPin);
+        }
+      }
+      scheduledModules.insert(module);
+      isModuleScheduled = true;
+      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_PIPELINE, "Relink program: processing module", module->getParameters()->instanceName);
+    }
+  }
+
+  // Feed the pipeline output pins, with zeros if they are not linked to an active source.
+  for (const IasAudioPinPtr &outputPin : mPipelineOutputPins)
+  {
+    const IasAudioPinConnectionParamsPtr params = getPinConnectionParams(outputPin);
+    if (hasStream(params) && !params->isInputDataDelayed)
+    {
+      const bool isSourceActive = (params->sourcePin != nullptr) && (activePins.count(params->sourcePin) != 0);
+      addTransferStep(params, isSourceActive ? params->sourcePin : nullptr);
+    }
+  }
+
+  // Finally, transfer the data via the delay elements, which is read in the next period.
+  for (const auto &entry : mAudioPinMap)
+  {
+    const IasAudioPinConnectionParamsPtr &params = entry.second;
+    if (hasStream(params) && (params->sourcePin != nullptr) && params->isInputDataDelayed)
+    {
+      const bool isSourceActive = (activePins.count(params->sourcePin) != 0);
+      addTransferStep(params, isSourceActive ? params->sourcePin : nullptr);
+    }
+  }
+
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_PIPELINE, "Relink program: number of steps:", program->steps.size(),
+              "number of scheduled modules:", scheduledModules.size(), "of", mProcessingModuleMap.size());
+}
+
+
 /*
  * @brief Retrieve output data from the pipeline.
  */
@@ -1278,11 +1772,14 @@ IasPipeline::IasResult IasPipeline::initAudioStreams()
     // whose direction is not ModuleInput, ModuleInputOutput, or PipelineOutput. Additionally, the
     // path ends if we reach an audio pin whose sourcePin is linked with a delay element, because
     // a delay element requires that we have separate streams at its input and output.
+    // If runtime relinking is enabled, each audio pin gets an audio stream of its own, because the links
+    // can change after the audio components have been bound to their streams.
     std::vector<IasAudioPinPtr>  connectedPins;
     IasAudioPinPtr                     currentPin = mapIt->first;
     IasAudioPinConnectionParamsPtr       pinConnectionParams = mapIt->second;
     connectedPins.push_back(currentPin);
-    while (((currentPin->getDirection() == IasAudioPin::eIasPinDirectionModuleInputOutput) ||
+    while ((!mRuntimeRelinking) &&
+           ((currentPin->getDirection() == IasAudioPin::eIasPinDirectionModuleInputOutput) ||
             (currentPin->getDirection() == IasAudioPin::eIasPinDirectionModuleInput) ||
             (currentPin->getDirection() == IasAudioPin::eIasPinDirectionPipelineOutput)) &&
            (pinConnectionParams->sourcePin != nullptr) &&
@@ -1348,10 +1845,34 @@ IasPipeline::IasResult IasPipeline::initAudioStreams()
     streamConnectionParams.audioStream = audioStream;
   }
 
+  // If runtime relinking is enabled, the channel buffers of all pins that can receive data from another pin
+  // are used to copy the data between the audio streams. The audio components of all modules are created,
+  // so that modules which are not linked yet can be inserted into the running pipeline.
+  IasProcessingModuleSchedulingList modulesToCreate = mProcessingModuleSchedulingList;
+  if (mRuntimeRelinking)
+  {
+    for (auto &entry : mAudioPinMap)
+    {
+      const IasAudioPin::IasPinDirection pinDirection = entry.first->getDirection();
+      if ((pinDirection == IasAudioPin::eIasPinDirectionModuleInput) ||
+          (pinDirection == IasAudioPin::eIasPinDirectionModuleInputOutput))
+      {
+        createAudioChannelBuffers(entry.second, entry.first->getParameters()->numChannels, mParams->periodSize);
+      }
+    }
+    for (auto &entry : mProcessingModuleMap)
+    {
+      if (std::find(modulesToCreate.begin(), modulesToCreate.end(), entry.first) == modulesToCreate.end())
+      {
+        modulesToCreate.push_back(entry.first);
+      }
+    }
+  }
+
   // Iterate over all modules, create the associated GenericAudioComponentConfigurations,
   // and add all audio streams and audio stream mappings to the configurations.
   // Finally, create the GenericAudioComponents based on the GenericAudioComponentConfigurations.
-  for (IasProcessingModulePtr module :mProcessingModuleSchedulingList)
+  for (IasProcessingModulePtr module :modulesToCreate)
   {
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_PIPELINE,
                 "Creating actual audio component for processing module", module->getParameters()->instanceName);
@@ -1420,6 +1941,7 @@ IasPipeline::IasResult IasPipeline::initAudioStreams()
 
     module->setGenericAudioComponent(audioComponent);
     mAudioChain->addAudioComponent(audioComponent);
+    mComponentModules.push_back(module);
   }
 
   return eIasOk;
@@ -1656,6 +2178,178 @@ IasPipeline::IasResult IasPipeline::startPinProbing(IasAudioPinPtr pin,
 }
 
 
+IasPipeline::IasResult IasPipeline::startLatencyProbe(IasAudioPinPtr pin, IasLatencyProbePtr probe)
+{
+  IasAudioPinConnectionParamsPtr params = getPinConnectionParams(pin);
+  if (params == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,"could not get pin connection params");
+    return eIasFailed;
+  }
+  if (params->audioStreamId >= mAudioStreams.size())
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,"pin", pin->getParameters()->name, "has no audio stream, pipeline not initialized yet");
+    return eIasFailed;
+  }
+  // Only one pin of the pipeline is scanned for the marker at a time
+  mLatencyProbeSlots.detachAll();
+  mLatencyProbeSlots.attach(probe, params->audioStreamId);
+  return eIasOk;
+}
+
+void IasPipeline::stopLatencyProbe()
+{
+  mLatencyProbeSlots.detachAll();
+}
+
+IasPipeline::IasResult IasPipeline::startStreamProbe(IasAudioPinPtr pin, IasStreamTapPtr probe)
+{
+  IAS_ASSERT(probe != nullptr);
+  IasAudioPinConnectionParamsPtr params = getPinConnectionParams(pin);
+  if (params == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,"could not get pin connection params");
+    return eIasFailed;
+  }
+  if (params->audioStreamId >= mAudioStreams.size())
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,"pin", pin->getParameters()->name, "has no audio stream, pipeline not initialized yet");
+    return eIasFailed;
+  }
+  const uint32_t key = getStreamTapKey(pin, params);
+  if (key == cStreamTapKeyUndefined)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,"module of pin", pin->getParameters()->name, "has no audio component");
+    return eIasFailed;
+  }
+  if (mStreamTapSlots.attach(probe, key) == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,"maximum number of stream probes reached:", cMaxNumStreamProbes);
+    return eIasFailed;
+  }
+  return eIasOk;
+}
+
+void IasPipeline::stopStreamProbe(IasAudioPinPtr pin)
+{
+  IasAudioPinConnectionParamsPtr params = getPinConnectionParams(pin);
+  if (params == nullptr)
+  {
+    return;
+  }
+  const uint32_t key = getStreamTapKey(pin, params);
+  if (key != cStreamTapKeyUndefined)
+  {
+    mStreamTapSlots.detach(key);
+  }
+}
+
+uint32_t IasPipeline::getStreamTapKey(const IasAudioPinPtr &pin, const IasAudioPinConnectionParamsPtr &params) const
+{
+  if ((mAudioChain == nullptr) || (params->audioStreamId >= mAudioStreams.size()))
+  {
+    return cStreamTapKeyUndefined;
+  }
+  IAS_ASSERT(params->audioStreamId < (1u << cStreamTapPositionShift));
+  const IasGenericAudioCompVector &components = mAudioChain->getAudioComponents();
+  uint32_t position = 0;
+  switch (pin->getDirection())
+  {
+    case IasAudioPin::eIasPinDirectionPipelineInput:
+      position = 0;
+      break;
+    case IasAudioPin::eIasPinDirectionPipelineOutput:
+      position = 2 * static_cast<uint32_t>(components.size()) + 1;
+      break;
+    default:
+    {
+      if (params->processingModule == nullptr)
+      {
+        return cStreamTapKeyUndefined;
+      }
+      auto compIt = std::find(components.begin(), components.end(), params->processingModule->getGenericAudioComponent());
+      if (compIt == components.end())
+      {
+        return cStreamTapKeyUndefined;
+      }
+      const uint32_t compIdx = static_cast<uint32_t>(compIt - components.begin());
+      position = (pin->getDirection() == IasAudioPin::eIasPinDirectionModuleInput) ? (2 * compIdx + 1) : (2 * compIdx + 2);
+      break;
+    }
+  }
+  return (position << cStreamTapPositionShift) | params->audioStreamId;
+}
+
+void IasPipeline::processStreamTaps(uint32_t position)
+{
+  for (auto &slot : mStreamTapSlots.getSlots())
+  {
+    IasAudioFrame* audioFrame = nullptr;
+    uint32_t    stride = 0;
+    if (((slot.key >> cStreamTapPositionShift) == position) &&
+        (getProbedAudioData(slot.key & cStreamTapStreamIdMask, &audioFrame, &stride) == true))
+    {
+      slot.probe->process(*audioFrame, stride, mParams->periodSize);
+    }
+  }
+}
+
+void IasPipeline::processAudioComponent(uint32_t componentIdx, IasGenericAudioCompCore *core)
+{
+  if (mModuleTimingEnabled && (componentIdx < mModuleTimes.size()))
+  {
+    const auto start = std::chrono::steady_clock::now();
+    (void)core->process();
+    const auto end = std::chrono::steady_clock::now();
+    mModuleTimes[componentIdx] += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  }
+  else
+  {
+    (void)core->process();
+  }
+}
+
+bool IasPipeline::getProbedAudioData(uint32_t audioStreamId, IasAudioFrame **audioFrame, uint32_t *stride) const
+{
+  if (audioStreamId >= mAudioStreams.size())
+  {
+    return false;
+  }
+  mAudioStreams[audioStreamId].audioStream->peekAudioDataPointers(audioFrame, stride);
+  return (*audioFrame != nullptr);
+}
+
+IasPipeline::IasResult IasPipeline::enableModuleTiming(bool enable)
+{
+  if (mAudioChain == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_PIPELINE,"audio chain not initialized yet");
+    return eIasFailed;
+  }
+  if (enable)
+  {
+    mModuleTimes.assign(mAudioChain->getAudioComponents().size(), 0);
+  }
+  mModuleTimingEnabled = enable;
+  return eIasOk;
+}
+
+void IasPipeline::getModuleTimes(IasModuleTimeVector *moduleTimes) const
+{
+  IAS_ASSERT(moduleTimes != nullptr);
+  moduleTimes->clear();
+  if (mAudioChain == nullptr)
+  {
+    return;
+  }
+  const IasGenericAudioCompVector &components = mAudioChain->getAudioComponents();
+  for (uint32_t compIdx = 0; compIdx < components.size() && compIdx < mModuleTimes.size(); ++compIdx)
+  {
+    moduleTimes->push_back(IasModuleTime(components[compIdx]->getInstanceName(), mModuleTimes[compIdx]));
+  }
+}
+
+
 /*
  * Function to get a IasPipeline::IasResult as string.
  */
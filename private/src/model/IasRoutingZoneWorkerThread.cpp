@@ -26,10 +26,13 @@
 #include "avbaudiomodules/internal/audio/common/IasDataProbe.hpp"
 #include "avbaudiomodules/internal/audio/common/IasDataProbeHelper.hpp"
 #include "model/IasPipeline.hpp"
+#include "smartx/IasLatencyProbe.hpp"
+#include "smartx/IasIStreamTap.hpp"
 #include "model/IasAudioSinkDevice.hpp"
 #include "model/IasRoutingZoneWorkerThread.hpp"
 #include "model/IasAudioPort.hpp"
 #include "smartx/IasThreadNames.hpp"
+#include "smartx/IasRtLog.hpp"
 #include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBufferMirror.hpp"
 #include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBufferFactory.hpp"
 
@@ -41,6 +44,9 @@ static const std::string cRunnerClassName = "IasRunnerThread::";
 #define LOG_RUNNER_PREFIX cRunnerClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
 #define LOG_ZONE "zone=" + mParams->name + ":"
 #define LOG_RUNNER_NAME "runner thread, parent=" + mParentZoneName + ":PSM=" + std::to_string(mPeriodSizeMultiple) + ":"
+// Prefixes for the real-time logs, passed as separate arguments to avoid building strings in the real-time thread.
+#define RT_LOG_ZONE "zone=", mParams->name
+#define RT_LOG_RUNNER_NAME "runner thread, parent=", mParentZoneName, "PSM=", mPeriodSizeMultiple
 
 IasRunnerThread::IasRunnerThread(uint32_t periodSizeMultiple, std::string parentZoneName)
   :mThreadShouldBeRunning(false)
@@ -53,6 +59,7 @@ IasRunnerThread::IasRunnerThread(uint32_t periodSizeMultiple, std::string parent
   ,mThread(nullptr)
   ,mIsProcessing(false)
   ,mParentZoneName(parentZoneName)
+  ,mName(parentZoneName + ".psm" + std::to_string(periodSizeMultiple))
 {
   mThread = new IasThread(this, std::string("runner thread") + mParentZoneName);
   IAS_ASSERT(mThread != nullptr);
@@ -203,8 +210,8 @@ bool IasRunnerThread::isAnyActive() const
 IasAudioCommonResult IasRunnerThread::run()
 {
   std::unique_lock<std::mutex> lk(mMutexDerivedZones);
-  IasThreadNames::getInstance()->setThreadName(IasThreadNames::eIasRealTime, std::string("Runner thread for periodSizeMultiple ") + std::to_string(mPeriodSizeMultiple));
-  IasConfigFile::configureThreadSchedulingParameters(mLog, eIasPriorityOneLess);
+  IasThreadNames::getInstance()->setThreadName(IasThreadNames::eIasRealTime, std::string("Runner thread ") + mName + " for periodSizeMultiple " + std::to_string(mPeriodSizeMultiple));
+  IasConfigFile::configureThreadSchedulingParameters(mLog, IasConfigFile::eIasThreadRoleRunner, mName, eIasPriorityOneLess);
   DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_RUNNER_PREFIX, LOG_RUNNER_NAME, "Starting thread");
   while (mThreadShouldBeRunning)
   {
@@ -235,17 +242,17 @@ IasAudioCommonResult IasRunnerThread::run()
         {
           derivedZoneParams->countPeriods = 0;
         }
-        std::string derivedZoneName = "(name=\"" + derivedZoneTransferThread->mParams->name + "\"):";
+        const std::string &derivedZoneName = derivedZoneTransferThread->mParams->name;
 
-        DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_RUNNER_PREFIX, LOG_RUNNER_NAME,
-                    "Executing IasRoutingZoneWorkerThread::transferPeriod method of derived zone", derivedZoneName);
+        IasRtLog::log(mLog, DLT_LOG_VERBOSE, cRunnerClassName, __func__, __LINE__, RT_LOG_RUNNER_NAME,
+                      "Executing IasRoutingZoneWorkerThread::transferPeriod method of derived zone", derivedZoneName);
         IasRoutingZoneWorkerThread::IasResult result;
         result = mapIt->first->transferPeriod();
         if (result != IasRoutingZoneWorkerThread::IasResult::eIasOk)
         {
-          DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_RUNNER_PREFIX, LOG_RUNNER_NAME,
-                      "Error during IasRoutingZoneWorkerThread::transferPeriod method of derived zone", derivedZoneName,
-                      toString(result));
+          IasRtLog::log(mLog, DLT_LOG_ERROR, cRunnerClassName, __func__, __LINE__, RT_LOG_RUNNER_NAME,
+                        "Error during IasRoutingZoneWorkerThread::transferPeriod method of derived zone", derivedZoneName,
+                        result);
           mIsProcessing = false;
           return eIasResultFailed;
         }
@@ -274,6 +281,11 @@ uint32_t IasRunnerThread::getPeriodSizeMultiple() const
   return mPeriodSizeMultiple;
 }
 
+const std::string& IasRunnerThread::getName() const
+{
+  return mName;
+}
+
 IasRoutingZoneWorkerThread::IasRoutingZoneWorkerThread(IasRoutingZoneParamsPtr params)
   :mLog(IasAudioLogging::registerDltContext("RZN", "Routing Zone"))
   ,mParams(params)
@@ -288,6 +300,8 @@ IasRoutingZoneWorkerThread::IasRoutingZoneWorkerThread(IasRoutingZoneParamsPtr p
   ,mEventProvider(nullptr)
   ,mDataProbe(nullptr)
   ,mProbingActive(false)
+  ,mLatencyProbeSlots()
+  ,mStreamTapSlots()
   ,mIsDerivedZone(false)
   ,mDerivedZoneCallCount(0)
   ,mPipeline(nullptr)
@@ -299,6 +313,11 @@ IasRoutingZoneWorkerThread::IasRoutingZoneWorkerThread(IasRoutingZoneParamsPtr p
   ,mLogInterval(0)
   ,mTimeoutCnt(0)
   ,mLogOkCnt(0)
+  ,mSinkPrefillParams()
+  ,mMutexSinkPrefill()
+  ,mSinkPrefillMailbox()
+  ,mSinkFillController()
+  ,mSinkFillControlEnabled(false)
 {
   IAS_ASSERT(params != nullptr)
   mEventProvider = IasEventProvider::getInstance();
@@ -1012,7 +1031,7 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
   IasAudioDevice::IasEventType lastEvent = IasAudioDevice::IasEventType::eIasNoEvent;
   while ((eventType = mSinkDevice->getNextEventType()) != IasAudioDevice::IasEventType::eIasNoEvent)
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Got event", toString(eventType), "from sink", mSinkDevice->getName());
+    IAS_RT_LOG(*mLog, DLT_LOG_INFO, "Got event", eventType, "from sink", mSinkDevice->getName());
     lastEvent = eventType;
     if (eventType == IasAudioDevice::IasEventType::eIasStop)
     {
@@ -1042,9 +1061,11 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
     IasDataProbe::IasResult probeRes = IasDataProbeHelper::processQueueEntry(probingQueueEntry, &mDataProbe, &mProbingActive, mSinkDevice->getNumPeriods()*mPeriodSize);
     if (probeRes != IasDataProbe::eIasOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "error during ", toString(probingQueueEntry.action)," :", toString(probeRes));
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "error during ", probingQueueEntry.action," :", probeRes);
     }
   }
+  mLatencyProbeSlots.update();
+  mStreamTapSlots.update();
 
   // Setup a vector of boolean flags, which indicates for each channel of the sink device
   // whether this channel has received valid PCM samples from one of the routing zone input ports.
@@ -1068,7 +1089,7 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
   {
     if (mTimeoutCnt > mLogInterval || mTimeoutCnt == 0)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE, "Timeout during IasAudioRingBuffer::updateAvailable. Trying to continue.");
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE, "Timeout during IasAudioRingBuffer::updateAvailable. Trying to continue.");
       mTimeoutCnt = 0;
     }
     mTimeoutCnt++;
@@ -1076,7 +1097,7 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
   }
   else if (result != IasAudioRingBufferResult::eIasRingBuffOk)
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE, "Error during IasAudioRingBuffer::updateAvailable:", toString(result));
+    IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE, "Error during IasAudioRingBuffer::updateAvailable:", result);
     if ((result == eIasRingBuffAlsaXrunError) || (result == eIasRingBuffAlsaSuspendError) || (result == eIasRingBuffAlsaError))
     {
       // Create event
@@ -1090,7 +1111,7 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
   else
   {
     mTimeoutCnt = 0;
-    DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, LOG_ZONE, "space available in sink device:",sinkDeviceNumFramesAvailable,"period size is:",mPeriodSize);
+    IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, RT_LOG_ZONE, "space available in sink device:",sinkDeviceNumFramesAvailable,"period size is:",mPeriodSize);
   }
   // If this is a base zone: trigger switchmatrix here to have all data ready in conversion buffers.
   if (!mIsDerivedZone)
@@ -1109,7 +1130,7 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
     mSinkDeviceRingBuffer->zeroOut();
     if (mLogCnt > mLogInterval || mLogCnt == 0)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_ZONE, "Only", sinkDeviceNumFramesAvailable, "frames free space available, but", mPeriodSize, "required. Zeroed out sink device buffer.");
+      IAS_RT_LOG(*mLog, DLT_LOG_INFO, RT_LOG_ZONE, "Only", sinkDeviceNumFramesAvailable, "frames free space available, but", mPeriodSize, "required. Zeroed out sink device buffer.");
       mLogCnt = 0;
     }
     mLogCnt++;
@@ -1133,6 +1154,10 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
   // buffers. This could happen, if the routing zone is a derived zone that
   // writes into an ALSA handler using the non-blocking mode.
   bool writeToSinkDevice = (sinkDeviceNumFramesAvailable >= mPeriodSize);
+  if (writeToSinkDevice && mIsDerivedZone && mSinkFillControlEnabled)
+  {
+    writeToSinkDevice = controlSinkFillLevel(&sinkDeviceNumFramesAvailable);
+  }
 
   uint32_t sinkDeviceOffset    = 0;
   uint32_t sinkDeviceNumFrames = mPeriodSize;
@@ -1150,7 +1175,7 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
 
     if (result != IasAudioRingBufferResult::eIasRingBuffOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE, "Error during IasAudioRingBuffer::beginAccess:", toString(result));
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE, "Error during IasAudioRingBuffer::beginAccess:", result);
       if (result == eIasRingBuffAlsaError)
       {
         // Create event
@@ -1213,8 +1238,8 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
       result = conversionBuffer->updateAvailable(eIasRingBufferAccessRead, &conversionBufferNumSamplesAvail);
       if (result != eIasRingBuffOk)
       {
-        DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE,
-                    "Error during IasAudioRingBuffer::updateAvailable method of the conversion buffer:", toString(result));
+        IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE,
+                    "Error during IasAudioRingBuffer::updateAvailable method of the conversion buffer:", result);
         return eIasFailed;
       }
 
@@ -1240,7 +1265,7 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
       // Print out the new status of the state machine, if it has changed.
       if (streamingState != streamingStatePrevious)
       {
-        DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_ZONE, "Changing to state", toString(streamingState), "conversionBufferNumSamplesAvail=", conversionBufferNumSamplesAvail, "numFramesToTransfer=", numFramesToTransfer);
+        IAS_RT_LOG(*mLog, DLT_LOG_INFO, RT_LOG_ZONE, "Changing to state", streamingState, "conversionBufferNumSamplesAvail=", conversionBufferNumSamplesAvail, "numFramesToTransfer=", numFramesToTransfer);
       }
 
       // Ask the conversion buffer for the number of contiguous frames available.
@@ -1252,8 +1277,8 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
 
       if (result != eIasRingBuffOk)
       {
-        DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE,
-                    "Error during IasAudioRingBuffer::beginAccess method of the conversion buffer:", toString(result));
+        IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE,
+                    "Error during IasAudioRingBuffer::beginAccess method of the conversion buffer:", result);
         return eIasFailed;
       }
 
@@ -1314,8 +1339,8 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
       result = conversionBuffer->endAccess(eIasRingBufferAccessRead, conversionBufferOffset, numFramesToRead);
       if (result != eIasRingBuffOk)
       {
-        DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE,
-                    "Error during IasAudioRingBuffer::endAccess method of the conversion buffer:", toString(result));
+        IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE,
+                    "Error during IasAudioRingBuffer::endAccess method of the conversion buffer:", result);
         return eIasFailed;
       }
       numFramesTransferred += numFramesToWrite;
@@ -1357,18 +1382,33 @@ IasRoutingZoneWorkerThread::IasResult IasRoutingZoneWorkerThread::transferPeriod
       IasDataProbe::IasResult probeRes =  mDataProbe->process(sinkDeviceAreas, sinkDeviceOffset, sinkDeviceNumFrames);
       if(probeRes != IasDataProbe::eIasOk)
       {
-        DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "delete probe");
+        IAS_RT_LOG(*mLog, DLT_LOG_INFO, "delete probe");
         mProbingActive.store(false);
         mDataProbe = nullptr;
       }
     }
 
+    // Scan for the marker of the latency probe. Everything still queued in the sink device
+    // will be played out before the current period.
+    IasLatencyProbe *latencyProbe = mLatencyProbeSlots.getProbe();
+    if (latencyProbe != nullptr)
+    {
+      const uint32_t sinkDeviceBufferSize = mSinkDevice->getNumPeriods() * mSinkDevice->getPeriodSize();
+      const uint32_t numFramesQueued = (sinkDeviceBufferSize > sinkDeviceNumFramesAvailable) ? (sinkDeviceBufferSize - sinkDeviceNumFramesAvailable) : 0;
+      latencyProbe->detect(sinkDeviceAreas, mSinkDeviceDataFormat, sinkDeviceOffset, sinkDeviceNumFrames, numFramesQueued);
+    }
+    IasIStreamTap *streamTap = mStreamTapSlots.getProbe();
+    if (streamTap != nullptr)
+    {
+      streamTap->process(sinkDeviceAreas, mSinkDeviceDataFormat, sinkDeviceOffset, sinkDeviceNumFrames);
+    }
+
     // Call the endAccess method of the linked sink device.
-    DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, LOG_ZONE, "Calling IasAudioRingBuffer::endAccess with sinkDeviceNumFrames=", sinkDeviceNumFrames);
+    IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, RT_LOG_ZONE, "Calling IasAudioRingBuffer::endAccess with sinkDeviceNumFrames=", sinkDeviceNumFrames);
     result = mSinkDeviceRingBuffer->endAccess(eIasRingBufferAccessWrite, sinkDeviceOffset, sinkDeviceNumFrames);
     if (result != IasAudioRingBufferResult::eIasRingBuffOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE, "Error during IasAudioRingBuffer::endAccess:", toString(result));
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE, "Error during IasAudioRingBuffer::endAccess:", result);
       if (result == eIasRingBuffAlsaError)
       {
         // Create event
@@ -1577,7 +1617,7 @@ IasAudioCommonResult IasRoutingZoneWorkerThread::run()
   IAS_ASSERT(mSwitchMatrix != nullptr); // already checked in start() method.
 
   IasThreadNames::getInstance()->setThreadName(IasThreadNames::eIasRealTime, "Routing Zone worker thread for Routing Zone " + mParams->name);
-  IasConfigFile::configureThreadSchedulingParameters(mLog);
+  IasConfigFile::configureThreadSchedulingParameters(mLog, IasConfigFile::eIasThreadRoleBaseZone, mParams->name);
 
   while (mThreadIsRunning == true)
   {
@@ -1593,8 +1633,8 @@ IasAudioCommonResult IasRoutingZoneWorkerThread::run()
     IasRoutingZoneWorkerThread::IasResult result = transferPeriod();
     if (result != eIasOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE,
-                  "Error during IasRoutingZoneWorkerThread::transferPeriod method of base zone:", toString(result));
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE,
+                  "Error during IasRoutingZoneWorkerThread::transferPeriod method of base zone:", result);
       return eIasResultFailed;
     }
     mDerivedZoneCallCount = 0;
@@ -1610,7 +1650,7 @@ IasAudioCommonResult IasRoutingZoneWorkerThread::run()
         uint32_t periodCount = derivedZoneRunnerThread->addPeriod(1);
         if (periodCount >= mapIt->second.periodSizeMultiple) {
           if (derivedZoneRunnerThread->isProcessing()) {
-            DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_ZONE, "Runner thread for periodSizeMultiple:", derivedZoneRunnerThread->getPeriodSizeMultiple(), " is still not done processing when new periods arrived");
+            IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE, "Runner thread for periodSizeMultiple:", derivedZoneRunnerThread->getPeriodSizeMultiple(), " is still not done processing when new periods arrived");
           }
           derivedZoneRunnerThread->wake();
           // mDerivedZoneCallCount only cares about whether there was a zone called or not
@@ -1707,17 +1747,17 @@ bool IasRoutingZoneWorkerThread::isSinkServiced() const
     }
     else
     {
-      // In this case we prefilled the buffer with bufferSize - periodSize zeros. If one period was consumed from
-      // the buffer, then the sink device is serviced.
-      targetValue = 2*periodSize;
+      // In this case we prefilled the buffer with the prefill target, by default bufferSize - periodSize zeros.
+      // If one period was consumed from the buffer, then the sink device is serviced.
+      targetValue = bufferSize - mSinkFillController.getTarget() + periodSize;
     }
   }
   else
   {
-    // In this case we prefilled the buffer with one periodSize zeros. If there is less than one period of samples in
-    // the buffer or respectively more space than bufferSize - periodSize + 1, then the sink device is serviced.
-    // The + 1 is required because we check for >= and not only >.
-    targetValue = bufferSize - periodSize + 1;
+    // In this case we prefilled the buffer with the prefill target, by default one periodSize zeros. If there is less
+    // than the prefill target of samples in the buffer or respectively more space than bufferSize - prefill + 1, then
+    // the sink device is serviced. The + 1 is required because we check for >= and not only >.
+    targetValue = bufferSize - mSinkFillController.getTarget() + 1;
   }
 
   if (avail >= targetValue)
@@ -1741,19 +1781,26 @@ void IasRoutingZoneWorkerThread::prefillSinkBuffer()
     uint32_t bufferSize = mSinkDevice->getNumPeriods() * periodSize;
     IasAudioArea *areas = nullptr;
     uint32_t offset = 0;
-    uint32_t framesToBeFilled = 0;
+    uint32_t defaultFill = 0;
     if (mSinkDevice->isAlsaHandler())
     {
       // In case of an ALSA handler prefill the sink device ALSA buffer with one period size less than the buffer size.
       // The additional empty period size space is used to compensate for scheduling jitter
-      framesToBeFilled = bufferSize - periodSize;
+      defaultFill = bufferSize - periodSize;
+      mSinkFillControlEnabled = (mSinkDevice->getDeviceParams()->clockType != IasClockType::eIasClockReceivedAsync);
     }
     else
     {
       // In case of a SmartXbar plugin we are providing the data for an ALSA capture device. Therefor it is engough to fill only with one
       // period size. This prevents the application to read more than one period in a loop at full speed, like e.g. arecord would do.
-      framesToBeFilled = periodSize;
+      defaultFill = periodSize;
+      mSinkFillControlEnabled = false;
     }
+    // The prefill depth configured for this zone replaces the default. The fill level is controlled once per log interval,
+    // which is roughly one second.
+    mSinkFillController.init(periodSize, bufferSize, defaultFill, mLogInterval);
+    mSinkFillController.setParams(getSinkPrefill());
+    uint32_t framesToBeFilled = mSinkFillController.getTarget();
     uint32_t frames = framesToBeFilled;
     IasAudioRingBufferResult rbres = mSinkDeviceRingBuffer->beginAccess(eIasRingBufferAccessWrite, &areas, &offset, &frames);
     if (rbres == eIasRingBuffOk)
@@ -1791,6 +1838,74 @@ void IasRoutingZoneWorkerThread::prefillSinkBuffer()
   }
 }
 
+void IasRoutingZoneWorkerThread::setSinkPrefill(const IasISetup::IasSinkPrefillParams &params)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutexSinkPrefill);
+    mSinkPrefillParams = params;
+  }
+  // If the zone is active, the real-time thread picks the new parameters up with the next period.
+  mSinkPrefillMailbox.post(params);
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_ZONE, "Sink prefill set to", params.numFrames,
+              "frames, adaptive =", params.adaptive, "min =", params.minFrames, "max =", params.maxFrames);
+}
+
+IasISetup::IasSinkPrefillParams IasRoutingZoneWorkerThread::getSinkPrefill() const
+{
+  std::lock_guard<std::mutex> lock(mMutexSinkPrefill);
+  return mSinkPrefillParams;
+}
+
+bool IasRoutingZoneWorkerThread::controlSinkFillLevel(uint32_t *numFramesAvailable)
+{
+  IAS_ASSERT(numFramesAvailable != nullptr);
+  const IasISetup::IasSinkPrefillParams *params = mSinkPrefillMailbox.fetch();
+  if (params != nullptr)
+  {
+    mSinkFillController.setParams(*params);
+    IAS_RT_LOG(*mLog, DLT_LOG_INFO, RT_LOG_ZONE, "New sink fill target:", mSinkFillController.getTarget(), "frames");
+  }
+
+  const uint32_t bufferSize = mSinkDevice->getNumPeriods() * mPeriodSize;
+  const uint32_t fillLevel = (bufferSize > *numFramesAvailable) ? (bufferSize - *numFramesAvailable) : 0;
+  const uint32_t previousTarget = mSinkFillController.getTarget();
+  const IasSinkFillController::IasAction action = mSinkFillController.update(fillLevel);
+  if (mSinkFillController.getTarget() != previousTarget)
+  {
+    IAS_RT_LOG(*mLog, DLT_LOG_INFO, RT_LOG_ZONE, "Adapted sink fill target from", previousTarget,
+               "to", mSinkFillController.getTarget(), "frames, fill level =", fillLevel);
+  }
+
+  if (action == IasSinkFillController::eIasDropPeriod)
+  {
+    IAS_RT_LOG(*mLog, DLT_LOG_INFO, RT_LOG_ZONE, "Dropping one period to approach the sink fill target, fill level =", fillLevel);
+    return false;
+  }
+  if ((action == IasSinkFillController::eIasInsertPeriod) && (*numFramesAvailable >= 2 * mPeriodSize))
+  {
+    IasAudioArea *areas = nullptr;
+    uint32_t offset = 0;
+    uint32_t frames = mPeriodSize;
+    IasAudioRingBufferResult rbres = mSinkDeviceRingBuffer->beginAccess(eIasRingBufferAccessWrite, &areas, &offset, &frames);
+    if (rbres == eIasRingBuffOk)
+    {
+      IAS_ASSERT(areas != nullptr);
+      zeroAudioAreaBuffers(areas, mSinkDeviceDataFormat, offset, mSinkDeviceNumChannels, 0, frames);
+      rbres = mSinkDeviceRingBuffer->endAccess(eIasRingBufferAccessWrite, offset, frames);
+    }
+    if (rbres != eIasRingBuffOk)
+    {
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, RT_LOG_ZONE, "Error while inserting one period of zeros into the sink ringbuffer:", rbres);
+    }
+    else
+    {
+      *numFramesAvailable -= frames;
+      IAS_RT_LOG(*mLog, DLT_LOG_INFO, RT_LOG_ZONE, "Inserted one period of zeros to approach the sink fill target, fill level =", fillLevel);
+    }
+  }
+  return true;
+}
+
 bool IasRoutingZoneWorkerThread::hasPipeline(IasPipelinePtr pipeline) const
 {
   return (pipeline == mPipeline);
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasSinkFillController.cpp
+ * @date   2018
+ * @brief  Control of the fill level of the sink device buffer of a derived routing zone.
+ */
+
+#include <algorithm>
+#include <limits>
+#include "model/IasSinkFillController.hpp"
+
+namespace IasAudio {
+
+/**
+ * @brief Number of consecutive windows with a large underrun margin before the target is lowered.
+ */
+static const uint32_t cNumSafeWindowsToLower = 10;
+
+
+IasSinkFillController::IasSinkFillController()
+  :mPeriodSize(0)
+  ,mMaxFill(0)
+  ,mDefaultFill(0)
+  ,mWindowLength(1)
+  ,mAdaptive(false)
+  ,mTargetMin(0)
+  ,mTargetMax(0)
+  ,mTarget(0)
+  ,mNumMeasurements(0)
+  ,mLowestFill(0)
+  ,mHighestFill(0)
+  ,mNumSafeWindows(0)
+  ,mNumInsertedPeriods(0)
+  ,mNumDroppedPeriods(0)
+{
+  resetWindow();
+}
+
+IasSinkFillController::~IasSinkFillController()
+{
+}
+
+void IasSinkFillController::init(uint32_t periodSize, uint32_t bufferSize, uint32_t defaultFill, uint32_t windowLength)
+{
+  mPeriodSize = periodSize;
+  mMaxFill = (bufferSize > periodSize) ? bufferSize - periodSize : 0;
+  mDefaultFill = roundToPeriods(std::min(defaultFill, mMaxFill));
+  mWindowLength = std::max(windowLength, 1u);
+  mNumInsertedPeriods = 0;
+  mNumDroppedPeriods = 0;
+  setParams(IasISetup::IasSinkPrefillParams());
+}
+
+void IasSinkFillController::setParams(const IasISetup::IasSinkPrefillParams &params)
+{
+  mAdaptive = params.adaptive;
+  mTargetMax = (params.maxFrames != 0) ? std::min(params.maxFrames, mMaxFill) : mMaxFill;
+  mTargetMin = (params.minFrames != 0) ? params.minFrames : 2 * mPeriodSize;
+  mTargetMin = std::min(mTargetMin, mTargetMax);
+  mTarget = (params.numFrames != 0) ? std::min(params.numFrames, mMaxFill) : mDefaultFill;
+  if (mAdaptive == true)
+  {
+    mTarget = std::max(mTargetMin, std::min(mTarget, mTargetMax));
+  }
+  // The sink device is always written in blocks of one period, which must not wrap around the end of the buffer.
+  mTarget = roundToPeriods(mTarget);
+  mTargetMin = roundToPeriods(mTargetMin);
+  mTargetMax = roundToPeriods(mTargetMax);
+  mNumSafeWindows = 0;
+  resetWindow();
+}
+
+IasSinkFillController::IasAction IasSinkFillController::update(uint32_t fillLevel)
+{
+  mLowestFill = std::min(mLowestFill, fillLevel);
+  mHighestFill = std::max(mHighestFill, fillLevel);
+  mNumMeasurements++;
+  if (mNumMeasurements < mWindowLength)
+  {
+    return eIasKeep;
+  }
+
+  if (mAdaptive == true)
+  {
+    if (2 * mLowestFill < mPeriodSize)
+    {
+      mTarget = std::min(mTarget + mPeriodSize, mTargetMax);
+      mNumSafeWindows = 0;
+    }
+    else if (2 * mLowestFill >= 3 * mPeriodSize)
+    {
+      mNumSafeWindows++;
+      if (mNumSafeWindows >= cNumSafeWindowsToLower)
+      {
+        mTarget = (mTarget >= mTargetMin + mPeriodSize) ? mTarget - mPeriodSize : mTargetMin;
+        mNumSafeWindows = 0;
+      }
+    }
+    else
+    {
+      mNumSafeWindows = 0;
+    }
+  }
+
+  // The target refers to the fill level after the period was written. A period is only inserted or dropped
+  // if the deviation is at least three quarters of a period, so that the correction does not overshoot.
+  const uint32_t highestFillAfterWrite = mHighestFill + mPeriodSize;
+  const uint32_t tolerance = mPeriodSize / 4;
+  IasAction action = eIasKeep;
+  if (highestFillAfterWrite + mPeriodSize <= mTarget + tolerance)
+  {
+    action = eIasInsertPeriod;
+    mNumInsertedPeriods++;
+  }
+  else if (highestFillAfterWrite + tolerance >= mTarget + mPeriodSize)
+  {
+    action = eIasDropPeriod;
+    mNumDroppedPeriods++;
+  }
+  resetWindow();
+  return action;
+}
+
+uint32_t IasSinkFillController::roundToPeriods(uint32_t numFrames) const
+{
+  return (mPeriodSize != 0) ? (numFrames / mPeriodSize) * mPeriodSize : numFrames;
+}
+
+void IasSinkFillController::resetWindow()
+{
+  mNumMeasurements = 0;
+  mLowestFill = std::numeric_limits<uint32_t>::max();
+  mHighestFill = 0;
+}
+
+} //namespace IasAudio
@@ -28,6 +28,7 @@ namespace IasAudio {
 IasAudioBuffer::IasAudioBuffer(uint32_t bufferSize)
   :mBufferSize(bufferSize)
   ,mHome(NULL)
+  ,mPoolIndex(cInvalidPoolIndex)
   ,mData(NULL)
 {
 }
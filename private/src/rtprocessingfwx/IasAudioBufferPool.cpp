@@ -9,42 +9,77 @@
  * @brief  The definition of the IasAudioBufferPool class
  */
 
+#include <algorithm>
 #include "rtprocessingfwx/IasAudioBufferPool.hpp"
 
 namespace IasAudio {
 
+const uint32_t IasAudioBufferPool::cMaxNumBuffers = IasAudioBufferPool::cChunkSize * IasAudioBufferPool::cMaxNumChunks;
+
+/**
+ * @brief Combine the tag and the index of the head of the free list
+ */
+static inline uint64_t makeHead(uint64_t oldHead, uint32_t index)
+{
+  return (((oldHead >> 32) + 1) << 32) | index;
+}
+
 IasAudioBufferPool::IasAudioBufferPool(uint32_t bufferSize)
   :mBufferSize(bufferSize)
+  ,mFreeHead(IasAudioBuffer::cInvalidPoolIndex)
+  ,mNumBuffers(0)
+  ,mNumReserved(0)
+  ,mNumInUse(0)
+  ,mHighWaterMark(0)
+  ,mNumExhausted(0)
+  ,mNumFailed(0)
+  ,mGrowMutex()
+  ,mLogContext(IasAudioLogging::getDltContext("PFW"))
 {
+  for (auto &chunk : mChunks)
+  {
+    chunk.store(nullptr, std::memory_order_relaxed);
+  }
 }
 
 IasAudioBufferPool::~IasAudioBufferPool()
 {
-  while(!mRingBuffers.empty())
+  // Only the free buffers are deleted. Buffers that are still in use are owned by their users.
+  for (uint32_t index = pop(); index != IasAudioBuffer::cInvalidPoolIndex; index = pop())
   {
-    delete mRingBuffers.front();
-    mRingBuffers.pop_front();
+    delete getChunk(index)->buffers[index % cChunkSize];
+  }
+  for (auto &chunk : mChunks)
+  {
+    delete chunk.load(std::memory_order_relaxed);
   }
 }
 
 IasAudioBuffer* IasAudioBufferPool::getBuffer()
 {
-  IasAudioBuffer* buffer = NULL;
-  if (mRingBuffers.empty() == true)
+  uint32_t index = pop();
+  if (index == IasAudioBuffer::cInvalidPoolIndex)
   {
-    // No buffer available, so create a new one
-    buffer = new IasAudioBuffer(mBufferSize);
-    IAS_ASSERT(buffer != nullptr);
-    IasAudioProcessingResult result = buffer->init();
-    (void)result;
-    IAS_ASSERT(result == eIasAudioProcOK);
-    buffer->setHomePool(this);
+    // No buffer available, so create a new one. This is the only path that allocates memory.
+    std::lock_guard<std::mutex> lock(mGrowMutex);
+    index = createBuffer();
+    if (index == IasAudioBuffer::cInvalidPoolIndex)
+    {
+      mNumFailed.fetch_add(1, std::memory_order_relaxed);
+      DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, "IasAudioBufferPool::getBuffer: Maximum number of", cMaxNumBuffers,
+                  "buffers reached for buffer size", mBufferSize);
+      return NULL;
+    }
+    mNumExhausted.fetch_add(1, std::memory_order_relaxed);
   }
-  else
+  IasAudioBuffer* buffer = getChunk(index)->buffers[index % cChunkSize];
+  IAS_ASSERT(buffer != NULL);
+
+  const uint32_t numInUse = mNumInUse.fetch_add(1, std::memory_order_relaxed) + 1;
+  uint32_t highWaterMark = mHighWaterMark.load(std::memory_order_relaxed);
+  while (numInUse > highWaterMark &&
+         mHighWaterMark.compare_exchange_weak(highWaterMark, numInUse, std::memory_order_relaxed) == false)
   {
-    buffer = mRingBuffers.back();
-    IAS_ASSERT(buffer != NULL);
-    mRingBuffers.pop_back();
   }
   return buffer;
 }
@@ -53,7 +88,112 @@ void IasAudioBufferPool::doReturnBuffer(IasAudioBuffer* buffer)
 {
   // Is already checked in the static function returnBuffer
   IAS_ASSERT(buffer != NULL);
-  mRingBuffers.push_back(buffer);
+  const uint32_t index = buffer->getPoolIndex();
+  if (index >= mNumBuffers.load(std::memory_order_acquire) || getChunk(index)->buffers[index % cChunkSize] != buffer)
+  {
+    // The buffer was not created by this pool, so it cannot be linked into the free list
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, "IasAudioBufferPool::returnBuffer: Buffer was not created by its home pool, buffer size",
+                mBufferSize, "pool index", index);
+    return;
+  }
+  mNumInUse.fetch_sub(1, std::memory_order_relaxed);
+  push(index);
+}
+
+void IasAudioBufferPool::reserve(uint32_t numBuffers)
+{
+  std::lock_guard<std::mutex> lock(mGrowMutex);
+  const uint32_t numReserved = mNumReserved.load(std::memory_order_relaxed) + numBuffers;
+  mNumReserved.store(numReserved, std::memory_order_relaxed);
+  while (mNumBuffers.load(std::memory_order_relaxed) < numReserved)
+  {
+    const uint32_t index = createBuffer();
+    if (index == IasAudioBuffer::cInvalidPoolIndex)
+    {
+      DLT_LOG_CXX(*mLogContext, DLT_LOG_WARN, "IasAudioBufferPool::reserve: Only", cMaxNumBuffers, "of", numReserved,
+                  "reserved buffers of size", mBufferSize, "can be created");
+      break;
+    }
+    push(index);
+  }
+}
+
+void IasAudioBufferPool::release(uint32_t numBuffers)
+{
+  std::lock_guard<std::mutex> lock(mGrowMutex);
+  const uint32_t numReserved = mNumReserved.load(std::memory_order_relaxed);
+  mNumReserved.store(numReserved - std::min(numBuffers, numReserved), std::memory_order_relaxed);
+}
+
+void IasAudioBufferPool::getStatistics(IasIDebug::IasBufferPoolStatistics *statistics) const
+{
+  IAS_ASSERT(statistics != nullptr);
+  statistics->bufferSize = mBufferSize;
+  // The number of buffers is read last, as it only grows and bounds the other counters
+  statistics->numInUse = mNumInUse.load(std::memory_order_acquire);
+  statistics->highWaterMark = mHighWaterMark.load(std::memory_order_acquire);
+  statistics->numExhausted = mNumExhausted.load(std::memory_order_relaxed);
+  statistics->numFailed = mNumFailed.load(std::memory_order_relaxed);
+  statistics->numReserved = mNumReserved.load(std::memory_order_relaxed);
+  statistics->numBuffers = mNumBuffers.load(std::memory_order_acquire);
+}
+
+uint32_t IasAudioBufferPool::createBuffer()
+{
+  const uint32_t index = mNumBuffers.load(std::memory_order_relaxed);
+  if (index >= cMaxNumBuffers)
+  {
+    return IasAudioBuffer::cInvalidPoolIndex;
+  }
+  IasChunk* chunk = mChunks[index / cChunkSize].load(std::memory_order_relaxed);
+  if (chunk == nullptr)
+  {
+    chunk = new IasChunk();
+    IAS_ASSERT(chunk != nullptr);
+    mChunks[index / cChunkSize].store(chunk, std::memory_order_release);
+  }
+  IasAudioBuffer* buffer = new IasAudioBuffer(mBufferSize);
+  IAS_ASSERT(buffer != nullptr);
+  IasAudioProcessingResult result = buffer->init();
+  (void)result;
+  IAS_ASSERT(result == eIasAudioProcOK);
+  buffer->setHomePool(this);
+  buffer->setPoolIndex(index);
+  chunk->buffers[index % cChunkSize] = buffer;
+  chunk->next[index % cChunkSize].store(IasAudioBuffer::cInvalidPoolIndex, std::memory_order_relaxed);
+  mNumBuffers.store(index + 1, std::memory_order_release);
+  return index;
+}
+
+uint32_t IasAudioBufferPool::pop()
+{
+  uint64_t head = mFreeHead.load(std::memory_order_acquire);
+  for (;;)
+  {
+    const uint32_t index = static_cast<uint32_t>(head);
+    if (index == IasAudioBuffer::cInvalidPoolIndex)
+    {
+      return index;
+    }
+    // The link may already be outdated if another thread took the buffer meanwhile. The tag of the head
+    // makes the compare-and-swap fail in this case.
+    const uint32_t next = getChunk(index)->next[index % cChunkSize].load(std::memory_order_relaxed);
+    if (mFreeHead.compare_exchange_weak(head, makeHead(head, next), std::memory_order_acquire, std::memory_order_acquire))
+    {
+      return index;
+    }
+  }
+}
+
+void IasAudioBufferPool::push(uint32_t index)
+{
+  std::atomic<uint32_t> &next = getChunk(index)->next[index % cChunkSize];
+  uint64_t head = mFreeHead.load(std::memory_order_relaxed);
+  do
+  {
+    next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+  }
+  while (mFreeHead.compare_exchange_weak(head, makeHead(head, index), std::memory_order_release, std::memory_order_relaxed) == false);
 }
 
 } // namespace IasAudio
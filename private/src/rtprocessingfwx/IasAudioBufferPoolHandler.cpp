@@ -14,19 +14,27 @@
 
 namespace IasAudio {
 
+const uint32_t IasAudioBufferPoolHandler::cMaxNumPools;
 
 IasAudioBufferPoolHandler::IasAudioBufferPoolHandler()
+  :mNumPools(0)
+  ,mCreateMutex()
+  ,mLogContext(IasAudioLogging::getDltContext("PFW"))
 {
+  for (auto &pool : mPools)
+  {
+    pool.store(nullptr, std::memory_order_relaxed);
+  }
 }
 
 IasAudioBufferPoolHandler::~IasAudioBufferPoolHandler()
 {
-  for (IasSizePoolMap::iterator mapIt = mSizePoolMap.begin(); mapIt != mSizePoolMap.end(); ++mapIt)
+  const uint32_t numPools = mNumPools.load(std::memory_order_acquire);
+  for (uint32_t index = 0; index < numPools; ++index)
   {
-    delete mapIt->second;
+    delete mPools[index].load(std::memory_order_relaxed);
   }
-
-  mSizePoolMap.clear();
+  mNumPools.store(0, std::memory_order_release);
 }
 
 IasAudioBufferPoolHandler* IasAudioBufferPoolHandler::getInstance()
@@ -35,25 +43,75 @@ IasAudioBufferPoolHandler* IasAudioBufferPoolHandler::getInstance()
   return &theInstance;
 }
 
-IasAudioBufferPool* IasAudioBufferPoolHandler::getBufferPool(uint32_t ringBufferSize)
+IasAudioBufferPool* IasAudioBufferPoolHandler::findBufferPool(uint32_t ringBufferSize) const
 {
-  IasAudioBufferPool* ringBufferPool = NULL;
-  IasSizePoolMap::iterator poolIt = mSizePoolMap.find(ringBufferSize);
-  if (poolIt != mSizePoolMap.end())
+  const uint32_t numPools = mNumPools.load(std::memory_order_acquire);
+  for (uint32_t index = 0; index < numPools; ++index)
   {
-    // Pool exists, so just return it
-    ringBufferPool = (*poolIt).second;
+    IasAudioBufferPool* ringBufferPool = mPools[index].load(std::memory_order_relaxed);
+    if (ringBufferPool->getBufferSize() == ringBufferSize)
+    {
+      return ringBufferPool;
+    }
   }
-  else
+  return NULL;
+}
+
+IasAudioBufferPool* IasAudioBufferPoolHandler::getBufferPool(uint32_t ringBufferSize)
+{
+  IasAudioBufferPool* ringBufferPool = findBufferPool(ringBufferSize);
+  if (ringBufferPool == NULL)
   {
-    // Currently no pool for that buffer size exists, so create one
-    ringBufferPool = new IasAudioBufferPool(ringBufferSize);
-    IAS_ASSERT(ringBufferPool != nullptr);
-    mSizePoolMap.insert(std::make_pair(ringBufferSize, ringBufferPool));
+    // Currently no pool for that buffer size exists, so create one. Another thread might have created
+    // it in the meantime, so look again while holding the lock.
+    std::lock_guard<std::mutex> lock(mCreateMutex);
+    ringBufferPool = findBufferPool(ringBufferSize);
+    const uint32_t numPools = mNumPools.load(std::memory_order_relaxed);
+    if (ringBufferPool == NULL && numPools < cMaxNumPools)
+    {
+      ringBufferPool = new IasAudioBufferPool(ringBufferSize);
+      IAS_ASSERT(ringBufferPool != nullptr);
+      mPools[numPools].store(ringBufferPool, std::memory_order_relaxed);
+      mNumPools.store(numPools + 1, std::memory_order_release);
+    }
+    else if (ringBufferPool == NULL)
+    {
+      DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, "IasAudioBufferPoolHandler::getBufferPool: Maximum number of", cMaxNumPools,
+                  "pools reached, no pool for buffer size", ringBufferSize);
+    }
   }
 
   return ringBufferPool;
 }
 
+void IasAudioBufferPoolHandler::reserveBuffers(uint32_t ringBufferSize, uint32_t numBuffers)
+{
+  IasAudioBufferPool* ringBufferPool = getBufferPool(ringBufferSize);
+  if (ringBufferPool != NULL)
+  {
+    ringBufferPool->reserve(numBuffers);
+  }
+}
+
+void IasAudioBufferPoolHandler::releaseBuffers(uint32_t ringBufferSize, uint32_t numBuffers)
+{
+  IasAudioBufferPool* ringBufferPool = findBufferPool(ringBufferSize);
+  if (ringBufferPool != NULL)
+  {
+    ringBufferPool->release(numBuffers);
+  }
+}
+
+void IasAudioBufferPoolHandler::getStatistics(std::vector<IasIDebug::IasBufferPoolStatistics> *statistics) const
+{
+  IAS_ASSERT(statistics != nullptr);
+  const uint32_t numPools = mNumPools.load(std::memory_order_acquire);
+  statistics->resize(numPools);
+  for (uint32_t index = 0; index < numPools; ++index)
+  {
+    mPools[index].load(std::memory_order_relaxed)->getStatistics(&(*statistics)[index]);
+  }
+}
+
 
 } // namespace IasAudio
@@ -9,7 +9,10 @@
  * @brief  This is the implementation of the IasAudioChain class.
  */
 
+#include <chrono>
+
 #include "rtprocessingfwx/IasAudioChain.hpp"
+#include "rtprocessingfwx/IasAudioBufferPoolHandler.hpp"
 
 
 #include "audio/smartx/rtprocessingfwx/IasAudioStream.hpp"
@@ -26,6 +29,11 @@ static const std::string cClassName = "IasAudioChain::";
 
 class IasAudioChainItem;
 
+/**
+ * @brief Number of simple stream representations of an audio stream, i.e., non-interleaved and interleaved
+ */
+static const uint32_t cNumStreamRepresentations = 2;
+
 IasAudioChain::IasAudioChain()
   :mInputBundleSequencer()
   ,mOutputBundleSequencer()
@@ -40,6 +48,7 @@ IasAudioChain::IasAudioChain()
   ,mZoneIdOutputStreamMap()
   ,mLog(IasAudioLogging::registerDltContext("PFW", "Log of rtprocessing framework"))
   ,mEnv(nullptr)
+  ,mReservedBufferSizes()
 {
 }
 
@@ -79,6 +88,13 @@ IasAudioChain::~IasAudioChain()
   mZoneIdOutputStreamMap.clear();
   mEnv = nullptr;
 
+  IasAudioBufferPoolHandler *bufferPoolHandler = IasAudioBufferPoolHandler::getInstance();
+  for (auto bufferSize : mReservedBufferSizes)
+  {
+    bufferPoolHandler->releaseBuffers(bufferSize, cNumStreamRepresentations);
+  }
+  mReservedBufferSizes.clear();
+
   DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Deleted");
 }
 
@@ -138,6 +154,7 @@ IasAudioStream*  IasAudioChain::createInputAudioStream(const std::string& name,
   if (result == eIasAudioProcOK)
   {
     mInputAudioStreams.push_back(newStream);
+    reserveStreamBuffers(numberChannels);
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX
                 "Successfully created new input audio stream");
   }
@@ -169,6 +186,7 @@ IasAudioStream*  IasAudioChain::createOutputAudioStream(const std::string& name,
   if (result == eIasAudioProcOK)
   {
     mOutputAudioStreams.push_back(newStream);
+    reserveStreamBuffers(numberChannels);
     mZoneIdOutputStreamMap[id] = newStream;
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX,
                 "Successfully created new output audio stream");
@@ -202,6 +220,7 @@ IasAudioStream* IasAudioChain::createIntermediateInputAudioStream(const std::str
   if (result == eIasAudioProcOK)
   {
     mIntermediateInputAudioStreams.push_back(newStream);
+    reserveStreamBuffers(numberChannels);
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX,
                 "Successfully created new intermediate input audio stream");
   }
@@ -235,6 +254,7 @@ IasAudioStream* IasAudioChain::createIntermediateOutputAudioStream(const std::st
   if (result == eIasAudioProcOK)
   {
     mIntermediateOutputAudioStreams.push_back(newStream);
+    reserveStreamBuffers(numberChannels);
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX,
                 "Successfully created new intermediate output audio stream");
   }
@@ -269,6 +289,15 @@ IasAudioChain::IasResult IasAudioChain::init(const IasInitParams& params)
   return eIasOk;
 }
 
+void IasAudioChain::reserveStreamBuffers(int32_t numberChannels)
+{
+  IAS_ASSERT(mEnv != nullptr);
+  // The buffer size has to match the one requested by IasSimpleAudioStream::setProperties
+  const uint32_t bufferSize = mEnv->getFrameLength() * static_cast<uint32_t>(numberChannels);
+  IasAudioBufferPoolHandler::getInstance()->reserveBuffers(bufferSize, cNumStreamRepresentations);
+  mReservedBufferSizes.push_back(bufferSize);
+}
+
 const IasAudioStream* IasAudioChain::getOutputStream(int32_t zoneId) const
 {
   const IasAudioStream *outputStream = NULL;
@@ -295,6 +324,18 @@ void IasAudioChain::process() const
   }
 }
 
+void IasAudioChain::process(std::vector<uint64_t> &processTimesNs) const
+{
+  IAS_ASSERT(processTimesNs.size() == mCompCores.size());
+  for (uint32_t coreIdx = 0; coreIdx < mCompCores.size(); ++coreIdx)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    (void)mCompCores[coreIdx]->process();
+    const auto end = std::chrono::steady_clock::now();
+    processTimesNs[coreIdx] += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  }
+}
+
 void IasAudioChain::clearOutputBundleBuffers() const
 {
   mOutputBundleSequencer.clearAllBundleBuffers();
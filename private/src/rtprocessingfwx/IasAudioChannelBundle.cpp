@@ -14,6 +14,7 @@
 #include <emmintrin.h>
  // #define IAS_ASSERT()
 #include "rtprocessingfwx/IasAudioChannelBundle.hpp"
+#include "rtprocessingfwx/IasSampleLayoutConverter.hpp"
 
 /* Define SSE to enable optimization */
 #define SSE 1
@@ -205,12 +206,9 @@ void IasAudioChannelBundle::writeTwoChannelsFromNonInterleaved(uint32_t offset,
   }
   else
   {
-    // Generic implementation, which does not required aligned data.
-    for(float *audioData = mAudioData+offset; audioData < mAudioDataEnd; audioData += cIasNumChannelsPerBundle)
-    {
-      audioData[0] = *channel0++;
-      audioData[1] = *channel1++;
-    }
+    // Version with unaligned load.
+    const float * const channels[2] = { channel0, channel1 };
+    IasSampleLayoutConverter::interleave(channels, 2, mAudioData+offset, cIasNumChannelsPerBundle, mFrameLength);
   }
 #else
   // This is the generic (non-optimized) code
@@ -227,12 +225,8 @@ void IasAudioChannelBundle::writeThreeChannelsFromNonInterleaved(uint32_t offset
                                                const float *channel1,
                                                const float *channel2)
 {
-  for (float *audioData = mAudioData+offset; audioData < mAudioDataEnd; audioData += cIasNumChannelsPerBundle)
-  {
-    audioData[0] = *channel0++;
-    audioData[1] = *channel1++;
-    audioData[2] = *channel2++;
-  }
+  const float * const channels[3] = { channel0, channel1, channel2 };
+  IasSampleLayoutConverter::interleave(channels, 3, mAudioData+offset, cIasNumChannelsPerBundle, mFrameLength);
 }
 
 void IasAudioChannelBundle::writeFourChannelsFromNonInterleaved(const float *channel0,
@@ -313,38 +307,20 @@ void IasAudioChannelBundle::writeTwoChannelsFromInterleaved(uint32_t offset,
                                                             uint32_t srcStride,
                                                             const float *channel)
 {
-  for(float *audioData = mAudioData+offset; audioData < mAudioDataEnd; audioData += cIasNumChannelsPerBundle)
-  {
-    audioData[0] = *channel;
-    audioData[1] = *(channel+1);
-    channel += srcStride;
-  }
+  IasSampleLayoutConverter::copyStrided(channel, srcStride, mAudioData+offset, cIasNumChannelsPerBundle, 2, mFrameLength);
 }
 
 void IasAudioChannelBundle::writeThreeChannelsFromInterleaved(uint32_t offset,
                                                               uint32_t srcStride,
                                                               const float *channel)
 {
-  for (float *audioData = mAudioData+offset; audioData < mAudioDataEnd; audioData += cIasNumChannelsPerBundle)
-  {
-    audioData[0] = *channel;
-    audioData[1] = *(channel+1);
-    audioData[2] = *(channel+2);
-    channel += srcStride;
-  }
+  IasSampleLayoutConverter::copyStrided(channel, srcStride, mAudioData+offset, cIasNumChannelsPerBundle, 3, mFrameLength);
 }
 
 void IasAudioChannelBundle::writeFourChannelsFromInterleaved(uint32_t srcStride,
                                                              const float *channel)
 {
-  for (float *audioData = mAudioData; audioData < mAudioDataEnd; audioData += cIasNumChannelsPerBundle)
-  {
-    audioData[0] = *channel;
-    audioData[1] = *(channel+1);
-    audioData[2] = *(channel+2);
-    audioData[3] = *(channel+3);
-    channel += srcStride;
-  }
+  IasSampleLayoutConverter::copyStrided(channel, srcStride, mAudioData, cIasNumChannelsPerBundle, cIasNumChannelsPerBundle, mFrameLength);
 }
 
 void IasAudioChannelBundle::readOneChannel(uint32_t offset, float *channel) const
@@ -474,12 +450,8 @@ void IasAudioChannelBundle::readThreeChannels(uint32_t offset,
   IAS_ASSERT(channel1 != nullptr);
   IAS_ASSERT(channel2 != nullptr);
 
-  for (float *audioData = mAudioData+offset; audioData < mAudioDataEnd; audioData += cIasNumChannelsPerBundle)
-  {
-    *channel0++ = audioData[0];
-    *channel1++ = audioData[1];
-    *channel2++ = audioData[2];
-  }
+  float * const channels[3] = { channel0, channel1, channel2 };
+  IasSampleLayoutConverter::deinterleave(mAudioData+offset, cIasNumChannelsPerBundle, channels, 3, mFrameLength);
 }
 
 void IasAudioChannelBundle::readFourChannels(float *channel0,
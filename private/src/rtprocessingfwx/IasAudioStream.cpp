@@ -116,6 +116,8 @@ IasSimpleAudioStream* IasAudioStream::getNonInterleavedStream()
       else
       {
         DLT_LOG_CXX(*mLogContext, DLT_LOG_FATAL, "IasAudioStream::getNonInterleavedStream: Error during setProperties for", mName, ":", static_cast<int32_t>(result));
+        delete mNonInterleaved;
+        mNonInterleaved = nullptr;
       }
     }
   }
@@ -156,6 +158,8 @@ IasSimpleAudioStream* IasAudioStream::getInterleavedStream()
       else
       {
         DLT_LOG_CXX(*mLogContext, DLT_LOG_FATAL, "IasAudioStream::getInterleavedStream: Error during setProperties for", mName, ":", static_cast<int32_t>(result));
+        delete mInterleaved;
+        mInterleaved = nullptr;
       }
     }
   }
@@ -360,6 +364,24 @@ void IasAudioStream::getAudioDataPointers(IasAudioFrame** audioFrame, uint32_t *
   }
 }
 
+void IasAudioStream::peekAudioDataPointers(IasAudioFrame** audioFrame, uint32_t *stride)
+{
+  IAS_ASSERT(audioFrame != nullptr);
+  if (mCopyFromInput == true)
+  {
+    (void)asBundledStream();
+  }
+  if (mCurrentRepresentation != nullptr)
+  {
+    mCurrentRepresentation->getAudioDataPointers(mAudioFrameInternal, stride);
+    *audioFrame = &mAudioFrameInternal;
+  }
+  else
+  {
+    *audioFrame = nullptr;
+  }
+}
+
 void IasAudioStream::getAudioDataPointers(IasAudioFrame& audioFrame )
 {
   if (mCurrentRepresentation != nullptr)
@@ -17,6 +17,7 @@
 #include "rtprocessingfwx/IasBundleSequencer.hpp"
 #include "rtprocessingfwx/IasBundleAssignment.hpp"
 #include "rtprocessingfwx/IasAudioChainEnvironment.hpp"
+#include "rtprocessingfwx/IasSampleLayoutConverter.hpp"
 
 
 #include "audio/smartx/rtprocessingfwx/IasSimpleAudioStream.hpp"
@@ -258,27 +259,15 @@ IasAudioProcessingResult IasBundledAudioStream::read(const IasAudioFrame &audioF
 
 IasAudioProcessingResult IasBundledAudioStream::read(float* audioFrame) const
 {
-  std::vector<float*> data;
-
-  for(uint32_t bundleCnt = 0; bundleCnt < mBundleAssignments.size(); bundleCnt++)
-  {
-	  const IasBundleAssignment &bundleAssignment = mBundleAssignments[bundleCnt];
-	  data.push_back(bundleAssignment.getBundle()->getAudioDataPointer());
-	  data[bundleCnt]+= bundleAssignment.getIndex();
-  }
-
   uint32_t frameLength = mEnv->getFrameLength();
-  for(uint32_t audioSampleCnt = 0; audioSampleCnt < (mNumberChannels * frameLength);)
+  uint32_t channelIndex = 0;
+  for (const IasBundleAssignment &bundleAssignment : mBundleAssignments)
   {
-	  for(uint32_t bundleCnt = 0; bundleCnt < mBundleAssignments.size(); bundleCnt++)
-	  {
-		  const IasBundleAssignment &bundleAssignment = mBundleAssignments[bundleCnt];
-		  for(uint32_t bundleChanCnt = 0; bundleChanCnt < bundleAssignment.getNumberChannels(); bundleChanCnt++)
-		  {
-			  audioFrame[audioSampleCnt++] = data[bundleCnt][bundleChanCnt];
-		  }
-		  data[bundleCnt] += cIasNumChannelsPerBundle;
-	  }
+    const float *audioData = bundleAssignment.getBundle()->getAudioDataPointer() + bundleAssignment.getIndex();
+    IasSampleLayoutConverter::copyStrided(audioData, cIasNumChannelsPerBundle,
+                                          audioFrame + channelIndex, mNumberChannels,
+                                          bundleAssignment.getNumberChannels(), frameLength);
+    channelIndex += bundleAssignment.getNumberChannels();
   }
   return eIasAudioProcOK;
 }
@@ -290,7 +279,10 @@ void IasBundledAudioStream::getAudioFrame(IasAudioFrame* audioFrame)
 
 void IasBundledAudioStream::asNonInterleavedStream(IasSimpleAudioStream *nonInterleaved)
 {
-  nonInterleaved->setProperties(mName, mId, mNumberChannels, eIasNonInterleaved, mEnv->getFrameLength(), mType, mSidAvailable);
+  if (nonInterleaved->setProperties(mName, mId, mNumberChannels, eIasNonInterleaved, mEnv->getFrameLength(), mType, mSidAvailable) != eIasAudioProcOK)
+  {
+    return;
+  }
   nonInterleaved->writeFromBundled(mAudioFrame);
   if (mSidAvailable == true)
   {
@@ -300,7 +292,10 @@ void IasBundledAudioStream::asNonInterleavedStream(IasSimpleAudioStream *nonInte
 
 void IasBundledAudioStream::asInterleavedStream(IasSimpleAudioStream *interleaved)
 {
-  interleaved->setProperties(mName, mId, mNumberChannels, eIasInterleaved, mEnv->getFrameLength(), mType, mSidAvailable);
+  if (interleaved->setProperties(mName, mId, mNumberChannels, eIasInterleaved, mEnv->getFrameLength(), mType, mSidAvailable) != eIasAudioProcOK)
+  {
+    return;
+  }
   interleaved->writeFromBundled(mAudioFrame);
   if (mSidAvailable == true)
   {
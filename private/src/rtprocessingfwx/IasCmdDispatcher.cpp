@@ -19,7 +19,10 @@ static const std::string cClassName = "IasCmdDispatcher::";
 #define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
 
 IasCmdDispatcher::IasCmdDispatcher()
-  :mLog(IasAudioLogging::registerDltContext("PFW", "Log of rtprocessing framework"))
+  :mMapMutex()
+  ,mCmdMap()
+  ,mFastCmdModules()
+  ,mLog(IasAudioLogging::registerDltContext("PFW", "Log of rtprocessing framework"))
 {
 }
 
@@ -40,7 +43,12 @@ IasICmdRegistration::IasResult IasCmdDispatcher::registerModuleIdInterface(const
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cmd interface to be registered for instance", instanceName, "== nullptr");
     return IasICmdRegistration::eIasFailed;
   }
-  auto ret = mCmdMap.insert(std::make_pair(instanceName, interface));
+  IasCmdEntryPtr entry = std::make_shared<IasCmdEntry>();
+  entry->interface = interface;
+  entry->isRegistered = true;
+  entry->fastCmdIndex = -1;
+  std::lock_guard<std::mutex> lock(mMapMutex);
+  auto ret = mCmdMap.insert(std::make_pair(instanceName, entry));
   if (ret.second == false)
   {
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cmd interface for instance", instanceName, "already registered");
@@ -60,9 +68,27 @@ void IasCmdDispatcher::unregisterModuleIdInterface(const std::string &instanceNa
     DLT_LOG_CXX(*mLog, DLT_LOG_WARN, LOG_PREFIX, "Instance name may not be empty");
     return;
   }
-  auto numberErased = mCmdMap.erase(instanceName);
-  if (numberErased > 0)
+  IasCmdEntryPtr entry;
   {
+    std::lock_guard<std::mutex> lock(mMapMutex);
+    auto cmdInterface = mCmdMap.find(instanceName);
+    if (cmdInterface != mCmdMap.end())
+    {
+      entry = cmdInterface->second;
+      mCmdMap.erase(cmdInterface);
+      // Invalidate all command handles of this instance. The index is not reused, so handles resolved
+      // before do not address a module registered later with the same name.
+      if (entry->fastCmdIndex >= 0)
+      {
+        mFastCmdModules[entry->fastCmdIndex] = nullptr;
+      }
+    }
+  }
+  if (entry != nullptr)
+  {
+    // Wait until a command that is currently processed by the module has been finished.
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    entry->isRegistered = false;
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Cmd interface for instance", instanceName, "successfully unregistered");
   }
   else
@@ -83,24 +109,139 @@ IasICmdRegistration::IasResult translate(IasIModuleId::IasResult res)
   }
 }
 
-IasICmdRegistration::IasResult IasCmdDispatcher::dispatchCmd(const std::string &instanceName, const IasProperties &cmdProperties, IasProperties &returnProperties)
+IasCmdDispatcher::IasCmdEntryPtr IasCmdDispatcher::findEntry(const std::string &instanceName)
 {
+  std::lock_guard<std::mutex> lock(mMapMutex);
   auto cmdInterface = mCmdMap.find(instanceName);
   if (cmdInterface == mCmdMap.end())
+  {
+    return nullptr;
+  }
+  return cmdInterface->second;
+}
+
+IasICmdRegistration::IasResult IasCmdDispatcher::dispatchCmd(const std::string &instanceName, const IasProperties &cmdProperties, IasProperties &returnProperties)
+{
+  IasCmdEntryPtr entry = findEntry(instanceName);
+  if (entry == nullptr)
   {
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cmd interface for instance", instanceName, "not registered");
     return IasICmdRegistration::eIasFailed;
   }
-  else
+  std::lock_guard<std::mutex> lock(entry->mutex);
+  if (entry->isRegistered == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cmd interface for instance", instanceName, "not registered");
+    return IasICmdRegistration::eIasFailed;
+  }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Passing cmd to instance", instanceName);
+  cmdProperties.dump("cmdProperties");
+  returnProperties.clearAll();
+  IasIModuleId::IasResult modres = entry->interface->processCmd(cmdProperties, returnProperties);
+  returnProperties.dump("returnProperties");
+  return translate(modres);
+}
+
+IasICmdRegistration::IasResult IasCmdDispatcher::resolveCmd(const std::string &instanceName, int32_t cmdId, const std::string &pinName, IasCmdHandle *handle)
+{
+  if (handle == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Parameter handle == nullptr");
+    return IasICmdRegistration::eIasFailed;
+  }
+  IasCmdEntryPtr entry = findEntry(instanceName);
+  if (entry == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cmd interface for instance", instanceName, "not registered");
+    return IasICmdRegistration::eIasFailed;
+  }
+  int32_t streamId = -1;
+  {
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    if (entry->isRegistered == false)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cmd interface for instance", instanceName, "not registered");
+      return IasICmdRegistration::eIasFailed;
+    }
+    if (entry->interface->isFastCmd(cmdId) == false)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cmd with cmdId", cmdId, "of instance", instanceName, "does not support command handles");
+      return IasICmdRegistration::eIasFailed;
+    }
+    if (entry->interface->resolveStreamId(pinName, &streamId) != IasIModuleId::eIasOk)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Pin", pinName, "not found for instance", instanceName);
+      return IasICmdRegistration::eIasFailed;
+    }
+  }
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Passing cmd to instance", instanceName);
-    cmdProperties.dump("cmdProperties");
-    returnProperties.clearAll();
-    IasIModuleId::IasResult modres = cmdInterface->second->processCmd(cmdProperties, returnProperties);
-    returnProperties.dump("returnProperties");
-    return translate(modres);
+    std::lock_guard<std::mutex> lock(mMapMutex);
+    auto cmdInterface = mCmdMap.find(instanceName);
+    if (cmdInterface == mCmdMap.end() || cmdInterface->second != entry)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Cmd interface for instance", instanceName, "was unregistered meanwhile");
+      return IasICmdRegistration::eIasFailed;
+    }
+    if (entry->fastCmdIndex < 0)
+    {
+      entry->fastCmdIndex = static_cast<int32_t>(mFastCmdModules.size());
+      mFastCmdModules.push_back(entry);
+    }
+    handle->moduleIndex = static_cast<uint32_t>(entry->fastCmdIndex);
   }
+  handle->cmdId = cmdId;
+  handle->streamId = streamId;
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Resolved cmdId", cmdId, "of instance", instanceName, "for pin", pinName);
+  return IasICmdRegistration::eIasOk;
 }
 
+IasICmdRegistration::IasResult IasCmdDispatcher::dispatchCmd(const IasCmdHandle &handle, float value)
+{
+  IasCmdEntryPtr entry;
+  {
+    std::lock_guard<std::mutex> lock(mMapMutex);
+    if (handle.moduleIndex < mFastCmdModules.size())
+    {
+      entry = mFastCmdModules[handle.moduleIndex];
+    }
+  }
+  if (entry == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid command handle, module index", handle.moduleIndex);
+    return IasICmdRegistration::eIasFailed;
+  }
+  std::lock_guard<std::mutex> lock(entry->mutex);
+  if (entry->isRegistered == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid command handle, module index", handle.moduleIndex);
+    return IasICmdRegistration::eIasFailed;
+  }
+  return translate(entry->interface->processFastCmd(handle, value));
+}
+
+IasCmdDispatcher::IasCmdEntryVector IasCmdDispatcher::lockModuleCmds(const std::vector<std::string> &instanceNames)
+{
+  IasCmdEntryVector lockedEntries;
+  for (const auto &instanceName : instanceNames)
+  {
+    IasCmdEntryPtr entry = findEntry(instanceName);
+    if (entry != nullptr)
+    {
+      entry->mutex.lock();
+      lockedEntries.push_back(entry);
+    }
+  }
+  return lockedEntries;
+}
+
+void IasCmdDispatcher::unlockModuleCmds(const IasCmdEntryVector &lockedEntries)
+{
+  // Unlock exactly the registrations locked before, even if a module was unregistered or
+  // registered again under the same instance name in the meantime.
+  for (const auto &entry : lockedEntries)
+  {
+    entry->mutex.unlock();
+  }
+}
 
 } /* namespace IasAudio */
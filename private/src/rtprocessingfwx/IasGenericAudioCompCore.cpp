@@ -9,6 +9,7 @@
  * @brief This is the implementation of the IasGenericAudioCompCore class.
  */
 
+#include <algorithm>
 #include <audio/smartx/rtprocessingfwx/IasIGenericAudioCompConfig.hpp>
 #include "audio/smartx/rtprocessingfwx/IasBaseAudioStream.hpp"
 #include "audio/smartx/rtprocessingfwx/IasSimpleAudioStream.hpp"
@@ -16,6 +17,8 @@
 #include "audio/smartx/rtprocessingfwx/IasGenericAudioCompCore.hpp"
 #include "rtprocessingfwx/IasAudioChainEnvironment.hpp"
 #include "rtprocessingfwx/IasBundleAssignment.hpp"
+#include "rtprocessingfwx/IasAudioChannelBundle.hpp"
+#include "helper/IasParameterMailbox.hpp"
 #include "audio/smartx/rtprocessingfwx/IasAudioStream.hpp"
 #include "avbaudiomodules/internal/audio/common/IasDataProbeHelper.hpp"
 
@@ -32,6 +35,11 @@ IasGenericAudioCompCore::IasGenericAudioCompCore(const IasIGenericAudioCompConfi
   ,mConfig(config)
   ,mProcessingState(eIasAudioCompEnabled)
   ,mComponentName(componentName)
+  ,mSnapshotMailbox(new IasParameterMailbox<IasParameterSnapshotEntry>())
+  ,mPendingSnapshot(nullptr)
+  ,mFadeState(eIasFadeIdle)
+  ,mFadeGain(1.0f)
+  ,mFadeStep(0.0f)
 {
 
 }
@@ -181,6 +189,8 @@ IasAudioProcessingResult IasGenericAudioCompCore::process()
 
   }
 
+  updateParameterSnapshot();
+
   IasGenericCoreProbeMap::iterator it;
   for ( it = mActiveInputDataProbes.begin(); it != mActiveInputDataProbes.end(); )
   {
@@ -206,6 +216,7 @@ IasAudioProcessingResult IasGenericAudioCompCore::process()
   {
     return res;
   }
+  applyFade();
 
   for ( it = mActiveOutputDataProbes.begin(); it != mActiveOutputDataProbes.end();)
   {
@@ -315,4 +326,110 @@ IasAudioProcessingResult IasGenericAudioCompCore::startProbe(const std::string&
   return eIasAudioProcOK;
 }
 
+IasAudioProcessingResult IasGenericAudioCompCore::setParameterSnapshot(IasParameterSnapshotPtr snapshot, uint32_t fadeLength)
+{
+  if (snapshot == nullptr)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "snapshot == nullptr");
+    return eIasAudioProcInvalidParam;
+  }
+  IasAudioProcessingResult res = prepareParameterSnapshot(*snapshot);
+  if (res != eIasAudioProcOK)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "Component", mComponentName, "failed to prepare parameter snapshot:", toString(res));
+    return res;
+  }
+  IasParameterSnapshotEntry entry;
+  entry.snapshot = snapshot;
+  entry.fadeLength = fadeLength;
+  // The mailbox keeps the snapshot referenced until it is overwritten by a later post, so
+  // snapshots are never released by the processing thread.
+  mSnapshotMailbox->post(entry);
+  DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Component", mComponentName, "parameter snapshot posted, fadeLength=", fadeLength);
+  return eIasAudioProcOK;
+}
+
+IasAudioProcessingResult IasGenericAudioCompCore::prepareParameterSnapshot(IasParameterSnapshot &snapshot)
+{
+  (void)snapshot;
+  return eIasAudioProcNotImplemented;
+}
+
+void IasGenericAudioCompCore::applyParameterSnapshot(const IasParameterSnapshot &snapshot)
+{
+  (void)snapshot;
+}
+
+void IasGenericAudioCompCore::updateParameterSnapshot()
+{
+  if ((mPendingSnapshot != nullptr) && (mFadeGain <= 0.0f))
+  {
+    // The output was faded out completely during the previous period.
+    applyParameterSnapshot(*mPendingSnapshot->snapshot);
+    mPendingSnapshot = nullptr;
+    mFadeState = eIasFadeIn;
+  }
+  if (mPendingSnapshot == nullptr)
+  {
+    // The fetched entry stays valid until the next fetch, which is not done before the fade-out has finished.
+    IasParameterSnapshotEntry *entry = mSnapshotMailbox->fetch();
+    if (entry != nullptr)
+    {
+      if (entry->fadeLength == 0)
+      {
+        applyParameterSnapshot(*entry->snapshot);
+      }
+      else
+      {
+        mPendingSnapshot = entry;
+        mFadeState = eIasFadeOut;
+        mFadeStep = 1.0f / static_cast<float>(entry->fadeLength);
+      }
+    }
+  }
+}
+
+void IasGenericAudioCompCore::applyFade()
+{
+  if (mFadeState == eIasFadeIdle)
+  {
+    return;
+  }
+  float step = (mFadeState == eIasFadeOut) ? -mFadeStep : mFadeStep;
+  for (auto &stream : mConfig->getStreams())
+  {
+    applyGainRamp(stream, mFadeGain, step);
+  }
+  for (auto &entry : mConfig->getStreamMapping())
+  {
+    // The key of the stream mapping is the output stream.
+    applyGainRamp(entry.first, mFadeGain, step);
+  }
+  mFadeGain = std::min(std::max(mFadeGain + step * static_cast<float>(mFrameLength), 0.0f), 1.0f);
+  if ((mFadeState == eIasFadeIn) && (mFadeGain >= 1.0f))
+  {
+    mFadeState = eIasFadeIdle;
+  }
+}
+
+void IasGenericAudioCompCore::applyGainRamp(IasAudioStream *stream, float gain, float step)
+{
+  const IasBundleAssignmentVector &bundleAssignments = stream->asBundledStream()->getBundleAssignments();
+  for (auto &assignment : bundleAssignments)
+  {
+    float *audioData = assignment.getBundle()->getAudioDataPointer() + assignment.getIndex();
+    uint32_t numChannels = assignment.getNumberChannels();
+    float frameGain = gain;
+    for (uint32_t frame = 0; frame < mFrameLength; ++frame)
+    {
+      frameGain = std::min(std::max(frameGain + step, 0.0f), 1.0f);
+      for (uint32_t channel = 0; channel < numChannels; ++channel)
+      {
+        audioData[channel] *= frameGain;
+      }
+      audioData += cIasNumChannelsPerBundle;
+    }
+  }
+}
+
 } // namespace IasAudio
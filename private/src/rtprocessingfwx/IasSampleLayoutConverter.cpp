@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasSampleLayoutConverter.cpp
+ * @date   2018
+ * @brief  Conversion of 32-bit float samples between the non-interleaved, interleaved and bundled layouts.
+ */
+
+#include <cstring>
+#include <xmmintrin.h>
+#include <immintrin.h>
+#include "rtprocessingfwx/IasSampleLayoutConverter.hpp"
+
+/* Define USE_SSE to enable the SSE optimization */
+#define USE_SSE 1
+
+/* Define USE_AVX to enable the AVX kernels, which are only used if the CPU supports AVX */
+#define USE_AVX 1
+
+namespace IasAudio {
+
+#if USE_SSE && USE_AVX
+/**
+ * @brief Check whether the CPU supports AVX.
+ *
+ * __builtin_cpu_init has to be called explicitly, because the result is used to initialize a static variable.
+ */
+static bool isAvxSupported()
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx") != 0;
+}
+
+static const bool cUseAvx = isAvxSupported();
+
+/**
+ * @brief Interleave four channels, eight frames per iteration.
+ *
+ * Each 128-bit lane is transposed like with _MM_TRANSPOSE4_PS. The lower lanes provide the frames 0..3,
+ * the upper lanes provide the frames 4..7.
+ *
+ * @returns The number of frames that have been processed.
+ */
+__attribute__((target("avx")))
+static uint32_t interleaveFourAvx(const float * const *channels, float *destination, uint32_t destinationStride, uint32_t numFrames)
+{
+  const float *ch0 = channels[0];
+  const float *ch1 = channels[1];
+  const float *ch2 = channels[2];
+  const float *ch3 = channels[3];
+  uint32_t frame = 0;
+  for (; frame + 8 <= numFrames; frame += 8)
+  {
+    __m256 tmp0 = _mm256_unpacklo_ps(_mm256_loadu_ps(ch0 + frame), _mm256_loadu_ps(ch1 + frame));
+    __m256 tmp1 = _mm256_unpackhi_ps(_mm256_loadu_ps(ch0 + frame), _mm256_loadu_ps(ch1 + frame));
+    __m256 tmp2 = _mm256_unpacklo_ps(_mm256_loadu_ps(ch2 + frame), _mm256_loadu_ps(ch3 + frame));
+    __m256 tmp3 = _mm256_unpackhi_ps(_mm256_loadu_ps(ch2 + frame), _mm256_loadu_ps(ch3 + frame));
+    __m256 row0 = _mm256_shuffle_ps(tmp0, tmp2, _MM_SHUFFLE(1,0,1,0));
+    __m256 row1 = _mm256_shuffle_ps(tmp0, tmp2, _MM_SHUFFLE(3,2,3,2));
+    __m256 row2 = _mm256_shuffle_ps(tmp1, tmp3, _MM_SHUFFLE(1,0,1,0));
+    __m256 row3 = _mm256_shuffle_ps(tmp1, tmp3, _MM_SHUFFLE(3,2,3,2));
+    float *dest = destination + frame * destinationStride;
+    _mm_storeu_ps(dest,                         _mm256_castps256_ps128(row0));
+    _mm_storeu_ps(dest + destinationStride,     _mm256_castps256_ps128(row1));
+    _mm_storeu_ps(dest + 2 * destinationStride, _mm256_castps256_ps128(row2));
+    _mm_storeu_ps(dest + 3 * destinationStride, _mm256_castps256_ps128(row3));
+    dest += 4 * destinationStride;
+    _mm_storeu_ps(dest,                         _mm256_extractf128_ps(row0, 1));
+    _mm_storeu_ps(dest + destinationStride,     _mm256_extractf128_ps(row1, 1));
+    _mm_storeu_ps(dest + 2 * destinationStride, _mm256_extractf128_ps(row2, 1));
+    _mm_storeu_ps(dest + 3 * destinationStride, _mm256_extractf128_ps(row3, 1));
+  }
+  return frame;
+}
+
+/**
+ * @brief Deinterleave four channels, eight frames per iteration.
+ *
+ * The frames 0..3 are loaded into the lower lanes, the frames 4..7 into the upper lanes.
+ *
+ * @returns The number of frames that have been processed.
+ */
+__attribute__((target("avx")))
+static uint32_t deinterleaveFourAvx(const float *source, uint32_t sourceStride, float * const *channels, uint32_t numFrames)
+{
+  float *ch0 = channels[0];
+  float *ch1 = channels[1];
+  float *ch2 = channels[2];
+  float *ch3 = channels[3];
+  uint32_t frame = 0;
+  for (; frame + 8 <= numFrames; frame += 8)
+  {
+    const float *src = source + frame * sourceStride;
+    const float *srcHigh = src + 4 * sourceStride;
+    __m256 row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src)),                    _mm_loadu_ps(srcHigh), 1);
+    __m256 row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + sourceStride)),     _mm_loadu_ps(srcHigh + sourceStride), 1);
+    __m256 row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 2 * sourceStride)), _mm_loadu_ps(srcHigh + 2 * sourceStride), 1);
+    __m256 row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 3 * sourceStride)), _mm_loadu_ps(srcHigh + 3 * sourceStride), 1);
+    __m256 tmp0 = _mm256_unpacklo_ps(row0, row1);
+    __m256 tmp1 = _mm256_unpackhi_ps(row0, row1);
+    __m256 tmp2 = _mm256_unpacklo_ps(row2, row3);
+    __m256 tmp3 = _mm256_unpackhi_ps(row2, row3);
+    _mm256_storeu_ps(ch0 + frame, _mm256_shuffle_ps(tmp0, tmp2, _MM_SHUFFLE(1,0,1,0)));
+    _mm256_storeu_ps(ch1 + frame, _mm256_shuffle_ps(tmp0, tmp2, _MM_SHUFFLE(3,2,3,2)));
+    _mm256_storeu_ps(ch2 + frame, _mm256_shuffle_ps(tmp1, tmp3, _MM_SHUFFLE(1,0,1,0)));
+    _mm256_storeu_ps(ch3 + frame, _mm256_shuffle_ps(tmp1, tmp3, _MM_SHUFFLE(3,2,3,2)));
+  }
+  return frame;
+}
+#endif
+
+static void interleaveFour(const float * const *channels, float *destination, uint32_t destinationStride, uint32_t numFrames)
+{
+  uint32_t frame = 0;
+#if USE_SSE
+#if USE_AVX
+  if (cUseAvx == true)
+  {
+    frame = interleaveFourAvx(channels, destination, destinationStride, numFrames);
+  }
+#endif
+  for (; frame + 4 <= numFrames; frame += 4)
+  {
+    __m128 row0 = _mm_loadu_ps(channels[0] + frame);
+    __m128 row1 = _mm_loadu_ps(channels[1] + frame);
+    __m128 row2 = _mm_loadu_ps(channels[2] + frame);
+    __m128 row3 = _mm_loadu_ps(channels[3] + frame);
+
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+    float *dest = destination + frame * destinationStride;
+    _mm_storeu_ps(dest,                         row0);
+    _mm_storeu_ps(dest + destinationStride,     row1);
+    _mm_storeu_ps(dest + 2 * destinationStride, row2);
+    _mm_storeu_ps(dest + 3 * destinationStride, row3);
+  }
+#endif
+  for (; frame < numFrames; ++frame)
+  {
+    float *dest = destination + frame * destinationStride;
+    dest[0] = channels[0][frame];
+    dest[1] = channels[1][frame];
+    dest[2] = channels[2][frame];
+    dest[3] = channels[3][frame];
+  }
+}
+
+static void interleaveTwo(const float * const *channels, float *destination, uint32_t destinationStride, uint32_t numFrames)
+{
+  uint32_t frame = 0;
+#if USE_SSE
+  for (; frame + 4 <= numFrames; frame += 4)
+  {
+    __m128 ch0 = _mm_loadu_ps(channels[0] + frame);
+    __m128 ch1 = _mm_loadu_ps(channels[1] + frame);
+    __m128 low  = _mm_unpacklo_ps(ch0, ch1);
+    __m128 high = _mm_unpackhi_ps(ch0, ch1);
+
+    float *dest = destination + frame * destinationStride;
+    _mm_storel_pi(reinterpret_cast<__m64*>(dest),                         low);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(dest + destinationStride),     low);
+    _mm_storel_pi(reinterpret_cast<__m64*>(dest + 2 * destinationStride), high);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(dest + 3 * destinationStride), high);
+  }
+#endif
+  for (; frame < numFrames; ++frame)
+  {
+    float *dest = destination + frame * destinationStride;
+    dest[0] = channels[0][frame];
+    dest[1] = channels[1][frame];
+  }
+}
+
+static void deinterleaveFour(const float *source, uint32_t sourceStride, float * const *channels, uint32_t numFrames)
+{
+  uint32_t frame = 0;
+#if USE_SSE
+#if USE_AVX
+  if (cUseAvx == true)
+  {
+    frame = deinterleaveFourAvx(source, sourceStride, channels, numFrames);
+  }
+#endif
+  for (; frame + 4 <= numFrames; frame += 4)
+  {
+    const float *src = source + frame * sourceStride;
+    __m128 row0 = _mm_loadu_ps(src);
+    __m128 row1 = _mm_loadu_ps(src + sourceStride);
+    __m128 row2 = _mm_loadu_ps(src + 2 * sourceStride);
+    __m128 row3 = _mm_loadu_ps(src + 3 * sourceStride);
+
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+    _mm_storeu_ps(channels[0] + frame, row0);
+    _mm_storeu_ps(channels[1] + frame, row1);
+    _mm_storeu_ps(channels[2] + frame, row2);
+    _mm_storeu_ps(channels[3] + frame, row3);
+  }
+#endif
+  for (; frame < numFrames; ++frame)
+  {
+    const float *src = source + frame * sourceStride;
+    channels[0][frame] = src[0];
+    channels[1][frame] = src[1];
+    channels[2][frame] = src[2];
+    channels[3][frame] = src[3];
+  }
+}
+
+static void deinterleaveTwo(const float *source, uint32_t sourceStride, float * const *channels, uint32_t numFrames)
+{
+  uint32_t frame = 0;
+#if USE_SSE
+  for (; frame + 4 <= numFrames; frame += 4)
+  {
+    const float *src = source + frame * sourceStride;
+    __m128 low  = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(src)),
+                               reinterpret_cast<const __m64*>(src + sourceStride));
+    __m128 high = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(src + 2 * sourceStride)),
+                               reinterpret_cast<const __m64*>(src + 3 * sourceStride));
+
+    _mm_storeu_ps(channels[0] + frame, _mm_shuffle_ps(low, high, _MM_SHUFFLE(2,0,2,0)));
+    _mm_storeu_ps(channels[1] + frame, _mm_shuffle_ps(low, high, _MM_SHUFFLE(3,1,3,1)));
+  }
+#endif
+  for (; frame < numFrames; ++frame)
+  {
+    const float *src = source + frame * sourceStride;
+    channels[0][frame] = src[0];
+    channels[1][frame] = src[1];
+  }
+}
+
+void IasSampleLayoutConverter::copyStrided(const float *source, uint32_t sourceStride,
+                                           float *destination, uint32_t destinationStride,
+                                           uint32_t numChannels, uint32_t numFrames)
+{
+  if ((sourceStride == numChannels) && (destinationStride == numChannels))
+  {
+    // Both layouts are dense, so the whole block can be copied at once.
+    std::memcpy(destination, source, sizeof(float) * numChannels * numFrames);
+    return;
+  }
+  uint32_t channel = 0;
+#if USE_SSE
+  for (; channel + 4 <= numChannels; channel += 4)
+  {
+    const float *src = source + channel;
+    float *dest = destination + channel;
+    for (uint32_t frame = 0; frame < numFrames; ++frame)
+    {
+      _mm_storeu_ps(dest, _mm_loadu_ps(src));
+      src += sourceStride;
+      dest += destinationStride;
+    }
+  }
+  if (channel + 2 <= numChannels)
+  {
+    const float *src = source + channel;
+    float *dest = destination + channel;
+    for (uint32_t frame = 0; frame < numFrames; ++frame)
+    {
+      _mm_storel_pi(reinterpret_cast<__m64*>(dest), _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(src)));
+      src += sourceStride;
+      dest += destinationStride;
+    }
+    channel += 2;
+  }
+#endif
+  for (; channel < numChannels; ++channel)
+  {
+    const float *src = source + channel;
+    float *dest = destination + channel;
+    for (uint32_t frame = 0; frame < numFrames; ++frame)
+    {
+      *dest = *src;
+      src += sourceStride;
+      dest += destinationStride;
+    }
+  }
+}
+
+void IasSampleLayoutConverter::interleave(const float * const *channels, uint32_t numChannels,
+                                          float *destination, uint32_t destinationStride,
+                                          uint32_t numFrames)
+{
+  uint32_t channel = 0;
+  for (; channel + 4 <= numChannels; channel += 4)
+  {
+    interleaveFour(channels + channel, destination + channel, destinationStride, numFrames);
+  }
+  if (channel + 2 <= numChannels)
+  {
+    interleaveTwo(channels + channel, destination + channel, destinationStride, numFrames);
+    channel += 2;
+  }
+  if (channel < numChannels)
+  {
+    const float *src = channels[channel];
+    float *dest = destination + channel;
+    for (uint32_t frame = 0; frame < numFrames; ++frame)
+    {
+      *dest = src[frame];
+      dest += destinationStride;
+    }
+  }
+}
+
+void IasSampleLayoutConverter::deinterleave(const float *source, uint32_t sourceStride,
+                                            float * const *channels, uint32_t numChannels,
+                                            uint32_t numFrames)
+{
+  uint32_t channel = 0;
+  for (; channel + 4 <= numChannels; channel += 4)
+  {
+    deinterleaveFour(source + channel, sourceStride, channels + channel, numFrames);
+  }
+  if (channel + 2 <= numChannels)
+  {
+    deinterleaveTwo(source + channel, sourceStride, channels + channel, numFrames);
+    channel += 2;
+  }
+  if (channel < numChannels)
+  {
+    const float *src = source + channel;
+    float *dest = channels[channel];
+    for (uint32_t frame = 0; frame < numFrames; ++frame)
+    {
+      dest[frame] = *src;
+      src += sourceStride;
+    }
+  }
+}
+
+} // namespace IasAudio
@@ -18,6 +18,7 @@
 #include "rtprocessingfwx/IasAudioBufferPoolHandler.hpp"
 #include "audio/smartx/rtprocessingfwx/IasBundledAudioStream.hpp"
 #include "rtprocessingfwx/IasAudioChannelBundle.hpp"
+#include "rtprocessingfwx/IasSampleLayoutConverter.hpp"
 #include "audio/smartx/rtprocessingfwx/IasProcessingTypes.hpp"
 #include "audio/smartx/rtprocessingfwx/IasSimpleAudioStream.hpp"
 
@@ -59,9 +60,15 @@ IasAudioProcessingResult IasSimpleAudioStream::setProperties(const std::string &
 
   IasAudioBufferPoolHandler *bufferPoolHandler = IasAudioBufferPoolHandler::getInstance();
   IasAudioBufferPool *bufferPool = bufferPoolHandler->getBufferPool(mFrameLength * mNumberChannels);
-  IAS_ASSERT(bufferPool != NULL);
+  if (bufferPool == NULL)
+  {
+    return eIasAudioProcNotEnoughMemory;
+  }
   IasAudioBuffer *buffer = bufferPool->getBuffer();
-  IAS_ASSERT(buffer != NULL);
+  if (buffer == NULL)
+  {
+    return eIasAudioProcNotEnoughMemory;
+  }
   mBuffer = buffer;
   float *audioBuffer = buffer->getData();
   for (uint32_t index = 0; index < mNumberChannels; ++index)
@@ -122,14 +129,7 @@ IasAudioProcessingResult IasSimpleAudioStream::writeFromNonInterleaved(const Ias
     }
     else if (mSampleLayout == eIasInterleaved)
     {
-      float *destination = mAudioFrame[0];
-      for (uint32_t index = 0; index < mNumberChannels; ++index)
-      {
-        for (uint32_t frameIndex = 0; frameIndex < mFrameLength; ++frameIndex)
-        {
-          destination[frameIndex*mNumberChannels+index] = audioFrame[index][frameIndex];
-        }
-      }
+      IasSampleLayoutConverter::interleave(audioFrame.data(), mNumberChannels, mAudioFrame[0], mNumberChannels, mFrameLength);
     }
     else
     {
@@ -155,35 +155,31 @@ IasAudioProcessingResult IasSimpleAudioStream::writeFromNonInterleaved(const Ias
 IasAudioProcessingResult IasSimpleAudioStream::writeFromBundled(const IasAudioFrame &audioFrame)
 {
   IAS_ASSERT(audioFrame.size() == mNumberChannels);
-  if (mSampleLayout == eIasNonInterleaved)
+  if ((mSampleLayout != eIasNonInterleaved) && (mSampleLayout != eIasInterleaved))
   {
-    for (uint32_t index = 0; index < mNumberChannels; ++index)
-    {
-      float *source = audioFrame[index];
-      float *destination = mAudioFrame[index];
-      for (uint32_t frameIndex = 0; frameIndex < mFrameLength; ++frameIndex)
-      {
-        *destination++ = *source;
-        source += cIasNumChannelsPerBundle;
-      }
-    }
+    return eIasAudioProcInitializationFailed;
   }
-  else if (mSampleLayout == eIasInterleaved)
+  uint32_t index = 0;
+  while (index < mNumberChannels)
   {
-    float *destination = mAudioFrame[0];
-    for (uint32_t index = 0; index < mNumberChannels; ++index)
+    // Channels that are adjacent in the same bundle are converted together.
+    float *source = audioFrame[index];
+    uint32_t numAdjacentChannels = 1;
+    while ((index + numAdjacentChannels < mNumberChannels) &&
+           (numAdjacentChannels < cIasNumChannelsPerBundle) &&
+           (audioFrame[index + numAdjacentChannels] == source + numAdjacentChannels))
     {
-      float *source = audioFrame[index];
-      for (uint32_t frameIndex = 0; frameIndex < mFrameLength; ++frameIndex)
-      {
-        destination[frameIndex*mNumberChannels+index] = *source;
-        source += cIasNumChannelsPerBundle;
-      }
+      numAdjacentChannels++;
     }
-  }
-  else
-  {
-    return eIasAudioProcInitializationFailed;
+    if (mSampleLayout == eIasNonInterleaved)
+    {
+      IasSampleLayoutConverter::deinterleave(source, cIasNumChannelsPerBundle, &mAudioFrame[index], numAdjacentChannels, mFrameLength);
+    }
+    else
+    {
+      IasSampleLayoutConverter::copyStrided(source, cIasNumChannelsPerBundle, mAudioFrame[0] + index, mNumberChannels, numAdjacentChannels, mFrameLength);
+    }
+    index += numAdjacentChannels;
   }
   return eIasAudioProcOK;
 }
@@ -193,16 +189,12 @@ void IasSimpleAudioStream::asNonInterleavedStream(IasSimpleAudioStream *nonInter
   if (mSampleLayout == eIasInterleaved)
   {
     // Convert from interleaved => non-interleaved
-    nonInterleaved->setProperties(mName, mId, mNumberChannels, eIasNonInterleaved, mFrameLength, mType, mSidAvailable);
-    const IasAudioFrame &destination = nonInterleaved->getAudioBuffers();
-    const float *source = mAudioFrame[0];
-    for (uint32_t index = 0; index < mNumberChannels; ++index)
+    if (nonInterleaved->setProperties(mName, mId, mNumberChannels, eIasNonInterleaved, mFrameLength, mType, mSidAvailable) != eIasAudioProcOK)
     {
-      for (uint32_t frameIndex = 0; frameIndex < mFrameLength; ++frameIndex)
-      {
-        destination[index][frameIndex] = source[frameIndex*mNumberChannels+index];
-      }
+      return;
     }
+    const IasAudioFrame &destination = nonInterleaved->getAudioBuffers();
+    IasSampleLayoutConverter::deinterleave(mAudioFrame[0], mNumberChannels, destination.data(), mNumberChannels, mFrameLength);
     if (mSidAvailable == true)
     {
       nonInterleaved->setSid(mSid);
@@ -215,16 +207,12 @@ void IasSimpleAudioStream::asInterleavedStream(IasSimpleAudioStream *interleaved
   if (mSampleLayout == eIasNonInterleaved)
   {
     // Convert from non-interleaved => interleaved
-    interleaved->setProperties(mName, mId, mNumberChannels, eIasInterleaved, mFrameLength, mType, mSidAvailable);
-    float *destination = (interleaved->getAudioBuffers())[0];
-    const IasAudioFrame &source = mAudioFrame;
-    for (uint32_t index = 0; index < mNumberChannels; ++index)
+    if (interleaved->setProperties(mName, mId, mNumberChannels, eIasInterleaved, mFrameLength, mType, mSidAvailable) != eIasAudioProcOK)
     {
-      for (uint32_t frameIndex = 0; frameIndex < mFrameLength; ++frameIndex)
-      {
-        destination[frameIndex*mNumberChannels+index] = source[index][frameIndex];
-      }
+      return;
     }
+    float *destination = (interleaved->getAudioBuffers())[0];
+    IasSampleLayoutConverter::interleave(mAudioFrame.data(), mNumberChannels, destination, mNumberChannels, mFrameLength);
     if (mSidAvailable == true)
     {
       interleaved->setSid(mSid);
@@ -272,14 +260,7 @@ void IasSimpleAudioStream::copyToOutputAudioChannels(const IasAudioFrame &outAud
   }
   else if (mSampleLayout == eIasInterleaved)
   {
-    float *source = mAudioFrame[0];
-    for (uint32_t chanIdx = 0; chanIdx < mNumberChannels; ++chanIdx)
-    {
-      for (uint32_t frameIndex = 0; frameIndex < mFrameLength; ++frameIndex)
-      {
-        outAudioFrame[chanIdx][frameIndex] = source[frameIndex*mNumberChannels+chanIdx];
-      }
-    }
+    IasSampleLayoutConverter::deinterleave(mAudioFrame[0], mNumberChannels, outAudioFrame.data(), mNumberChannels, mFrameLength);
   }
   if(mSidAvailable == true)
   {
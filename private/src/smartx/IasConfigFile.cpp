@@ -110,6 +110,13 @@ static const std::string cConfigDefaultPath = SMARTX_CFG_DIR;
 static const std::string cConfigFileName = "smartx_config.txt";
 static const std::string cRunnerThreadPrefix = "routingzone.runner_threads";
 static const std::string cAlsaHandlerDiagPrefix = "alsahandler.diagnostic";
+static const std::string cAlsaHandlerAsrcPrefix = "alsahandler.asrc";
+static const std::string cSchedulingRtPrefix = "scheduling.rt.";
+static const std::string cBaseZoneRole = "basezone";
+static const std::string cRunnerRole = "runner";
+static const std::string cAlsaHandlerRole = "alsahandler";
+static const std::string cHelperPoolRole = "helperpool";
+static const uint32_t cMaxStartupThreads = 16;
 
 IasConfigFile::IasConfigFile()
   :mLog(IasAudioLogging::registerDltContext("SMX", "SmartX Common"))
@@ -123,6 +130,10 @@ IasConfigFile::IasConfigFile()
   ,mAlsaHandlerDiagnosticParams()
   ,mNumEntriesPerMsg(18)
   ,mLogPeriodTime(500)
+  ,mAlsaHandlerAsrcParams()
+  ,mThreadSchedulingParams()
+  ,mStartupThreads(0)
+  ,mPreloadPlugins(eIasDisabled)
 {
 }
 
@@ -177,24 +188,35 @@ static std::string policyToString(int32_t policy)
   }
 }
 
-void IasConfigFile::setSchedPolicy(po::variable_value value)
+static bool stringToPolicy(const std::string &policyString, int32_t *policy)
 {
-  // value is always filled because we provided a default value
-  IAS_ASSERT(!value.empty());
-  std::string policy = value.as<std::string>();
-  if (policy == "fifo")
+  IAS_ASSERT(policy != nullptr);
+  if (policyString == "fifo")
   {
-    mSchedPolicy = SCHED_FIFO;
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Scheduling policy", policyToString(mSchedPolicy), "set");
+    *policy = SCHED_FIFO;
   }
-  else if (policy == "rr")
+  else if (policyString == "rr")
   {
-    mSchedPolicy = SCHED_RR;
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Scheduling policy", policyToString(mSchedPolicy), "set");
+    *policy = SCHED_RR;
+  }
+  else if (policyString == "cfs")
+  {
+    *policy = SCHED_OTHER;
   }
-  else if (policy == "cfs")
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+void IasConfigFile::setSchedPolicy(po::variable_value value)
+{
+  // value is always filled because we provided a default value
+  IAS_ASSERT(!value.empty());
+  std::string policy = value.as<std::string>();
+  if (stringToPolicy(policy, &mSchedPolicy) == true)
   {
-    mSchedPolicy = SCHED_OTHER;
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Scheduling policy", policyToString(mSchedPolicy), "set");
   }
   else
@@ -234,6 +256,46 @@ void IasConfigFile::setSchedPriority(po::variable_value value)
   }
 }
 
+void IasConfigFile::setStartupThreads(po::variable_value value)
+{
+  // value is always filled because we provided a default value
+  IAS_ASSERT(!value.empty());
+  uint32_t numThreads = value.as<uint32_t>();
+  if (numThreads > cMaxStartupThreads)
+  {
+    /**
+     * @log The number of start-up threads configured in the config file is out of range.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Number of start-up threads", numThreads, "exceeds the maximum of", cMaxStartupThreads, ". Use the maximum instead");
+    numThreads = cMaxStartupThreads;
+  }
+  mStartupThreads = numThreads;
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Number of start-up threads", mStartupThreads, "set");
+}
+
+void IasConfigFile::setPreloadPlugins(po::variable_value value)
+{
+  // value is always filled because we provided a default value
+  IAS_ASSERT(!value.empty());
+  std::string state = value.as<std::string>();
+  if (state == "enabled")
+  {
+    mPreloadPlugins = eIasEnabled;
+  }
+  else if (state == "disabled")
+  {
+    mPreloadPlugins = eIasDisabled;
+  }
+  else
+  {
+    mPreloadPlugins = eIasDisabled;
+    /**
+     * @log The plug-in preload state in the config file is neither enabled nor disabled.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid plug-in preload state set:", state, ". Use disabled instead");
+  }
+}
+
 void IasConfigFile::setShmGroupName(po::variable_value value)
 {
   // value is always filled because we provided a default value
@@ -253,6 +315,10 @@ void IasConfigFile::load()
   // Reset the vector in case load was called before
   mCpuAffinities.clear();
   mAlsaHandlerDiagnosticParams.clear();
+  mAlsaHandlerAsrcParams.clear();
+  mThreadSchedulingParams.clear();
+  mStartupThreads = 0;
+  mPreloadPlugins = eIasDisabled;
 
   po::options_description descriptions;
 
@@ -272,6 +338,9 @@ void IasConfigFile::load()
     ("shm.group", po::value<std::string>()->default_value("ias_audio"), "Group name of the created shared memory files")
 
     ("routingzone.runner_threads", po::value<std::string>()->default_value("disabled"), "Runner thread configuration option")
+
+    ("startup.threads", po::value<uint32_t>()->default_value(0), "Number of threads starting the routing zones and source devices")
+    ("startup.preload_plugins", po::value<std::string>()->default_value("disabled"), "Load the plug-in libraries in the background")
     ;
 
   fs::path fullConfigPath;
@@ -334,8 +403,15 @@ void IasConfigFile::load()
         addRunnerThreadState(entry.string_key, entry.value[0]);
         // There are probably unregistered entries for ALSA handler diagnostics, so we try to add them to the map
         addAlsaHandlerDiagParam(entry.string_key, entry.value[0]);
+        // There are probably unregistered entries for the ASRC buffers of ALSA handlers, so we try to add them to the map
+        addAlsaHandlerAsrcParam(entry.string_key, entry.value[0]);
+        // There are probably unregistered entries for role specific scheduling params, so we try to add them to the map
+        addThreadSchedulingParam(entry.string_key, entry.value[0]);
       }
     }
+    // Set the start-up params
+    setStartupThreads(varMap["startup.threads"]);
+    setPreloadPlugins(varMap["startup.preload_plugins"]);
     // Set the group name
     setShmGroupName(varMap["shm.group"]);
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Config file", fullConfigPath.c_str(), "successfully loaded");
@@ -345,6 +421,12 @@ void IasConfigFile::load()
 }
 
 void IasConfigFile::configureThreadSchedulingParameters(DltContext *logCtx, IasRunnerThreadSchedulePriority priorityConfig)
+{
+  configureThreadSchedulingParameters(logCtx, eIasThreadRoleDefault, "", priorityConfig);
+}
+
+void IasConfigFile::configureThreadSchedulingParameters(DltContext *logCtx, IasThreadRole role, const std::string &name,
+                                                        IasRunnerThreadSchedulePriority priorityConfig)
 {
   char threadName[16];
   int err = pthread_getname_np(pthread_self(), threadName, sizeof(threadName));
@@ -356,13 +438,13 @@ void IasConfigFile::configureThreadSchedulingParameters(DltContext *logCtx, IasR
   struct sched_param params;
   IasConfigFile *cfg = getInstance();
   IAS_ASSERT(cfg != nullptr);
-  uint32_t sched_priority = cfg->getSchedPriority();
-  if (priorityConfig == eIasPriorityOneLess)
+  IasThreadSchedulingParams schedParams = cfg->getThreadSchedulingParams(role, name, priorityConfig);
+  if (role != eIasThreadRoleDefault)
   {
-    sched_priority -= 1;
+    DLT_LOG_CXX(*logCtx, DLT_LOG_INFO, LOG_PREFIX, LOG_THREAD, "Using scheduling parameters of", getThreadRoleKey(role, name));
   }
-  params.sched_priority = sched_priority;
-  int32_t policy = cfg->getSchedPolicy();
+  params.sched_priority = schedParams.priority;
+  int32_t policy = schedParams.policy;
   int32_t result = pthread_setschedparam(pthread_self(), policy, &params);
   if(result == 0)
   {
@@ -379,11 +461,11 @@ void IasConfigFile::configureThreadSchedulingParameters(DltContext *logCtx, IasR
      */
     DLT_LOG_CXX(*logCtx, DLT_LOG_ERROR, LOG_PREFIX, LOG_THREAD, "Scheduling parameters couldn't be set. Policy=", policyToString(policy), "Priority=", params.sched_priority);
   }
-  if (cfg->getCpuAffinities().size() > 0)
+  if (schedParams.cpuAffinities.size() > 0)
   {
     cpu_set_t cpu_set;
     CPU_ZERO(&cpu_set);
-    for (auto &entry : cfg->getCpuAffinities())
+    for (auto &entry : schedParams.cpuAffinities)
     {
       // Set an upper limit to avoid errors in macro
       if (entry <= 16)
@@ -526,6 +608,49 @@ const IasConfigFile::IasAlsaHandlerDiagnosticParams* IasConfigFile::getAlsaHandl
   }
 }
 
+void IasConfigFile::addAlsaHandlerAsrcParam(const std::string& optionKey, const std::string& optionValue)
+{
+  if (optionKey.find(cAlsaHandlerAsrcPrefix + ".") != 0)
+  {
+    return;
+  }
+  std::string mapKey = optionKey.substr(0, optionKey.find_last_of("."));
+  std::string paramName = optionKey.substr(optionKey.find_last_of(".") + 1);
+  if (paramName.compare("adaptive") == 0)
+  {
+    mAlsaHandlerAsrcParams[mapKey].adaptive = (optionValue.compare("enabled") == 0);
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Successfully set", optionKey, "=", mAlsaHandlerAsrcParams[mapKey].adaptive);
+  }
+  else if (paramName.compare("min_fill") == 0 || paramName.compare("max_fill") == 0)
+  {
+    std::uint32_t &value = (paramName.compare("min_fill") == 0) ? mAlsaHandlerAsrcParams[mapKey].minFill :
+                                                                  mAlsaHandlerAsrcParams[mapKey].maxFill;
+    try
+    {
+      value = static_cast<std::uint32_t>(std::stoul(optionValue));
+      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Successfully set", optionKey, "=", value);
+    }
+    catch(std::exception&)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid value in config file for", optionKey, ". Keeping default value", value);
+    }
+  }
+  else
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Unknown ALSA handler ASRC key detected:", optionKey);
+  }
+}
+
+const IasConfigFile::IasAlsaHandlerAsrcParams* IasConfigFile::getAlsaHandlerAsrcParams(const std::string& deviceName) const
+{
+  auto entryIter = mAlsaHandlerAsrcParams.find(cAlsaHandlerAsrcPrefix + "." + deviceName);
+  if (entryIter != mAlsaHandlerAsrcParams.end())
+  {
+    return &(entryIter->second);
+  }
+  return nullptr;
+}
+
 std::uint32_t IasConfigFile::getLogPeriodTime() const
 {
   return mLogPeriodTime;
@@ -536,5 +661,133 @@ std::uint32_t IasConfigFile::getNumEntriesPerMsg() const
   return mNumEntriesPerMsg;
 }
 
+std::string IasConfigFile::getThreadRoleKey(IasThreadRole role, const std::string &name)
+{
+  switch (role)
+  {
+    case eIasThreadRoleBaseZone:
+      return cSchedulingRtPrefix + cBaseZoneRole + "." + name;
+    case eIasThreadRoleRunner:
+      return cSchedulingRtPrefix + cRunnerRole + "." + name;
+    case eIasThreadRoleAlsaHandler:
+      return cSchedulingRtPrefix + cAlsaHandlerRole + "." + name;
+    case eIasThreadRoleHelperPool:
+      return cSchedulingRtPrefix + cHelperPoolRole + "." + name;
+    default:
+      return "scheduling.rt";
+  }
+}
+
+IasConfigFile::IasThreadSchedulingParams IasConfigFile::getThreadSchedulingParams(IasThreadRole role, const std::string &name,
+                                                                                  IasRunnerThreadSchedulePriority priorityConfig) const
+{
+  IasThreadSchedulingParams effectiveParams;
+  effectiveParams.policy = mSchedPolicy;
+  effectiveParams.priority = mSchedPriority;
+  if (priorityConfig == eIasPriorityOneLess)
+  {
+    effectiveParams.priority -= 1;
+  }
+  effectiveParams.cpuAffinities = mCpuAffinities;
+  if (role == eIasThreadRoleDefault)
+  {
+    return effectiveParams;
+  }
+  auto entryIter = mThreadSchedulingParams.find(getThreadRoleKey(role, name));
+  if (entryIter != mThreadSchedulingParams.end())
+  {
+    const IasThreadSchedulingParams &roleParams = entryIter->second;
+    if (roleParams.hasPolicy == true)
+    {
+      effectiveParams.policy = roleParams.policy;
+      effectiveParams.hasPolicy = true;
+    }
+    if (roleParams.hasPriority == true)
+    {
+      effectiveParams.priority = roleParams.priority;
+      effectiveParams.hasPriority = true;
+    }
+    if (roleParams.hasCpuAffinities == true)
+    {
+      effectiveParams.cpuAffinities = roleParams.cpuAffinities;
+      effectiveParams.hasCpuAffinities = true;
+    }
+  }
+  return effectiveParams;
+}
+
+void IasConfigFile::addThreadSchedulingParam(const std::string& optionKey, const std::string& optionValue)
+{
+  if (optionKey.find(cSchedulingRtPrefix + cBaseZoneRole + ".") != 0 &&
+      optionKey.find(cSchedulingRtPrefix + cRunnerRole + ".") != 0 &&
+      optionKey.find(cSchedulingRtPrefix + cAlsaHandlerRole + ".") != 0 &&
+      optionKey.find(cSchedulingRtPrefix + cHelperPoolRole + ".") != 0)
+  {
+    return;
+  }
+  std::size_t dotPos = optionKey.find_last_of(".");
+  std::string mapKey = optionKey.substr(0, dotPos);
+  std::string paramName = optionKey.substr(dotPos + 1);
+  IasThreadSchedulingParams &roleParams = mThreadSchedulingParams[mapKey];
+  if (paramName == "policy")
+  {
+    if (stringToPolicy(optionValue, &roleParams.policy) == true)
+    {
+      roleParams.hasPolicy = true;
+      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Successfully set", optionKey, "=", policyToString(roleParams.policy));
+    }
+    else
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid scheduling policy set for", optionKey, ":", optionValue, ". Use global policy instead");
+    }
+  }
+  else if (paramName == "priority")
+  {
+    try
+    {
+      std::uint32_t priority = static_cast<std::uint32_t>(std::stoul(optionValue));
+      if (priority > 99)
+      {
+        DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Priority has to be in the range 0 to 99. Configured priority for", optionKey, "ignored:", priority);
+      }
+      else
+      {
+        roleParams.priority = priority;
+        roleParams.hasPriority = true;
+        DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Successfully set", optionKey, "=", roleParams.priority);
+      }
+    }
+    catch(std::exception&)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid value in config file for", optionKey, ". Use global priority instead");
+    }
+  }
+  else if (paramName == "cpu_affinity")
+  {
+    std::vector<std::string> strs;
+    boost::split(strs, optionValue, boost::is_any_of("\t "), boost::token_compress_on);
+    roleParams.cpuAffinities.clear();
+    for (auto &entry : strs)
+    {
+      if (!entry.empty())
+      {
+        errno = 0;
+        char *endPtr = nullptr;
+        uint32_t cpuAffinity = static_cast<uint32_t>(strtol(entry.c_str(), &endPtr, 10));
+        if ((errno == 0) && ((endPtr == nullptr) || (*endPtr == '\0')))
+        {
+          roleParams.cpuAffinities.push_back(cpuAffinity);
+        }
+      }
+    }
+    roleParams.hasCpuAffinities = (roleParams.cpuAffinities.size() > 0);
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Stored", roleParams.cpuAffinities.size(), "CPU affinities for", mapKey);
+  }
+  else
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Unknown role specific scheduling key detected:", optionKey);
+  }
+}
+
 
 } //namespace IasAudio
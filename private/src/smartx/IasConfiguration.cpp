@@ -34,6 +34,13 @@ IasConfiguration::IasConfiguration()
   ,mOutputPortMap()
   ,mInputPortMap()
   ,mLogicalSourceMap()
+  ,mPortMap()
+  ,mModulePropertiesMap()
+  ,mPinMap()
+  ,mPortIndex()
+  ,mOutputPortIndex()
+  ,mInputPortIndex()
+  ,mPinIndex()
 {
 }
 
@@ -58,6 +65,7 @@ IasConfiguration::~IasConfiguration()
     port->clearOwner();
   }
   mOutputPortMap.clear();
+  mOutputPortIndex.clear();
 
   for (auto &entry : mInputPortMap)
   {
@@ -65,6 +73,7 @@ IasConfiguration::~IasConfiguration()
     port->clearOwner();
   }
   mInputPortMap.clear();
+  mInputPortIndex.clear();
 }
 
 IasConfiguration::IasResult IasConfiguration::addAudioDevice(const std::string& name, IasAudioSourceDevicePtr sourceDevice)
@@ -87,15 +96,13 @@ IasConfiguration::IasResult IasConfiguration::getAudioDevice(const std::string&
   // You cannot pass a nullptr. The compiler prevents this because we have an overloaded function
   // which would be ambiguous.
   IAS_ASSERT(sourceDevice != nullptr);
-  if (mSourceDeviceMap.count(name) > 0)
-  {
-    *sourceDevice = mSourceDeviceMap.at(name);
-    return eIasOk;
-  }
-  else
+  IasSourceDeviceMap::const_iterator it = mSourceDeviceMap.find(name);
+  if (it == mSourceDeviceMap.end())
   {
     return eIasObjectNotFound;
   }
+  *sourceDevice = it->second;
+  return eIasOk;
 }
 
 void IasConfiguration::deleteAudioDevice(const std::string& name)
@@ -130,15 +137,13 @@ IasConfiguration::IasResult IasConfiguration::getAudioDevice(const std::string&
   // You cannot pass a nullptr. The compiler prevents this because we have an overloaded function
   // which would be ambiguous.
   IAS_ASSERT(sinkDevice != nullptr);
-  if (mSinkDeviceMap.count(name) > 0)
-  {
-    *sinkDevice = mSinkDeviceMap.at(name);
-    return eIasOk;
-  }
-  else
+  IasSinkDeviceMap::const_iterator it = mSinkDeviceMap.find(name);
+  if (it == mSinkDeviceMap.end())
   {
     return eIasObjectNotFound;
   }
+  *sinkDevice = it->second;
+  return eIasOk;
 }
 
 IasConfiguration::IasResult IasConfiguration::addRoutingZone(const std::string& name, IasRoutingZonePtr routingZone)
@@ -162,15 +167,13 @@ IasConfiguration::IasResult IasConfiguration::getRoutingZone(const std::string&
   {
     return eIasNullPointer;
   }
-  if (mRoutingZoneMap.count(name) > 0)
-  {
-    *routingZone = mRoutingZoneMap.at(name);
-    return eIasOk;
-  }
-  else
+  IasRoutingZoneMap::const_iterator it = mRoutingZoneMap.find(name);
+  if (it == mRoutingZoneMap.end())
   {
     return eIasObjectNotFound;
   }
+  *routingZone = it->second;
+  return eIasOk;
 }
 
 IasConfiguration::IasResult IasConfiguration::getRoutingZone(const IasPipelinePtr pipeline, IasRoutingZonePtr *routingZone)
@@ -221,15 +224,13 @@ IasConfiguration::IasResult IasConfiguration::getPipeline(const std::string& nam
   {
     return eIasNullPointer;
   }
-  if (mPipelineMap.count(name) > 0)
-  {
-    *pipeline = mPipelineMap.at(name);
-    return eIasOk;
-  }
-  else
+  IasPipelineMap::const_iterator it = mPipelineMap.find(name);
+  if (it == mPipelineMap.end())
   {
     return eIasObjectNotFound;
   }
+  *pipeline = it->second;
+  return eIasOk;
 }
 
 void IasConfiguration::deletePipeline(const std::string& name)
@@ -268,8 +269,8 @@ IasConfiguration::IasResult IasConfiguration::addPin(IasAudioPinPtr pin)
     return eIasFailed;
   }
 
-  std::string name = pin->getParameters()->name;
-  if (mPinMap.find(name) == mPinMap.end())
+  const std::string &name = pin->getParameters()->name;
+  if (mPinIndex.emplace(name, pin).second)
   {
     mPinMap[name] = pin;
   }
@@ -278,8 +279,7 @@ IasConfiguration::IasResult IasConfiguration::addPin(IasAudioPinPtr pin)
 
 void IasConfiguration::removePin(std::string name)
 {
-
-  if (mPinMap.find(name) != mPinMap.end())
+  if (mPinIndex.erase(name) > 0)
   {
     mPinMap.erase(name);
   }
@@ -294,39 +294,49 @@ IasConfiguration::IasResult IasConfiguration::addPort(IasAudioPortPtr port)
   }
   int32_t id = port->getParameters()->id;
 
-  std::string name = port->getParameters()->name;
-  if (mPortMap.find(name) == mPortMap.end())
-  {
-    mPortMap[name] = port;
-  }
-
   // If the port ID is specified (i.e., if it is not -1), add the port to the Port Map.
+  // The id is checked first, so that a port with a conflicting id is not added by name either.
   if (id >= 0)
   {
     IasPortDirection direction = port->getParameters()->direction;
     std::string directionStr;
     IasIdPortMap *portMap;
+    IasIdPortIndex *portIndex;
     if (direction == eIasPortDirectionInput)
     {
       directionStr = "Input";
       portMap = &mInputPortMap;
+      portIndex = &mInputPortIndex;
     }
     else
     {
       directionStr = "Output";
       portMap = &mOutputPortMap;
+      portIndex = &mOutputPortIndex;
     }
     IAS_ASSERT(portMap != nullptr);
-    if (portMap->find(id) != portMap->end())
+    if (portIndex->emplace(id, port).second == false)
     {
       DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, directionStr, "Port with Id", id, "already exists");
       return eIasFailed;
     }
     (*portMap)[id] = port;
   }
+
+  const std::string &name = port->getParameters()->name;
+  if (mPortIndex.emplace(name, port).second)
+  {
+    mPortMap[name] = port;
+  }
   return eIasOk;
 }
 
+uint64_t IasConfiguration::erasePortName(const std::string &name)
+{
+  mPortIndex.erase(name);
+  return mPortMap.erase(name);
+}
+
 IasConfiguration::IasResult IasConfiguration::getPinByName(const std::string &name, IasAudioPinPtr *pin)
 {
   if(pin == nullptr)
@@ -334,26 +344,14 @@ IasConfiguration::IasResult IasConfiguration::getPinByName(const std::string &na
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "pin == nullptr");
     return eIasFailed;
   }
-  bool bPinNameFound = false;
-  for(auto& it : mPinMap)
-  {
-    std::string nameFound = it.second->getParameters()->name;
-    if(nameFound.compare(name) == 0)
-    {
-      bPinNameFound = true;
-      *pin = it.second;
-      break;
-    }
-  }
-  if(bPinNameFound == false)
+  IasPinIndex::const_iterator it = mPinIndex.find(name);
+  if (it == mPinIndex.end())
   {
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Pin with name", name.c_str(), "doesn't exist");
     return eIasObjectNotFound;
   }
-  else
-  {
-    return eIasOk;
-  }
+  *pin = it->second;
+  return eIasOk;
 }
 
 IasConfiguration::IasResult IasConfiguration::getPortByName(const std::string &name, IasAudioPortPtr *port)
@@ -367,20 +365,8 @@ IasConfiguration::IasResult IasConfiguration::getPortByName(const std::string &n
     return eIasFailed;
   }
 
-  bool bPortNameFound = false;
-
-  for(auto& it : mPortMap)
-  {
-    std::string nameFound = it.second->getParameters()->name;
-    if(nameFound.compare(name) == 0)
-    {
-      bPortNameFound = true;
-      *port = it.second;
-      break;
-    }
-  }
-
-  if(bPortNameFound == false)
+  IasPortIndex::const_iterator it = mPortIndex.find(name);
+  if (it == mPortIndex.end())
   {
     /**
      * @log Port with name doesn't exist.
@@ -388,10 +374,8 @@ IasConfiguration::IasResult IasConfiguration::getPortByName(const std::string &n
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Port with name", name.c_str(), "doesn't exist");
     return eIasObjectNotFound;
   }
-  else
-  {
-    return eIasOk;
-  }
+  *port = it->second;
+  return eIasOk;
 }
 
 IasConfiguration::IasResult IasConfiguration::getOutputPort(int32_t sourceId, IasAudioPortPtr* port)
@@ -404,7 +388,8 @@ IasConfiguration::IasResult IasConfiguration::getOutputPort(int32_t sourceId, Ia
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Port == nullptr");
     return eIasFailed;
   }
-  if (mOutputPortMap.find(sourceId) == mOutputPortMap.end())
+  IasIdPortIndex::const_iterator it = mOutputPortIndex.find(sourceId);
+  if (it == mOutputPortIndex.end())
   {
     /**
      * @log Port with sourceId <ID> doesn't exist.
@@ -412,7 +397,7 @@ IasConfiguration::IasResult IasConfiguration::getOutputPort(int32_t sourceId, Ia
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Port with sourceId", sourceId, "doesn't exist");
     return eIasFailed;
   }
-  *port = mOutputPortMap[sourceId];
+  *port = it->second;
   return eIasOk;
 }
 
@@ -420,8 +405,8 @@ void IasConfiguration::deleteOutputPort(int32_t sourceId)
 {
   if (sourceId >= 0)
   {
-    IasIdPortMap::iterator it = mOutputPortMap.find(sourceId);
-    if(it == mOutputPortMap.end())
+    IasIdPortIndex::iterator it = mOutputPortIndex.find(sourceId);
+    if(it == mOutputPortIndex.end())
     {
       /**
        * @log Output port with <ID> doesn't exist.
@@ -430,7 +415,7 @@ void IasConfiguration::deleteOutputPort(int32_t sourceId)
       return;
     }
     std::string portName = it->second->getParameters()->name;
-    uint64_t numDeleted =  mPortMap.erase(portName);
+    uint64_t numDeleted = erasePortName(portName);
     if(numDeleted != 1)
     {
       /**
@@ -439,6 +424,7 @@ void IasConfiguration::deleteOutputPort(int32_t sourceId)
       DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Couldn't delete port with sourceId from global port list", sourceId);
       return;
     }
+    mOutputPortIndex.erase(it);
     mOutputPortMap.erase(sourceId); //should work, cause we checked above that sourceId can be found in this map
   }
 }
@@ -453,7 +439,8 @@ IasConfiguration::IasResult IasConfiguration::getInputPort(int32_t sinkId, IasAu
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Port == nullptr");
     return eIasFailed;
   }
-  if (mInputPortMap.find(sinkId) == mInputPortMap.end())
+  IasIdPortIndex::const_iterator it = mInputPortIndex.find(sinkId);
+  if (it == mInputPortIndex.end())
   {
     /**
      * @log Port with sinkId <ID> doesn't exist.
@@ -461,7 +448,7 @@ IasConfiguration::IasResult IasConfiguration::getInputPort(int32_t sinkId, IasAu
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Port with sinkId", sinkId, "doesn't exist");
     return eIasFailed;
   }
-  *port = mInputPortMap[sinkId];
+  *port = it->second;
   return eIasOk;
 }
 
@@ -469,8 +456,8 @@ void IasConfiguration::deleteInputPort(int32_t sinkId)
 {
   if (sinkId >= 0)
   {
-    IasIdPortMap::iterator it = mInputPortMap.find(sinkId);
-    if(it == mInputPortMap.end())
+    IasIdPortIndex::iterator it = mInputPortIndex.find(sinkId);
+    if(it == mInputPortIndex.end())
     {
       /**
        * @log Output port with <ID> doesn't exist.
@@ -479,7 +466,7 @@ void IasConfiguration::deleteInputPort(int32_t sinkId)
       return;
     }
     std::string portName = it->second->getParameters()->name;
-    uint64_t numDeleted =  mPortMap.erase(portName);
+    uint64_t numDeleted = erasePortName(portName);
     if(numDeleted != 1)
     {
       /**
@@ -488,14 +475,14 @@ void IasConfiguration::deleteInputPort(int32_t sinkId)
       DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Couldn't delete port with sinkId from global port list", sinkId);
       return;
     }
+    mInputPortIndex.erase(it);
     mInputPortMap.erase(sinkId); //should work, cause we checked above that sourceId can be found in this map
   }
 }
 
 void IasConfiguration::deletePortByName(std::string name)
 {
-  IasPortMap::iterator it = mPortMap.find(name);
-  if(it == mPortMap.end())
+  if (erasePortName(name) == 0)
   {
     /**
      * @log Could not delete port with <name> from global port list.
@@ -503,7 +490,6 @@ void IasConfiguration::deletePortByName(std::string name)
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Couldn't delete port with name",name.c_str(), "from global port list");
     return;
   }
-  mPortMap.erase(name);
 
 }
 
@@ -17,11 +17,19 @@
 
 #include "switchmatrix/IasSwitchMatrix.hpp"
 #include "smartx/IasSmartXClient.hpp"
+#include "smartx/IasLatencyProbe.hpp"
+#include "smartx/IasStreamProbe.hpp"
+#include "smartx/IasMultiPointProbe.hpp"
+#include "smartx/IasDecoratorGuard.hpp"
+#include "rtprocessingfwx/IasAudioBufferPoolHandler.hpp"
 
 
 
 #include <string.h>
 #include <atomic>
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
 
 #ifndef RW_TMP_PATH
 #define RW_TMP_PATH "/tmp/"
@@ -60,12 +68,32 @@ static const std::string cClassName = "IasDebugImpl::";
 IasDebugImpl::IasDebugImpl(IasConfigurationPtr config)
  :mLog(IasAudioLogging::registerDltContext("DBG", "SmartX Debug"))
  ,mConfig(config)
+ ,mLatencyProbe(nullptr)
+ ,mLatencyInjectPort(nullptr)
+ ,mLatencyDetectPort(nullptr)
+ ,mLatencyDetectPin(nullptr)
 {
 }
 
 IasDebugImpl::~IasDebugImpl()
 {
   DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX);
+  stopLatencyProbe();
+  while (mStreamProbes.empty() == false)
+  {
+    const IasStreamProbeEntry &entry = mStreamProbes.begin()->second;
+    if (entry.probe != nullptr)
+    {
+      stopStreamRecord(mStreamProbes.begin()->first);
+    }
+    else
+    {
+      stopMultiPointRecord(entry.streamName);
+    }
+  }
+  mStoppedStreamProbes.clear();
+  mStoppedLatencyProbes.clear();
+  mLatencyProbe = nullptr;
   mConfig = nullptr;
 }
 
@@ -329,4 +357,617 @@ IasDebugImpl::IasResult IasDebugImpl::startRoutingZoneProbing(IasAudioPortParams
   return res;
 }
 
+IasSwitchMatrixPtr IasDebugImpl::getSwitchMatrix(IasAudioPortPtr port)
+{
+  if(port->getParameters()->direction == eIasPortDirectionOutput)
+  {
+    return port->getSwitchMatrix();
+  }
+  IasAudioPortOwnerPtr portOwner = nullptr;
+  port->getOwner(&portOwner);
+  IAS_ASSERT(portOwner != nullptr);
+  return portOwner->getSwitchMatrix();
+}
+
+IasIDebug::IasResult IasDebugImpl::startLatencyProbe(const std::string &sourceName,
+                                                     const std::string &sinkName,
+                                                     uint32_t numMeasurements)
+{
+  if (numMeasurements == 0)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Number of measurements must not be 0");
+    return eIasFailed;
+  }
+  if (mLatencyInjectPort != nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Latency probe already active, stop it first");
+    return eIasFailed;
+  }
+  retireLatencyProbe();
+
+  IasAudioPortPtr sourcePort = nullptr;
+  IasConfiguration::IasResult cfgres = mConfig->getPortByName(sourceName, &sourcePort);
+  if (cfgres != IasConfiguration::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Source port", sourceName, "not found");
+    return translate(cfgres);
+  }
+  IasAudioPortParamsPtr sourceParams = sourcePort->getParameters();
+  IAS_ASSERT(sourceParams != nullptr);
+  if (sourceParams->direction != eIasPortDirectionOutput)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Port", sourceName, "is not an output port of a source device");
+    return eIasFailed;
+  }
+  IasAudioPortOwnerPtr sourceOwner = nullptr;
+  sourcePort->getOwner(&sourceOwner);
+  IAS_ASSERT(sourceOwner != nullptr);
+  IasSwitchMatrixPtr sourceSwitchMatrix = getSwitchMatrix(sourcePort);
+  if (sourceSwitchMatrix == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Source port", sourceName, "is not connected");
+    return eIasFailed;
+  }
+
+  IasLatencyProbeParams params;
+  params.numMeasurements = numMeasurements;
+  params.injectIndex = sourceParams->index;
+  params.injectNumChannels = sourceParams->numChannels;
+  params.injectSampleRate = sourceOwner->getSampleRate();
+
+  IasAudioPortPtr sinkPort = nullptr;
+  IasAudioPinPtr sinkPin = nullptr;
+  cfgres = mConfig->getPortByName(sinkName, &sinkPort);
+  if (cfgres == IasConfiguration::eIasObjectNotFound)
+  {
+    // no port found, maybe we can find a pin?
+    cfgres = mConfig->getPinByName(sinkName, &sinkPin);
+  }
+  if (cfgres != IasConfiguration::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Neither port or pin", sinkName, "was found for latency detection");
+    return translate(cfgres);
+  }
+
+  if (sinkPort != nullptr)
+  {
+    IasAudioPortParamsPtr sinkParams = sinkPort->getParameters();
+    IAS_ASSERT(sinkParams != nullptr);
+    if (sinkParams->direction != eIasPortDirectionInput)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Port", sinkName, "is not an input port");
+      return eIasFailed;
+    }
+    IasAudioPortOwnerPtr sinkOwner = nullptr;
+    sinkPort->getOwner(&sinkOwner);
+    IAS_ASSERT(sinkOwner != nullptr);
+    params.detectIndex = sinkParams->index;
+    params.detectNumChannels = sinkParams->numChannels;
+    params.detectSampleRate = sinkOwner->getSampleRate();
+    mLatencyProbe = std::make_shared<IasLatencyProbe>(params);
+
+    IasLatencyProbeSlots *detectSlots = nullptr;
+    if (getPortProbeSlots(sinkPort, &detectSlots, nullptr) == false)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Sink port", sinkName, "is not connected");
+      return eIasFailed;
+    }
+    detectSlots->attach(mLatencyProbe);
+    mLatencyDetectPort = sinkPort;
+  }
+  else
+  {
+    IasPipelinePtr pipeline = sinkPin->getPipeline();
+    if (pipeline == nullptr)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Pin was not added to any pipeline, no latency detection possible");
+      return eIasFailed;
+    }
+    params.detectIndex = 0;
+    params.detectNumChannels = sinkPin->getParameters()->numChannels;
+    params.detectSampleRate = pipeline->getParameters()->samplerate;
+    mLatencyProbe = std::make_shared<IasLatencyProbe>(params);
+    IasResult res = translate(pipeline->startLatencyProbe(sinkPin, mLatencyProbe));
+    if (res != eIasOk)
+    {
+      return res;
+    }
+    mLatencyDetectPin = sinkPin;
+  }
+
+  // Start the injection as the last step, so that no marker can get lost while the detector is attached.
+  IasLatencyProbeSlots *injectSlots = sourceSwitchMatrix->getLatencyProbeSlots(sourcePort);
+  mLatencyInjectPort = sourcePort;
+  if (injectSlots == nullptr)
+  {
+    stopLatencyProbe();
+    return eIasFailed;
+  }
+  injectSlots->attach(mLatencyProbe);
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Latency probe started from", sourceName, "to", sinkName, "with", numMeasurements, "measurements");
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::getLatencyProbeResult(IasLatencyResult *result)
+{
+  if (result == nullptr || mLatencyProbe == nullptr)
+  {
+    return eIasFailed;
+  }
+  mLatencyProbe->getResult(result);
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::stopLatencyProbe()
+{
+  if (mLatencyInjectPort == nullptr && mLatencyDetectPort == nullptr && mLatencyDetectPin == nullptr)
+  {
+    return eIasFailed;
+  }
+  IasLatencyProbeSlots *slots = nullptr;
+  if ((mLatencyInjectPort != nullptr) && (getPortProbeSlots(mLatencyInjectPort, &slots, nullptr) == true))
+  {
+    slots->detach();
+  }
+  if ((mLatencyDetectPort != nullptr) && (getPortProbeSlots(mLatencyDetectPort, &slots, nullptr) == true))
+  {
+    slots->detach();
+  }
+  if (mLatencyDetectPin != nullptr)
+  {
+    IasPipelinePtr pipeline = mLatencyDetectPin->getPipeline();
+    if (pipeline != nullptr)
+    {
+      pipeline->stopLatencyProbe();
+    }
+  }
+  mLatencyInjectPort = nullptr;
+  mLatencyDetectPort = nullptr;
+  mLatencyDetectPin = nullptr;
+  releaseLatencyProbes();
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::startStreamRecord(const std::string &streamName, const std::string &location)
+{
+  releaseStreamProbes();
+  if (streamName.empty())
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Stream name must not be empty");
+    return eIasFailed;
+  }
+  if (mStreamProbes.find(location) != mStreamProbes.end())
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Stream recording already active for", location);
+    return eIasFailed;
+  }
+  if (isStreamNameUsed(streamName))
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Stream name", streamName, "already used");
+    return eIasFailed;
+  }
+
+  IasStreamProbeEntry entry;
+  IasStreamProbeParams params;
+  IasResult res = resolveStreamProbe(location, &entry, &params);
+  if (res != eIasOk)
+  {
+    return res;
+  }
+  params.name = streamName;
+  entry.streamName = streamName;
+  entry.probe = std::make_shared<IasStreamProbe>(params);
+  IAS_ASSERT(entry.probe != nullptr);
+  if (entry.probe->init() != IasStreamProbe::eIasOk)
+  {
+    return eIasFailed;
+  }
+  entry.tap = entry.probe;
+  res = attachStreamProbe(entry);
+  if (res != eIasOk)
+  {
+    return res;
+  }
+  mStreamProbes[location] = entry;
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Stream recording of", location, "started as", streamName);
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::getStreamRecordStatistics(const std::string &location, IasStreamProbeStatistics *statistics)
+{
+  auto it = mStreamProbes.find(location);
+  if (statistics == nullptr || it == mStreamProbes.end() || it->second.probe == nullptr)
+  {
+    return eIasFailed;
+  }
+  it->second.probe->getStatistics(statistics);
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::stopStreamRecord(const std::string &location)
+{
+  auto it = mStreamProbes.find(location);
+  if (it == mStreamProbes.end() || it->second.probe == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "No stream recording active for", location);
+    return eIasFailed;
+  }
+  detachStreamProbe(it->second);
+  mStoppedStreamProbes.push_back(it->second.tap);
+  mStreamProbes.erase(it);
+  releaseStreamProbes();
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::startMultiPointRecord(const std::string &streamName, const IasStringVector &names)
+{
+  releaseStreamProbes();
+  if (streamName.empty() || names.empty())
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Stream name and list of ports/pins must not be empty");
+    return eIasFailed;
+  }
+  if (isStreamNameUsed(streamName))
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Stream name", streamName, "already used");
+    return eIasFailed;
+  }
+
+  std::vector<IasStreamProbeEntry> entries;
+  std::vector<IasStreamProbeParams> params;
+  for (auto &location : names)
+  {
+    if (mStreamProbes.find(location) != mStreamProbes.end() ||
+        std::count(names.begin(), names.end(), location) > 1)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Stream recording already active for", location);
+      return eIasFailed;
+    }
+    IasStreamProbeEntry entry;
+    IasStreamProbeParams locationParams;
+    IasResult res = resolveStreamProbe(location, &entry, &locationParams);
+    if (res != eIasOk)
+    {
+      return res;
+    }
+    if (params.empty() == false && locationParams.sampleRate != params.front().sampleRate)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Sample rate", locationParams.sampleRate, "of", location,
+                  "differs from sample rate", params.front().sampleRate, "of", names.front());
+      return eIasFailed;
+    }
+    entry.streamName = streamName;
+    entries.push_back(entry);
+    params.push_back(locationParams);
+  }
+
+  IasMultiPointProbePtr multiPointProbe = std::make_shared<IasMultiPointProbe>(streamName,
+                                                                              params.front().sampleRate,
+                                                                              params.front().periodSize);
+  IAS_ASSERT(multiPointProbe != nullptr);
+  for (uint32_t i = 0; i < entries.size(); ++i)
+  {
+    entries[i].tap = multiPointProbe->addTap(names[i], params[i].index, params[i].numChannels, getProbeClockDomain(entries[i]));
+  }
+  if (multiPointProbe->start() != IasMultiPointProbe::eIasOk)
+  {
+    return eIasFailed;
+  }
+  for (uint32_t i = 0; i < entries.size(); ++i)
+  {
+    if (attachStreamProbe(entries[i]) != eIasOk)
+    {
+      for (uint32_t j = 0; j < i; ++j)
+      {
+        detachStreamProbe(entries[j]);
+        mStoppedStreamProbes.push_back(entries[j].tap);
+      }
+      multiPointProbe->stop();
+      return eIasFailed;
+    }
+  }
+  for (uint32_t i = 0; i < entries.size(); ++i)
+  {
+    mStreamProbes[names[i]] = entries[i];
+  }
+  mMultiPointProbes[streamName] = multiPointProbe;
+  writeMultiPointHeader(multiPointProbe);
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Multi-point recording of", names.size(), "ports/pins started as", streamName);
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::getMultiPointRecordHeader(const std::string &streamName, IasMultiPointHeader *header)
+{
+  auto it = mMultiPointProbes.find(streamName);
+  if (header == nullptr || it == mMultiPointProbes.end())
+  {
+    return eIasFailed;
+  }
+  it->second->getHeader(header);
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::getMultiPointRecordStatistics(const std::string &streamName, IasStreamProbeStatistics *statistics)
+{
+  auto it = mMultiPointProbes.find(streamName);
+  if (statistics == nullptr || it == mMultiPointProbes.end())
+  {
+    return eIasFailed;
+  }
+  it->second->getStatistics(statistics);
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::stopMultiPointRecord(const std::string &streamName)
+{
+  auto multiIt = mMultiPointProbes.find(streamName);
+  if (multiIt == mMultiPointProbes.end())
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "No multi-point recording active for", streamName);
+    return eIasFailed;
+  }
+  auto it = mStreamProbes.begin();
+  while (it != mStreamProbes.end())
+  {
+    if (it->second.streamName == streamName)
+    {
+      detachStreamProbe(it->second);
+      mStoppedStreamProbes.push_back(it->second.tap);
+      it = mStreamProbes.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  multiIt->second->stop();
+  mMultiPointProbes.erase(multiIt);
+  std::string headerFileName = std::string(RW_TMP_PATH) + streamName + ".hdr";
+  remove(headerFileName.c_str());
+  releaseStreamProbes();
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::getLockStatistics(std::vector<IasLockStatistics> *statistics)
+{
+  if (statistics == nullptr)
+  {
+    return eIasFailed;
+  }
+  IasDecoratorGuard::getStatistics(statistics);
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::getBufferPoolStatistics(std::vector<IasBufferPoolStatistics> *statistics)
+{
+  if (statistics == nullptr)
+  {
+    return eIasFailed;
+  }
+  IasAudioBufferPoolHandler::getInstance()->getStatistics(statistics);
+  return eIasOk;
+}
+
+IasIDebug::IasResult IasDebugImpl::resolveStreamProbe(const std::string &location, IasStreamProbeEntry *entry, IasStreamProbeParams *params)
+{
+  IAS_ASSERT(entry != nullptr);
+  IAS_ASSERT(params != nullptr);
+  IasConfiguration::IasResult cfgres = mConfig->getPortByName(location, &entry->port);
+  if (cfgres == IasConfiguration::eIasObjectNotFound)
+  {
+    // no port found, maybe we can find a pin?
+    cfgres = mConfig->getPinByName(location, &entry->pin);
+  }
+  if (cfgres != IasConfiguration::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Neither port or pin", location, "was found for stream recording");
+    return translate(cfgres);
+  }
+
+  if (entry->port != nullptr)
+  {
+    IasAudioPortParamsPtr portParams = entry->port->getParameters();
+    IAS_ASSERT(portParams != nullptr);
+    IasAudioPortOwnerPtr portOwner = nullptr;
+    entry->port->getOwner(&portOwner);
+    IAS_ASSERT(portOwner != nullptr);
+    params->index = portParams->index;
+    params->numChannels = portParams->numChannels;
+    params->sampleRate = portOwner->getSampleRate();
+    params->periodSize = portOwner->getPeriodSize();
+    params->dataFormat = portOwner->getSampleFormat();
+  }
+  else
+  {
+    IasPipelinePtr pipeline = entry->pin->getPipeline();
+    if (pipeline == nullptr)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Pin was not added to any pipeline, no stream recording possible");
+      return eIasFailed;
+    }
+    params->index = 0;
+    params->numChannels = entry->pin->getParameters()->numChannels;
+    params->sampleRate = pipeline->getParameters()->samplerate;
+    params->periodSize = pipeline->getParameters()->periodSize;
+    params->dataFormat = eIasFormatFloat32;
+  }
+  return eIasOk;
+}
+
+bool IasDebugImpl::isStreamNameUsed(const std::string &streamName) const
+{
+  for (auto &entry : mStreamProbes)
+  {
+    if (entry.second.streamName == streamName)
+    {
+      return true;
+    }
+  }
+  return mMultiPointProbes.find(streamName) != mMultiPointProbes.end();
+}
+
+IasIDebug::IasResult IasDebugImpl::attachStreamProbe(const IasStreamProbeEntry &entry)
+{
+  if (entry.port != nullptr)
+  {
+    IasStreamTapSlots *slots = nullptr;
+    if (getPortProbeSlots(entry.port, nullptr, &slots) == false)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Port", entry.port->getParameters()->name, "is not connected");
+      return eIasFailed;
+    }
+    slots->attach(entry.tap);
+    return eIasOk;
+  }
+  IasPipelinePtr pipeline = entry.pin->getPipeline();
+  IAS_ASSERT(pipeline != nullptr);
+  return translate(pipeline->startStreamProbe(entry.pin, entry.tap));
+}
+
+void IasDebugImpl::detachStreamProbe(const IasStreamProbeEntry &entry)
+{
+  if (entry.port != nullptr)
+  {
+    IasStreamTapSlots *slots = nullptr;
+    if (getPortProbeSlots(entry.port, nullptr, &slots) == true)
+    {
+      slots->detach();
+    }
+  }
+  else if (entry.pin != nullptr)
+  {
+    IasPipelinePtr pipeline = entry.pin->getPipeline();
+    if (pipeline != nullptr)
+    {
+      pipeline->stopStreamProbe(entry.pin);
+    }
+  }
+}
+
+bool IasDebugImpl::getPortProbeSlots(IasAudioPortPtr port, IasLatencyProbeSlots **latencySlots, IasStreamTapSlots **streamSlots)
+{
+  IAS_ASSERT(port != nullptr);
+  if (getProbeLocation(port->getParameters()) == eIasProbeSwitchMatrix)
+  {
+    IasSwitchMatrixPtr switchMatrix = getSwitchMatrix(port);
+    if (switchMatrix == nullptr)
+    {
+      return false;
+    }
+    if (latencySlots != nullptr)
+    {
+      *latencySlots = switchMatrix->getLatencyProbeSlots(port);
+      return (*latencySlots != nullptr);
+    }
+    IAS_ASSERT(streamSlots != nullptr);
+    *streamSlots = switchMatrix->getStreamTapSlots(port);
+    return (*streamSlots != nullptr);
+  }
+  IasAudioPortOwnerPtr portOwner = nullptr;
+  port->getOwner(&portOwner);
+  IAS_ASSERT(portOwner != nullptr);
+  IasRoutingZonePtr rZone = portOwner->getRoutingZone();
+  IAS_ASSERT(rZone != nullptr);
+  IasRoutingZoneWorkerThreadPtr rzWorker = rZone->getWorkerThread();
+  if (rzWorker == nullptr)
+  {
+    return false;
+  }
+  if (latencySlots != nullptr)
+  {
+    *latencySlots = &rzWorker->getLatencyProbeSlots();
+  }
+  else
+  {
+    IAS_ASSERT(streamSlots != nullptr);
+    *streamSlots = &rzWorker->getStreamTapSlots();
+  }
+  return true;
+}
+
+const void* IasDebugImpl::getProbeClockDomain(const IasStreamProbeEntry &entry)
+{
+  if (entry.pin != nullptr)
+  {
+    return entry.pin->getPipeline().get();
+  }
+  IAS_ASSERT(entry.port != nullptr);
+  if (getProbeLocation(entry.port->getParameters()) == eIasProbeSwitchMatrix)
+  {
+    return getSwitchMatrix(entry.port).get();
+  }
+  IasAudioPortOwnerPtr portOwner = nullptr;
+  entry.port->getOwner(&portOwner);
+  IAS_ASSERT(portOwner != nullptr);
+  IasRoutingZonePtr rZone = portOwner->getRoutingZone();
+  IAS_ASSERT(rZone != nullptr);
+  return rZone->getWorkerThread().get();
+}
+
+void IasDebugImpl::writeMultiPointHeader(const IasMultiPointProbePtr &multiPointProbe)
+{
+  IasMultiPointHeader header;
+  multiPointProbe->getHeader(&header);
+  std::string headerFileName = std::string(RW_TMP_PATH) + header.streamName + ".hdr";
+  std::ofstream headerFile(headerFileName, std::ios::out | std::ios::trunc);
+  if (headerFile.is_open() == false)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_WARN, LOG_PREFIX, "Could not create header file", headerFileName);
+    return;
+  }
+  headerFile << "stream=" << header.streamName << std::endl;
+  headerFile << "samplerate=" << header.sampleRate << std::endl;
+  headerFile << "channels=" << header.numChannels << std::endl;
+  headerFile << "format=float32" << std::endl;
+  headerFile << "start_time_ns=" << header.startTimeNs << std::endl;
+  for (auto &point : header.points)
+  {
+    headerFile << "point=" << point.name << "," << point.firstChannel << "," << point.numChannels << std::endl;
+  }
+}
+
+void IasDebugImpl::retireLatencyProbe()
+{
+  // The real-time threads may still hold the last probe, because they drop it only when they
+  // process the next period. Keep a reference until they did, so that it is not freed by them.
+  if (mLatencyProbe != nullptr)
+  {
+    mStoppedLatencyProbes.push_back(mLatencyProbe);
+    mLatencyProbe = nullptr;
+  }
+  releaseLatencyProbes();
+}
+
+void IasDebugImpl::releaseLatencyProbes()
+{
+  auto it = mStoppedLatencyProbes.begin();
+  while (it != mStoppedLatencyProbes.end())
+  {
+    if (it->use_count() == 1)
+    {
+      it = mStoppedLatencyProbes.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void IasDebugImpl::releaseStreamProbes()
+{
+  auto it = mStoppedStreamProbes.begin();
+  while (it != mStoppedStreamProbes.end())
+  {
+    if (it->use_count() == 1)
+    {
+      it = mStoppedStreamProbes.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
 } //namespace IasAudio
@@ -14,6 +14,14 @@
 
 namespace IasAudio {
 
+/**
+ * @brief Domains read by the probes while they look up and attach to their locations
+ *
+ * Probes of ports are attached via the tasks of the switch matrices, whose task maps are modified when the routing
+ * domain connects or disconnects ports, so the routing domain has to be locked as well.
+ */
+static const uint32_t cIasLockProbeLocations = cIasLockTopology | cIasLockPipeline | cIasLockRouting;
+
 IasDebugMutexDecorator::IasDebugMutexDecorator(IasIDebug *debug)
   :mDebug(debug)
 {
@@ -29,22 +37,95 @@ IasDebugMutexDecorator::~IasDebugMutexDecorator()
 IasIDebug::IasResult IasDebugMutexDecorator::startInject(const std::string& fileNamePrefix, const std::string& portName,
                                                         uint32_t numSeconds)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
   return mDebug->startInject(fileNamePrefix, portName, numSeconds);
 }
 
 IasIDebug::IasResult IasDebugMutexDecorator::startRecord(const std::string& fileNamePrefix, const std::string& portName,
                                                         uint32_t numSeconds)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
   return mDebug->startRecord(fileNamePrefix, portName, numSeconds);
 }
 
 IasIDebug::IasResult IasDebugMutexDecorator::stopProbing(const std::string& portName)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
   return mDebug->stopProbing(portName);
 }
 
+IasIDebug::IasResult IasDebugMutexDecorator::startLatencyProbe(const std::string& sourceName, const std::string& sinkName,
+                                                              uint32_t numMeasurements)
+{
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
+  return mDebug->startLatencyProbe(sourceName, sinkName, numMeasurements);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::getLatencyProbeResult(IasLatencyResult *result)
+{
+  const IasDecoratorGuard lk{cIasLockDebug, 0, __func__};
+  return mDebug->getLatencyProbeResult(result);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::stopLatencyProbe()
+{
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
+  return mDebug->stopLatencyProbe();
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::startStreamRecord(const std::string& streamName, const std::string& name)
+{
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
+  return mDebug->startStreamRecord(streamName, name);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::getStreamRecordStatistics(const std::string& name, IasStreamProbeStatistics *statistics)
+{
+  const IasDecoratorGuard lk{cIasLockDebug, 0, __func__};
+  return mDebug->getStreamRecordStatistics(name, statistics);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::stopStreamRecord(const std::string& name)
+{
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
+  return mDebug->stopStreamRecord(name);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::startMultiPointRecord(const std::string& streamName, const IasStringVector& names)
+{
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
+  return mDebug->startMultiPointRecord(streamName, names);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::getMultiPointRecordHeader(const std::string& streamName, IasMultiPointHeader *header)
+{
+  const IasDecoratorGuard lk{cIasLockDebug, 0, __func__};
+  return mDebug->getMultiPointRecordHeader(streamName, header);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::getMultiPointRecordStatistics(const std::string& streamName, IasStreamProbeStatistics *statistics)
+{
+  const IasDecoratorGuard lk{cIasLockDebug, 0, __func__};
+  return mDebug->getMultiPointRecordStatistics(streamName, statistics);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::stopMultiPointRecord(const std::string& streamName)
+{
+  const IasDecoratorGuard lk{cIasLockProbeLocations, cIasLockDebug, __func__};
+  return mDebug->stopMultiPointRecord(streamName);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::getLockStatistics(std::vector<IasLockStatistics> *statistics)
+{
+  // The statistics are atomic counters, locking a domain would only distort them.
+  return mDebug->getLockStatistics(statistics);
+}
+
+IasIDebug::IasResult IasDebugMutexDecorator::getBufferPoolStatistics(std::vector<IasBufferPoolStatistics> *statistics)
+{
+  // The buffer pools are lock-free and independent of the topology.
+  return mDebug->getBufferPoolStatistics(statistics);
+}
+
 } /* namespace IasAudio */
 
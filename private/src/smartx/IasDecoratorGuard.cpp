@@ -10,21 +10,135 @@
  */
 
 
+#include <ctime>
 #include <smartx/IasDecoratorGuard.hpp>
+#include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 
 namespace IasAudio {
 
+static const std::string cClassName = "IasDecoratorGuard::";
+#define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
 
-IasDecoratorGuard::IasDecoratorGuard() :
-  std::lock_guard<std::mutex>(mMutexDecorator)
+static const uint64_t cIasLongLockHoldTimeNs = 20000000;   // 20 ms
+
+static const char* const cIasLockDomainNames[eIasLockDomainLast] =
+{
+  "topology",
+  "pipeline",
+  "routing",
+  "debug",
+};
+
+static uint64_t getMonotonicTimeNs()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void updateMax(std::atomic<uint64_t> &maxValue, uint64_t value)
+{
+  uint64_t current = maxValue.load(std::memory_order_relaxed);
+  while (value > current && !maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+
+IasDecoratorGuard::IasDomainLock::IasDomainLock()
+  :numShared(0)
+  ,numExclusive(0)
+  ,totalWaitTimeNs(0)
+  ,maxWaitTimeNs(0)
+  ,totalHoldTimeNs(0)
+  ,maxHoldTimeNs(0)
 {
+  pthread_rwlock_init(&rwLock, nullptr);
+}
+
+IasDecoratorGuard::IasDomainLock::~IasDomainLock()
+{
+  pthread_rwlock_destroy(&rwLock);
+}
+
+
+IasDecoratorGuard::IasDecoratorGuard(uint32_t sharedDomains, uint32_t exclusiveDomains, const char *name)
+  :mLockedDomains(sharedDomains | exclusiveDomains)
+  ,mAcquiredNs()
+  ,mName(name)
+{
+  for (uint32_t domain = 0; domain < eIasLockDomainLast; ++domain)
+  {
+    uint32_t mask = 1u << domain;
+    if ((mLockedDomains & mask) == 0)
+    {
+      continue;
+    }
+    IasDomainLock &domainLock = mDomainLocks[domain];
+    uint64_t startNs = getMonotonicTimeNs();
+    if ((exclusiveDomains & mask) != 0)
+    {
+      pthread_rwlock_wrlock(&domainLock.rwLock);
+      domainLock.numExclusive.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+      pthread_rwlock_rdlock(&domainLock.rwLock);
+      domainLock.numShared.fetch_add(1, std::memory_order_relaxed);
+    }
+    mAcquiredNs[domain] = getMonotonicTimeNs();
+    uint64_t waitTimeNs = mAcquiredNs[domain] - startNs;
+    domainLock.totalWaitTimeNs.fetch_add(waitTimeNs, std::memory_order_relaxed);
+    updateMax(domainLock.maxWaitTimeNs, waitTimeNs);
+  }
 }
 
 IasDecoratorGuard::~IasDecoratorGuard()
 {
+  uint64_t releasedNs = getMonotonicTimeNs();
+  // Unlock in the reverse order of locking.
+  for (int32_t domain = eIasLockDomainLast - 1; domain >= 0; --domain)
+  {
+    if ((mLockedDomains & (1u << domain)) == 0)
+    {
+      continue;
+    }
+    IasDomainLock &domainLock = mDomainLocks[domain];
+    pthread_rwlock_unlock(&domainLock.rwLock);
+    uint64_t holdTimeNs = releasedNs - mAcquiredNs[domain];
+    domainLock.totalHoldTimeNs.fetch_add(holdTimeNs, std::memory_order_relaxed);
+    updateMax(domainLock.maxHoldTimeNs, holdTimeNs);
+    if (holdTimeNs > cIasLongLockHoldTimeNs)
+    {
+      DltContext *log = IasAudioLogging::getDltContext("SMX");
+      DLT_LOG_CXX(*log, DLT_LOG_WARN, LOG_PREFIX, mName, "held the", cIasLockDomainNames[domain], "lock for", holdTimeNs / 1000, "us");
+    }
+  }
+}
+
+void IasDecoratorGuard::getStatistics(std::vector<IasIDebug::IasLockStatistics> *statistics)
+{
+  if (statistics == nullptr)
+  {
+    return;
+  }
+  statistics->clear();
+  for (uint32_t domain = 0; domain < eIasLockDomainLast; ++domain)
+  {
+    const IasDomainLock &domainLock = mDomainLocks[domain];
+    IasIDebug::IasLockStatistics domainStatistics;
+    domainStatistics.domain = cIasLockDomainNames[domain];
+    domainStatistics.numShared = domainLock.numShared.load(std::memory_order_relaxed);
+    domainStatistics.numExclusive = domainLock.numExclusive.load(std::memory_order_relaxed);
+    domainStatistics.totalWaitTimeNs = domainLock.totalWaitTimeNs.load(std::memory_order_relaxed);
+    domainStatistics.maxWaitTimeNs = domainLock.maxWaitTimeNs.load(std::memory_order_relaxed);
+    domainStatistics.totalHoldTimeNs = domainLock.totalHoldTimeNs.load(std::memory_order_relaxed);
+    domainStatistics.maxHoldTimeNs = domainLock.maxHoldTimeNs.load(std::memory_order_relaxed);
+    statistics->push_back(domainStatistics);
+  }
 }
 
 
-std::mutex IasDecoratorGuard::mMutexDecorator;
+IasDecoratorGuard::IasDomainLock IasDecoratorGuard::mDomainLocks[eIasLockDomainLast];
 
 } //namespace IasAudio
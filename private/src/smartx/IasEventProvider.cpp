@@ -9,10 +9,19 @@
  * @brief
  */
 
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "audio/smartx/IasConnectionEvent.hpp"
 #include "audio/smartx/IasSetupEvent.hpp"
 #include "audio/smartx/rtprocessingfwx/IasModuleEvent.hpp"
+#include "smartx/IasEventPool.hpp"
+#include "smartx/IasRtLog.hpp"
 
 #include "audio/smartx/IasEventProvider.hpp"
 
@@ -21,19 +30,95 @@ namespace IasAudio {
 static const std::string cClassName = "IasEventProvider::";
 #define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
 
+/**
+ * @brief Log via the log ring of a registered real-time thread, or directly via DLT from all other threads
+ */
+#define EVENT_LOG(level, ...)                                     \
+  if (IasRtLog::isThreadRegistered())                             \
+  {                                                               \
+    IAS_RT_LOG(*mLog, level, __VA_ARGS__);                        \
+  }                                                               \
+  else                                                            \
+  {                                                               \
+    DLT_LOG_CXX(*mLog, level, LOG_PREFIX, __VA_ARGS__);           \
+  }
+
+static const uint32_t cNumConnectionEvents = 64;   //!< Number of preallocated connection events
+static const uint32_t cNumSetupEvents = 32;        //!< Number of preallocated setup events
+static const uint32_t cNumModuleEvents = 32;       //!< Number of preallocated module events
+
+/**
+ * @brief Combine a value into an event key
+ */
+static void combineKey(uint64_t &key, uint64_t value)
+{
+  key ^= value + 0x9e3779b97f4a7c15ULL + (key << 6) + (key >> 2);
+}
+
+/**
+ * @brief State of the calling thread for the coalescing of identical events
+ */
+struct IasSenderState
+{
+  bool       isValid;     //!< True if the thread already sent an event that can be coalesced
+  uint64_t   lastKey;     //!< Key of the previous event sent by the thread
+  uint64_t   lastIndex;   //!< Queue index of the previous event sent by the thread
+};
+
+static thread_local IasSenderState tSenderState = {false, 0, 0};
+
+static void resetConnectionEvent(IasConnectionEvent &event)
+{
+  event.setEventType(IasConnectionEvent::eIasUninitialized);
+  event.setSourceId(-1);
+  event.setSinkId(-1);
+}
+
+static void resetSetupEvent(IasSetupEvent &event)
+{
+  event.setEventType(IasSetupEvent::eIasUninitialized);
+  event.setSourceDevice(nullptr);
+  event.setSinkDevice(nullptr);
+}
+
+static void resetModuleEvent(IasModuleEvent &event)
+{
+  // The properties of module events allocate memory anyway, so releasing them cannot avoid freeing memory.
+  static const IasProperties cEmptyProperties;
+  event.setProperties(cEmptyProperties);
+}
+
 IasEventProvider::IasEventProvider()
   :mLog(IasAudioLogging::registerDltContext("EVT", "SmartX Events"))
+  ,mConnectionEventPool(new IasEventPool<IasConnectionEvent>(cNumConnectionEvents, resetConnectionEvent))
+  ,mSetupEventPool(new IasEventPool<IasSetupEvent>(cNumSetupEvents, resetSetupEvent))
+  ,mModuleEventPool(new IasEventPool<IasModuleEvent>(cNumModuleEvents, resetModuleEvent))
   ,mEventQueue()
-  ,mMutex()
-  ,mCondition()
-  ,mNrEvents(0)
+  ,mEventFd(eventfd(0, EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC))
+  ,mNumQueued(0)
+  ,mNumFetched(0)
+  ,mFetchedIndexEnd(0)
+  ,mNumCoalesced(0)
 {
+  if (mEventFd < 0)
+  {
+    /**
+     * @log The eventfd to signal new events could not be created, waitForEvent will always run into the timeout.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error creating eventfd:", strerror(errno));
+  }
   DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Event provider singleton created");
 }
 
 IasEventProvider::~IasEventProvider()
 {
-  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Event provider singleton destroyed");
+  if (mEventFd >= 0)
+  {
+    close(mEventFd);
+  }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Event provider singleton destroyed, coalesced events=", mNumCoalesced.load(),
+              "pool fallbacks connection/setup/module=", mConnectionEventPool->getNumFallbacks(), mSetupEventPool->getNumFallbacks(),
+              mModuleEventPool->getNumFallbacks());
 }
 
 IasEventProvider* IasEventProvider::getInstance()
@@ -44,75 +129,168 @@ IasEventProvider* IasEventProvider::getInstance()
 
 void IasEventProvider::clearEventQueue()
 {
-  mEventQueue.clear();
-  mNrEvents = 0;
+  IasEventQueueEntry entry;
+  while (mEventQueue.try_pop(entry))
+  {
+    markFetched(entry.index);
+  }
+  // Reset the eventfd counter. In semaphore mode each read decrements it by one.
+  uint64_t value;
+  while ((mEventFd >= 0) && (read(mEventFd, &value, sizeof(value)) == sizeof(value)))
+  {
+  }
+}
+
+uint64_t IasEventProvider::getNumCoalescedEvents() const
+{
+  return mNumCoalesced.load(std::memory_order_relaxed);
 }
 
 IasConnectionEventPtr IasEventProvider::createConnectionEvent()
 {
-  return std::make_shared<IasConnectionEvent>();
+  return mConnectionEventPool->create();
 }
 
 void IasEventProvider::destroyConnectionEvent(IasConnectionEventPtr event)
 {
-  // Nothing to do here currently. However this method can be useful when switching from shared_ptr to
-  // normal pointer and using the boost pool implementation for efficient handling of events
+  // The event is returned to the pool as soon as the last reference is dropped.
   event = nullptr;
 }
 
 IasSetupEventPtr IasEventProvider::createSetupEvent()
 {
-  return std::make_shared<IasSetupEvent>();
+  return mSetupEventPool->create();
 }
 
 void IasEventProvider::destroySetupEvent(IasSetupEventPtr event)
 {
-  // Nothing to do here currently. However this method can be useful when switching from shared_ptr to
-  // normal pointer and using the boost pool implementation for efficient handling of events
+  // The event is returned to the pool as soon as the last reference is dropped.
   event = nullptr;
 }
 
 IasModuleEventPtr IasEventProvider::createModuleEvent()
 {
-  return std::make_shared<IasModuleEvent>();
+  return mModuleEventPool->create();
 }
 
 void IasEventProvider::destroyModuleEvent(IasModuleEventPtr event)
 {
-  // Nothing to do here currently. However this method can be useful when switching from shared_ptr to
-  // normal pointer and using the boost pool implementation for efficient handling of events
+  // The event is returned to the pool as soon as the last reference is dropped.
   event = nullptr;
 }
 
+uint64_t IasEventProvider::getEventKey(const IasEventPtr &event)
+{
+  uint64_t key = 0;
+  if (IasConnectionEvent *connectionEvent = dynamic_cast<IasConnectionEvent*>(event.get()))
+  {
+    key = 1;
+    combineKey(key, static_cast<uint64_t>(connectionEvent->getEventType()));
+    combineKey(key, static_cast<uint64_t>(connectionEvent->getSourceId()));
+    combineKey(key, static_cast<uint64_t>(connectionEvent->getSinkId()));
+  }
+  else if (IasSetupEvent *setupEvent = dynamic_cast<IasSetupEvent*>(event.get()))
+  {
+    key = 2;
+    combineKey(key, static_cast<uint64_t>(setupEvent->getEventType()));
+    combineKey(key, reinterpret_cast<uintptr_t>(setupEvent->getSourceDevice().get()));
+    combineKey(key, reinterpret_cast<uintptr_t>(setupEvent->getSinkDevice().get()));
+  }
+  else if (IasModuleEvent *moduleEvent = dynamic_cast<IasModuleEvent*>(event.get()))
+  {
+    key = 3;
+    combineKey(key, moduleEvent->getProperties().getHash());
+  }
+  return key;
+}
+
+void IasEventProvider::markFetched(uint64_t index)
+{
+  // Events of different threads can be fetched in a different order than their indices were taken,
+  // so only ever move the end of the fetched indices forward.
+  uint64_t end = mFetchedIndexEnd.load(std::memory_order_relaxed);
+  while ((end <= index) && (mFetchedIndexEnd.compare_exchange_weak(end, index + 1, std::memory_order_release) == false))
+  {
+  }
+  mNumFetched.fetch_add(1, std::memory_order_relaxed);
+}
+
 void IasEventProvider::send(IasEventPtr event)
 {
-  mEventQueue.push(event);
+  if (event == nullptr)
+  {
+    /**
+     * @log The event to be sent is a nullptr.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "event == nullptr");
+    return;
+  }
+  // Events of unknown type have the key 0 and are never coalesced.
+  uint64_t key = getEventKey(event);
+  // The previous event of this thread is still in the queue as long as no event with the same or a higher index was fetched.
+  // While several threads send at the same time, an event can be taken as fetched too early, so it is sent once more,
+  // but a fetched event is never taken as queued.
+  if ((key != 0) && (tSenderState.isValid == true) && (tSenderState.lastKey == key) &&
+      (mFetchedIndexEnd.load(std::memory_order_acquire) <= tSenderState.lastIndex))
+  {
+    mNumCoalesced.fetch_add(1, std::memory_order_relaxed);
+    EVENT_LOG(DLT_LOG_VERBOSE, "Identical event still in queue, event dropped");
+    return;
+  }
+  IasEventQueueEntry entry;
+  entry.event = std::move(event);
+  entry.index = mNumQueued.fetch_add(1, std::memory_order_relaxed);
+  mEventQueue.push(entry);
+  tSenderState.isValid = (key != 0);
+  tSenderState.lastKey = key;
+  tSenderState.lastIndex = entry.index;
 
-  // Keep the lock only inside this scope
+  if (mEventFd >= 0)
   {
-    std::lock_guard<std::mutex> lk(mMutex);
-    mNrEvents++;
+    uint64_t value = 1;
+    if (write(mEventFd, &value, sizeof(value)) != sizeof(value))
+    {
+      EVENT_LOG(DLT_LOG_ERROR, "Error signaling new event:", errno);
+    }
   }
-  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Event put into queue");
-  mCondition.notify_one();
+  EVENT_LOG(DLT_LOG_INFO, "Event put into queue");
 }
 
 IasEventProvider::IasResult IasEventProvider::waitForEvent(uint32_t timeout)
 {
-  std::unique_lock<std::mutex> lk(mMutex);
   DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Waiting for event");
-  bool isEventReceived = mCondition.wait_for(lk, std::chrono::milliseconds(timeout), [this] { return mNrEvents != 0; });
-  if (isEventReceived == true)
-  {
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Event received. Nr events in queue=", mNrEvents);
-    mNrEvents--;
-    return eIasOk;
-  }
-  else
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+  int32_t remaining = static_cast<int32_t>(timeout);
+  while (true)
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Timeout while waiting for events", mNrEvents);
-    return eIasTimeout;
+    struct pollfd pollFd;
+    pollFd.fd = mEventFd;
+    pollFd.events = POLLIN;
+    pollFd.revents = 0;
+    int32_t result = poll(&pollFd, 1, remaining);
+    if (result > 0)
+    {
+      uint64_t value;
+      if (read(mEventFd, &value, sizeof(value)) == sizeof(value))
+      {
+        DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Event received. Nr events in queue=", mNumQueued.load() - mNumFetched.load());
+        return eIasOk;
+      }
+      // Another thread waiting for events was faster, so wait for the remaining time.
+    }
+    else if ((result == 0) || (errno != EINTR))
+    {
+      break;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now >= deadline)
+    {
+      break;
+    }
+    remaining = static_cast<int32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count());
   }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Timeout while waiting for events", mNumQueued.load() - mNumFetched.load());
+  return eIasTimeout;
 }
 
 IasEventProvider::IasResult IasEventProvider::getNextEvent(IasEventPtr* event)
@@ -125,11 +303,12 @@ IasEventProvider::IasResult IasEventProvider::getNextEvent(IasEventPtr* event)
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "event == nullptr");
     return eIasFailed;
   }
-  IasEventPtr eventPtr;
-  if (mEventQueue.try_pop(eventPtr))
+  IasEventQueueEntry entry;
+  if (mEventQueue.try_pop(entry))
   {
+    markFetched(entry.index);
     DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Event removed from event queue");
-    *event = eventPtr;
+    *event = std::move(entry.event);
     return eIasOk;
   }
   else
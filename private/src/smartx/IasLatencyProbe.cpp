@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasLatencyProbe.cpp
+ * @date   2018
+ * @brief  Latency measurement by injection and detection of an in-band marker.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include "smartx/IasLatencyProbe.hpp"
+
+namespace IasAudio {
+
+static const float    cMarkerAmplitude = 0.99f;   //!< Amplitude of the injected impulse
+static const float    cDetectThreshold = 0.05f;   //!< Detection threshold, approx. -26 dBFS
+static const uint32_t cHoldOffMs       = 250;     //!< Time to let the path settle after a detection
+static const uint32_t cTimeoutMs       = 1000;    //!< Time after which a marker is considered lost
+
+static inline void* getSampleAddress(const IasAudioArea &area, uint32_t frame)
+{
+  return static_cast<char*>(area.start) + ((area.first + frame * area.step) >> 3);
+}
+
+static inline float readSample(const IasAudioArea &area, IasAudioCommonDataFormat dataFormat, uint32_t frame)
+{
+  void *address = getSampleAddress(area, frame);
+  switch (dataFormat)
+  {
+    case eIasFormatFloat32:
+      return *static_cast<float*>(address);
+    case eIasFormatInt16:
+      return static_cast<float>(*static_cast<int16_t*>(address)) * (1.0f / 32768.0f);
+    case eIasFormatInt32:
+      return static_cast<float>(*static_cast<int32_t*>(address)) * (1.0f / 2147483648.0f);
+    default:
+      return 0.0f;
+  }
+}
+
+static inline void writeSample(const IasAudioArea &area, IasAudioCommonDataFormat dataFormat, uint32_t frame, float value)
+{
+  void *address = getSampleAddress(area, frame);
+  switch (dataFormat)
+  {
+    case eIasFormatFloat32:
+      *static_cast<float*>(address) = value;
+      break;
+    case eIasFormatInt16:
+      *static_cast<int16_t*>(address) = static_cast<int16_t>(value * 32767.0f);
+      break;
+    case eIasFormatInt32:
+      *static_cast<int32_t*>(address) = static_cast<int32_t>(static_cast<double>(value) * 2147483647.0);
+      break;
+    default:
+      break;
+  }
+}
+
+IasLatencyProbe::IasLatencyProbe(const IasLatencyProbeParams &params)
+  :mParams(params)
+  ,mHoldOffFrames(params.injectSampleRate * cHoldOffMs / 1000)
+  ,mTimeoutFrames(params.injectSampleRate * cTimeoutMs / 1000)
+  ,mFrameCounter(0)
+  ,mInjectTimeNs(0)
+  ,mState(eIasMarkerIdle)
+  ,mNumMissed(0)
+  ,mNumMeasurements(0)
+  ,mLatencies(params.numMeasurements, 0.0f)
+{
+}
+
+IasLatencyProbe::~IasLatencyProbe()
+{
+}
+
+int64_t IasLatencyProbe::getTimeNs() const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool IasLatencyProbe::isFinished() const
+{
+  return (mNumMeasurements.load(std::memory_order_acquire) + mNumMissed.load(std::memory_order_relaxed)) >= mParams.numMeasurements;
+}
+
+void IasLatencyProbe::inject(IasAudioArea *areas, IasAudioCommonDataFormat dataFormat,
+                             uint32_t offset, uint32_t numFrames, uint32_t numFramesAvailable)
+{
+  if (areas == nullptr || numFrames == 0)
+  {
+    return;
+  }
+
+  uint32_t state = mState.load(std::memory_order_acquire);
+  if (state == eIasMarkerDetected)
+  {
+    mFrameCounter = 0;
+    mState.store(eIasMarkerIdle, std::memory_order_relaxed);
+    state = eIasMarkerIdle;
+  }
+
+  if (state == eIasMarkerInFlight)
+  {
+    mFrameCounter += numFrames;
+    if (mFrameCounter >= mTimeoutFrames)
+    {
+      uint32_t expected = eIasMarkerInFlight;
+      if (mState.compare_exchange_strong(expected, eIasMarkerIdle, std::memory_order_acq_rel))
+      {
+        mNumMissed.fetch_add(1, std::memory_order_relaxed);
+        mFrameCounter = 0;
+      }
+    }
+    return;
+  }
+
+  if (isFinished() == true)
+  {
+    return;
+  }
+
+  // Idle: wait until the hold-off time elapsed, then place the marker into this block.
+  uint32_t framePos = 0;
+  if (mFrameCounter < mHoldOffFrames)
+  {
+    uint32_t missing = mHoldOffFrames - mFrameCounter;
+    if (missing >= numFrames)
+    {
+      mFrameCounter += numFrames;
+      return;
+    }
+    framePos = missing;
+  }
+
+  for (uint32_t chan = 0; chan < mParams.injectNumChannels; ++chan)
+  {
+    writeSample(areas[mParams.injectIndex + chan], dataFormat, offset + framePos, cMarkerAmplitude);
+  }
+
+  // The oldest frame of the buffer is read first, so the marker position was written
+  // (numFramesAvailable - framePos) frames ago by the producer of the source buffer.
+  uint32_t framesInBuffer = (numFramesAvailable > framePos) ? (numFramesAvailable - framePos) : 0;
+  mInjectTimeNs = getTimeNs() - static_cast<int64_t>(framesInBuffer) * 1000000000LL / mParams.injectSampleRate;
+  mFrameCounter = numFrames - framePos;
+  mState.store(eIasMarkerInFlight, std::memory_order_release);
+}
+
+void IasLatencyProbe::detect(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat,
+                             uint32_t offset, uint32_t numFrames, uint32_t numFramesQueued)
+{
+  if (areas == nullptr || mState.load(std::memory_order_acquire) != eIasMarkerInFlight)
+  {
+    return;
+  }
+  for (uint32_t frame = 0; frame < numFrames; ++frame)
+  {
+    for (uint32_t chan = 0; chan < mParams.detectNumChannels; ++chan)
+    {
+      if (std::fabs(readSample(areas[mParams.detectIndex + chan], dataFormat, offset + frame)) >= cDetectThreshold)
+      {
+        markerDetected(frame, numFramesQueued);
+        return;
+      }
+    }
+  }
+}
+
+void IasLatencyProbe::detect(const IasAudioFrame &audioFrame, uint32_t stride, uint32_t numFrames)
+{
+  if (mState.load(std::memory_order_acquire) != eIasMarkerInFlight)
+  {
+    return;
+  }
+  const uint32_t numChannels = std::min(mParams.detectNumChannels, static_cast<uint32_t>(audioFrame.size()));
+  for (uint32_t frame = 0; frame < numFrames; ++frame)
+  {
+    for (uint32_t chan = 0; chan < numChannels; ++chan)
+    {
+      if (std::fabs(audioFrame[chan][frame * stride]) >= cDetectThreshold)
+      {
+        markerDetected(frame, 0);
+        return;
+      }
+    }
+  }
+}
+
+void IasLatencyProbe::markerDetected(uint32_t framePos, uint32_t numFramesQueued)
+{
+  // The inject time is stable as long as the marker is in flight, so read it before taking ownership.
+  const int64_t injectTimeNs = mInjectTimeNs;
+  uint32_t expected = eIasMarkerInFlight;
+  if (mState.compare_exchange_strong(expected, eIasMarkerDetected, std::memory_order_acq_rel) == false)
+  {
+    return;
+  }
+  const int64_t leaveTimeNs = getTimeNs() + static_cast<int64_t>(framePos + numFramesQueued) * 1000000000LL / mParams.detectSampleRate;
+  const uint32_t index = mNumMeasurements.load(std::memory_order_relaxed);
+  if (index < mLatencies.size())
+  {
+    mLatencies[index] = static_cast<float>(leaveTimeNs - injectTimeNs) / 1000.0f;
+    mNumMeasurements.store(index + 1, std::memory_order_release);
+  }
+}
+
+void IasLatencyProbe::getResult(IasIDebug::IasLatencyResult *result) const
+{
+  if (result == nullptr)
+  {
+    return;
+  }
+  *result = IasIDebug::IasLatencyResult();
+  const uint32_t numMeasurements = mNumMeasurements.load(std::memory_order_acquire);
+  result->numMeasurements = numMeasurements;
+  result->numMissed = mNumMissed.load(std::memory_order_relaxed);
+  result->isFinished = isFinished();
+  if (numMeasurements == 0)
+  {
+    return;
+  }
+
+  double sum = 0.0;
+  float minUs = std::numeric_limits<float>::max();
+  float maxUs = 0.0f;
+  for (uint32_t i = 0; i < numMeasurements; ++i)
+  {
+    sum += mLatencies[i];
+    minUs = std::min(minUs, mLatencies[i]);
+    maxUs = std::max(maxUs, mLatencies[i]);
+  }
+  const double mean = sum / numMeasurements;
+  double variance = 0.0;
+  for (uint32_t i = 0; i < numMeasurements; ++i)
+  {
+    variance += (mLatencies[i] - mean) * (mLatencies[i] - mean);
+  }
+  variance /= numMeasurements;
+
+  const float framesPerUs = static_cast<float>(mParams.detectSampleRate) / 1000000.0f;
+  result->minUs = minUs;
+  result->maxUs = maxUs;
+  result->meanUs = static_cast<float>(mean);
+  result->jitterUs = static_cast<float>(std::sqrt(variance));
+  result->minFrames = minUs * framesPerUs;
+  result->maxFrames = maxUs * framesPerUs;
+  result->meanFrames = static_cast<float>(mean) * framesPerUs;
+  result->jitterFrames = result->jitterUs * framesPerUs;
+}
+
+} // namespace IasAudio
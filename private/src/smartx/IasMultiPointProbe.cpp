@@ -0,0 +1,399 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasMultiPointProbe.cpp
+ * @date   2018
+ * @brief  Simultaneous recording of several ports and pins into one sample aligned multi-channel stream.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+#include "smartx/IasMultiPointProbe.hpp"
+#include "smartx/IasStreamProbe.hpp"
+#include "smartx/IasThreadNames.hpp"
+#include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
+#include "avbaudiomodules/internal/audio/common/helper/IasCopyAudioAreaBuffers.hpp"
+
+namespace IasAudio {
+
+static const std::string cClassName = "IasMultiPointProbe::";
+#define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
+#define LOG_STREAM "stream=" + mStreamName + ":"
+
+static const uint32_t cTapCapacityMs = 1000;    //!< Capacity of the FIFO of each tap
+static const uint32_t cMaxTapDelayMs = 500;     //!< Time after which a tap without data is filled with silence
+
+static inline int64_t getTimeNs()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+IasMultiPointTap::IasMultiPointTap(const std::string &name, uint32_t index, uint32_t numChannels, uint32_t capacity,
+                                   IasMultiPointClockPtr clock)
+  :mName(name)
+  ,mIndex(index)
+  ,mNumChannels(numChannels)
+  ,mCapacity(capacity)
+  ,mFifo(capacity * numChannels, 0.0f)
+  ,mFifoAreas(numChannels)
+  ,mFrameAreas(numChannels)
+  ,mClock(clock)
+  ,mStartTimeNs(0)
+  ,mSampleRate(0)
+  ,mPendingGap(0)
+  ,mWritePos(0)
+  ,mReadPos(0)
+  ,mStartFrame(0)
+  ,mIsStarted(false)
+  ,mNumFramesDropped(0)
+  ,mNumOverruns(0)
+{
+  for (uint32_t chan = 0; chan < mNumChannels; ++chan)
+  {
+    mFifoAreas[chan].start = mFifo.data();
+    mFifoAreas[chan].first = static_cast<uint32_t>(chan * 8 * sizeof(float));          // expressed in bits
+    mFifoAreas[chan].step  = static_cast<uint32_t>(mNumChannels * 8 * sizeof(float));  // expressed in bits
+    mFifoAreas[chan].index = chan;
+    mFifoAreas[chan].maxIndex = mNumChannels - 1;
+  }
+}
+
+IasMultiPointTap::~IasMultiPointTap()
+{
+}
+
+void IasMultiPointTap::setTimeBase(int64_t startTimeNs, uint32_t sampleRate)
+{
+  mStartTimeNs = startTimeNs;
+  mSampleRate = sampleRate;
+}
+
+void IasMultiPointTap::write(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t firstChannel,
+                             uint64_t writePos, uint32_t numFrames)
+{
+  // Split the access at the wrap-around of the FIFO.
+  uint32_t fifoOffset = static_cast<uint32_t>(writePos % mCapacity);
+  uint32_t numFramesRemaining = numFrames;
+  while (numFramesRemaining > 0)
+  {
+    const uint32_t numFramesChunk = std::min(numFramesRemaining, mCapacity - fifoOffset);
+    if (areas == nullptr)
+    {
+      zeroAudioAreaBuffers(mFifoAreas.data(), eIasFormatFloat32, fifoOffset, mNumChannels, 0, numFramesChunk);
+    }
+    else
+    {
+      copyAudioAreaBuffers(mFifoAreas.data(), eIasFormatFloat32, fifoOffset, mNumChannels, 0, numFramesChunk,
+                           areas, dataFormat, offset, mNumChannels, firstChannel, numFramesChunk);
+      offset += numFramesChunk;
+    }
+    numFramesRemaining -= numFramesChunk;
+    fifoOffset = 0;
+  }
+}
+
+void IasMultiPointTap::process(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t numFrames)
+{
+  append(areas, dataFormat, offset, mIndex, numFrames);
+}
+
+void IasMultiPointTap::append(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t firstChannel, uint32_t numFrames)
+{
+  if (areas == nullptr || numFrames == 0 || mSampleRate == 0)
+  {
+    return;
+  }
+  if (mIsStarted.load(std::memory_order_relaxed) == false)
+  {
+    int64_t startFrame = (getTimeNs() - mStartTimeNs) * static_cast<int64_t>(mSampleRate) / 1000000000LL;
+    if (mClock != nullptr)
+    {
+      // The first tap of the clock domain defines its time base, the others start a whole number of blocks later.
+      int64_t clockStartFrame = IasMultiPointClock::cStartFrameUndefined;
+      if (mClock->startFrame.compare_exchange_strong(clockStartFrame, startFrame) == true)
+      {
+        clockStartFrame = startFrame;
+      }
+      const int64_t blockSize = static_cast<int64_t>(numFrames);
+      const int64_t distance = startFrame - clockStartFrame;
+      const int64_t numBlocks = (distance >= 0) ? ((distance + blockSize / 2) / blockSize) : -((blockSize / 2 - distance) / blockSize);
+      startFrame = clockStartFrame + numBlocks * blockSize;
+    }
+    mStartFrame.store(startFrame, std::memory_order_relaxed);
+    mIsStarted.store(true, std::memory_order_release);
+  }
+
+  uint64_t writePos = mWritePos.load(std::memory_order_relaxed);
+  uint64_t numFramesFree = mCapacity - (writePos - mReadPos.load(std::memory_order_acquire));
+
+  // Replace frames that were dropped before by silence to keep the alignment of the following data.
+  if (mPendingGap > 0)
+  {
+    const uint32_t numFramesSilence = static_cast<uint32_t>(std::min(mPendingGap, numFramesFree));
+    write(nullptr, eIasFormatFloat32, 0, 0, writePos, numFramesSilence);
+    writePos += numFramesSilence;
+    numFramesFree -= numFramesSilence;
+    mPendingGap -= numFramesSilence;
+  }
+  if (mPendingGap > 0 || numFramesFree < numFrames)
+  {
+    if (mPendingGap == 0)
+    {
+      mNumOverruns.fetch_add(1, std::memory_order_relaxed);
+    }
+    mPendingGap += numFrames;
+    mNumFramesDropped.fetch_add(numFrames, std::memory_order_relaxed);
+  }
+  else
+  {
+    write(areas, dataFormat, offset, firstChannel, writePos, numFrames);
+    writePos += numFrames;
+  }
+  mWritePos.store(writePos, std::memory_order_release);
+}
+
+void IasMultiPointTap::process(const IasAudioFrame &audioFrame, uint32_t stride, uint32_t numFrames)
+{
+  if (audioFrame.size() < mNumChannels)
+  {
+    return;
+  }
+  for (uint32_t chan = 0; chan < mNumChannels; ++chan)
+  {
+    mFrameAreas[chan].start = audioFrame[chan];
+    mFrameAreas[chan].first = 0;
+    mFrameAreas[chan].step = static_cast<uint32_t>(8 * sizeof(float) * stride); // expressed in bits
+    mFrameAreas[chan].index = chan;
+    mFrameAreas[chan].maxIndex = mNumChannels - 1;
+  }
+  append(mFrameAreas.data(), eIasFormatFloat32, 0, 0, numFrames);
+}
+
+bool IasMultiPointTap::getHorizon(int64_t *horizon) const
+{
+  if (mIsStarted.load(std::memory_order_acquire) == false)
+  {
+    return false;
+  }
+  *horizon = mStartFrame.load(std::memory_order_relaxed) + static_cast<int64_t>(mWritePos.load(std::memory_order_acquire));
+  return true;
+}
+
+void IasMultiPointTap::read(float *dest, uint32_t destNumChannels, uint32_t destFirstChannel, int64_t captureFrame, uint32_t numFrames)
+{
+  const bool isStarted = mIsStarted.load(std::memory_order_acquire);
+  const uint64_t writePos = mWritePos.load(std::memory_order_acquire);
+  uint64_t readPos = mReadPos.load(std::memory_order_relaxed);
+  int64_t tapFrame = isStarted ? (mStartFrame.load(std::memory_order_relaxed) + static_cast<int64_t>(readPos)) : std::numeric_limits<int64_t>::max();
+
+  // Discard data that belongs to frames that were already merged without this tap.
+  if (tapFrame < captureFrame)
+  {
+    const uint64_t numFramesSkip = std::min(writePos - readPos, static_cast<uint64_t>(captureFrame - tapFrame));
+    readPos += numFramesSkip;
+    tapFrame += static_cast<int64_t>(numFramesSkip);
+  }
+
+  for (uint32_t frame = 0; frame < numFrames; ++frame)
+  {
+    float *destFrame = dest + frame * destNumChannels + destFirstChannel;
+    if ((captureFrame + frame < tapFrame) || (readPos >= writePos))
+    {
+      std::memset(destFrame, 0, mNumChannels * sizeof(float));
+    }
+    else
+    {
+      std::memcpy(destFrame, &mFifo[(readPos % mCapacity) * mNumChannels], mNumChannels * sizeof(float));
+      readPos++;
+      tapFrame++;
+    }
+  }
+  mReadPos.store(readPos, std::memory_order_release);
+}
+
+
+IasMultiPointProbe::IasMultiPointProbe(const std::string &streamName, uint32_t sampleRate, uint32_t blockSize)
+  :mLog(IasAudioLogging::registerDltContext("DBG", "SmartX Debug"))
+  ,mStreamName(streamName)
+  ,mSampleRate(sampleRate)
+  ,mBlockSize(blockSize)
+  ,mNumChannels(0)
+  ,mTaps()
+  ,mClocks()
+  ,mOutput(nullptr)
+  ,mBlockBuffer()
+  ,mBlockAreas()
+  ,mStartTimeNs(0)
+  ,mCaptureFrame(0)
+  ,mMergerThread(nullptr)
+  ,mIsRunning(false)
+{
+}
+
+IasMultiPointProbe::~IasMultiPointProbe()
+{
+  stop();
+}
+
+IasStreamTapPtr IasMultiPointProbe::addTap(const std::string &name, uint32_t index, uint32_t numChannels, const void *clockDomain)
+{
+  IAS_ASSERT(mMergerThread == nullptr);
+  IasMultiPointClockPtr clock = nullptr;
+  if (clockDomain != nullptr)
+  {
+    IasMultiPointClockPtr &domainClock = mClocks[clockDomain];
+    if (domainClock == nullptr)
+    {
+      domainClock = std::make_shared<IasMultiPointClock>();
+    }
+    clock = domainClock;
+  }
+  IasMultiPointTapPtr tap = std::make_shared<IasMultiPointTap>(name, index, numChannels, mSampleRate * cTapCapacityMs / 1000, clock);
+  IAS_ASSERT(tap != nullptr);
+  mTaps.push_back(tap);
+  mNumChannels += numChannels;
+  return tap;
+}
+
+IasMultiPointProbe::IasResult IasMultiPointProbe::start()
+{
+  if (mTaps.empty() || mSampleRate == 0 || mBlockSize == 0)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_STREAM, "Invalid parameters, numTaps=", mTaps.size(),
+                "sampleRate=", mSampleRate, "blockSize=", mBlockSize);
+    return eIasFailed;
+  }
+  IasStreamProbeParams params;
+  params.name = mStreamName;
+  params.index = 0;
+  params.numChannels = mNumChannels;
+  params.sampleRate = mSampleRate;
+  params.periodSize = mBlockSize;
+  params.dataFormat = eIasFormatFloat32;
+  mOutput = std::make_shared<IasStreamProbe>(params);
+  IAS_ASSERT(mOutput != nullptr);
+  if (mOutput->init() != IasStreamProbe::eIasOk)
+  {
+    mOutput = nullptr;
+    return eIasFailed;
+  }
+
+  mBlockBuffer.assign(mBlockSize * mNumChannels, 0.0f);
+  mBlockAreas.resize(mNumChannels);
+  for (uint32_t chan = 0; chan < mNumChannels; ++chan)
+  {
+    mBlockAreas[chan].start = mBlockBuffer.data();
+    mBlockAreas[chan].first = static_cast<uint32_t>(chan * 8 * sizeof(float));          // expressed in bits
+    mBlockAreas[chan].step  = static_cast<uint32_t>(mNumChannels * 8 * sizeof(float));  // expressed in bits
+    mBlockAreas[chan].index = chan;
+    mBlockAreas[chan].maxIndex = mNumChannels - 1;
+  }
+
+  mStartTimeNs = getTimeNs();
+  mCaptureFrame = 0;
+  for (auto &tap : mTaps)
+  {
+    tap->setTimeBase(mStartTimeNs, mSampleRate);
+  }
+  mIsRunning.store(true);
+  mMergerThread = new (std::nothrow) std::thread([this]{mergerThread();});
+  IAS_ASSERT(mMergerThread != nullptr);
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_STREAM, "Multi-point probe started with", mTaps.size(), "taps and", mNumChannels, "channels");
+  return eIasOk;
+}
+
+void IasMultiPointProbe::stop()
+{
+  mIsRunning.store(false);
+  if (mMergerThread != nullptr)
+  {
+    mMergerThread->join();
+    delete mMergerThread;
+    mMergerThread = nullptr;
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_STREAM, "Multi-point probe stopped after", mCaptureFrame, "frames");
+  }
+}
+
+void IasMultiPointProbe::mergerThread()
+{
+  IasThreadNames::getInstance()->setThreadName(IasThreadNames::eIasStandard, "multi-point probe merger thread for " + mStreamName);
+
+  const int64_t maxTapDelayFrames = static_cast<int64_t>(mSampleRate) * cMaxTapDelayMs / 1000;
+  const std::chrono::microseconds sleepTime(std::max(1000ULL, 500000ULL * mBlockSize / mSampleRate));
+  while (mIsRunning.load() == true)
+  {
+    std::this_thread::sleep_for(sleepTime);
+
+    // The capture can be merged up to the frame for which all taps delivered data. Taps that are
+    // late for more than maxTapDelayFrames, e.g. because their routing zone is stopped, do not hold back the others.
+    const int64_t nowFrame = (getTimeNs() - mStartTimeNs) * static_cast<int64_t>(mSampleRate) / 1000000000LL;
+    int64_t horizon = nowFrame;
+    for (auto &tap : mTaps)
+    {
+      int64_t tapHorizon = std::numeric_limits<int64_t>::min();
+      tap->getHorizon(&tapHorizon);
+      horizon = std::min(horizon, std::max(tapHorizon, nowFrame - maxTapDelayFrames));
+    }
+
+    while ((mCaptureFrame + mBlockSize <= horizon) && (mIsRunning.load() == true))
+    {
+      uint32_t firstChannel = 0;
+      for (auto &tap : mTaps)
+      {
+        tap->read(mBlockBuffer.data(), mNumChannels, firstChannel, mCaptureFrame, mBlockSize);
+        firstChannel += tap->getNumChannels();
+      }
+      mOutput->process(mBlockAreas.data(), eIasFormatFloat32, 0, mBlockSize);
+      mCaptureFrame += mBlockSize;
+    }
+  }
+}
+
+void IasMultiPointProbe::getHeader(IasIDebug::IasMultiPointHeader *header) const
+{
+  if (header == nullptr)
+  {
+    return;
+  }
+  header->streamName = mStreamName;
+  header->sampleRate = mSampleRate;
+  header->numChannels = mNumChannels;
+  header->startTimeNs = mStartTimeNs;
+  header->points.clear();
+  uint32_t firstChannel = 0;
+  for (auto &tap : mTaps)
+  {
+    IasIDebug::IasProbePointInfo point;
+    point.name = tap->getName();
+    point.firstChannel = firstChannel;
+    point.numChannels = tap->getNumChannels();
+    header->points.push_back(point);
+    firstChannel += tap->getNumChannels();
+  }
+}
+
+void IasMultiPointProbe::getStatistics(IasIDebug::IasStreamProbeStatistics *statistics) const
+{
+  if (statistics == nullptr)
+  {
+    return;
+  }
+  *statistics = IasIDebug::IasStreamProbeStatistics();
+  if (mOutput != nullptr)
+  {
+    mOutput->getStatistics(statistics);
+  }
+  for (auto &tap : mTaps)
+  {
+    statistics->numFramesDropped += tap->getNumFramesDropped();
+    statistics->numOverruns += tap->getNumOverruns();
+  }
+}
+
+} // namespace IasAudio
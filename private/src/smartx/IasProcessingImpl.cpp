@@ -44,5 +44,15 @@ IasIProcessing::IasResult IasProcessingImpl::sendCmd(const std::string &instance
   return translate(mCmdDispatcher->dispatchCmd(instanceName, cmdProperties, returnProperties));
 }
 
+IasIProcessing::IasResult IasProcessingImpl::resolveCmd(const std::string &instanceName, int32_t cmdId, const std::string &pinName, IasCmdHandle *handle)
+{
+  return translate(mCmdDispatcher->resolveCmd(instanceName, cmdId, pinName, handle));
+}
+
+IasIProcessing::IasResult IasProcessingImpl::sendCmd(const IasCmdHandle &handle, float value)
+{
+  return translate(mCmdDispatcher->dispatchCmd(handle, value));
+}
+
 
 } //namespace IasAudio
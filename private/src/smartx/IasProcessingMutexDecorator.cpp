@@ -9,7 +9,6 @@
  * @brief Definition of IasProcessingMutexDecorator
  */
 
-#include <smartx/IasDecoratorGuard.hpp>
 #include "smartx/IasProcessingMutexDecorator.hpp"
 
 namespace IasAudio {
@@ -28,8 +27,18 @@ IasProcessingMutexDecorator::~IasProcessingMutexDecorator()
 
 IasIProcessing::IasResult IasProcessingMutexDecorator::sendCmd(const std::string &instanceName, const IasProperties &cmdProperties, IasProperties &returnProperties)
 {
-  const IasDecoratorGuard lk{};
+  // The command dispatcher serializes the commands per module, so commands do not lock any domain.
   return mProcessing->sendCmd(instanceName, cmdProperties, returnProperties);
 }
 
+IasIProcessing::IasResult IasProcessingMutexDecorator::resolveCmd(const std::string &instanceName, int32_t cmdId, const std::string &pinName, IasCmdHandle *handle)
+{
+  return mProcessing->resolveCmd(instanceName, cmdId, pinName, handle);
+}
+
+IasIProcessing::IasResult IasProcessingMutexDecorator::sendCmd(const IasCmdHandle &handle, float value)
+{
+  return mProcessing->sendCmd(handle, value);
+}
+
 } /* namespace IasAudio */
@@ -9,6 +9,8 @@
  * @brief  This file contains the IasProperties class definition.
  */
 
+#include <functional>
+
 #include "audio/smartx/IasProperties.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 
@@ -92,6 +94,42 @@ void IasProperties::clearAll()
   mHasProperties = false;
 }
 
+/**
+ * @brief Combine a hash value into the hash value of the properties
+ */
+static void combineHash(uint64_t &hash, uint64_t value)
+{
+  hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+}
+
+template <typename VALUE>
+static uint64_t hashValue(const VALUE &value)
+{
+  return std::hash<VALUE>()(value);
+}
+
+template <typename VALUE>
+static uint64_t hashValue(const std::vector<VALUE> &values)
+{
+  uint64_t hash = values.size();
+  for (auto &value : values)
+  {
+    combineHash(hash, hashValue(value));
+  }
+  return hash;
+}
+
+template <typename MAP>
+static void combineMap(uint64_t &hash, const MAP &map)
+{
+  combineHash(hash, map.size());
+  for (auto &entry : map)
+  {
+    combineHash(hash, hashValue(entry.first));
+    combineHash(hash, hashValue(entry.second));
+  }
+}
+
 IasProperties::IasProperties()
   :mHasProperties(false)
   ,mLog(IasAudioLogging::registerDltContext("PFW", "Log of rtprocessing framework"))
@@ -166,4 +204,21 @@ IasProperties::IasResult IasProperties::getKeyDataType(std::string key, std::str
 
 }
 
+uint64_t IasProperties::getHash() const
+{
+  // The maps are ordered, so the hash value does not depend on the order in which the properties were set.
+  uint64_t hash = 0;
+  combineMap(hash, mMap_int64_t);
+  combineMap(hash, mMap_int32_t);
+  combineMap(hash, mMap_float64);
+  combineMap(hash, mMap_float32);
+  combineMap(hash, mMap_string);
+  combineMap(hash, mMap_IasInt64Vector);
+  combineMap(hash, mMap_IasInt32Vector);
+  combineMap(hash, mMap_IasFloat64Vector);
+  combineMap(hash, mMap_IasFloat32Vector);
+  combineMap(hash, mMap_IasStringVector);
+  return hash;
+}
+
 } // namespace IasAudio
@@ -28,25 +28,25 @@ IasRoutingMutexDecorator::~IasRoutingMutexDecorator()
 
 IasIRouting::IasResult IasRoutingMutexDecorator::connect(std::int32_t sourceId, std::int32_t sinkId)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockRouting, __func__};
   return mRouting->connect(sourceId, sinkId);
 }
 
 IasIRouting::IasResult IasRoutingMutexDecorator::disconnect(std::int32_t sourceId, std::int32_t sinkId)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockRouting, __func__};
   return mRouting->disconnect(sourceId, sinkId);
 }
 
 IasConnectionVector IasRoutingMutexDecorator::getActiveConnections() const
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology | cIasLockRouting, 0, __func__};
   return mRouting->getActiveConnections();
 }
 
 IasDummySourcesSet IasRoutingMutexDecorator::getDummySources() const
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology | cIasLockRouting, 0, __func__};
   return mRouting->getDummySources();
 }
 
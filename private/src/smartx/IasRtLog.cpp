@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasRtLog.cpp
+ * @date   2018
+ * @brief  Deferred logging for the real-time threads of the SmartXbar.
+ */
+
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "smartx/IasRtLog.hpp"
+#include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
+
+namespace IasAudio {
+
+static const std::string cClassName = "IasRtLog::";
+#define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
+
+static const std::chrono::milliseconds cDrainInterval(10);   //!< Interval between two drains of the rings
+
+/**
+ * @brief The ring of the current thread, owned together with the log thread
+ */
+static thread_local IasRtLogRingPtr tRing;
+
+/**
+ * @brief Cached raw pointer of tRing for the real-time path
+ */
+static thread_local IasRtLogRing *tRingRaw = nullptr;
+
+/** \class IasRtLogThread
+ *  Owns the rings of all threads and drains them periodically into DLT.
+ */
+class IasRtLogThread
+{
+  public:
+    static IasRtLogThread* getInstance()
+    {
+      static IasRtLogThread theInstance;
+      return &theInstance;
+    }
+
+    void addRing(const IasRtLogRingPtr &ring)
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mRings.push_back(ring);
+      if (mThread.joinable() == false)
+      {
+        mIsRunning = true;
+        mThread = std::thread(&IasRtLogThread::run, this);
+      }
+    }
+
+    uint64_t getNumDropped()
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      return mNumDroppedOfRemovedRings + sumDropped();
+    }
+
+  private:
+    IasRtLogThread()
+      :mMutex()
+      ,mRings()
+      ,mThread()
+      ,mIsRunning(false)
+      ,mNumDroppedOfRemovedRings(0)
+    {
+    }
+
+    ~IasRtLogThread()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsRunning = false;
+      }
+      if (mThread.joinable() == true)
+      {
+        mThread.join();
+      }
+    }
+
+    IasRtLogThread(IasRtLogThread const &other);
+    IasRtLogThread& operator=(IasRtLogThread const &other);
+
+    uint64_t sumDropped() const
+    {
+      uint64_t numDropped = 0;
+      for (auto &ring : mRings)
+      {
+        numDropped += ring->numDropped.load(std::memory_order_relaxed);
+      }
+      return numDropped;
+    }
+
+    void run()
+    {
+      bool isRunning = true;
+      while (isRunning == true)
+      {
+        std::this_thread::sleep_for(cDrainInterval);
+        std::lock_guard<std::mutex> lock(mMutex);
+        isRunning = mIsRunning;
+        for (auto ringIt = mRings.begin(); ringIt != mRings.end();)
+        {
+          IasRtLogRing &ring = **ringIt;
+          IasRtLog::drain(ring);
+          // The log thread holds the last reference if the owning thread has exited.
+          if (ringIt->use_count() == 1)
+          {
+            mNumDroppedOfRemovedRings += ring.numDropped.load(std::memory_order_relaxed);
+            ringIt = mRings.erase(ringIt);
+          }
+          else
+          {
+            ++ringIt;
+          }
+        }
+      }
+    }
+
+    std::mutex                      mMutex;                      //!< Protects the list of rings
+    std::vector<IasRtLogRingPtr>    mRings;                      //!< The rings of all threads
+    std::thread                     mThread;                     //!< The log thread
+    bool                            mIsRunning;                  //!< Exit condition of the log thread
+    uint64_t                        mNumDroppedOfRemovedRings;   //!< Dropped records of threads that have exited
+};
+
+void IasRtLog::registerThread(const std::string &threadName)
+{
+  if (tRing != nullptr)
+  {
+    return;
+  }
+  tRing = std::make_shared<IasRtLogRing>(threadName);
+  tRingRaw = tRing.get();
+  IasRtLogThread::getInstance()->addRing(tRing);
+}
+
+bool IasRtLog::isThreadRegistered()
+{
+  return (tRingRaw != nullptr);
+}
+
+IasRtLogRing* IasRtLog::getRing()
+{
+  return tRingRaw;
+}
+
+uint32_t IasRtLog::drain(IasRtLogRing &ring)
+{
+  uint32_t numForwarded = 0;
+  uint64_t writeIndex = ring.writeIndex.load(std::memory_order_acquire);
+  uint64_t readIndex = ring.readIndex.load(std::memory_order_relaxed);
+  while (readIndex != writeIndex)
+  {
+    forward(ring.records[readIndex & (cIasRtLogRingSize - 1)]);
+    ++readIndex;
+    ++numForwarded;
+    ring.readIndex.store(readIndex, std::memory_order_release);
+  }
+  uint64_t numDropped = ring.numDropped.load(std::memory_order_relaxed);
+  if (numDropped != ring.numReportedDropped)
+  {
+    static DltContext *log = IasAudioLogging::registerDltContext("SMX", "SmartX Common");
+    DLT_LOG_CXX(*log, DLT_LOG_WARN, LOG_PREFIX, "Dropped", numDropped - ring.numReportedDropped, "log messages of thread", ring.threadName);
+    ring.numReportedDropped = numDropped;
+  }
+  return numForwarded;
+}
+
+std::string IasRtLog::format(const IasRtLogRecord &record)
+{
+  std::ostringstream message;
+  message << *record.className << record.function << "(" << record.line << "):";
+  for (uint32_t index = 0; index < record.numArgs; ++index)
+  {
+    const IasRtLogArg &arg = record.args[index];
+    message << " ";
+    switch (arg.type)
+    {
+      case IasRtLogArg::eIasInt:
+        message << arg.intValue;
+        break;
+      case IasRtLogArg::eIasUInt:
+        message << arg.uintValue;
+        break;
+      case IasRtLogArg::eIasDouble:
+        message << arg.doubleValue;
+        break;
+      case IasRtLogArg::eIasBool:
+        message << (arg.boolValue ? "true" : "false");
+        break;
+      case IasRtLogArg::eIasText:
+        message.write(&record.text[arg.text.offset], arg.text.length);
+        break;
+    }
+  }
+  return message.str();
+}
+
+void IasRtLog::forward(const IasRtLogRecord &record)
+{
+  DLT_LOG_CXX(*record.context, record.level, format(record));
+}
+
+uint64_t IasRtLog::getNumDropped()
+{
+  return IasRtLogThread::getInstance()->getNumDropped();
+}
+
+} // namespace IasAudio
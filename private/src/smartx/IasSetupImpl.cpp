@@ -16,6 +16,7 @@
 #include "model/IasAudioSinkDevice.hpp"
 #include "model/IasAudioPort.hpp"
 #include "model/IasRoutingZone.hpp"
+#include "model/IasRoutingZoneWorkerThread.hpp"
 #include "model/IasPipeline.hpp"
 #include "model/IasAudioPin.hpp"
 #include "model/IasProcessingModule.hpp"
@@ -94,6 +95,11 @@ bool isRoutingZoneActive(IasRoutingZonePtr routingZone)
   return routingZone->isActive() || routingZone->isActivePending();
 }
 
+bool isPipelineRelinkable(IasPipelinePtr pipeline)
+{
+  return pipeline->isRuntimeRelinkingEnabled() && pipeline->isAudioChainInitialized();
+}
+
 IasSetupImpl::IasSetupImpl(IasConfigurationPtr config, IasCmdDispatcherPtr cmdDispatcher, IasIRouting* routing)
   :mConfig(config)
   ,mCmdDispatcher(cmdDispatcher)
@@ -101,6 +107,8 @@ IasSetupImpl::IasSetupImpl(IasConfigurationPtr config, IasCmdDispatcherPtr cmdDi
   ,mLog(IasAudioLogging::getDltContext("CFG"))
   ,mMaxDataBuffSize(MAX_DATA_BUFFER_SIZE_DEVICE)
   ,mRouting(routing)
+  ,mPluginLoader()
+  ,mPluginLoadFailed(false)
 {
   IAS_ASSERT(mConfig != nullptr);
   IAS_ASSERT(mLog != nullptr);
@@ -110,6 +118,10 @@ IasSetupImpl::IasSetupImpl(IasConfigurationPtr config, IasCmdDispatcherPtr cmdDi
 
 IasSetupImpl::~IasSetupImpl()
 {
+  if (mPluginLoader.joinable())
+  {
+    mPluginLoader.join();
+  }
   //Stop all routing zones
   IasRoutingZoneMap tmpRoutingZoneMap = mConfig->getRoutingZoneMap();
   for( auto &entry : tmpRoutingZoneMap)
@@ -1244,7 +1256,7 @@ void IasSetupImpl::unlink(IasAudioPortPtr zoneInputPort, IasAudioPortPtr sinkDev
 IasAudioPinVector IasSetupImpl::getAudioPins() const
 {
   IasAudioPinVector pins;
-  mConfig->getPinMap().size();
+  pins.reserve(mConfig->getPinMap().size());
   for (auto &entry : mConfig->getPinMap())
   {
     pins.push_back(entry.second);
@@ -1322,42 +1334,21 @@ IasAudioSinkDeviceVector IasSetupImpl::getAudioSinkDevices() const
 IasRoutingZonePtr IasSetupImpl::getRoutingZone(const std::string &name)
 {
   IasRoutingZonePtr rzn = nullptr;
-  for (auto &entry : getRoutingZones())
-  {
-    if (entry->getName().compare(name) == 0)
-    {
-      rzn = entry;
-      break;
-    }
-  }
+  (void)mConfig->getRoutingZone(name, &rzn);
   return rzn;
 }
 
 IasAudioSourceDevicePtr IasSetupImpl::getAudioSourceDevice(const std::string &name)
 {
   IasAudioSourceDevicePtr source = nullptr;
-  for (auto &entry : getAudioSourceDevices())
-  {
-    if (entry->getName().compare(name) == 0)
-    {
-      source = entry;
-      break;
-    }
-  }
+  (void)mConfig->getAudioDevice(name, &source);
   return source;
 }
 
 IasAudioSinkDevicePtr IasSetupImpl::getAudioSinkDevice(const std::string &name)
 {
   IasAudioSinkDevicePtr sink = nullptr;
-  for (auto &entry : getAudioSinkDevices())
-  {
-    if (entry->getName().compare(name) == 0)
-    {
-      sink = entry;
-      break;
-    }
-  }
+  (void)mConfig->getAudioDevice(name, &sink);
   return sink;
 }
 
@@ -1392,6 +1383,17 @@ IasISetup::IasResult IasSetupImpl::createPipeline(const IasPipelineParams &param
     return eIasFailed;
   }
 
+  // Wait for the plugin engine, if the plug-in libraries are loaded in the background.
+  if (mPluginLoader.joinable())
+  {
+    mPluginLoader.join();
+    if (mPluginLoadFailed == true)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "No plug-in libraries found. Pipeline will not be created");
+      return eIasFailed;
+    }
+  }
+
   // Create plugin engine, if not created yet.
   if (mPluginEngine == nullptr)
   {
@@ -1426,6 +1428,23 @@ IasISetup::IasResult IasSetupImpl::createPipeline(const IasPipelineParams &param
   return setres;
 }
 
+void IasSetupImpl::preloadPluginLibraries()
+{
+  if (mPluginEngine != nullptr)
+  {
+    return;
+  }
+  mPluginEngine = std::make_shared<IasPluginEngine>(mCmdDispatcher);
+  IAS_ASSERT(mPluginEngine != nullptr);
+  mPluginLoadFailed = false;
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Loading the plug-in libraries in the background");
+  // The plugin engine is only accessed by the background thread until createPipeline joins it.
+  IasPluginEnginePtr pluginEngine = mPluginEngine;
+  mPluginLoader = std::thread([this, pluginEngine]() {
+    mPluginLoadFailed = (pluginEngine->loadPluginLibraries() != IasAudioProcessingResult::eIasAudioProcOK);
+  });
+}
+
 IasPipelinePtr IasSetupImpl::getPipeline(const std::string &name)
 {
   IasPipelinePtr pipeline = nullptr;
@@ -2416,10 +2435,12 @@ IasISetup::IasResult IasSetupImpl::link(IasAudioPinPtr outputPin, IasAudioPinPtr
     return eIasFailed;
   }
 
-  // Verify that the routing zone is not running
+  // Verify that the routing zone is not running, unless the pipeline can be relinked at runtime.
+  // In this case, the new link takes effect when the links are committed.
   IasRoutingZonePtr routingZone;
   IasConfiguration::IasResult cfgres = mConfig->getRoutingZone(pipeline1, &routingZone);
-  if (cfgres == IasConfiguration::eIasOk && routingZone != nullptr && isRoutingZoneActive(routingZone))
+  if (cfgres == IasConfiguration::eIasOk && routingZone != nullptr && isRoutingZoneActive(routingZone) &&
+      !isPipelineRelinkable(pipeline1))
   {
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,
                 "Cannot link pins", outputPin->getParameters()->name,
@@ -2442,8 +2463,58 @@ IasISetup::IasResult IasSetupImpl::link(IasAudioPinPtr outputPin, IasAudioPinPtr
 }
 
 
-void IasSetupImpl::unlink(IasAudioPinPtr /*outputPin*/, IasAudioPinPtr /*inputPin*/)
+void IasSetupImpl::unlink(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin)
 {
+  if (outputPin == nullptr)
+  {
+    /**
+     * @log Invalid parameter: outputPin == nullptr.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: outputPin == nullptr");
+    return;
+  }
+
+  if (inputPin == nullptr)
+  {
+    /**
+     * @log Invalid parameter: inputPin == nullptr.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: inputPin == nullptr");
+    return;
+  }
+
+  IasPipelinePtr pipeline = outputPin->getPipeline();
+  if ((pipeline == nullptr) || (pipeline != inputPin->getPipeline()))
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,
+                "Invalid configuration: output pin", outputPin->getParameters()->name,
+                "and input pin", inputPin->getParameters()->name,
+                "do not belong to the same pipeline.");
+    return;
+  }
+
+  // Verify that the routing zone is not running, unless the pipeline can be relinked at runtime.
+  IasRoutingZonePtr routingZone;
+  IasConfiguration::IasResult cfgres = mConfig->getRoutingZone(pipeline, &routingZone);
+  if (cfgres == IasConfiguration::eIasOk && routingZone != nullptr && isRoutingZoneActive(routingZone) &&
+      !isPipelineRelinkable(pipeline))
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,
+                "Cannot unlink pins", outputPin->getParameters()->name,
+                "and", inputPin->getParameters()->name,
+                "when routing zone", routingZone->getName(), "is running" );
+    return;
+  }
+
+  IasPipeline::IasResult result = pipeline->unlink(outputPin, inputPin);
+  if (result != IasPipeline::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,
+                "Error during IasPipeline::unlink()");
+    return;
+  }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Successfully unlinked output pin", outputPin->getParameters()->name,
+              "from input pin", inputPin->getParameters()->name);
 }
 
 void IasSetupImpl::setProperties(IasProcessingModulePtr module, const IasProperties &properties)
@@ -2478,9 +2549,22 @@ IasISetup::IasResult IasSetupImpl::initPipelineAudioChain(IasPipelinePtr pipelin
      * @log Invalid parameter: pipeline == nullptr.
      */
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: pipeline == nullptr");
+    return eIasFailed;
   }
 
+  // Commands to the modules of this pipeline that are already registered have to wait until their
+  // audio chain is initialized, commands to all other modules are not blocked. The command interfaces
+  // registered by initAudioChain are not locked, so only the locked ones are unlocked afterwards.
+  IasPipeline::IasProcessingModuleVector processingModules;
+  pipeline->getProcessingModules(&processingModules);
+  std::vector<std::string> instanceNames;
+  for (const auto &module : processingModules)
+  {
+    instanceNames.push_back(module->getParameters()->instanceName);
+  }
+  IasCmdDispatcher::IasCmdEntryVector lockedEntries = mCmdDispatcher->lockModuleCmds(instanceNames);
   IasPipeline::IasResult pipelineResult = pipeline->initAudioChain();
+  mCmdDispatcher->unlockModuleCmds(lockedEntries);
   if (pipelineResult != IasPipeline::eIasOk)
   {
     DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error while calling IasPipeline::initAudioChain:", toString(pipelineResult));
@@ -2492,6 +2576,91 @@ IasISetup::IasResult IasSetupImpl::initPipelineAudioChain(IasPipelinePtr pipelin
   return eIasOk;
 }
 
+IasISetup::IasResult IasSetupImpl::setRuntimeRelinking(IasPipelinePtr pipeline, bool enable)
+{
+  if (pipeline == nullptr)
+  {
+    /**
+     * @log Invalid parameter: pipeline == nullptr.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: pipeline == nullptr");
+    return eIasFailed;
+  }
+  IasPipeline::IasResult pipelineResult = pipeline->setRuntimeRelinking(enable);
+  if (pipelineResult != IasPipeline::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error while calling IasPipeline::setRuntimeRelinking:", toString(pipelineResult));
+    return eIasFailed;
+  }
+  return eIasOk;
+}
+
+IasISetup::IasResult IasSetupImpl::commitPinLinks(IasPipelinePtr pipeline, uint32_t crossfadeLength)
+{
+  if (pipeline == nullptr)
+  {
+    /**
+     * @log Invalid parameter: pipeline == nullptr.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: pipeline == nullptr");
+    return eIasFailed;
+  }
+  IasPipeline::IasResult pipelineResult = pipeline->commitPinLinks(crossfadeLength);
+  if (pipelineResult != IasPipeline::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error while calling IasPipeline::commitPinLinks:", toString(pipelineResult));
+    return eIasFailed;
+  }
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Successfully committed pin links of pipeline", pipeline->getParameters()->name);
+  return eIasOk;
+}
+
+IasISetup::IasResult IasSetupImpl::setSinkPrefill(IasRoutingZonePtr routingZone, const IasSinkPrefillParams &params)
+{
+  if (routingZone == nullptr)
+  {
+    /**
+     * @log Parameter routingZone is invalid.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "routingZone == nullptr");
+    return eIasFailed;
+  }
+  if ((params.minFrames != 0) && (params.maxFrames != 0) && (params.minFrames > params.maxFrames))
+  {
+    /**
+     * @log The lowest fill level of the adaptation is higher than the highest one.
+     */
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: minFrames =", params.minFrames,
+                "is higher than maxFrames =", params.maxFrames);
+    return eIasFailed;
+  }
+  IasAudioSinkDevicePtr sinkDevice = routingZone->getAudioSinkDevice();
+  if (sinkDevice != nullptr)
+  {
+    // One period of the sink device buffer has to remain free for writing the next period.
+    const uint32_t periodSize = sinkDevice->getPeriodSize();
+    const uint32_t maxFill = (sinkDevice->getNumPeriods() > 1) ? (sinkDevice->getNumPeriods() - 1) * periodSize : 0;
+    if ((params.numFrames > maxFill) || (params.minFrames > maxFill) || (params.maxFrames > maxFill))
+    {
+      /**
+       * @log The requested fill level leaves less than one period of free space in the sink device buffer.
+       */
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: fill level exceeds", maxFill,
+                  "frames, which is the limit of sink device", sinkDevice->getName());
+      return eIasFailed;
+    }
+  }
+  IasRoutingZoneWorkerThreadPtr workerThread = routingZone->getWorkerThread();
+  if (workerThread == nullptr)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Routing zone", routingZone->getName(), "has no worker thread");
+    return eIasFailed;
+  }
+  workerThread->setSinkPrefill(params);
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Successfully set sink prefill of routing zone", routingZone->getName());
+  return eIasOk;
+}
+
 bool IasSetupImpl::verifyBufferSize(const IasAudioDeviceParams &params)
 {
 
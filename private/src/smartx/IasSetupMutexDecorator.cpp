@@ -28,375 +28,393 @@ IasSetupMutexDecorator::~IasSetupMutexDecorator()
 
 IasSetupMutexDecorator::IasResult IasSetupMutexDecorator::addAudioOutputPort(IasAudioSourceDevicePtr audioSourceDevice, IasAudioPortPtr audioPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->addAudioOutputPort(audioSourceDevice, audioPort);
 }
 
 void IasSetupMutexDecorator::deleteAudioOutputPort(IasAudioSourceDevicePtr audioSourceDevice, IasAudioPortPtr audioPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->deleteAudioOutputPort(audioSourceDevice, audioPort);
 }
 
 IasSetupMutexDecorator::IasResult IasSetupMutexDecorator::addAudioInputPort(IasAudioSinkDevicePtr audioSinkDevice, IasAudioPortPtr audioPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->addAudioInputPort(audioSinkDevice, audioPort);
 }
 
 void IasSetupMutexDecorator::deleteAudioInputPort(IasAudioSinkDevicePtr audioSinkDevice, IasAudioPortPtr audioPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->deleteAudioInputPort(audioSinkDevice, audioPort);
 }
 
 IasSetupMutexDecorator::IasResult IasSetupMutexDecorator::addAudioInputPort(IasRoutingZonePtr routingZone, IasAudioPortPtr audioPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->addAudioInputPort(routingZone, audioPort);
 }
 
 void IasSetupMutexDecorator::deleteAudioInputPort(IasRoutingZonePtr routingZone, IasAudioPortPtr audioPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->deleteAudioInputPort(routingZone, audioPort);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::addDerivedZone(IasRoutingZonePtr baseZone, IasRoutingZonePtr derivedZone)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->addDerivedZone(baseZone, derivedZone);
 }
 
 void IasSetupMutexDecorator::deleteDerivedZone(IasRoutingZonePtr baseZone, IasRoutingZonePtr derivedZone)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->deleteDerivedZone(baseZone, derivedZone);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::createAudioPort(const IasAudioPortParams& params, IasAudioPortPtr* audioPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->createAudioPort(params, audioPort);
 }
 
 void IasSetupMutexDecorator::destroyAudioPort(IasAudioPortPtr audioPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->destroyAudioPort(audioPort);
 }
 
 void IasSetupMutexDecorator::destroyAudioSinkDevice(IasAudioSinkDevicePtr audioSinkDevice)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->destroyAudioSinkDevice(audioSinkDevice);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::createAudioSourceDevice(const IasAudioDeviceParams& params, IasAudioSourceDevicePtr* audioSourceDevice)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->createAudioSourceDevice(params, audioSourceDevice);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::createAudioSinkDevice(const IasAudioDeviceParams& params, IasAudioSinkDevicePtr* audioSinkDevice)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->createAudioSinkDevice(params, audioSinkDevice);
 }
 
 void IasSetupMutexDecorator::destroyAudioSourceDevice(IasAudioSourceDevicePtr audioSourceDevice)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->destroyAudioSourceDevice(audioSourceDevice);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::startAudioSourceDevice(IasAudioSourceDevicePtr audioSourceDevice)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->startAudioSourceDevice(audioSourceDevice);
 }
 
 void IasSetupMutexDecorator::stopAudioSourceDevice(IasAudioSourceDevicePtr audioSourceDevice)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->stopAudioSourceDevice(audioSourceDevice);
 }
 
 IasSetupMutexDecorator::IasResult IasSetupMutexDecorator::createRoutingZone(const IasRoutingZoneParams &params, IasRoutingZonePtr* routingZone)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->createRoutingZone(params, routingZone);
 }
 
 void IasSetupMutexDecorator::destroyRoutingZone(IasRoutingZonePtr routingZone)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->destroyRoutingZone(routingZone);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::startRoutingZone(IasRoutingZonePtr routingZone)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockPipeline, cIasLockTopology, __func__};
   return mSetup->startRoutingZone(routingZone);
 }
 
 void IasSetupMutexDecorator::stopRoutingZone(IasRoutingZonePtr routingZone)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockPipeline, cIasLockTopology, __func__};
   return mSetup->stopRoutingZone(routingZone);
 }
 
 IasSetupMutexDecorator::IasResult IasSetupMutexDecorator::link(IasRoutingZonePtr routingZone, IasAudioSinkDevicePtr audioSinkDevice)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->link(routingZone, audioSinkDevice);
 }
 
 void IasSetupMutexDecorator::unlink(IasRoutingZonePtr routingZone, IasAudioSinkDevicePtr audioSinkDevice)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->unlink(routingZone, audioSinkDevice);
 }
 
 IasSetupMutexDecorator::IasResult IasSetupMutexDecorator::link(IasAudioPortPtr zoneInputPort, IasAudioPortPtr sinkDeviceInputPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->link(zoneInputPort, sinkDeviceInputPort);
 }
 
 void IasSetupMutexDecorator::unlink(IasAudioPortPtr zoneInputPort, IasAudioPortPtr sinkDeviceInputPort)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->unlink(zoneInputPort, sinkDeviceInputPort);
 }
 
 IasAudioPortVector IasSetupMutexDecorator::getAudioPorts() const
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getAudioPorts();
 }
 
 IasAudioPinVector IasSetupMutexDecorator::getAudioPins() const
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology | cIasLockPipeline, 0, __func__};
   return mSetup->getAudioPins();
 }
 
 IasAudioPortVector IasSetupMutexDecorator::getAudioInputPorts() const
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getAudioInputPorts();
 }
 
 IasAudioPortVector IasSetupMutexDecorator::getAudioOutputPorts() const
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getAudioOutputPorts();
 }
 
 IasRoutingZoneVector IasSetupMutexDecorator::getRoutingZones() const
 {
-  const IasDecoratorGuard lk{};;
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};;
   return mSetup->getRoutingZones();
 }
 
 IasAudioSourceDeviceVector IasSetupMutexDecorator::getAudioSourceDevices() const
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getAudioSourceDevices();
 }
 
 IasAudioSinkDeviceVector IasSetupMutexDecorator::getAudioSinkDevices() const
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getAudioSinkDevices();
 }
 
 IasRoutingZonePtr IasSetupMutexDecorator::getRoutingZone(const std::string &name)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getRoutingZone(name);
 }
 
 IasAudioSourceDevicePtr IasSetupMutexDecorator::getAudioSourceDevice(const std::string &name)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getAudioSourceDevice(name);
 }
 
 IasAudioSinkDevicePtr IasSetupMutexDecorator::getAudioSinkDevice(const std::string &name)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getAudioSinkDevice(name);
 }
 
 IasPipelinePtr IasSetupMutexDecorator::getPipeline(const std::string &name)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology | cIasLockPipeline, 0, __func__};
   return mSetup->getPipeline(name);
 }
 
 void IasSetupMutexDecorator::addSourceGroup (const std::string &name, std::int32_t id)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
   return mSetup->addSourceGroup (name, id);
 }
 
 IasSourceGroupMap IasSetupMutexDecorator::getSourceGroups()
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, 0, __func__};
   return mSetup->getSourceGroups();
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::createPipeline(const IasPipelineParams &params, IasPipelinePtr *pipeline)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->createPipeline(params, pipeline);
 }
 
 void IasSetupMutexDecorator::destroyPipeline(IasPipelinePtr *pipeline)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->destroyPipeline(pipeline);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::addPipeline(IasRoutingZonePtr routingZone, IasPipelinePtr pipeline)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->addPipeline(routingZone, pipeline);
 }
 
 void IasSetupMutexDecorator::deletePipeline(IasRoutingZonePtr routingZone)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->deletePipeline(routingZone);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::createAudioPin(const IasAudioPinParams &params, IasAudioPinPtr *pin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->createAudioPin(params, pin);
 }
 
 void IasSetupMutexDecorator::destroyAudioPin(IasAudioPinPtr *pin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->destroyAudioPin(pin);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::addAudioInputPin(IasPipelinePtr pipeline, IasAudioPinPtr pipelineInputPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->addAudioInputPin(pipeline, pipelineInputPin);
 }
 
 void IasSetupMutexDecorator::deleteAudioInputPin(IasPipelinePtr pipeline, IasAudioPinPtr pipelineInputPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->deleteAudioInputPin(pipeline, pipelineInputPin);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::addAudioOutputPin(IasPipelinePtr pipeline, IasAudioPinPtr pipelineOutputPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->addAudioOutputPin(pipeline, pipelineOutputPin);
 }
 
 void IasSetupMutexDecorator::deleteAudioOutputPin(IasPipelinePtr pipeline, IasAudioPinPtr pipelineOutputPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->deleteAudioOutputPin(pipeline, pipelineOutputPin);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::addAudioInOutPin(IasProcessingModulePtr module, IasAudioPinPtr inOutPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->addAudioInOutPin(module, inOutPin);
 }
 
 void IasSetupMutexDecorator::deleteAudioInOutPin(IasProcessingModulePtr module, IasAudioPinPtr inOutPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->deleteAudioInOutPin(module, inOutPin);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::addAudioPinMapping(IasProcessingModulePtr module, IasAudioPinPtr inputPin, IasAudioPinPtr outputPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->addAudioPinMapping(module, inputPin, outputPin);
 }
 
 void IasSetupMutexDecorator::deleteAudioPinMapping(IasProcessingModulePtr module, IasAudioPinPtr inputPin, IasAudioPinPtr outputPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->deleteAudioPinMapping(module, inputPin, outputPin);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::createProcessingModule(const IasProcessingModuleParams &params, IasProcessingModulePtr *module)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockPipeline, __func__};
   return mSetup->createProcessingModule(params, module);
 }
 
 void IasSetupMutexDecorator::destroyProcessingModule(IasProcessingModulePtr *module)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->destroyProcessingModule(module);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::addProcessingModule(IasPipelinePtr pipeline, IasProcessingModulePtr module)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->addProcessingModule(pipeline, module);
 }
 
 void IasSetupMutexDecorator::deleteProcessingModule(IasPipelinePtr pipeline, IasProcessingModulePtr module)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->deleteProcessingModule(pipeline, module);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::link(IasAudioPortPtr inputPort, IasAudioPinPtr pipelinePin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->link(inputPort, pipelinePin);
 }
 
 void IasSetupMutexDecorator::unlink(IasAudioPortPtr inputPort, IasAudioPinPtr pipelinePin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->unlink(inputPort, pipelinePin);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::link(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin, IasAudioPinLinkType linkType)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->link(outputPin, inputPin, linkType);
 }
 
 void IasSetupMutexDecorator::unlink(IasAudioPinPtr outputPin, IasAudioPinPtr inputPin)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
   return mSetup->unlink(outputPin,  inputPin);
 }
 
 void IasSetupMutexDecorator::setProperties(IasProcessingModulePtr module, const IasProperties &properties)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockTopology | cIasLockPipeline, __func__};
   return mSetup->setProperties(module, properties);
 }
 
 IasPropertiesPtr IasSetupMutexDecorator::getProperties(IasProcessingModulePtr module)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{cIasLockTopology | cIasLockPipeline, 0, __func__};
   return mSetup->getProperties(module);
 }
 
 IasISetup::IasResult IasSetupMutexDecorator::initPipelineAudioChain(IasPipelinePtr pipeline)
 {
-  const IasDecoratorGuard lk{};
+  const IasDecoratorGuard lk{0, cIasLockPipeline, __func__};
   return mSetup->initPipelineAudioChain(pipeline);
 }
 
+IasISetup::IasResult IasSetupMutexDecorator::setRuntimeRelinking(IasPipelinePtr pipeline, bool enable)
+{
+  const IasDecoratorGuard lk{0, cIasLockPipeline, __func__};
+  return mSetup->setRuntimeRelinking(pipeline, enable);
+}
+
+IasISetup::IasResult IasSetupMutexDecorator::commitPinLinks(IasPipelinePtr pipeline, uint32_t crossfadeLength)
+{
+  const IasDecoratorGuard lk{cIasLockTopology, cIasLockPipeline, __func__};
+  return mSetup->commitPinLinks(pipeline, crossfadeLength);
+}
+
+IasISetup::IasResult IasSetupMutexDecorator::setSinkPrefill(IasRoutingZonePtr routingZone, const IasSinkPrefillParams &params)
+{
+  const IasDecoratorGuard lk{0, cIasLockTopology, __func__};
+  return mSetup->setSinkPrefill(routingZone, params);
+}
+
 
 } /* namespace IasAudio */
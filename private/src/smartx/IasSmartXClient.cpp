@@ -42,15 +42,7 @@ IasSmartXClient::IasSmartXClient(IasAudioDeviceParamsPtr params)
 
 IasSmartXClient::~IasSmartXClient()
 {
-  mIsRunning.store(false);
-  if (mIpcThread != nullptr)
-  {
-    // Cancel the wait for condition variable
-    pthread_cancel(mIpcThread->native_handle());
-    mIpcThread->join();
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "IPC thread successfully ended");
-    delete mIpcThread;
-  }
+  stopIpcThread();
 }
 
 IasSmartXClient::IasResult IasSmartXClient::init(IasDeviceType deviceType)
@@ -104,6 +96,32 @@ IasSmartXClient::IasResult IasSmartXClient::getRingBuffer(IasAudioRingBuffer** r
 }
 
 
+IasSmartXClient::IasResult IasSmartXClient::stopIpcThread()
+{
+  mIsRunning.store(false);
+  if (mIpcThread == nullptr)
+  {
+    return eIasOk;
+  }
+  // The shutdown package is put into the incoming queue, which is the one the alsa-smartx-plugin pushes to,
+  // so the IPC thread wakes up the same way as for a request of the plugin. The plugin never sends
+  // eIasAudioIpcInvalid as control, and the package is only treated as shutdown request after mIsRunning
+  // was cleared, so the protocol is not affected.
+  IasResult result = eIasOk;
+  if ((mInIpc == nullptr) || (mInIpc->push<IasAudioIpcPluginControl>(eIasAudioIpcInvalid) != eIasResultOk))
+  {
+    // The shutdown package could not be queued, so cancel the wait for the condition variable as last resort
+    DLT_LOG_CXX(*mLog, DLT_LOG_WARN, LOG_PREFIX, LOG_DEVICE, "Shutdown package could not be sent, canceling IPC thread");
+    pthread_cancel(mIpcThread->native_handle());
+    result = eIasFailed;
+  }
+  mIpcThread->join();
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "IPC thread successfully ended");
+  delete mIpcThread;
+  mIpcThread = nullptr;
+  return result;
+}
+
 void IasSmartXClient::setHwConstraints()
 {
   // Set the hardware device parameters.
@@ -133,8 +151,8 @@ void IasSmartXClient::ipcThread()
   IasAudioCommonResult result;
   while (mIsRunning.load() == true)
   {
-    // This call will block until either at least one package is received or
-    // pthread_cancel is called in the destructor
+    // This call will block until at least one package is received, either from the alsa-smartx-plugin
+    // or the shutdown package sent by stopIpcThread
     mInIpc->waitForPackage();
     while(mInIpc->packagesAvailable())
     {
@@ -147,7 +165,13 @@ void IasSmartXClient::ipcThread()
       // Check if the package is extractable
       if(eIasResultOk == mInIpc->pop_noblock<IasAudioIpcPluginControl>(&inControl))
       {
-        // Check the contents of the control
+        if (inControl == eIasAudioIpcInvalid && mIsRunning.load() == false)
+        {
+          // Shutdown package of stopIpcThread, there is nobody waiting for a response
+          break;
+        }
+        // Check the contents of the control. The response is sent before logging, because the
+        // alsa-smartx-plugin blocks until it receives the response.
         switch(inControl)
         {
           case eIasAudioIpcGetLatency:
@@ -170,17 +194,17 @@ void IasSmartXClient::ipcThread()
             break;
           }
           case eIasAudioIpcStart:
-            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control, session id=", mSessionId);
             outResponse.control = inControl;
             outResponse.response = eIasAudioIpcACK;
             result = mOutIpc->push<IasAudioIpcPluginControlResponse>(outResponse);
+            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control, session id=", mSessionId);
             putEventType(IasAudioDevice::eIasStart);
             break;
           case eIasAudioIpcStop:
-            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control, session id=", mSessionId);
             outResponse.control = inControl;
             outResponse.response = eIasAudioIpcACK;
             result = mOutIpc->push<IasAudioIpcPluginControlResponse>(outResponse);
+            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control, session id=", mSessionId);
             if (mDeviceType == eIasDeviceTypeSource)
             {
               // Reset the shared memory of the ALSA device in case it is a playback device.
@@ -195,28 +219,28 @@ void IasSmartXClient::ipcThread()
             putEventType(IasAudioDevice::eIasStop);
             break;
           case eIasAudioIpcDrain:
-            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control");
             outResponse.control = inControl;
             outResponse.response = eIasAudioIpcACK;
             result = mOutIpc->push<IasAudioIpcPluginControlResponse>(outResponse);
+            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control");
             break;
           case eIasAudioIpcPause:
-            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control");
             outResponse.control = inControl;
             outResponse.response = eIasAudioIpcACK;
             result = mOutIpc->push<IasAudioIpcPluginControlResponse>(outResponse);
+            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control");
             break;
           case eIasAudioIpcResume:
-            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control");
             outResponse.control = inControl;
             outResponse.response = eIasAudioIpcACK;
             result = mOutIpc->push<IasAudioIpcPluginControlResponse>(outResponse);
+            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control");
             break;
           default:
-            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control");
             outResponse.control = inControl;
             outResponse.response = eIasAudioIpcNAK;
             result = mOutIpc->push<IasAudioIpcPluginControlResponse>(outResponse);
+            DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_DEVICE, "Received", toString(inControl), "control");
         }
         if (result != eIasResultOk)
         {
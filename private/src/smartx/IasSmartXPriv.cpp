@@ -10,6 +10,9 @@
  */
 
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include "version.h"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "avbaudiomodules/internal/audio/common/IasCommonVersion.hpp"
@@ -21,6 +24,7 @@
 #include "smartx/IasProcessingImpl.hpp"
 #include "smartx/IasDebugImpl.hpp"
 #include "smartx/IasConfiguration.hpp"
+#include "smartx/IasDecoratorGuard.hpp"
 #include "audio/smartx/IasEventProvider.hpp"
 
 #include "smartx/IasConfigFile.hpp"
@@ -60,6 +64,7 @@ IasSmartXPriv::IasSmartXPriv()
   :mLog(IasAudioLogging::registerDltContext("SMX", "SmartX Common"))
   ,mConfig(nullptr)
   ,mSetup(nullptr)
+  ,mSetupImpl(nullptr)
   ,mRouting(nullptr)
   ,mProcessing(nullptr)
   ,mDebug(nullptr)
@@ -94,6 +99,12 @@ IasSmartXPriv::IasResult IasSmartXPriv::init()
   mSetup = setupHook(setup());
   mProcessing = processingHook(processing());
 
+  if (cfgFile->getPreloadPlugins() == IasConfigFile::eIasEnabled)
+  {
+    // Load the plug-in libraries while the topology is set up
+    mSetupImpl->preloadPluginLibraries();
+  }
+
   DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, "ias-audio-common version:", getLibCommonVersion());
   DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, "ias-audio-smartx version:", VERSION_STRING);
 
@@ -105,8 +116,9 @@ IasISetup* IasSmartXPriv::setup()
   if (mSetup == nullptr)
   {
     IAS_ASSERT(mConfig != nullptr);
-    mSetup = new IasSetupImpl(mConfig, mCmdDispatcher, mRouting);
-    IAS_ASSERT(mSetup != nullptr);
+    mSetupImpl = new IasSetupImpl(mConfig, mCmdDispatcher, mRouting);
+    IAS_ASSERT(mSetupImpl != nullptr);
+    mSetup = mSetupImpl;
   }
   return mSetup;
 }
@@ -148,12 +160,32 @@ IasSmartXPriv::IasResult IasSmartXPriv::start()
   IAS_ASSERT(mConfig != nullptr);
   IasSmartXPriv::IasResult result = eIasOk;
 
+  std::vector<IasRoutingZonePtr> routingZones;
+  for (const auto &entry : mConfig->getRoutingZoneMap())
+  {
+    routingZones.push_back(entry.second);
+  }
+  std::vector<IasAudioSourceDevicePtr> sourceDevices;
+  for (const auto &entry : mConfig->getSourceDeviceMap())
+  {
+    sourceDevices.push_back(entry.second);
+  }
+
+  IasConfigFile *cfgFile = IasConfigFile::getInstance();
+  IAS_ASSERT(cfgFile != nullptr);
+  const uint32_t numThreads = cfgFile->getStartupThreads();
+  if (numThreads > 1 && routingZones.size() + sourceDevices.size() > 1)
+  {
+    if (startParallel(routingZones, sourceDevices, numThreads) == false)
+    {
+      result = eIasFailed;
+    }
+    return result;
+  }
+
   // Iterate over all routing zones and start them.
-  const IasRoutingZoneMap &rznMap = mConfig->getRoutingZoneMap();
-  IasRoutingZoneMap::const_iterator rznMapIt;
-  for (rznMapIt=rznMap.begin(); rznMapIt != rznMap.end(); ++rznMapIt)
+  for (auto &routingZone : routingZones)
   {
-    IasRoutingZonePtr routingZone = (*rznMapIt).second;
     IasISetup::IasResult setres = setup()->startRoutingZone(routingZone);
     if (setres != IasISetup::eIasOk)
     {
@@ -162,11 +194,8 @@ IasSmartXPriv::IasResult IasSmartXPriv::start()
   }
 
   // Iterate over all source devices and start them.
-  const IasSourceDeviceMap &sdMap = mConfig->getSourceDeviceMap();
-  IasSourceDeviceMap::const_iterator sdMapIt;
-  for (sdMapIt=sdMap.begin(); sdMapIt != sdMap.end(); ++sdMapIt)
+  for (auto &audioSourceDevice : sourceDevices)
   {
-    IasAudioSourceDevicePtr audioSourceDevice = (*sdMapIt).second;
     IasISetup::IasResult setres = setup()->startAudioSourceDevice(audioSourceDevice);
     if (setres != IasISetup::eIasOk)
     {
@@ -177,6 +206,55 @@ IasSmartXPriv::IasResult IasSmartXPriv::start()
   return result;
 }
 
+bool IasSmartXPriv::startParallel(const std::vector<IasRoutingZonePtr> &routingZones,
+                                  const std::vector<IasAudioSourceDevicePtr> &sourceDevices, uint32_t numThreads)
+{
+  IAS_ASSERT(mSetupImpl != nullptr);
+  const uint32_t numZones = static_cast<uint32_t>(routingZones.size());
+  const uint32_t numJobs = numZones + static_cast<uint32_t>(sourceDevices.size());
+  numThreads = std::min(numThreads, numJobs);
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Starting", numZones, "routing zones and", sourceDevices.size(),
+              "source devices with", numThreads, "threads");
+
+  // The start of a routing zone or a source device only touches the zone, respectively the device, itself
+  // and its concrete device. Therefore, the setup implementation is called directly by the start-up threads,
+  // while the topology is locked once for all of them against concurrent calls of the decorated interfaces.
+  const IasDecoratorGuard lk{cIasLockPipeline, cIasLockTopology, __func__};
+  std::atomic<uint32_t> nextJob(0);
+  std::atomic<bool> success(true);
+  auto startJobs = [&]() {
+    for (uint32_t index = nextJob++; index < numJobs; index = nextJob++)
+    {
+      IasISetup::IasResult setres;
+      if (index < numZones)
+      {
+        setres = mSetupImpl->startRoutingZone(routingZones[index]);
+      }
+      else
+      {
+        setres = mSetupImpl->startAudioSourceDevice(sourceDevices[index - numZones]);
+      }
+      if (setres != IasISetup::eIasOk)
+      {
+        success = false;
+      }
+    }
+  };
+
+  // The calling thread is one of the start-up threads
+  std::vector<std::thread> threads;
+  for (uint32_t count = 1; count < numThreads; ++count)
+  {
+    threads.emplace_back(startJobs);
+  }
+  startJobs();
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  return success;
+}
+
 IasSmartXPriv::IasResult IasSmartXPriv::stop()
 {
   IAS_ASSERT(mConfig != nullptr);
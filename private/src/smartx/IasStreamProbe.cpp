@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/**
+ * @file   IasStreamProbe.cpp
+ * @date   2018
+ * @brief  Unbounded recording of an audio port or pin into a shared memory ring buffer.
+ */
+
+#include <algorithm>
+
+#include "smartx/IasStreamProbe.hpp"
+#include "smartx/IasSmartXClient.hpp"
+#include "model/IasAudioDevice.hpp"
+#include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
+#include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBuffer.hpp"
+#include "avbaudiomodules/internal/audio/common/helper/IasCopyAudioAreaBuffers.hpp"
+
+namespace IasAudio {
+
+static const std::string cClassName = "IasStreamProbe::";
+#define LOG_PREFIX cClassName + __func__ + "(" + std::to_string(__LINE__) + "):"
+#define LOG_STREAM "stream=" + mParams.name + ":"
+
+static const uint32_t cMinNumPeriods = 4;       //!< Minimum number of periods of the shm ring buffer
+static const uint32_t cBufferSizeMs  = 1000;    //!< Time the reader may be delayed before blocks are dropped
+
+IasStreamProbe::IasStreamProbe(const IasStreamProbeParams &params)
+  :mLog(IasAudioLogging::registerDltContext("DBG", "SmartX Debug"))
+  ,mParams(params)
+  ,mDeviceParams(nullptr)
+  ,mSmartXClient(nullptr)
+  ,mRingBuffer(nullptr)
+  ,mFrameAreas(params.numChannels)
+  ,mIsOverrun(false)
+  ,mNumFramesWritten(0)
+  ,mNumFramesDropped(0)
+  ,mNumOverruns(0)
+{
+}
+
+IasStreamProbe::~IasStreamProbe()
+{
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_STREAM, "Stream probe closed,",
+              "framesWritten=", mNumFramesWritten.load(), "framesDropped=", mNumFramesDropped.load(),
+              "overruns=", mNumOverruns.load());
+  mRingBuffer = nullptr;
+  mSmartXClient = nullptr;
+}
+
+IasStreamProbe::IasResult IasStreamProbe::init()
+{
+  if (mParams.name.empty() || mParams.numChannels == 0 || mParams.sampleRate == 0 || mParams.periodSize == 0)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_STREAM, "Invalid parameters, numChannels=", mParams.numChannels,
+                "sampleRate=", mParams.sampleRate, "periodSize=", mParams.periodSize);
+    return eIasFailed;
+  }
+  mDeviceParams = std::make_shared<IasAudioDeviceParams>();
+  IAS_ASSERT(mDeviceParams != nullptr);
+  mDeviceParams->name = mParams.name;
+  mDeviceParams->numChannels = mParams.numChannels;
+  mDeviceParams->samplerate = mParams.sampleRate;
+  mDeviceParams->dataFormat = mParams.dataFormat;
+  mDeviceParams->clockType = eIasClockProvided;
+  mDeviceParams->periodSize = mParams.periodSize;
+  mDeviceParams->numPeriods = std::max(cMinNumPeriods, (mParams.sampleRate * cBufferSizeMs / 1000) / mParams.periodSize);
+
+  // The probe acts like a SmartX sink device, i.e. SmartX writes and the alsa-smartx-plugin reads.
+  mSmartXClient = std::make_shared<IasSmartXClient>(mDeviceParams);
+  IAS_ASSERT(mSmartXClient != nullptr);
+  if (mSmartXClient->init(eIasDeviceTypeSink) != IasSmartXClient::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, LOG_STREAM, "Error creating the shared memory ring buffer");
+    mSmartXClient = nullptr;
+    return eIasFailed;
+  }
+  if (mSmartXClient->getRingBuffer(&mRingBuffer) != IasSmartXClient::eIasOk)
+  {
+    mSmartXClient = nullptr;
+    return eIasFailed;
+  }
+  mSmartXClient->enableEventQueue(true);
+  DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, LOG_STREAM, "Stream probe created, numChannels=", mParams.numChannels,
+              "sampleRate=", mParams.sampleRate, "periodSize=", mParams.periodSize, "numPeriods=", mDeviceParams->numPeriods);
+  return eIasOk;
+}
+
+void IasStreamProbe::handleClientEvents()
+{
+  IasAudioDevice::IasEventType eventType = IasAudioDevice::eIasNoEvent;
+  while ((eventType = mSmartXClient->getNextEventType()) != IasAudioDevice::eIasNoEvent)
+  {
+    if (eventType == IasAudioDevice::eIasStop)
+    {
+      // Start the next reader session with an empty buffer instead of stale data.
+      mRingBuffer->resetFromReader();
+      mIsOverrun = false;
+    }
+  }
+}
+
+void IasStreamProbe::process(const IasAudioArea *areas, IasAudioCommonDataFormat dataFormat, uint32_t offset, uint32_t numFrames)
+{
+  if (mRingBuffer == nullptr || areas == nullptr || numFrames == 0)
+  {
+    return;
+  }
+  handleClientEvents();
+
+  uint32_t numFramesFree = 0;
+  mRingBuffer->updateAvailable(eIasRingBufferAccessWrite, &numFramesFree);
+  if (numFramesFree < numFrames)
+  {
+    // The reader does not keep up or is not attached at all. Drop the whole block, so that
+    // the reader sees at most one gap per overrun event.
+    if (mIsOverrun == false)
+    {
+      mIsOverrun = true;
+      mNumOverruns.fetch_add(1, std::memory_order_relaxed);
+    }
+    mNumFramesDropped.fetch_add(numFrames, std::memory_order_relaxed);
+    return;
+  }
+  mIsOverrun = false;
+
+  uint32_t numFramesRemaining = numFrames;
+  uint32_t srcOffset = offset;
+  while (numFramesRemaining > 0)
+  {
+    IasAudioArea *shmAreas = nullptr;
+    uint32_t shmOffset = 0;
+    uint32_t shmNumFrames = numFramesRemaining;
+    IasAudioRingBufferResult rbres = mRingBuffer->beginAccess(eIasRingBufferAccessWrite, &shmAreas, &shmOffset, &shmNumFrames);
+    if (rbres != eIasRingBuffOk || shmNumFrames == 0)
+    {
+      mNumFramesDropped.fetch_add(numFramesRemaining, std::memory_order_relaxed);
+      return;
+    }
+    copyAudioAreaBuffers(shmAreas, mParams.dataFormat, shmOffset, mParams.numChannels, 0, shmNumFrames,
+                         areas, dataFormat, srcOffset, mParams.numChannels, mParams.index, shmNumFrames);
+    mRingBuffer->endAccess(eIasRingBufferAccessWrite, shmOffset, shmNumFrames);
+    numFramesRemaining -= shmNumFrames;
+    srcOffset += shmNumFrames;
+  }
+  mNumFramesWritten.fetch_add(numFrames, std::memory_order_relaxed);
+}
+
+void IasStreamProbe::process(const IasAudioFrame &audioFrame, uint32_t stride, uint32_t numFrames)
+{
+  const uint32_t numChannels = std::min(static_cast<uint32_t>(mFrameAreas.size()), static_cast<uint32_t>(audioFrame.size()));
+  for (uint32_t chan = 0; chan < numChannels; ++chan)
+  {
+    mFrameAreas[chan].start = audioFrame[chan];
+    mFrameAreas[chan].first = 0;
+    mFrameAreas[chan].step = static_cast<uint32_t>(8 * sizeof(float) * stride); // expressed in bits
+    mFrameAreas[chan].index = chan;
+    mFrameAreas[chan].maxIndex = numChannels - 1;
+  }
+  if (numChannels < mFrameAreas.size())
+  {
+    return;
+  }
+  process(mFrameAreas.data(), eIasFormatFloat32, 0, numFrames);
+}
+
+void IasStreamProbe::getStatistics(IasIDebug::IasStreamProbeStatistics *statistics) const
+{
+  if (statistics == nullptr)
+  {
+    return;
+  }
+  statistics->numFramesWritten = mNumFramesWritten.load(std::memory_order_relaxed);
+  statistics->numFramesDropped = mNumFramesDropped.load(std::memory_order_relaxed);
+  statistics->numOverruns = mNumOverruns.load(std::memory_order_relaxed);
+}
+
+} // namespace IasAudio
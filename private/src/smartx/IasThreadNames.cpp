@@ -13,6 +13,7 @@
 #include <iomanip>
 #include <sched.h>
 #include "smartx/IasThreadNames.hpp"
+#include "smartx/IasRtLog.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 
 
@@ -93,6 +94,11 @@ void IasThreadNames::setThreadName(IasThreadType type, const std::string &descri
   int32_t result = pthread_setname_np(pthread_self(), threadName.str().c_str());
   IAS_ASSERT(result == 0);
   (void)result;
+  if (type == eIasRealTime)
+  {
+    // Preallocate the log ring, so the first log of the real-time thread does not allocate memory.
+    IasRtLog::registerThread(fulltext.str());
+  }
 }
 
 
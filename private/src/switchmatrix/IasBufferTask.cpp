@@ -12,6 +12,9 @@
 #include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBuffer.hpp"
 #include "avbaudiomodules/internal/audio/common/IasDataProbe.hpp"
 #include "avbaudiomodules/internal/audio/common/IasDataProbeHelper.hpp"
+#include "smartx/IasLatencyProbe.hpp"
+#include "smartx/IasRtLog.hpp"
+#include "smartx/IasIStreamTap.hpp"
 #include "switchmatrix/IasSwitchMatrixJob.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "audio/smartx/IasEventProvider.hpp"
@@ -40,6 +43,8 @@ IasBufferTask::IasBufferTask(IasAudioPortPtr src,
   ,mIsDummy(isDummy)
   ,mDataProbe(nullptr)
   ,mProbingActive(false)
+  ,mLatencyProbeSlots()
+  ,mStreamTapSlots()
   ,mSourceState(eIasSourceUnderrun)
 {
   IAS_ASSERT(readSize != 0);
@@ -109,7 +114,7 @@ IasBufferTask::IasResult IasBufferTask::doDummy()
 
 std::set<IasSwitchMatrixJobPtr>::iterator IasBufferTask::deleteJob(std::set<IasSwitchMatrixJobPtr>::iterator jobIt, IasJobAction jobAction)
 {
-  DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, "Delete job for", mOrigin->getName());
+  IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, "Delete job for", mOrigin->getName());
   int32_t sourcePort = (*jobIt)->getSourcePortId();
   int32_t sinkPort = (*jobIt)->getSinkPortId();
   jobIt = mJobs.erase(jobIt);
@@ -139,7 +144,7 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
   {
     if (entry.second == eIasAddJob)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, "Adding new job for", mOrigin->getName());
+      IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, "Adding new job for", mOrigin->getName());
       mJobs.insert(entry.first);
       IasConnectionEventPtr event = mEventProvider->createConnectionEvent();
       event->setEventType(IasConnectionEvent::eIasConnectionEstablished);
@@ -155,13 +160,13 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
     }
     else
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Delete all jobs for source", mOrigin->getName());
+      IAS_RT_LOG(*mLog, DLT_LOG_INFO, "Delete all jobs for source", mOrigin->getName());
       auto jobIt = mJobs.begin();
       while (jobIt != mJobs.end())
       {
         if(mSrcPort == (*jobIt)->getSourcePort())
         {
-          DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Job found for source", mOrigin->getName(),
+          IAS_RT_LOG(*mLog, DLT_LOG_INFO, "Job found for source", mOrigin->getName(),
               "and sink", (*jobIt)->getSinkPort()->getParameters()->name);
           jobIt = deleteJob(jobIt, eIasDeleteAllSourceJobs);
         }
@@ -179,13 +184,16 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
     IasDataProbe::IasResult probeRes = IasDataProbeHelper::processQueueEntry(probingQueueEntry, &mDataProbe, &mProbingActive, mSourcePeriodSize);
     if (probeRes != IasDataProbe::eIasOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "error during ", toString(probingQueueEntry.action),"for", mOrigin->getName(), ":", toString(probeRes));
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "error during ", probingQueueEntry.action,"for", mOrigin->getName(), ":", probeRes);
     }
   }
 
+  mLatencyProbeSlots.update();
+  mStreamTapSlots.update();
+
   if(mJobs.begin() == mJobs.end())
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "no more jobs to execute for", mOrigin->getName());
+    IAS_RT_LOG(*mLog, DLT_LOG_INFO, "no more jobs to execute for", mOrigin->getName());
     return eIasNoJobs;
   }
   uint32_t srcSamples = 0;
@@ -201,12 +209,12 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
     IasAudioRingBufferResult rbres = mOrigin->updateAvailable(eIasRingBufferAccessRead, &srcSamples);
     if(rbres != eIasRingBuffOk)
     {
-     DLT_LOG_CXX(*mLog, DLT_LOG_WARN, LOG_PREFIX,"Error can not access ring buffer", mOrigin->getName(), "for read: ", toString(rbres).c_str());
+     IAS_RT_LOG(*mLog, DLT_LOG_WARN, "Error can not access ring buffer", mOrigin->getName(), "for read: ", rbres);
     }
-    DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX,"wants to have at least",mSourcePeriodSize,"samples");
+    IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, "wants to have at least",mSourcePeriodSize,"samples");
     if (srcSamples == 0 && mSourceState != eIasSourceUnderrun)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_WARN, LOG_PREFIX, mOrigin->getName(), "underrun , but still", framesStillToConsume,"sample to process");
+      IAS_RT_LOG(*mLog, DLT_LOG_WARN, mOrigin->getName(), "underrun , but still", framesStillToConsume,"sample to process");
       mSourceState = eIasSourceUnderrun;
       if(framesStillToConsume == 0)
       {
@@ -219,7 +227,7 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
     }
     if (srcSamples >= mSourcePeriodSize && mSourceState == eIasSourceUnderrun)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_WARN, LOG_PREFIX, mOrigin->getName(), "playing !!");
+      IAS_RT_LOG(*mLog, DLT_LOG_WARN, mOrigin->getName(), "playing !!");
       mSourceState = eIasSourcePlaying;
     }
 
@@ -231,7 +239,7 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
     rbres = mOrigin->beginAccess(eIasRingBufferAccessRead, &areas, &srcOffset, &framesToRead);
     if(rbres != eIasRingBuffOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,"Error begin accessing ring buffer", mOrigin->getName(), "for read: ", toString(rbres).c_str());
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "Error begin accessing ring buffer", mOrigin->getName(), "for read: ", rbres);
     }
     IAS_ASSERT(areas != nullptr);
     if(framesStillToConsume != 0 )
@@ -246,11 +254,26 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
       IasDataProbe::IasResult probeRes = mDataProbe->process(areas,srcOffset,framesToRead);
       if(probeRes != IasDataProbe::eIasOk)
       {
-        DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "delete probe");
+        IAS_RT_LOG(*mLog, DLT_LOG_INFO, "delete probe");
         mProbingActive.store(false);
         mDataProbe = nullptr;
       }
     }
+    IasLatencyProbe *latencyProbe = mLatencyProbeSlots.getProbe();
+    IasIStreamTap *streamTap = mStreamTapSlots.getProbe();
+    if((latencyProbe != nullptr) || (streamTap != nullptr))
+    {
+      IasAudioCommonDataFormat dataFormat;
+      mOrigin->getDataFormat(&dataFormat);
+      if(latencyProbe != nullptr)
+      {
+        latencyProbe->inject(areas, dataFormat, srcOffset, framesToRead, srcSamples);
+      }
+      if(streamTap != nullptr)
+      {
+        streamTap->process(areas, dataFormat, srcOffset, framesToRead);
+      }
+    }
     for( auto &entry : mJobs)
     {
       IasSwitchMatrixJob::IasResult smjres = entry->updateSrcAreas(areas);
@@ -259,7 +282,7 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
       uint32_t prevFramesConsumed = framesConsumed;
       if(entry->execute(srcOffset,framesToRead, &framesStillToConsume, &framesConsumed))
       {
-        DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error executing job for", mOrigin->getName(),"with src", entry->getSourcePort()->getParameters()->id, "and sink", entry->getSourcePort()->getParameters()->id);
+        IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "Error executing job for", mOrigin->getName(),"with src", entry->getSourcePort()->getParameters()->id, "and sink", entry->getSourcePort()->getParameters()->id);
       }
       framesConsumed = std::max(framesConsumed, prevFramesConsumed);
     }
@@ -270,7 +293,7 @@ IasBufferTask::IasResult IasBufferTask::doJobs()
     rbres = mOrigin->endAccess(eIasRingBufferAccessRead, srcOffset, framesConsumed);
     if(rbres != eIasRingBuffOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,"Error end accessing", mOrigin->getName(),"for read: ",  toString(rbres).c_str());
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "Error end accessing", mOrigin->getName(),"for read: ",  rbres);
     }
   }while(framesStillToConsume != 0);
   if (lockAfterLoop == true)
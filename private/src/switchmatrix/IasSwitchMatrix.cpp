@@ -16,6 +16,7 @@
 #include "switchmatrix/IasSwitchMatrixJob.hpp"
 #include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBuffer.hpp"
 #include "smartx/IasConfigFile.hpp"
+#include "smartx/IasRtLog.hpp"
 
 namespace IasAudio {
 
@@ -334,12 +335,12 @@ IasSwitchMatrix::IasResult IasSwitchMatrix::trigger()
   {
     if (entry.second == eIasAddBufferTask)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, "Adding new buffer task");
+      IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, "Adding new buffer task");
       mBufferTasks.push_back(entry.first);
     }
     else
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, "Delete buffer task");
+      IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, "Delete buffer task");
       // Before deleting the buffer task, we have to trigger it one more time to send all possible
       // disconnect events first.
       // If we don't do that, the buffer task will be deleted before the disconnect of a job is actually done
@@ -357,10 +358,10 @@ IasSwitchMatrix::IasResult IasSwitchMatrix::trigger()
 
   for (auto &task : mBufferTasks)
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, "worker ",mName,": Doing buffer tasks");
+    IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, "worker ",mName,": Doing buffer tasks");
     if(task->isDummy() == true)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, ": Worker ",mName," doingDummy");
+      IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, ": Worker ",mName," doingDummy");
       task->doDummy();
     }
     else
@@ -528,6 +529,58 @@ IasSwitchMatrix::IasResult IasSwitchMatrix::startProbing(IasAudioPortPtr port,
   return eIasOk;
 }
 
+IasLatencyProbeSlots* IasSwitchMatrix::getLatencyProbeSlots(IasAudioPortPtr port)
+{
+  IasSwitchMatrixJobPtr job = nullptr;
+  IasBufferTaskPtr task = nullptr;
+  if (findProbeLocation(port, &job, &task) == false)
+  {
+    return nullptr;
+  }
+  return (job != nullptr) ? &job->getLatencyProbeSlots() : &task->getLatencyProbeSlots();
+}
+
+IasStreamTapSlots* IasSwitchMatrix::getStreamTapSlots(IasAudioPortPtr port)
+{
+  IasSwitchMatrixJobPtr job = nullptr;
+  IasBufferTaskPtr task = nullptr;
+  if (findProbeLocation(port, &job, &task) == false)
+  {
+    return nullptr;
+  }
+  return (job != nullptr) ? &job->getStreamTapSlots() : &task->getStreamTapSlots();
+}
+
+bool IasSwitchMatrix::findProbeLocation(IasAudioPortPtr port, std::shared_ptr<IasSwitchMatrixJob> *job, IasBufferTaskPtr *task)
+{
+  IAS_ASSERT(port != nullptr);
+  IAS_ASSERT(job != nullptr);
+  IAS_ASSERT(task != nullptr);
+  if (port->getParameters()->direction == eIasPortDirectionInput)
+  {
+    for(auto &entry : mTaskMap)
+    {
+      *job = entry.second->findJob(port);
+      if (*job != nullptr)
+      {
+        return true;
+      }
+    }
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, ": No switch matrix job found for", port->getParameters()->name);
+    return false;
+  }
+  IasAudioRingBuffer* ringbuf = nullptr;
+  port->getRingBuffer(&ringbuf);
+  auto taskIt = mTaskMap.find(ringbuf);
+  if (taskIt == mTaskMap.end())
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, ": No connection active for", port->getParameters()->name);
+    return false;
+  }
+  *task = taskIt->second;
+  return true;
+}
+
 void IasSwitchMatrix::unlockJobs()
 {
   for ( auto &task : mBufferTasks)
@@ -13,6 +13,9 @@
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "avbaudiomodules/internal/audio/common/IasDataProbe.hpp"
 #include "avbaudiomodules/internal/audio/common/IasDataProbeHelper.hpp"
+#include "smartx/IasLatencyProbe.hpp"
+#include "smartx/IasRtLog.hpp"
+#include "smartx/IasIStreamTap.hpp"
 #include "avbaudiomodules/internal/audio/common/helper/IasCopyAudioAreaBuffers.hpp"
 #include "avbaudiomodules/internal/audio/common/samplerateconverter/IasSrcWrapperBase.hpp"
 #include "avbaudiomodules/internal/audio/common/samplerateconverter/IasSrcWrapper.hpp"
@@ -40,6 +43,8 @@ IasSwitchMatrixJob::IasSwitchMatrixJob(const IasAudioPortPtr src, const IasAudio
   ,mNumFramesStillToProcess(0)
   ,mJobTask(eIasJobSimpleCopy)
   ,mProbingActive(false)
+  ,mLatencyProbeSlots()
+  ,mStreamTapSlots()
   ,mSampleFormatConv(eIasInt16Int16)
   ,mLocked(true)
   ,mSizeFactor(0.0f)
@@ -198,7 +203,7 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::execute(uint32_t  srcOffset,
     if (mLogCnt > mLogInterval || mLogCnt == 0)
     {
       mLogCnt = 0;
-      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX,"Job between", mSrc->getParameters()->name, "and", mSink->getParameters()->name, "is locked, unlock to execute");
+      IAS_RT_LOG(*mLog, DLT_LOG_INFO, "Job between", mSrc->getParameters()->name, "and", mSink->getParameters()->name, "is locked, unlock to execute");
     }
     mLogCnt++;
 
@@ -214,9 +219,11 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::execute(uint32_t  srcOffset,
     IasDataProbe::IasResult probeRes = IasDataProbeHelper::processQueueEntry(probingQueueEntry, &mDataProbe, &mProbingActive, mDestSize);
     if (probeRes != IasDataProbe::eIasOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "error during ", toString(probingQueueEntry.action)," :", toString(probeRes));
+      IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "error during ", probingQueueEntry.action," :", probeRes);
     }
   }
+  mLatencyProbeSlots.update();
+  mStreamTapSlots.update();
 
   if (mJobTask == eIasJobSimpleCopy)
   {
@@ -253,7 +260,7 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::copy(uint32_t srcOffset,
 
   uint32_t numSamplesToCopy = std::min(mDestSize,framesToRead);
   numSamplesToCopy = std::min(numSamplesToCopy,sinkSamples); //to guarantee only to copy as much as there is space
-  DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, "copy", numSamplesToCopy, "samples from", srcParams->name, "to", sinkParams->name, "space available=", sinkSamples);
+  IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, "copy", numSamplesToCopy, "samples from", srcParams->name, "to", sinkParams->name, "space available=", sinkSamples);
   copyAudioAreaBuffers(mSinkCopyInfos.areas,mSinkCopyInfos.dataFormat,sinkOffset,mSinkCopyInfos.numChannels,sinkParams->index,numSamplesToCopy,
                        mSrcCopyInfos.areas, mSrcCopyInfos.dataFormat,srcOffset,mSrcCopyInfos.numChannels,srcParams->index, numSamplesToCopy );
 
@@ -262,11 +269,12 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::copy(uint32_t srcOffset,
     IasDataProbe::IasResult probeRes = mDataProbe->process(mSinkCopyInfos.areas, sinkOffset,numSamplesToCopy);
     if (probeRes != IasDataProbe::eIasOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "delete probe");
+      IAS_RT_LOG(*mLog, DLT_LOG_INFO, "delete probe");
       mProbingActive.store(false);
       mDataProbe = nullptr;
     }
   }
+  processProbeSlots(sinkOffset, numSamplesToCopy);
   rbres = sinkBuffer->endAccess(eIasRingBufferAccessWrite, sinkOffset, numSamplesToCopy);
   IAS_ASSERT(rbres == eIasRingBuffOk);
   *framesConsumed = numSamplesToCopy;
@@ -300,7 +308,7 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::sampleRateConvert(uint32_t src
     *framesStillToConsume = 0;
     *framesConsumed = 0;
     mSrcWrapper->reset();
-    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "SRC reset, due to no input data");
+    IAS_RT_LOG(*mLog, DLT_LOG_INFO, "SRC reset, due to no input data");
     return eIasOk;
   }
   uint32_t numSourceSamples = framesToRead;
@@ -310,7 +318,7 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::sampleRateConvert(uint32_t src
   rbres = sinkBuffer->beginAccess(eIasRingBufferAccessWrite, &(mSinkCopyInfos.areas), &sinkOffset, &sinkSamples);
   if(rbres != eIasRingBuffOk)
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "result of begin ringbuffer access ",toString(rbres).c_str(), "for", sinkBuffer->getName());
+    IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "result of begin ringbuffer access ",rbres, "for", sinkBuffer->getName());
   }
   IAS_ASSERT(rbres == eIasRingBuffOk);
   sinkSamples = std::min(sinkSamples,mNumFramesStillToProcess);
@@ -322,7 +330,7 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::sampleRateConvert(uint32_t src
                                                         sinkOffset);
   if(srcWrapRes)
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX " Error processing sample rate converter: result = ", toString(srcResult), "for", sinkBuffer->getName());
+    IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "Error processing sample rate converter: result = ", srcResult, "for", sinkBuffer->getName());
     return eIasFailed;
   }
 
@@ -331,19 +339,20 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::sampleRateConvert(uint32_t src
     IasDataProbe::IasResult probeRes = mDataProbe->process(mSinkCopyInfos.areas, sinkOffset,numOutputGenerated);
     if (probeRes != IasDataProbe::eIasOk)
     {
-      DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "delete probe for", sinkBuffer->getName());
+      IAS_RT_LOG(*mLog, DLT_LOG_INFO, "delete probe for", sinkBuffer->getName());
       mProbingActive.store(false);
       mDataProbe = nullptr;
     }
   }
+  processProbeSlots(sinkOffset, numOutputGenerated);
 
   rbres = sinkBuffer->endAccess(eIasRingBufferAccessWrite, sinkOffset, numOutputGenerated);
   if(rbres != eIasRingBuffOk)
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "result of end ringbuffer access ",toString(rbres).c_str(), "for", sinkBuffer->getName());
+    IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "result of end ringbuffer access ",rbres, "for", sinkBuffer->getName());
   }
   IAS_ASSERT(rbres == eIasRingBuffOk);
-  DLT_LOG_CXX(*mLog, DLT_LOG_VERBOSE, LOG_PREFIX, "written",numOutputGenerated,"and consumed",numInputConsumed,"samples");
+  IAS_RT_LOG(*mLog, DLT_LOG_VERBOSE, "written",numOutputGenerated,"and consumed",numInputConsumed,"samples");
   mNumFramesStillToProcess -= numOutputGenerated;
 
   if(mNumFramesStillToProcess == 0)
@@ -370,7 +379,7 @@ IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::updateSrcAreas(IasAudioArea* s
   }
   else
   {
-    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "passed NULL pointer to function, ");
+    IAS_RT_LOG(*mLog, DLT_LOG_ERROR, "passed NULL pointer to function, ");
     return eIasFailed;
   }
 }
@@ -382,6 +391,20 @@ void IasSwitchMatrixJob::stopProbe()
   mProbingQueue.push(entry);
 }
 
+void IasSwitchMatrixJob::processProbeSlots(uint32_t sinkOffset, uint32_t numFrames)
+{
+  IasLatencyProbe *latencyProbe = mLatencyProbeSlots.getProbe();
+  if(latencyProbe != nullptr)
+  {
+    latencyProbe->detect(mSinkCopyInfos.areas, mSinkCopyInfos.dataFormat, sinkOffset, numFrames, 0);
+  }
+  IasIStreamTap *streamTap = mStreamTapSlots.getProbe();
+  if(streamTap != nullptr)
+  {
+    streamTap->process(mSinkCopyInfos.areas, mSinkCopyInfos.dataFormat, sinkOffset, numFrames);
+  }
+}
+
 IasSwitchMatrixJob::IasResult IasSwitchMatrixJob::startProbe(const std::string& fileNamePrefix,
                                                              bool bInject,
                                                              uint32_t numSeconds,
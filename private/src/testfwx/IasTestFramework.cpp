@@ -12,6 +12,10 @@
 #include "testfwx/IasTestFrameworkPriv.hpp"
 #include "audio/testfwx/IasTestFramework.hpp"
 
+#include <chrono>
+#include <thread>
+#include <vector>
+
 
 
 namespace IasAudio {
@@ -19,6 +23,8 @@ namespace IasAudio {
 
 std::atomic_int IasTestFramework::mNumberInstances(0);
 
+static const int32_t cNumberInstancesBenchmark = -1;  //!< Value of mNumberInstances while the static benchmark owns its instances
+
 
 IasTestFramework::IasTestFramework()
   :mPriv(nullptr)
@@ -91,6 +97,127 @@ IasTestFramework::IasResult IasTestFramework::process(uint32_t numPeriods)
 }
 
 
+IasTestFramework::IasResult IasTestFramework::benchmark(uint32_t numPeriods, IasBenchmarkResult *result)
+{
+  IAS_ASSERT(mPriv != nullptr);
+  if (result == nullptr)
+  {
+    return eIasNullPointer;
+  }
+  IasResult res = static_cast<IasTestFramework::IasResult>(mPriv->prepareBenchmark(numPeriods));
+  if (res != eIasOk)
+  {
+    return res;
+  }
+  return static_cast<IasTestFramework::IasResult>(mPriv->runBenchmark(numPeriods, result));
+}
+
+
+IasTestFramework::IasResult IasTestFramework::benchmark(const IasPipelineParams &pipelineParams,
+                                                        const IasSetupFunction &setupFunction,
+                                                        const IasBenchmarkParams &params,
+                                                        IasBenchmarkResult *result)
+{
+  if (result == nullptr)
+  {
+    return eIasNullPointer;
+  }
+  if (!setupFunction || params.numPeriods == 0 || params.numInstances == 0)
+  {
+    return eIasFailed;
+  }
+  // The instances of the benchmark are not registered as application instance, so neither create nor destroy
+  // can be used while they exist, not even by the setup function.
+  int32_t expected = 0;
+  if (mNumberInstances.compare_exchange_strong(expected, cNumberInstancesBenchmark) == false)
+  {
+    return eIasFailed;
+  }
+
+  IasResult res = eIasOk;
+  std::vector<IasTestFramework*> instances;
+  for (uint32_t instanceIdx = 0; (instanceIdx < params.numInstances) && (res == eIasOk); ++instanceIdx)
+  {
+    IasTestFramework *testFramework = new IasTestFramework();
+    IAS_ASSERT(testFramework != nullptr);
+    instances.push_back(testFramework);
+    res = testFramework->init(pipelineParams);
+    if (res == eIasOk)
+    {
+      res = setupFunction(testFramework, instanceIdx);
+    }
+    if (res == eIasOk)
+    {
+      res = testFramework->start();
+    }
+    if (res == eIasOk)
+    {
+      res = static_cast<IasTestFramework::IasResult>(testFramework->mPriv->prepareBenchmark(params.numPeriods));
+    }
+  }
+
+  if (res == eIasOk)
+  {
+    std::vector<IasBenchmarkResult> instanceResults(instances.size());
+    std::vector<IasResult> instanceRes(instances.size(), eIasFailed);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> threads;
+    for (uint32_t instanceIdx = 0; instanceIdx < instances.size(); ++instanceIdx)
+    {
+      threads.push_back(std::thread([&, instanceIdx]()
+      {
+        while (go.load() == false)
+        {
+          std::this_thread::yield();
+        }
+        instanceRes[instanceIdx] = static_cast<IasTestFramework::IasResult>(
+          instances[instanceIdx]->mPriv->runBenchmark(params.numPeriods, &instanceResults[instanceIdx]));
+      }));
+    }
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto &thread : threads)
+    {
+      thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    *result = instanceResults[0];
+    result->numInstances = static_cast<uint32_t>(instances.size());
+    result->processTimeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    result->numAllocations = 0;
+    for (auto &moduleTime : result->moduleTimes)
+    {
+      moduleTime.processTimeNs = 0;
+    }
+    for (uint32_t instanceIdx = 0; instanceIdx < instances.size(); ++instanceIdx)
+    {
+      if (instanceRes[instanceIdx] != eIasOk)
+      {
+        res = instanceRes[instanceIdx];
+        continue;
+      }
+      const IasBenchmarkResult &instanceResult = instanceResults[instanceIdx];
+      result->numAllocations += instanceResult.numAllocations;
+      for (uint32_t moduleIdx = 0; moduleIdx < result->moduleTimes.size() && moduleIdx < instanceResult.moduleTimes.size(); ++moduleIdx)
+      {
+        result->moduleTimes[moduleIdx].processTimeNs += instanceResult.moduleTimes[moduleIdx].processTimeNs;
+      }
+    }
+    result->realtimeFactor = (result->processTimeNs > 0) ?
+      static_cast<float>(result->audioTimeNs) * static_cast<float>(result->numInstances) / static_cast<float>(result->processTimeNs) : 0.0f;
+  }
+
+  for (auto testFramework : instances)
+  {
+    testFramework->stop();
+    delete testFramework;
+  }
+  mNumberInstances.store(0);
+  return res;
+}
+
+
 IasTestFrameworkSetup* IasTestFramework::setup()
 {
   IAS_ASSERT(mPriv != nullptr);
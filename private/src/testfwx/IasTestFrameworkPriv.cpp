@@ -14,6 +14,7 @@
 #include "testfwx/IasTestFrameworkConfiguration.hpp"
 #include "testfwx/IasTestFrameworkTypes.hpp"
 #include "testfwx/IasTestFrameworkRoutingZone.hpp"
+#include "testfwx/IasTestFrameworkAllocationCounter.hpp"
 #include "smartx/IasProcessingImpl.hpp"
 #include "smartx/IasDebugImpl.hpp"
 #include "rtprocessingfwx/IasCmdDispatcher.hpp"
@@ -23,6 +24,8 @@
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "model/IasPipeline.hpp"
 
+#include <chrono>
+
 
 namespace IasAudio {
 
@@ -254,6 +257,86 @@ IasTestFrameworkPriv::IasResult IasTestFrameworkPriv::process(uint32_t numPeriod
 }
 
 
+IasTestFrameworkPriv::IasResult IasTestFrameworkPriv::prepareBenchmark(uint32_t numPeriods)
+{
+  IAS_ASSERT(mConfig != nullptr);
+
+  const IasTestFrameworkRoutingZonePtr routingZone = mConfig->getTestFrameworkRoutingZone();
+  IAS_ASSERT(routingZone != nullptr);
+
+  IasTestFrameworkRoutingZone::IasResult res = routingZone->preloadInputs(numPeriods);
+  if (res != IasTestFrameworkRoutingZone::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Failed to preload input files, error ", toString(res));
+    return eIasFailed;
+  }
+
+  return eIasOk;
+}
+
+
+IasTestFrameworkPriv::IasResult IasTestFrameworkPriv::runBenchmark(uint32_t numPeriods, IasBenchmarkResult *result)
+{
+  IAS_ASSERT(mConfig != nullptr);
+  if (result == nullptr)
+  {
+    return eIasNullPointer;
+  }
+
+  const IasTestFrameworkRoutingZonePtr routingZone = mConfig->getTestFrameworkRoutingZone();
+  IAS_ASSERT(routingZone != nullptr);
+  IasPipelinePtr pipeline = mConfig->getTestFrameworkPipeline();
+  IAS_ASSERT(pipeline != nullptr);
+
+  if (pipeline->enableModuleTiming(true) != IasPipeline::eIasOk)
+  {
+    return eIasFailed;
+  }
+
+  const bool countAllocations = (&getNumThreadAllocations != nullptr);
+  const uint64_t numAllocationsBefore = countAllocations ? getNumThreadAllocations() : 0;
+  const auto start = std::chrono::steady_clock::now();
+  IasTestFrameworkRoutingZone::IasResult res = routingZone->processPreloadedPeriods(numPeriods);
+  const auto end = std::chrono::steady_clock::now();
+  const uint64_t numAllocationsAfter = countAllocations ? getNumThreadAllocations() : 0;
+
+  pipeline->enableModuleTiming(false);
+  if (res != IasTestFrameworkRoutingZone::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Benchmark processing failed with error ", toString(res));
+    return eIasFailed;
+  }
+
+  const IasPipelineParamsPtr pipelineParams = pipeline->getParameters();
+  result->numInstances = 1;
+  result->numPeriods = numPeriods;
+  result->audioTimeNs = static_cast<uint64_t>(numPeriods) * pipelineParams->periodSize * 1000000000ull / pipelineParams->samplerate;
+  result->processTimeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  result->realtimeFactor = (result->processTimeNs > 0) ? static_cast<float>(result->audioTimeNs) / static_cast<float>(result->processTimeNs) : 0.0f;
+  result->allocationsCounted = countAllocations;
+  result->numAllocations = numAllocationsAfter - numAllocationsBefore;
+  IasPipeline::IasModuleTimeVector moduleTimes;
+  pipeline->getModuleTimes(&moduleTimes);
+  result->moduleTimes.clear();
+  for (auto &moduleTime : moduleTimes)
+  {
+    result->moduleTimes.push_back(IasBenchmarkModuleTime(moduleTime.first, moduleTime.second));
+  }
+
+  if (countAllocations == true)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Processed", numPeriods, "periods in", result->processTimeNs, "ns, realtime factor",
+                result->realtimeFactor, ", allocations", result->numAllocations);
+  }
+  else
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_INFO, LOG_PREFIX, "Processed", numPeriods, "periods in", result->processTimeNs, "ns, realtime factor",
+                result->realtimeFactor, ", allocations not available");
+  }
+  return eIasOk;
+}
+
+
 IasTestFrameworkSetup* IasTestFrameworkPriv::setup()
 {
   if (mSetup == nullptr)
@@ -421,6 +421,93 @@ IasTestFrameworkRoutingZone::IasResult IasTestFrameworkRoutingZone::processPerio
 }
 
 
+IasTestFrameworkRoutingZone::IasResult IasTestFrameworkRoutingZone::preloadInputs(uint32_t numPeriods)
+{
+  if (numPeriods == 0)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Invalid parameter: numPeriods is 0");
+    return eIasInvalidParam;
+  }
+
+  if (!mIsRunning)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Test framework routing zone has not been started yet");
+    return eIasNotInitialized;
+  }
+
+  uint32_t numFrames = numPeriods * mPipeline->getParameters()->periodSize;
+  for (IasRingBufferParamsMap::iterator mapIt = mInputBufferParamsMap.begin();
+       mapIt != mInputBufferParamsMap.end(); mapIt++)
+  {
+    IasTestFrameworkWaveFilePtr inputWaveFile = mapIt->second.waveFile;
+    IasTestFrameworkWaveFile::IasResult res = inputWaveFile->preload(numFrames);
+    if (res != IasTestFrameworkWaveFile::eIasOk)
+    {
+      DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error while preloading", inputWaveFile->getFileName(), ":", toString(res));
+      return eIasFailed;
+    }
+  }
+
+  return eIasOk;
+}
+
+
+IasTestFrameworkRoutingZone::IasResult IasTestFrameworkRoutingZone::processPreloadedPeriods(uint32_t numPeriods)
+{
+  if (!mIsRunning)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Test framework routing zone has not been started yet");
+    return eIasNotInitialized;
+  }
+
+  uint32_t numFramesToTransfer = mPipeline->getParameters()->periodSize;
+  for (uint32_t i = 0; i < numPeriods; i++)
+  {
+    for (IasRingBufferParamsMap::iterator mapIt = mInputBufferParamsMap.begin();
+         mapIt != mInputBufferParamsMap.end(); mapIt++)
+    {
+      IasResult result = readPreloadedData(mapIt->second.waveFile, mapIt->second.ringBuffer, numFramesToTransfer);
+      if (result != eIasOk)
+      {
+        return eIasFailed;
+      }
+
+      uint32_t numFramesRemaining = 0;
+      IasPipeline::IasResult pipelineResult = mPipeline->provideInputData(mapIt->first,
+                                                                          0, //inputBufferOffset=0
+                                                                          numFramesToTransfer,
+                                                                          numFramesToTransfer,
+                                                                          &numFramesRemaining);
+      if (pipelineResult != IasPipeline::eIasOk)
+      {
+        DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Failed to provide input data to pipeline");
+        return eIasFailed;
+      }
+    }
+
+    mPipeline->process();
+
+    for (IasRingBufferParamsMap::iterator mapIt = mOutputBufferParamsMap.begin();
+         mapIt != mOutputBufferParamsMap.end(); mapIt++)
+    {
+      IasRingBufferParams&  outputBufferParams = mapIt->second;
+      IasAudioSinkDevicePtr sinkDevice = outputBufferParams.waveFile->getDummySinkDevice();
+      IasResult result = retrieveDataFromPipeline(sinkDevice, outputBufferParams.ringBuffer, numFramesToTransfer);
+      if (result == eIasOk)
+      {
+        result = discardOutputData(outputBufferParams.ringBuffer);
+      }
+      if (result != eIasOk)
+      {
+        return eIasFailed;
+      }
+    }
+  }
+
+  return eIasOk;
+}
+
+
 IasTestFrameworkRoutingZone::IasResult IasTestFrameworkRoutingZone::transferPeriod()
 {
   IasResult result = eIasOk;
@@ -625,6 +712,60 @@ IasTestFrameworkRoutingZone::IasResult IasTestFrameworkRoutingZone::writeDataInt
 }
 
 
+IasTestFrameworkRoutingZone::IasResult IasTestFrameworkRoutingZone::readPreloadedData(IasTestFrameworkWaveFilePtr waveFile,
+                                                                                      IasAudioRingBuffer* inputBuffer,
+                                                                                      uint32_t numFrames)
+{
+  IasAudioArea *areas = nullptr;
+  uint32_t offset = 0;
+  uint32_t bufferNumFrames = 0;
+  IasAudioRingBufferResult bufferRes;
+
+  bufferRes = inputBuffer->beginAccess(eIasRingBufferAccessWrite, &areas, &offset, &bufferNumFrames);
+  if (bufferRes != eIasRingBuffOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,
+                "Error during IasAudioRingBuffer::beginAccess for writing", toString(bufferRes));
+    return eIasFailed;
+  }
+
+  waveFile->readPreloadedFrames(areas, offset, numFrames);
+
+  bufferRes = inputBuffer->endAccess(eIasRingBufferAccessWrite, offset, bufferNumFrames);
+  if (bufferRes != eIasRingBuffOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,
+                "Error during IasAudioRingBuffer::endAccess for writing", toString(bufferRes));
+    return eIasFailed;
+  }
+
+  return eIasOk;
+}
+
+
+IasTestFrameworkRoutingZone::IasResult IasTestFrameworkRoutingZone::discardOutputData(IasAudioRingBuffer* outputBuffer)
+{
+  IasAudioArea *areas = nullptr;
+  uint32_t offset = 0;
+  uint32_t bufferNumFrames = 0;
+  IasAudioRingBufferResult bufferRes;
+
+  bufferRes = outputBuffer->beginAccess(eIasRingBufferAccessRead, &areas, &offset, &bufferNumFrames);
+  if (bufferRes == eIasRingBuffOk)
+  {
+    bufferRes = outputBuffer->endAccess(eIasRingBufferAccessRead, offset, bufferNumFrames);
+  }
+  if (bufferRes != eIasRingBuffOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX,
+                "Error while discarding output data", toString(bufferRes));
+    return eIasFailed;
+  }
+
+  return eIasOk;
+}
+
+
 /*
  * Function to get a IasRoutingZone::IasResult as string.
  */
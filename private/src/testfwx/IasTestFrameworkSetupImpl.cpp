@@ -683,7 +683,11 @@ void IasTestFrameworkSetupImpl::unlink(IasAudioPinPtr outputPin, IasAudioPinPtr
     return;
   }
 
-  pipeline->unlink(outputPin, inputPin);
+  IasPipeline::IasResult result = pipeline->unlink(outputPin, inputPin);
+  if (result != IasPipeline::eIasOk)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Error during IasPipeline::unlink()", toString(result));
+  }
 }
 
 
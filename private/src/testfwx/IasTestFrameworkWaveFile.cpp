@@ -9,6 +9,8 @@
  * @brief  Class for reading / writing WAVE files.
  */
 
+#include <algorithm>
+
 #include "testfwx/IasTestFrameworkWaveFile.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "avbaudiomodules/internal/audio/common/helper/IasCopyAudioAreaBuffers.hpp"
@@ -37,6 +39,10 @@ IasTestFrameworkWaveFile::IasTestFrameworkWaveFile(IasTestFrameworkWaveFileParam
 ,mDummySourceDevice(nullptr)
 ,mDummySinkDevice(nullptr)
 ,mAudioPin(nullptr)
+,mPreloadBuffer()
+,mPreloadArea()
+,mPreloadNumFrames(0)
+,mPreloadPosition(0)
 {
   IAS_ASSERT(mParams != nullptr);
   mFileInfo.channels = 0;
@@ -167,6 +173,11 @@ void IasTestFrameworkWaveFile::reset()
     mArea = nullptr;
   }
 
+  mPreloadBuffer.clear();
+  mPreloadArea.clear();
+  mPreloadNumFrames = 0;
+  mPreloadPosition = 0;
+
   mBufferSize = 0;
   mFileIsOpen = false;
 }
@@ -328,6 +339,66 @@ IasTestFrameworkWaveFile::IasResult IasTestFrameworkWaveFile::readFrames(IasAudi
 }
 
 
+IasTestFrameworkWaveFile::IasResult IasTestFrameworkWaveFile::preload(uint32_t maxNumFrames)
+{
+  if (!mFileIsOpen)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "File was not open yet");
+    return eIasFileNotOpen;
+  }
+  if (!isInputFile())
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "Preloading allowed for input files only");
+    return eIasFailed;
+  }
+
+  uint32_t numChannels = static_cast<uint32_t>(mFileInfo.channels);
+  mPreloadBuffer.resize(static_cast<size_t>(maxNumFrames) * numChannels);
+  mPreloadNumFrames = static_cast<uint32_t>(sf_readf_float(mFilePtr, mPreloadBuffer.data(), maxNumFrames));
+  mPreloadPosition = 0;
+  if (mPreloadNumFrames == 0)
+  {
+    DLT_LOG_CXX(*mLog, DLT_LOG_ERROR, LOG_PREFIX, "No frames available in file", mParams->fileName);
+    mPreloadBuffer.clear();
+    return eIasFailed;
+  }
+  mPreloadBuffer.resize(static_cast<size_t>(mPreloadNumFrames) * numChannels);
+
+  mPreloadArea.resize(numChannels);
+  for(uint32_t channel = 0; channel < numChannels; channel++)
+  {
+    mPreloadArea[channel].start = mPreloadBuffer.data();
+    mPreloadArea[channel].first = channel * toSize(mDataFormat) * 8; //expressed in bits
+    mPreloadArea[channel].step  = numChannels * toSize(mDataFormat) * 8; //expressed in bits
+    mPreloadArea[channel].index = channel;
+    mPreloadArea[channel].maxIndex = numChannels - 1;
+  }
+
+  return eIasOk;
+}
+
+
+void IasTestFrameworkWaveFile::readPreloadedFrames(IasAudioArea* area, uint32_t offset, uint32_t numFrames)
+{
+  IAS_ASSERT(area != nullptr);
+  IAS_ASSERT(mPreloadNumFrames > 0);
+  uint32_t numChannels = static_cast<uint32_t>(mFileInfo.channels);
+  uint32_t numFramesDone = 0;
+  while (numFramesDone < numFrames)
+  {
+    uint32_t numFramesChunk = std::min(numFrames - numFramesDone, mPreloadNumFrames - mPreloadPosition);
+    copyAudioAreaBuffers(area, mDataFormat, offset + numFramesDone, numChannels, 0, numFramesChunk,
+                         mPreloadArea.data(), mDataFormat, mPreloadPosition, numChannels, 0, numFramesChunk);
+    numFramesDone += numFramesChunk;
+    mPreloadPosition += numFramesChunk;
+    if (mPreloadPosition == mPreloadNumFrames)
+    {
+      mPreloadPosition = 0;
+    }
+  }
+}
+
+
 IasTestFrameworkWaveFile::IasResult IasTestFrameworkWaveFile::writeFrames(IasAudioArea* area, uint32_t offset, uint32_t numFrames, uint32_t& numFramesWritten)
 {
   if (area == nullptr)
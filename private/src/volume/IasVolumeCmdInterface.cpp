@@ -12,6 +12,7 @@
 #include "volume/IasVolumeCmdInterface.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "audio/volumex/IasVolumeCmd.hpp"
+#include "audio/smartx/IasIProcessing.hpp"
 #include "audio/smartx/rtprocessingfwx/IasIModuleId.hpp"
 #include "helper/IasRamp.hpp"
 #include "volume/IasVolumeLoudnessCore.hpp"
@@ -195,32 +196,72 @@ IasIModuleId::IasResult IasVolumeCmdInterface::setVolume(const IasProperties& cm
     return IasIModuleId::eIasFailed;
   }
   int32_t rampTime = rampParams[0];
+  IasRampShapes rampShape = static_cast<IasRampShapes>(rampParams[1]);
+  modres = checkRampParams(rampTime, rampShape);
+  if (modres != IasIModuleId::eIasOk)
+  {
+    return modres;
+  }
+  DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Ramp time=", rampTime, "ms");
+  DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Ramp shape=", rampParams[1]);
+  return applyVolume(streamId, static_cast<float>(volumedb), rampTime, rampShape);
+}
+
+IasIModuleId::IasResult IasVolumeCmdInterface::checkRampParams(int32_t rampTime, IasRampShapes rampShape)
+{
   if (rampTime < cMinRampTime || rampTime > cMaxRampTime)
   {
     DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "Ramp time of",rampTime,"[ms] not valid, must be in the range of",cMinRampTime,"to",cMaxRampTime);
     return IasIModuleId::eIasFailed;
   }
-  DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Ramp time=", rampTime, "ms");
-  IasRampShapes rampShape = static_cast<IasRampShapes>(rampParams[1]);
   if ((rampShape != eIasRampShapeLinear) && (rampShape != eIasRampShapeExponential))
   {
     DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "Ramp shape ",toString(rampShape),"is not supported");
     return IasIModuleId::eIasFailed;
   }
-  DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Ramp shape=", rampParams[1]);
-  float volume = static_cast<float>(volumedb);
-  if(volumedb <= -1440)
+  return IasIModuleId::eIasOk;
+}
+
+IasIModuleId::IasResult IasVolumeCmdInterface::applyVolume(int32_t streamId, float volumedb, int32_t rampTime, IasRampShapes rampShape)
+{
+  float volume;
+  if(volumedb <= -1440.0f)
   {
     DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Received volume of ",volumedb, "[db/10], will be treated as mute.");
     volume = 0.0f;
   }
   else
   {
-    volume = powf(10.0f, volume/200.0f);
+    volume = powf(10.0f, volumedb/200.0f);
   }
   return translate(mCore->setVolume(streamId, volume, rampTime, rampShape));
 }
 
+bool IasVolumeCmdInterface::isFastCmd(int32_t cmdId) const
+{
+  return (cmdId == IasVolume::eIasSetVolume);
+}
+
+IasIModuleId::IasResult IasVolumeCmdInterface::processFastCmd(const IasCmdHandle &handle, float value)
+{
+  if (handle.cmdId != IasVolume::eIasSetVolume)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "Cmd with cmdId", handle.cmdId, "does not support command handles");
+    return IasIModuleId::eIasFailed;
+  }
+  if (handle.rampTime == 0)
+  {
+    return applyVolume(handle.streamId, value, cFastCmdVolumeRampTime, eIasRampShapeLinear);
+  }
+  const IasRampShapes rampShape = static_cast<IasRampShapes>(handle.rampShape);
+  IasIModuleId::IasResult modres = checkRampParams(handle.rampTime, rampShape);
+  if (modres != IasIModuleId::eIasOk)
+  {
+    return modres;
+  }
+  return applyVolume(handle.streamId, value, handle.rampTime, rampShape);
+}
+
 IasIModuleId::IasResult IasVolumeCmdInterface::setMuteState(const IasProperties& cmdProperties,
                                                             IasProperties& returnProperties)
 {
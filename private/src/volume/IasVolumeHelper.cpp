@@ -9,8 +9,10 @@
  * @brief
  */
 
-#include <sstream>
+#include <algorithm>
 #include <array>
+#include <math.h>
+#include <sstream>
 #include "volume/IasVolumeHelper.hpp"
 #include "volume/IasVolumeLoudnessCore.hpp"
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
@@ -274,6 +276,170 @@ void setSDVTableInProperties(const IasVolumeSDVTable &sdvTable, IasProperties &p
   properties.set("sdv.gain_dec", gain_dec);
 }
 
+float convertVolumeToDb(float volume)
+{
+  if( volume <= 6.309573445e-08f) // -144 dB = 6.309573445e-08f in linear
+  {
+    return static_cast<float>(cIasMinLoudnessVolume);
+  }
+  return 200.0f*log10f(volume);
+}
+
+float getLoudnessGain(int32_t volume, const IasVolumeLoudnessGainTable &gainTable)
+{
+  if (gainTable.gains.size() == 0)
+  {
+    return 1.0f;
+  }
+  if (volume >= gainTable.maxVolume)
+  {
+    return gainTable.gains[0];
+  }
+  uint32_t index = static_cast<uint32_t>(gainTable.maxVolume - volume);
+  if (index >= gainTable.gains.size())
+  {
+    return gainTable.gains.back();
+  }
+  return gainTable.gains[index];
+}
+
+float interpolateLoudnessGain(int32_t volume_dB, const IasVolumeLoudnessTable &table)
+{
+  uint32_t cnt = 1;
+  float gain;
+
+  if(volume_dB >= table.volumes[0])
+  {
+    gain =  powf(10.0f, static_cast<float>(table.gains[0])/200.0f);
+    return gain;
+  }
+
+  do
+  {
+    if(volume_dB >= table.volumes[cnt])
+    {
+      break;
+    }
+    cnt++;
+  } while(cnt<table.volumes.size());
+
+
+  if(cnt == table.volumes.size())
+  {
+    // this formula calculates 10^((gain/20)/10) to have the gain in the logarithmic format of [dB/10]
+    gain =  powf(10.0f, static_cast<float>(table.gains[cnt-1])/200.0f);
+    return gain;
+  }
+  else
+  {
+    float deltaVolume = static_cast<float>(table.volumes[cnt-1] - table.volumes[cnt]);
+    float deltaCoeff  = static_cast<float>(table.volumes[cnt-1] - volume_dB) / deltaVolume;
+    float deltaGain   = static_cast<float>(table.gains[cnt] - table.gains[cnt-1]);
+    float gain_dB     = static_cast<float>(table.gains[cnt-1]) + deltaGain*deltaCoeff;
+    return (powf(10.0f, gain_dB/200.0f));
+  }
+}
+
+void buildLoudnessGainTable(const IasVolumeLoudnessTable &table, IasVolumeLoudnessGainTable *gainTable)
+{
+  gainTable->gains.clear();
+  if (table.volumes.size() == 0)
+  {
+    gainTable->maxVolume = 0;
+    return;
+  }
+  // The volume is converted to integer steps of 0.1 dB, so one entry per step gives exactly
+  // the interpolated gain of the table. Above the first and below the last data point, the gain is constant.
+  int32_t maxVolume = std::max(table.volumes.front(), cIasMinLoudnessVolume);
+  int32_t minVolume = *std::min_element(table.volumes.begin(), table.volumes.end());
+  minVolume = std::min(std::max(minVolume, cIasMinLoudnessVolume), maxVolume);
+  gainTable->maxVolume = maxVolume;
+  gainTable->gains.resize(static_cast<uint32_t>(maxVolume - minVolume) + 1);
+  for (uint32_t index = 0; index < gainTable->gains.size(); ++index)
+  {
+    gainTable->gains[index] = interpolateLoudnessGain(maxVolume - static_cast<int32_t>(index), table);
+  }
+}
+
+float interpolateSDV_GainDb(uint32_t speed, const IasVolumeSDVTable &table, const std::vector<uint32_t> &gainVec)
+{
+  float gain = 0.0f;
+  uint32_t tableLength = static_cast<uint32_t>(table.speed.size());
+  int32_t cnt = static_cast<int32_t>(tableLength-1);
+
+  if (speed <= table.speed[0])
+  {
+    return 0.0f;
+  }
+  else
+  {
+    do
+    {
+      if (speed >= table.speed[cnt])
+      {
+        break;
+      }
+      cnt--;
+    }
+    while(cnt>=0);
+
+    if((speed == table.speed[cnt]) || ( cnt == (int32_t)(tableLength-1) ))
+    {
+      gain = (float)(gainVec[cnt]);
+    }
+    else
+    {
+      float deltaSpeed = static_cast<float>(table.speed[cnt+1] - table.speed[cnt]);
+      float deltaGain  = static_cast<float>(gainVec[cnt+1] - gainVec[cnt]);
+      float deltaCoeff = deltaGain  / deltaSpeed;
+      gain = static_cast<float>(gainVec[cnt]) + deltaCoeff* static_cast<float>(speed-table.speed[cnt]);
+    }
+  }
+  return gain;
+}
+
+void buildSDVGainTable(const IasVolumeSDVTable &table, IasVolumeSDVGainTable *gainTable)
+{
+  // The speed is an integer in km/h, so one entry per km/h gives exactly the interpolated gain of the table.
+  uint32_t numSpeeds = std::min(table.speed.back(), cIasMaxSDVGainTableSpeed) + 1;
+  gainTable->gain_inc.resize(numSpeeds);
+  gainTable->gain_dec.resize(numSpeeds);
+  gainTable->gainDb_inc.resize(numSpeeds);
+  gainTable->gainDb_dec.resize(numSpeeds);
+  for (uint32_t speed = 0; speed < numSpeeds; ++speed)
+  {
+    gainTable->gainDb_inc[speed] = interpolateSDV_GainDb(speed, table, table.gain_inc);
+    gainTable->gainDb_dec[speed] = interpolateSDV_GainDb(speed, table, table.gain_dec);
+    gainTable->gain_inc[speed] = powf(10.0f, gainTable->gainDb_inc[speed]/200.0f);
+    gainTable->gain_dec[speed] = powf(10.0f, gainTable->gainDb_dec[speed]/200.0f);
+  }
+  // The gains for decreasing speed are not smaller than the ones for increasing speed, so the last
+  // gain for decreasing speed is the highest gain of the table.
+  uint32_t numSteps = static_cast<uint32_t>(static_cast<float>(table.gain_dec.back()) / cIasSDVGainTableStep) + 2;
+  gainTable->linearGains.resize(numSteps);
+  for (uint32_t step = 0; step < numSteps; ++step)
+  {
+    gainTable->linearGains[step] = powf(10.0f, static_cast<float>(step) * cIasSDVGainTableStep / 200.0f);
+  }
+  // The sdv gain can only be applied without overflow up to the volume that compensates the highest gain for increasing speed.
+  gainTable->criticalVolumeDb = -static_cast<float>(table.gain_inc.back());
+}
+
+float getSDV_LinearGain(float gainDb, const IasVolumeSDVGainTable &gainTable)
+{
+  if (gainTable.linearGains.size() < 2)
+  {
+    return 1.0f;
+  }
+  float position = std::max(gainDb, 0.0f) / cIasSDVGainTableStep;
+  uint32_t index = static_cast<uint32_t>(position);
+  if (index >= gainTable.linearGains.size() - 1)
+  {
+    return gainTable.linearGains.back();
+  }
+  float fraction = position - static_cast<float>(index);
+  return gainTable.linearGains[index] + fraction * (gainTable.linearGains[index + 1] - gainTable.linearGains[index]);
+}
 
 } // namespace IasVolumeHelper
 
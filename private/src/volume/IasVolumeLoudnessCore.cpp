@@ -23,11 +23,13 @@
 #include "rtprocessingfwx/IasBundleAssignment.hpp"
 #include "rtprocessingfwx/IasStreamParams.hpp"
  // #define IAS_ASSERT()
+#include <algorithm>
 #include <malloc.h>
 #include <iostream>
 #include <math.h>
 #include <stdio.h>
 #include <sstream>
+#include <utility>
 
 namespace IasAudio {
 
@@ -61,19 +63,22 @@ IasVolumeLoudnessCore::IasVolumeLoudnessCore(const IasIGenericAudioCompConfig *c
   ,mStreams()
   ,mBundleIndexMap()
   ,mLoudnessTableVector()
+  ,mLoudnessGainTables()
   ,mCallbackMap()
   ,mSDVTable()
+  ,mSDVGainTable()
   ,mMaxVolume(0.0f)
-  ,mVolumeSDV_Critical(1.0f)
+  ,mMaxVolumeDb(static_cast<float>(cIasMinLoudnessVolume))
+  ,mSDVReduction(1.0f)
   ,mLoudnessFilterParams()
-  ,mVolumeQueue()
-  ,mMuteQueue()
-  ,mLoudnessStateQueue()
-  ,mSpeedQueue()
-  ,mSDVStateQueue()
-  ,mSDVTableQueue()
-  ,mLoudnessTableQueue()
-  ,mLoudnessFilterQueue()
+  ,mVolumeMailboxes()
+  ,mMuteMailboxes()
+  ,mLoudnessStateMailboxes()
+  ,mSpeedMailbox()
+  ,mSDVStateMailboxes()
+  ,mSDVTableMailbox()
+  ,mLoudnessTableMailboxes()
+  ,mLoudnessFilterMailboxes()
   ,mTypeName("")
   ,mInstanceName("")
   ,mLogContext(IasAudioLogging::getDltContext("_VOL"))
@@ -146,7 +151,11 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setMuteState(int32_t Id,
   queueEntry.rampShape = rampShape;
   queueEntry.rampTime = rampTime;
   queueEntry.streamId = Id;
-  mMuteQueue.push(queueEntry);
+  if (mMuteMailboxes.post(Id, queueEntry) == false)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no mute mailbox for sinkId: Id=", Id);
+    return eIasAudioProcInvalidParam;
+  }
 
   return eIasAudioProcOK;
 }
@@ -174,10 +183,15 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setVolume(int32_t   Id,
 
   IasVolumeQueueEntry queueEntry;
   queueEntry.volume = volume;
+  queueEntry.volumeDb = IasVolumeHelper::convertVolumeToDb(volume);
   queueEntry.rampShape = rampShape;
   queueEntry.rampTime = rampTime;
   queueEntry.streamId = Id;
-  mVolumeQueue.push(queueEntry);
+  if (mVolumeMailboxes.post(Id, queueEntry) == false)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no volume mailbox for sinkId: Id=", Id);
+    return eIasAudioProcInvalidParam;
+  }
 
   return eIasAudioProcOK;
 }
@@ -380,6 +394,7 @@ IasAudioProcessingResult IasVolumeLoudnessCore::init()
     volumeParams.currentMuteGain = 1.0f;
     volumeParams.muteVolume = 0.0f;
     volumeParams.destinationVolume = 0.0f;
+    volumeParams.destinationVolumeDb = static_cast<float>(cIasMinLoudnessVolume);
     volumeParams.numSamplesLeftToRamp = 0;
     volumeParams.numSDVSamplesLeftToRamp = 0;
     volumeParams.numMuteSamplesLeftToRamp = 0;
@@ -392,6 +407,7 @@ IasAudioProcessingResult IasVolumeLoudnessCore::init()
     volumeParams.lastRunSDV = false;
     volumeParams.lastRunMute = false;
     volumeParams.activeLoudness = true;
+    volumeParams.loudnessVolume = cIasInvalidLoudnessVolume;
 
     std::vector<uint32_t> filterBands;
 
@@ -417,13 +433,36 @@ IasAudioProcessingResult IasVolumeLoudnessCore::init()
     callbackParams.stateSDV = false;
     mCallbackMap.insert(std::pair<int32_t,IasVolumeCallbackParams>(streamId,callbackParams));
 
+    // One mailbox per stream and parameter, the set of mailboxes is fixed after init.
+    mVolumeMailboxes.add(streamId);
+    mMuteMailboxes.add(streamId);
+    mLoudnessStateMailboxes.add(streamId);
+    mSDVStateMailboxes.add(streamId);
+
     streamCounter++;
   }
   for(uint32_t i=0;i<mNumFilterBands;++i)
   {
     IasVolumeLoudnessTable loudnessTable;
     mLoudnessTableVector.push_back(loudnessTable);
+    IasVolumeLoudnessGainTable loudnessGainTable;
+    loudnessGainTable.maxVolume = 0;
+    mLoudnessGainTables.push_back(loudnessGainTable);
+    mLoudnessTableMailboxes.add(i);
+    mLoudnessFilterMailboxes.add(i);
   }
+  // Preallocate the table slots, so posting a table of maximum size does not allocate.
+  mLoudnessTableMailboxes.forEachSlot([this](IasLoudnessTableQueueEntry &entry)
+  {
+    entry.table.gains.reserve(mLoudnessTableLengthMax);
+    entry.table.volumes.reserve(mLoudnessTableLengthMax);
+  });
+  mSDVTableMailbox.forEachSlot([this](IasSDVTableQueueEntry &entry)
+  {
+    entry.table.speed.reserve(mSDVTableLengthMax);
+    entry.table.gain_inc.reserve(mSDVTableLengthMax);
+    entry.table.gain_dec.reserve(mSDVTableLengthMax);
+  });
 
   return initFromConfiguration();
 }
@@ -539,7 +578,17 @@ IasAudioProcessingResult IasVolumeLoudnessCore::processChild()
           uint32_t chanIndex = it_map->second.mVolumeRampParamsVector[i].channelIndex;
           uint32_t nChannels = it_map->second.mVolumeRampParamsVector[i].nChannels;;
           it_map->second.mVolumeRampParamsVector[i].rampVol->getRampValues(mGains[gainBundleIndex],chanIndex,nChannels,&(it_map->second.numSamplesLeftToRamp));
-          updateLoudness(streamId,mGains[gainBundleIndex][0+chanIndex]);
+        }
+        // All channels of the stream share the same ramp and the loudness gain only changes in steps of 0.1 dB,
+        // so the loudness filters are updated once per period and only if the volume reached another step.
+        if (it_map->second.activeLoudness && (it_map->second.mVolumeRampParamsVector.size() > 0))
+        {
+          const IasVolumeRampParams &rampParams = it_map->second.mVolumeRampParamsVector[0];
+          float volume = mGains[rampParams.bundleIndex][rampParams.channelIndex];
+          if (convertVolumeToLoudnessVolume(volume) != it_map->second.loudnessVolume)
+          {
+            updateLoudness(streamId, volume);
+          }
         }
         if(it_map->second.lastRunVol == true)
         {
@@ -758,7 +807,7 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setLoudnessFilter(int32_t stream
       return eIasAudioProcInvalidParam;
     }
     // get gain for filter depending on current volume and update filter params with gain
-    float gain = getLoudnessGain(it_map->second.currentVolume,&mLoudnessTableVector[band]);
+    float gain = IasVolumeHelper::getLoudnessGain(convertVolumeToLoudnessVolume(it_map->second.currentVolume), mLoudnessGainTables[band]);
     params->gain = gain;
 
     for (streamParamsIt=streamParamsRange.first; streamParamsIt!=streamParamsRange.second; ++streamParamsIt)
@@ -781,6 +830,7 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setLoudnessFilter(int32_t stream
     else
     {
       DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "no loudness gain update due to active ramp");
+      it_map->second.loudnessVolume = cIasInvalidLoudnessVolume;
     }
   }
 
@@ -813,7 +863,11 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setLoudnessFilterAllStreams(uint
     queueEntry.params.type = filterParams->type;
 
     DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "setting loudness filter for all streams for band", band);
-    mLoudnessFilterQueue.push(queueEntry);
+    if (mLoudnessFilterMailboxes.post(band, queueEntry) == false)
+    {
+      DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no loudness filter mailbox for band=", band);
+      return eIasAudioProcInvalidParam;
+    }
   }
 
   return eIasAudioProcOK;
@@ -848,7 +902,11 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setLoudnessOnOff(int32_t streamI
   queueEntry.streamId = streamId;
   queueEntry.loudnessActive = isOn;
 
-  mLoudnessStateQueue.push(queueEntry);
+  if (mLoudnessStateMailboxes.post(streamId, queueEntry) == false)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no loudness state mailbox for sink Id=", streamId);
+    return eIasAudioProcInvalidParam;
+  }
 
   return eIasAudioProcOK;
 }
@@ -873,56 +931,23 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setSpeedControlledVolume(int32_t
 
   queueEntry.sdvActive = mode;
   queueEntry.streamId = streamId;
-  mSDVStateQueue.push(queueEntry);
+  if (mSDVStateMailboxes.post(streamId, queueEntry) == false)
+  {
+    DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no SDV state mailbox for sink Id=", streamId);
+    return eIasAudioProcInvalidParam;
+  }
 
   return eIasAudioProcOK;
 
 }
 
-float IasVolumeLoudnessCore::getLoudnessGain(float volume, IasVolumeLoudnessTable* table )
+int32_t IasVolumeLoudnessCore::convertVolumeToLoudnessVolume(float volume)
 {
-  uint32_t cnt = 1;
-  int32_t volume_dB = 0;
-  float gain;
-
   if( volume <= 6.309573445e-08f) // -144 dB = 6.309573445e-08f in linear
   {
-    volume_dB = -1440;
-  }
-  else
-  {
-    volume_dB = static_cast<int32_t>(20.0f*log10f(volume)*10.0f);
-  }
-  if(volume_dB >= table->volumes[0])
-  {
-    gain =  powf(10.0f, static_cast<float>(table->gains[0])/200.0f);
-    return gain;
-  }
-
-  do
-  {
-    if(volume_dB >= table->volumes[cnt])
-    {
-      break;
-    }
-    cnt++;
-  } while(cnt<table->volumes.size());
-
-
-  if(cnt == table->volumes.size())
-  {
-    // this formula calculates 10^((gain/20)/10) to have the gain in the logarithmic format of [dB/10]
-    gain =  powf(10.0f, static_cast<float>(table->gains[cnt-1])/200.0f);
-    return gain;
-  }
-  else
-  {
-    float deltaVolume = static_cast<float>(table->volumes[cnt-1] - table->volumes[cnt]);
-    float deltaCoeff  = static_cast<float>(table->volumes[cnt-1] - volume_dB) / deltaVolume;
-    float deltaGain   = static_cast<float>(table->gains[cnt] - table->gains[cnt-1]);
-    float gain_dB     = static_cast<float>(table->gains[cnt-1]) + deltaGain*deltaCoeff;
-    return (powf(10.0f, gain_dB/200.0f));
+    return cIasMinLoudnessVolume;
   }
+  return static_cast<int32_t>(20.0f*log10f(volume)*10.0f);
 }
 
 void IasVolumeLoudnessCore::updateLoudness(int32_t streamId, float volume)
@@ -935,11 +960,13 @@ void IasVolumeLoudnessCore::updateLoudness(int32_t streamId, float volume)
       const IasStreamParamsMultimap &streamParams = mConfig->getStreamParams();
       auto streamParamsRange = streamParams.equal_range(streamId);
       IasStreamParamsMultimap::const_iterator streamParamsIt;
+      int32_t loudnessVolume = convertVolumeToLoudnessVolume(volume);
+      (*it_map).second.loudnessVolume = loudnessVolume;
       for (uint32_t i=0; i<mBandFilters.size(); ++i)
       {
         if(checkStreamActiveForBand(streamId,i))
         {
-          float gain = getLoudnessGain(volume, &mLoudnessTableVector[i]);
+          float gain = IasVolumeHelper::getLoudnessGain(loudnessVolume, mLoudnessGainTables[i]);
           IasAudioFilter **filter = mBandFilters[i];
           for (streamParamsIt=streamParamsRange.first; streamParamsIt!=streamParamsRange.second; ++streamParamsIt)
           {
@@ -992,7 +1019,11 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setLoudnessTable(uint32_t band,
     DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX,
                 "directly setting loudness table with", loudnessTable->gains.size(),
                 "parameters for band=", band);
-    updateLoudnessTable(band, *loudnessTable);
+    IasLoudnessTableQueueEntry newEntry;
+    newEntry.band = band;
+    newEntry.table = *loudnessTable;
+    IasVolumeHelper::buildLoudnessGainTable(newEntry.table, &newEntry.gainTable);
+    updateLoudnessTable(band, newEntry);
   }
   else
   {
@@ -1002,7 +1033,12 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setLoudnessTable(uint32_t band,
     IasLoudnessTableQueueEntry queueEntry;
     queueEntry.band = band;
     queueEntry.table = *loudnessTable;
-    mLoudnessTableQueue.push(queueEntry);
+    IasVolumeHelper::buildLoudnessGainTable(queueEntry.table, &queueEntry.gainTable);
+    if (mLoudnessTableMailboxes.post(band, queueEntry) == false)
+    {
+      DLT_LOG_CXX(*mLogContext, DLT_LOG_ERROR, LOG_PREFIX, "no loudness table mailbox for band=", band);
+      return eIasAudioProcInvalidParam;
+    }
   }
 
   return eIasAudioProcOK;
@@ -1032,7 +1068,6 @@ IasAudioProcessingResult IasVolumeLoudnessCore::getLoudnessTable(uint32_t band,
 float IasVolumeLoudnessCore::calculateSDV_Gain(uint32_t speed,IasVolumeParams *params)
 {
   float gain=1.0f;
-  std::vector<uint32_t> *gainVec;
 
   if(speed > mCurrentSpeed && mSDV_HysteresisState == eSpeedDec_HysOff)
   {
@@ -1058,39 +1093,13 @@ float IasVolumeLoudnessCore::calculateSDV_Gain(uint32_t speed,IasVolumeParams *p
   switch(mSDV_HysteresisState)
   {
     case eSpeedInc_HysOff:
-      gainVec = &(mSDVTable.gain_inc);
-      gain = getSDV_Gain(speed,gainVec);
+      gain = getSDV_Gain(speed, true);
       DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "sdv gain from table:",gain);
-      if(mMaxVolume > mVolumeSDV_Critical )
-      {
-        IAS_ASSERT(mVolumeSDV_Critical != 1.0f);
-        // we have to take care not to divide by zero when we calculate log10(mVolumeSDV_Critical)
-        // this term would be zero if mVolumeSDV_Critical is equal to 1.0f
-        // if this would be the case, then the if condition would not match, because mMaxVolume can not be bigger than 1.0f
-        float logCrit = static_cast<float>(log10(mVolumeSDV_Critical));
-        float logMax = static_cast<float>(log10(mMaxVolume));
-        float logGain = static_cast<float>(log10(gain));
-        gain = static_cast<float>(powf(10.0f,(logMax*logGain/logCrit)));
-        DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Gain was reduced to",gain );
-      }
       break;
 
     case eSpeedDec_HysOn:
-      gainVec = &(mSDVTable.gain_dec);
-      gain = getSDV_Gain(speed,gainVec);
+      gain = getSDV_Gain(speed, false);
       DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "sdv gain from table:",gain);
-      if(mMaxVolume > mVolumeSDV_Critical )
-      {
-        IAS_ASSERT(mVolumeSDV_Critical != 1.0f);
-        // we have to take care not to divide by zero when we calculate log10(mVolumeSDV_Critical)
-        // this term would be zero if mVolumeSDV_Critical is equal to 1.0f
-        // if this would be the case, then the if condition would not match, because mMaxVolume can not be bigger than 1.0f
-        float logCrit = static_cast<float>(log10(mVolumeSDV_Critical));
-        float logMax = static_cast<float>(log10(mMaxVolume));
-        float logGain = static_cast<float>(log10(gain));
-        gain = static_cast<float>(powf(10.0f,(logMax*logGain/logCrit)));
-        DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Gain was reduced to",gain );
-      }
       if(gain <= params->currentSDVGain )
       {
         mSDV_HysteresisState = eSpeedDec_HysOff;
@@ -1103,39 +1112,13 @@ float IasVolumeLoudnessCore::calculateSDV_Gain(uint32_t speed,IasVolumeParams *p
       break;
 
     case eSpeedDec_HysOff:
-      gainVec = &(mSDVTable.gain_dec);
-      gain = getSDV_Gain(speed,gainVec);
+      gain = getSDV_Gain(speed, false);
       DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "sdv gain from table:",gain);
-      if(mMaxVolume > mVolumeSDV_Critical )
-      {
-        IAS_ASSERT(mVolumeSDV_Critical != 1.0f);
-        // we have to take care not to divide by zero when we calculate log10(mVolumeSDV_Critical)
-        // this term would be zero if mVolumeSDV_Critical is equal to 1.0f
-        // if this would be the case, then the if condition would not match, because mMaxVolume can not be bigger than 1.0f
-        float logCrit = static_cast<float>(log10(mVolumeSDV_Critical));
-        float logMax = static_cast<float>(log10(mMaxVolume));
-        float logGain = static_cast<float>(log10(gain));
-        gain = static_cast<float>(powf(10.0f,(logMax*logGain/logCrit)));
-        DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Gain was reduced to",gain );
-      }
       break;
 
     case eSpeedInc_HysOn:
-      gainVec = &(mSDVTable.gain_inc);
-      gain = getSDV_Gain(speed,gainVec);
+      gain = getSDV_Gain(speed, true);
       DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "sdv gain from table:",gain);
-      if(mMaxVolume > mVolumeSDV_Critical  )
-      {
-        IAS_ASSERT(mVolumeSDV_Critical != 1.0f);
-        // we have to take care not to divide by zero when we calculate log10(mVolumeSDV_Critical)
-        // this term would be zero if mVolumeSDV_Critical is equal to 1.0f
-        // if this would be the case, then the if condition would not match, because mMaxVolume can not be bigger than 1.0f
-        float logCrit = static_cast<float>(log10(mVolumeSDV_Critical));
-        float logMax = static_cast<float>(log10(mMaxVolume));
-        float logGain = static_cast<float>(log10(gain));
-        gain = static_cast<float>(powf(10.0f,(logMax*logGain/logCrit)));
-        DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "Gain was reduced to",gain );
-      }
       if(gain >= params->currentSDVGain)
       {
         mSDV_HysteresisState = eSpeedInc_HysOff;
@@ -1151,46 +1134,51 @@ float IasVolumeLoudnessCore::calculateSDV_Gain(uint32_t speed,IasVolumeParams *p
   return (gain);
 }
 
-float IasVolumeLoudnessCore::getSDV_Gain(uint32_t speed, std::vector<uint32_t> *gainVec)
+float IasVolumeLoudnessCore::getSDV_Gain(uint32_t speed, bool increasing) const
 {
-  float gain = 0.0f;
-  int32_t cnt = static_cast<int32_t>(mSDVTableLength-1);
-
-  if (speed <= mSDVTable.speed[0])
+  if (mSDVTable.speed.size() == 0)
   {
     return 1.0f;
   }
+  const std::vector<float> &gainVec = increasing ? mSDVGainTable.gain_inc : mSDVGainTable.gain_dec;
+  if ((mSDVReduction >= 1.0f) && (speed < gainVec.size()))
+  {
+    return gainVec[speed];
+  }
+  const std::vector<float> &gainDbVec = increasing ? mSDVGainTable.gainDb_inc : mSDVGainTable.gainDb_dec;
+  float gainDb;
+  if (speed < gainDbVec.size())
+  {
+    gainDb = gainDbVec[speed];
+  }
   else
   {
-    do
-    {
-      if (speed >= mSDVTable.speed[cnt])
-      {
-        break;
-      }
-      cnt--;
-    }
-    while(cnt>=0);
+    // speed beyond the precomputed range
+    gainDb = IasVolumeHelper::interpolateSDV_GainDb(speed, mSDVTable, increasing ? mSDVTable.gain_inc : mSDVTable.gain_dec);
+  }
+  return IasVolumeHelper::getSDV_LinearGain(gainDb * mSDVReduction, mSDVGainTable);
+}
 
-    if((speed == mSDVTable.speed[cnt]) || ( cnt == (int32_t)(mSDVTableLength-1) ))
-    {
-      gain = (float)((*gainVec)[cnt]);
-    }
-    else
-    {
-      float deltaSpeed = static_cast<float>(mSDVTable.speed[cnt+1] - mSDVTable.speed[cnt]);
-      float deltaGain  = static_cast<float>((*gainVec)[cnt+1] - (*gainVec)[cnt]);
-      float deltaCoeff = deltaGain  / deltaSpeed;
-      gain = static_cast<float>((*gainVec)[cnt]) + deltaCoeff* static_cast<float>(speed-mSDVTable.speed[cnt]);
-    }
+void IasVolumeLoudnessCore::updateSDVReduction()
+{
+  // The sdv gain is reduced, if the maximum user volume is above the critical volume, to avoid an overflow.
+  // The reduced gain is 10^(log10(maxVolume)*log10(gain)/log10(criticalVolume)), which is the gain in [dB/10]
+  // scaled by the ratio of the maximum and the critical volume in [dB/10].
+  if ((mSDVTable.speed.size() != 0) && (mMaxVolumeDb > mSDVGainTable.criticalVolumeDb))
+  {
+    IAS_ASSERT(mSDVGainTable.criticalVolumeDb < 0.0f);
+    mSDVReduction = mMaxVolumeDb / mSDVGainTable.criticalVolumeDb;
+  }
+  else
+  {
+    mSDVReduction = 1.0f;
   }
-  return (powf(10.0f, gain/200.0f));
 }
 
 void IasVolumeLoudnessCore::setSpeed(uint32_t speed)
 {
   DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "setting new speed to", speed);
-  mSpeedQueue.push(speed);
+  mSpeedMailbox.post(speed);
 
 }
 
@@ -1242,12 +1230,18 @@ IasAudioProcessingResult IasVolumeLoudnessCore::setSDVTable(IasVolumeSDVTable* t
     if (directInit == true)
     {
       DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "directly setting sdv table of size", table->gain_dec.size());
-      updateSDVTable(*table);
+      IasSDVTableQueueEntry newEntry;
+      newEntry.table = *table;
+      IasVolumeHelper::buildSDVGainTable(newEntry.table, &newEntry.gainTable);
+      updateSDVTable(newEntry);
     }
     else
     {
       DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX, "setting sdv table of size", table->gain_dec.size());
-      mSDVTableQueue.push(*table);
+      IasSDVTableQueueEntry queueEntry;
+      queueEntry.table = *table;
+      IasVolumeHelper::buildSDVGainTable(queueEntry.table, &queueEntry.gainTable);
+      mSDVTableMailbox.post(queueEntry);
     }
   }
   return result;
@@ -1294,7 +1288,7 @@ void IasVolumeLoudnessCore::updateMute(int32_t streamId, bool mute, uint32_t ram
 
 }
 
-void IasVolumeLoudnessCore::updateVolume( int32_t streamId, float volume, uint32_t rampTime, IasRampShapes rampShape)
+void IasVolumeLoudnessCore::updateVolume( int32_t streamId, float volume, float volumeDb, uint32_t rampTime, IasRampShapes rampShape)
 {
   IasVolumeRampMap::iterator it_map;
   IasVolumeRampMap::iterator it_map_all;
@@ -1302,15 +1296,19 @@ void IasVolumeLoudnessCore::updateVolume( int32_t streamId, float volume, uint32
   it_map = mVolumeParamsMap.find(streamId);
   IAS_ASSERT(it_map != mVolumeParamsMap.end())
   it_map->second.destinationVolume = volume;
+  it_map->second.destinationVolumeDb = volumeDb;
   float mMaxVolumeOld = mMaxVolume;
   mMaxVolume= 0.0f;
+  mMaxVolumeDb = static_cast<float>(cIasMinLoudnessVolume);
   for(it_map_all = mVolumeParamsMap.begin();it_map_all!=mVolumeParamsMap.end();it_map_all++)
   {
     if(it_map_all->second.destinationVolume > mMaxVolume)
     {
       mMaxVolume = it_map_all->second.destinationVolume;
+      mMaxVolumeDb = it_map_all->second.destinationVolumeDb;
     }
   }
+  updateSDVReduction();
   if(mSDVTable.speed.size()!=0) //Only try to calculate gain if a table was set
   {
     sdvGain = calculateSDV_Gain(mCurrentSpeed,&(it_map->second));
@@ -1467,35 +1465,25 @@ void IasVolumeLoudnessCore::updateSpeed(uint32_t speed)
   }
 }
 
-void IasVolumeLoudnessCore::updateSDVTable(IasVolumeSDVTable table)
+void IasVolumeLoudnessCore::updateSDVTable(IasSDVTableQueueEntry &entry)
 {
-  uint32_t i = 0;
-  mSDVTable.speed.resize(0);
-  mSDVTable.gain_inc.resize(0);
-  mSDVTable.gain_dec.resize(0);
-  for(i=0; i<table.speed.size();i++)
-  {
-    mSDVTable.speed.push_back(table.speed[i]);
-    mSDVTable.gain_inc.push_back(table.gain_inc[i]);
-    mSDVTable.gain_dec.push_back(table.gain_dec[i]);
-  }
-  mSDVTableLength = i;
-  mVolumeSDV_Critical = 1.0f/(powf(10,(float)(table.gain_inc[mSDVTableLength-1])/200.0f));
+  std::swap(mSDVTable, entry.table);
+  std::swap(mSDVGainTable, entry.gainTable);
+  mSDVTableLength = mSDVTable.speed.size();
+  updateSDVReduction();
   DLT_LOG_CXX(*mLogContext, DLT_LOG_INFO, LOG_PREFIX,
-              "Critical volume when the SDV gain has to be reduced = ",mVolumeSDV_Critical);
+              "Critical volume when the SDV gain has to be reduced = ",mSDVGainTable.criticalVolumeDb, "[dB/10]");
 
 }
 
-void IasVolumeLoudnessCore::updateLoudnessTable(uint32_t band, IasVolumeLoudnessTable table)
+void IasVolumeLoudnessCore::updateLoudnessTable(uint32_t band, IasLoudnessTableQueueEntry &entry)
 {
-  IasVolumeLoudnessTable* currentTable = &(mLoudnessTableVector[band]);
-  currentTable->gains.resize(0);
-  currentTable->volumes.resize(0);
-
-  for(uint32_t i=0;i< static_cast<uint32_t>(table.gains.size());i++)
+  std::swap(mLoudnessTableVector[band], entry.table);
+  std::swap(mLoudnessGainTables[band], entry.gainTable);
+  // Force the update of the loudness filters with the new gains during the next volume ramp.
+  for (auto &volumeParams : mVolumeParamsMap)
   {
-    currentTable->gains.push_back(table.gains[i]);
-    currentTable->volumes.push_back(table.volumes[i]);
+    volumeParams.second.loudnessVolume = cIasInvalidLoudnessVolume;
   }
 }
 
@@ -1541,67 +1529,49 @@ std::int32_t IasVolumeLoudnessCore::getMaxVol()
 
 void IasVolumeLoudnessCore::checkQueues()
 {
-
-  IasMuteQueueEntry muteQueueEntry;
-  muteQueueEntry.mute = false;
-  muteQueueEntry.rampShape = eIasRampShapeLinear;
-  muteQueueEntry.rampTime = 0;
-  muteQueueEntry.streamId = 0;
-  while(mMuteQueue.try_pop(muteQueueEntry))
+  // Each mailbox only holds the latest command, so the work per period is bounded
+  // by the number of streams and filter bands, independent of the command rate.
+  mMuteMailboxes.fetchAll([this](int32_t streamId, IasMuteQueueEntry &entry)
   {
-    updateMute( muteQueueEntry.streamId, muteQueueEntry.mute, muteQueueEntry.rampTime, muteQueueEntry.rampShape);
-  }
+    updateMute(streamId, entry.mute, entry.rampTime, entry.rampShape);
+  });
 
-  IasVolumeQueueEntry volumeQueueEntry;
-  volumeQueueEntry.volume = 0.0f;
-  volumeQueueEntry.rampShape = eIasRampShapeLinear;
-  volumeQueueEntry.rampTime = 0;
-  volumeQueueEntry.streamId = 0;
-  while(mVolumeQueue.try_pop(volumeQueueEntry))
+  mVolumeMailboxes.fetchAll([this](int32_t streamId, IasVolumeQueueEntry &entry)
   {
-    updateVolume( volumeQueueEntry.streamId, volumeQueueEntry.volume, volumeQueueEntry.rampTime, volumeQueueEntry.rampShape);
-  }
-
-  IasLoudnessStateQueueEntry loudnessStateQueueEntry;
-  loudnessStateQueueEntry.loudnessActive = false;
-  loudnessStateQueueEntry.streamId = 0;
-  while(mLoudnessStateQueue.try_pop(loudnessStateQueueEntry))
-   {
-    updateLoudnessParams(loudnessStateQueueEntry.streamId, loudnessStateQueueEntry.loudnessActive);
-   }
+    updateVolume(streamId, entry.volume, entry.volumeDb, entry.rampTime, entry.rampShape);
+  });
 
-  IasSDVStateQueueEntry sdvStateQueueEntry;
-  sdvStateQueueEntry.sdvActive = false;
-  sdvStateQueueEntry.streamId = 0;
-  while(mSDVStateQueue.try_pop(sdvStateQueueEntry))
+  mLoudnessStateMailboxes.fetchAll([this](int32_t streamId, IasLoudnessStateQueueEntry &entry)
   {
-    updateSDV_State(sdvStateQueueEntry.streamId,sdvStateQueueEntry.sdvActive);
-  }
+    updateLoudnessParams(streamId, entry.loudnessActive);
+  });
 
-  uint32_t speed = 0;
-  while(mSpeedQueue.try_pop(speed))
+  mSDVStateMailboxes.fetchAll([this](int32_t streamId, IasSDVStateQueueEntry &entry)
   {
-    updateSpeed(speed);
-  }
+    updateSDV_State(streamId, entry.sdvActive);
+  });
 
-  IasVolumeSDVTable table;
-  while(mSDVTableQueue.try_pop(table))
+  uint32_t *speed = mSpeedMailbox.fetch();
+  if (speed != nullptr)
   {
-    updateSDVTable(table);
+    updateSpeed(*speed);
   }
 
-  IasLoudnessTableQueueEntry loudnessTableQueueEntry;
-  while(mLoudnessTableQueue.try_pop(loudnessTableQueueEntry))
+  IasSDVTableQueueEntry *sdvEntry = mSDVTableMailbox.fetch();
+  if (sdvEntry != nullptr)
   {
-    updateLoudnessTable(loudnessTableQueueEntry.band,loudnessTableQueueEntry.table);
+    updateSDVTable(*sdvEntry);
   }
 
-  IasLoudnessFilterQueueEntry loudnessFilterQueueEntry;
-  while(mLoudnessFilterQueue.try_pop(loudnessFilterQueueEntry))
+  mLoudnessTableMailboxes.fetchAll([this](uint32_t band, IasLoudnessTableQueueEntry &entry)
   {
-    updateLoudnessFilter(loudnessFilterQueueEntry.band, loudnessFilterQueueEntry.params);
-  }
+    updateLoudnessTable(band, entry);
+  });
 
+  mLoudnessFilterMailboxes.fetchAll([this](uint32_t band, IasLoudnessFilterQueueEntry &entry)
+  {
+    updateLoudnessFilter(band, entry.params);
+  });
 }
 
 bool IasVolumeLoudnessCore::checkStreamActiveForBand(int32_t streamId, uint32_t band) const
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/*
+ * IasAsrcFillControllerTest.cpp
+ *
+ * Closed-loop simulation of the ASRC buffer of an asynchronous ALSA handler with an adaptive target fill level.
+ * The remote side writes one period per tick at a rate given by the drift profile of drift.txt. The write is late
+ * by a jitter that follows a sequence of tick profiles, like the timing sequences of the VADS devices. The ASRC
+ * closed-loop controller drives the fill level toward the target, in the same way as the worker thread of a sink
+ * device uses it.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "avbaudiomodules/internal/audio/common/samplerateconverter/IasSrcController.hpp"
+#include "alsahandler/IasAsrcFillController.hpp"
+#include "IasAlsaHandlerTest.hpp"
+#include "IasDrift.hpp"
+
+namespace IasAudio
+{
+
+namespace {
+
+const uint32_t cSamplerate = 48000;
+const uint32_t cPeriodSize = 192;                            // 4 ms
+const uint32_t cBufferLength = 4 * cPeriodSize;
+const uint32_t cFixedTarget = (cBufferLength + cPeriodSize) >> 1;
+const uint32_t cWindowLength = 62;                           // a quarter second, as used by the worker thread
+
+/**
+ * One step of a jitter profile: for numTicks periods, the write of the remote side is late by up to maxLateness us.
+ */
+struct JitterStep
+{
+  uint32_t numTicks;
+  uint32_t maxLateness;
+};
+
+struct SimulationResult
+{
+  std::vector<uint32_t> targets;      // Target fill level after each period
+  uint32_t numTargetChanges;          // Number of target changes during the second half of the simulation
+  uint32_t lowestMarginAfterConvergence; // Lowest measured fill level minus one period during the second half
+};
+
+/**
+ * Simple deterministic pseudo random generator, so that the results do not depend on the platform.
+ */
+class Lcg
+{
+  public:
+    Lcg() : mState(12345u) {}
+    uint32_t next(uint32_t range)
+    {
+      mState = mState * 1664525u + 1013904223u;
+      return (range == 0) ? 0 : (mState >> 8) % (range + 1);
+    }
+  private:
+    uint32_t mState;
+};
+
+SimulationResult simulate(IasAsrcFillController &controller, const std::vector<JitterStep> &profile, IasDrift *drift)
+{
+  SimulationResult result;
+  result.numTargetChanges = 0;
+  result.lowestMarginAfterConvergence = cBufferLength;
+
+  uint32_t numTicks = 0;
+  for (const auto &step : profile)
+  {
+    numTicks += step.numTicks;
+  }
+
+  IasSrcController srcController;
+  EXPECT_EQ(IasSrcController::eIasOk, srcController.init());
+  EXPECT_EQ(IasSrcController::eIasOk, srcController.setJitterBufferParams(cBufferLength, controller.getTarget()));
+  srcController.reset();
+
+  Lcg random;
+  double fill = static_cast<double>(controller.getTarget());
+  float ratioAdaptive = 1.0f;
+  uint32_t tick = 0;
+  for (const auto &step : profile)
+  {
+    for (uint32_t count = 0; count < step.numTicks; ++count, ++tick)
+    {
+      int32_t driftPpm = 0;
+      if (drift != nullptr)
+      {
+        drift->updateCurrentDrift(static_cast<uint32_t>(static_cast<uint64_t>(tick) * cPeriodSize * 1000 / cSamplerate), &driftPpm);
+      }
+      const uint32_t latenessFrames = random.next(step.maxLateness) * cSamplerate / 1000000;
+      const uint32_t numTotalFrames = static_cast<uint32_t>(std::max(fill - latenessFrames, 0.0));
+
+      bool outputActive;
+      EXPECT_EQ(IasSrcController::eIasOk, srcController.process(&ratioAdaptive, &outputActive, numTotalFrames));
+
+      // The remote side writes one period at the drifted rate, the sample rate converter of the sink device
+      // reads with the conversion ratio 2.0 - ratioAdaptive to fill one period of the device buffer.
+      fill += cPeriodSize * (1.0 + driftPpm * 1.0e-6) - cPeriodSize * (2.0 - ratioAdaptive);
+      fill = std::min(std::max(fill, 0.0), static_cast<double>(cBufferLength));
+
+      const uint32_t previousTarget = controller.getTarget();
+      if (controller.update(numTotalFrames))
+      {
+        EXPECT_EQ(IasSrcController::eIasOk, srcController.setJitterBufferParams(cBufferLength, controller.getTarget()));
+      }
+      if (tick >= numTicks / 2)
+      {
+        if (controller.getTarget() != previousTarget)
+        {
+          result.numTargetChanges++;
+        }
+        const uint32_t margin = (numTotalFrames > cPeriodSize) ? numTotalFrames - cPeriodSize : 0;
+        result.lowestMarginAfterConvergence = std::min(result.lowestMarginAfterConvergence, margin);
+      }
+      result.targets.push_back(controller.getTarget());
+    }
+  }
+  return result;
+}
+
+}
+
+
+TEST_F(IasAlsaHandlerTest, asrcFillControllerFixed)
+{
+  IasAsrcFillController controller;
+  controller.init(cPeriodSize, cBufferLength, cFixedTarget, false, 0, 0, cWindowLength);
+  EXPECT_FALSE(controller.isAdaptive());
+  EXPECT_EQ(cFixedTarget, controller.getTarget());
+  for (uint32_t count = 0; count < 10 * cWindowLength; ++count)
+  {
+    EXPECT_FALSE(controller.update(count % cPeriodSize));
+  }
+  EXPECT_EQ(cFixedTarget, controller.getTarget());
+
+  // The start target is limited to the configured bounds
+  controller.init(cPeriodSize, cBufferLength, cFixedTarget, true, 0, 400, cWindowLength);
+  EXPECT_EQ(400u, controller.getTarget());
+  controller.init(cPeriodSize, cBufferLength, cFixedTarget, true, 500, 0, cWindowLength);
+  EXPECT_EQ(500u, controller.getTarget());
+}
+
+TEST_F(IasAlsaHandlerTest, asrcFillControllerConvergence)
+{
+  // Low jitter of up to 0.5 ms: the target converges to the lower bound and stays there
+  IasAsrcFillController controller;
+  controller.init(cPeriodSize, cBufferLength, cFixedTarget, true, 0, 0, cWindowLength);
+  SimulationResult result = simulate(controller, {{20000, 500}}, nullptr);
+  const uint32_t lowerBound = cPeriodSize + (cPeriodSize >> 1);
+  RecordProperty("lowJitterTarget", static_cast<int>(controller.getTarget()));
+  EXPECT_EQ(lowerBound, controller.getTarget());
+  EXPECT_LT(controller.getTarget(), cFixedTarget);
+  EXPECT_EQ(0u, result.numTargetChanges);
+  EXPECT_GT(result.lowestMarginAfterConvergence, 0u);
+
+  // High jitter of up to 3 ms: the target covers the jitter, but still stays below the fixed target
+  controller.init(cPeriodSize, cBufferLength, cFixedTarget, true, 0, 0, cWindowLength);
+  result = simulate(controller, {{20000, 3000}}, nullptr);
+  RecordProperty("highJitterTarget", static_cast<int>(controller.getTarget()));
+  RecordProperty("highJitter", static_cast<int>(controller.getJitter()));
+  EXPECT_GE(controller.getTarget(), cPeriodSize + controller.getJitter());
+  EXPECT_LE(controller.getTarget(), cFixedTarget);
+  EXPECT_LE(result.numTargetChanges, 2u);
+  EXPECT_GT(result.lowestMarginAfterConvergence, 0u);
+}
+
+TEST_F(IasAlsaHandlerTest, asrcFillControllerJitterIncrease)
+{
+  // After a quiet phase, the jitter increases. The target has to follow within one window.
+  IasAsrcFillController controller;
+  controller.init(cPeriodSize, cBufferLength, cFixedTarget, true, 0, 0, cWindowLength);
+  SimulationResult result = simulate(controller, {{10000, 200}, {5000, 4000}}, nullptr);
+  const uint32_t quietTarget = result.targets[9999];
+  const uint32_t noisyTarget = result.targets[10000 + 2 * cWindowLength];
+  RecordProperty("quietTarget", static_cast<int>(quietTarget));
+  RecordProperty("noisyTarget", static_cast<int>(noisyTarget));
+  EXPECT_GT(noisyTarget, quietTarget);
+  EXPECT_GE(noisyTarget, cPeriodSize + 4000 * cSamplerate / 1000000 / 2);
+  EXPECT_LE(controller.getTarget(), cBufferLength - cPeriodSize);
+}
+
+TEST_F(IasAlsaHandlerTest, asrcFillControllerDriftProfile)
+{
+  // The drift profile is compensated by the closed-loop controller and must not drive the target up
+  IasDrift *myDrift = new IasDrift();
+  ASSERT_EQ(IasDrift::eIasOk, myDrift->init("drift.txt"));
+  IasAsrcFillController controller;
+  controller.init(cPeriodSize, cBufferLength, cFixedTarget, true, 0, 0, cWindowLength);
+  SimulationResult result = simulate(controller, {{60000, 500}}, myDrift);
+  RecordProperty("driftTarget", static_cast<int>(controller.getTarget()));
+  RecordProperty("driftJitter", static_cast<int>(controller.getJitter()));
+  EXPECT_LT(controller.getTarget(), cFixedTarget);
+  EXPECT_GT(result.lowestMarginAfterConvergence, 0u);
+  delete myDrift;
+}
+
+}
@@ -11,8 +11,10 @@
 
 
 #include <string>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <libxml/parser.h>
 #include <libxml/tree.h>
 #include <libxml/xmlmemory.h>
@@ -23,6 +25,7 @@
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
 #include "audio/configparser/IasSmartXconfigParser.hpp"
 #include "configparser/IasParseHelper.hpp"
+#include "configparser/IasTopologyCache.hpp"
 #include "audio/smartx/IasSmartX.hpp"
 #include "audio/smartx/IasIRouting.hpp"
 #include "audio/smartx/IasISetup.hpp"
@@ -95,6 +98,19 @@ protected:
     std::vector<Ias::String> getValidXmlFiles();
     std::vector<Ias::String> getInvalidXmlFiles();
 
+    /*!
+     * @brief Get the path of a file in the temporary directory of the test
+     *
+     * The directory is created by SetUp and removed together with its content by TearDown.
+     *
+     * @param[in] fileName name of the file
+     *
+     * @returns path of the file
+     */
+    std::string getTempPath(const std::string& fileName);
+
+    fs::path mTempDir;
+
     class WrapperSmartX
     {
       IasAudio::IasSmartX* mSmartx;
@@ -128,11 +144,20 @@ void InitConfigParser::SetUp()
   setenv("AUDIO_PLUGIN_DIR", "../../..", true);
   validXmlFiles   = getFileList(validXmlFilesPath);
   invalidXmlFiles = getFileList(invalidXmlFilesPath);
+  const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  mTempDir = fs::temp_directory_path() / fs::unique_path("sxb_" + testName + "_%%%%-%%%%-%%%%");
+  fs::create_directories(mTempDir);
 }
 
 void InitConfigParser::TearDown()
 {
+  boost::system::error_code ec;
+  fs::remove_all(mTempDir, ec);
+}
 
+std::string InitConfigParser::getTempPath(const std::string& fileName)
+{
+  return (mTempDir / fileName).string();
 }
 
 std::vector<Ias::String> InitConfigParser::getValidXmlFiles()
@@ -372,6 +397,160 @@ TEST_F(InitConfigParser, checkData_sxb_topology_1_xml)
 }
 
 
+/**
+ * Write a synthetic topology with numZones SmartX sink devices, each with one routing zone, and numSources SmartX
+ * source devices. Each source is connected to one routing zone.
+ */
+static void writeLargeTopology(const std::string &fileName, uint32_t numZones, uint32_t numSources)
+{
+  std::ofstream xml(fileName.c_str(), std::ios::trunc);
+  xml << "<?xml version=\"1.0\"?>\n<SmartXbar>\n  <Sinks>\n";
+  for (uint32_t zone = 0; zone < numZones; ++zone)
+  {
+    xml << "    <Sink name=\"smartx:sink" << zone << "\" clock_type=\"ClockReceived\" data_format=\"Int16\""
+        << " asrc_period_count=\"4\" num_channels=\"2\" num_period=\"4\" period_size=\"192\" sample_rate=\"48000\">\n"
+        << "      <Port name=\"sink" << zone << "_port\" channel_count=\"2\" id=\"-1\" channel_index=\"0\"/>\n"
+        << "    </Sink>\n";
+  }
+  xml << "  </Sinks>\n  <Sources>\n";
+  for (uint32_t source = 0; source < numSources; ++source)
+  {
+    xml << "    <Source name=\"smartx:source" << source << "\" clock_type=\"ClockReceived\" data_format=\"Int16\""
+        << " asrc_period_count=\"4\" num_channels=\"2\" num_period=\"4\" period_size=\"192\" sample_rate=\"48000\">\n"
+        << "      <Port name=\"source" << source << "_port\" channel_count=\"2\" id=\"" << source << "\" channel_index=\"0\"/>\n"
+        << "    </Source>\n";
+  }
+  xml << "  </Sources>\n  <RoutingZones>\n";
+  for (uint32_t zone = 0; zone < numZones; ++zone)
+  {
+    xml << "    <RoutingZone name=\"zone" << zone << "\" sink=\"smartx:sink" << zone << "\">\n"
+        << "      <Port name=\"zone" << zone << "_port\" channel_count=\"2\" id=\"" << 1000 + zone << "\" channel_index=\"0\"/>\n"
+        << "    </RoutingZone>\n";
+  }
+  xml << "  </RoutingZones>\n  <Links>\n    <SetupLinks>\n";
+  for (uint32_t zone = 0; zone < numZones; ++zone)
+  {
+    xml << "      <SetupLink rz_input_port=\"zone" << zone << "_port\" sink_input_port=\"sink" << zone << "_port\"/>\n";
+  }
+  xml << "    </SetupLinks>\n    <RoutingLinks>\n";
+  for (uint32_t source = 0; source < numSources; ++source)
+  {
+    xml << "      <RoutingLink output_port_id=\"" << source << "\" rz_input_port_id=\"" << 1000 + (source % numZones) << "\"/>\n";
+  }
+  xml << "    </RoutingLinks>\n  </Links>\n</SmartXbar>\n";
+}
+
+TEST_F(InitConfigParser, topologyCacheEqualsXml)
+{
+  const std::string xmlFile = getTempPath("topology.xml");
+  const std::string cacheFile = getTempPath("topology.cache");
+  writeLargeTopology(xmlFile, 8, 16);
+
+  WrapperSmartX* smartXl = new WrapperSmartX{};
+  EXPECT_TRUE(parseConfig(smartXl->getSmartX(), xmlFile.c_str()));
+  IasAudioDataComparer l{smartXl->getSmartX()};
+  delete smartXl;
+
+  // The first parse with a cache file reads the XML file and writes the cache file
+  WrapperSmartX* smartXm = new WrapperSmartX{};
+  EXPECT_TRUE(parseConfig(smartXm->getSmartX(), xmlFile.c_str(), cacheFile.c_str()));
+  IasAudioDataComparer m{smartXm->getSmartX()};
+  delete smartXm;
+  std::ifstream cache(cacheFile.c_str());
+  EXPECT_TRUE(cache.good());
+
+  // The second parse replays the cache file
+  WrapperSmartX* smartXr = new WrapperSmartX{};
+  EXPECT_TRUE(parseConfig(smartXr->getSmartX(), xmlFile.c_str(), cacheFile.c_str()));
+  IasAudioDataComparer r{smartXr->getSmartX()};
+  delete smartXr;
+
+  EXPECT_EQ(l, m);
+  EXPECT_EQ(l, r);
+}
+
+TEST_F(InitConfigParser, topologyCacheInvalidation)
+{
+  const std::string xmlFile = getTempPath("topology.xml");
+  const std::string cacheFile = getTempPath("topology.cache");
+  writeLargeTopology(xmlFile, 4, 4);
+  {
+    WrapperSmartX wrapperSmartX{};
+    EXPECT_TRUE(parseConfig(wrapperSmartX.getSmartX(), xmlFile.c_str(), cacheFile.c_str()));
+  }
+  uint64_t hash = 0;
+  uint64_t size = 0;
+  ASSERT_EQ(IasTopologyCache::eIasOk, IasTopologyCache::hashFile(xmlFile, &hash, &size));
+  IasTopologyCache cache;
+  EXPECT_EQ(IasTopologyCache::eIasOk, cache.load(cacheFile, hash, size));
+  EXPECT_EQ(4u, cache.getNumConnections());
+
+  // A changed XML file outdates the cache file, the XML file is parsed and the cache file is rewritten
+  writeLargeTopology(xmlFile, 4, 6);
+  ASSERT_EQ(IasTopologyCache::eIasOk, IasTopologyCache::hashFile(xmlFile, &hash, &size));
+  EXPECT_EQ(IasTopologyCache::eIasOutdated, cache.load(cacheFile, hash, size));
+  WrapperSmartX* smartXl = new WrapperSmartX{};
+  EXPECT_TRUE(parseConfig(smartXl->getSmartX(), xmlFile.c_str(), cacheFile.c_str()));
+  IasAudioDataComparer l{smartXl->getSmartX()};
+  delete smartXl;
+  EXPECT_EQ(IasTopologyCache::eIasOk, cache.load(cacheFile, hash, size));
+  EXPECT_EQ(6u, cache.getNumConnections());
+
+  // A corrupt cache file is rejected and the XML file is parsed instead
+  {
+    std::fstream file(cacheFile.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(-1, std::ios::end);
+    file.put('\x5a');
+  }
+  EXPECT_EQ(IasTopologyCache::eIasInvalid, cache.load(cacheFile, hash, size));
+  WrapperSmartX* smartXr = new WrapperSmartX{};
+  EXPECT_TRUE(parseConfig(smartXr->getSmartX(), xmlFile.c_str(), cacheFile.c_str()));
+  IasAudioDataComparer r{smartXr->getSmartX()};
+  delete smartXr;
+  EXPECT_EQ(l, r);
+  EXPECT_EQ(IasTopologyCache::eIasOk, cache.load(cacheFile, hash, size));
+}
+
+/**
+ * Time the full start-up path, from the creation of the SmartX instance until all routing zones are running,
+ * once with parsing the XML file and once with replaying the cache file.
+ */
+TEST_F(InitConfigParser, topologyCacheStartupBenchmark)
+{
+  const std::string xmlFile = getTempPath("topology.xml");
+  const std::string cacheFile = getTempPath("topology.cache");
+  writeLargeTopology(xmlFile, 64, 256);
+  {
+    WrapperSmartX wrapperSmartX{};
+    EXPECT_TRUE(parseConfig(wrapperSmartX.getSmartX(), xmlFile.c_str(), cacheFile.c_str()));
+  }
+
+  auto measureStartup = [](const char *xml, const char *cache) {
+    const auto start = std::chrono::steady_clock::now();
+    IasSmartX *smartx = IasSmartX::create();
+    EXPECT_TRUE(smartx != nullptr);
+    EXPECT_TRUE(parseConfig(smartx, xml, cache));
+    EXPECT_EQ(IasSmartX::eIasOk, smartx->start());
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(IasSmartX::eIasOk, smartx->stop());
+    IasSmartX::destroy(smartx);
+    return duration;
+  };
+
+  const uint32_t cNumRuns = 5;
+  std::chrono::microseconds xmlDuration(0);
+  std::chrono::microseconds cacheDuration(0);
+  for (uint32_t run = 0; run < cNumRuns; ++run)
+  {
+    xmlDuration += measureStartup(xmlFile.c_str(), nullptr);
+    cacheDuration += measureStartup(xmlFile.c_str(), cacheFile.c_str());
+  }
+  RecordProperty("numRuns", static_cast<int>(cNumRuns));
+  RecordProperty("xmlStartupTimeUs", static_cast<int>(xmlDuration.count() / cNumRuns));
+  RecordProperty("cacheStartupTimeUs", static_cast<int>(cacheDuration.count() / cNumRuns));
+}
+
+
 } /* namespace IasAudio */
 
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/*
+ * IasLatencyProbeTest.cpp
+ *
+ *  Created 2018
+ */
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+#include "smartx/IasLatencyProbe.hpp"
+
+using namespace IasAudio;
+
+namespace IasAudio {
+
+static const uint32_t cSampleRate  = 48000;
+static const uint32_t cPeriodSize  = 240;       // 5 ms
+static const float    cMaxErrorUs  = 0.01f;
+
+/**
+ * @brief Latency probe with a simulated clock, which is set by the test
+ */
+class IasSimulatedLatencyProbe : public IasLatencyProbe
+{
+  public:
+    IasSimulatedLatencyProbe(const IasLatencyProbeParams &params)
+      :IasLatencyProbe(params)
+      ,mNowNs(0)
+    {}
+
+    void setFrameTime(uint64_t frames)
+    {
+      mNowNs = static_cast<int64_t>(frames * 1000000000ULL / cSampleRate);
+    }
+
+  protected:
+    virtual int64_t getTimeNs() const
+    {
+      return mNowNs;
+    }
+
+  private:
+    int64_t mNowNs;
+};
+
+/**
+ * @brief Simulates a mono path with a fixed delay between the source and the sink buffer
+ *
+ * In each period the source block is passed to IasLatencyProbe::inject with one period available in the source
+ * buffer. The block that leaves the delay line is passed to IasLatencyProbe::detect with the given number of
+ * frames queued in front of it. The expected latency of this path is delay + period + queued frames.
+ */
+class IasLatencyProbeTest : public ::testing::Test
+{
+  protected:
+    IasLatencyProbeParams getParams(uint32_t numMeasurements)
+    {
+      IasLatencyProbeParams params;
+      params.numMeasurements = numMeasurements;
+      params.injectIndex = 0;
+      params.injectNumChannels = 1;
+      params.injectSampleRate = cSampleRate;
+      params.detectIndex = 0;
+      params.detectNumChannels = 1;
+      params.detectSampleRate = cSampleRate;
+      return params;
+    }
+
+    static IasAudioArea getArea(float *buffer)
+    {
+      IasAudioArea area;
+      area.start = buffer;
+      area.first = 0;
+      area.step = 8 * sizeof(float);
+      area.index = 0;
+      area.maxIndex = 0;
+      return area;
+    }
+
+    /**
+     * @brief Run the simulated path until the probe is finished, detectEnabled = false switches the sink side off
+     *
+     * @param[in] queuedFrames Returns the number of frames queued at the sink for the given measurement index
+     */
+    template <typename Queued>
+    uint32_t run(IasSimulatedLatencyProbe &probe, uint32_t delay, bool detectEnabled, Queued queuedFrames)
+    {
+      std::vector<float> signal;
+      uint32_t numPeriods = 0;
+      for (; (probe.isFinished() == false) && (numPeriods < 10000); ++numPeriods)
+      {
+        const uint64_t periodStart = static_cast<uint64_t>(numPeriods) * cPeriodSize;
+        probe.setFrameTime(periodStart);
+        signal.resize(periodStart + cPeriodSize, 0.0f);
+        IasAudioArea sourceArea = getArea(&signal[periodStart]);
+        probe.inject(&sourceArea, eIasFormatFloat32, 0, cPeriodSize, cPeriodSize);
+
+        if (detectEnabled == true && periodStart >= delay)
+        {
+          IasIDebug::IasLatencyResult result;
+          probe.getResult(&result);
+          IasAudioArea sinkArea = getArea(&signal[periodStart - delay]);
+          probe.detect(&sinkArea, eIasFormatFloat32, 0, cPeriodSize, queuedFrames(result.numMeasurements));
+        }
+      }
+      return numPeriods;
+    }
+};
+
+TEST_F(IasLatencyProbeTest, knownDelay)
+{
+  const uint32_t numMeasurements = 4;
+  const uint32_t delay = 1000;
+  const uint32_t queued = 480;
+  IasSimulatedLatencyProbe probe(getParams(numMeasurements));
+  run(probe, delay, true, [queued](uint32_t) { return queued; });
+
+  IasIDebug::IasLatencyResult result;
+  probe.getResult(&result);
+  EXPECT_TRUE(result.isFinished);
+  EXPECT_EQ(numMeasurements, result.numMeasurements);
+  EXPECT_EQ(0u, result.numMissed);
+  const float expectedFrames = static_cast<float>(delay + cPeriodSize + queued);
+  const float expectedUs = expectedFrames * 1000000.0f / cSampleRate;
+  EXPECT_NEAR(expectedUs, result.minUs, cMaxErrorUs);
+  EXPECT_NEAR(expectedUs, result.maxUs, cMaxErrorUs);
+  EXPECT_NEAR(expectedUs, result.meanUs, cMaxErrorUs);
+  EXPECT_NEAR(0.0f, result.jitterUs, cMaxErrorUs);
+  EXPECT_NEAR(expectedFrames, result.meanFrames, 0.01f);
+}
+
+TEST_F(IasLatencyProbeTest, statistics)
+{
+  // A different number of frames is queued at the sink for each marker, which gives a known spread.
+  const std::vector<uint32_t> queued = {0, 48, 96, 480, 960};
+  const uint32_t delay = 100;
+  IasSimulatedLatencyProbe probe(getParams(static_cast<uint32_t>(queued.size())));
+  run(probe, delay, true, [&queued](uint32_t index) { return queued[index]; });
+
+  std::vector<double> expectedUs;
+  for (auto frames : queued)
+  {
+    expectedUs.push_back(static_cast<double>(delay + cPeriodSize + frames) * 1000000.0 / cSampleRate);
+  }
+  double mean = 0.0;
+  for (auto value : expectedUs)
+  {
+    mean += value;
+  }
+  mean /= static_cast<double>(expectedUs.size());
+  double variance = 0.0;
+  for (auto value : expectedUs)
+  {
+    variance += (value - mean) * (value - mean);
+  }
+  const double jitter = std::sqrt(variance / static_cast<double>(expectedUs.size()));
+
+  IasIDebug::IasLatencyResult result;
+  probe.getResult(&result);
+  EXPECT_EQ(queued.size(), result.numMeasurements);
+  EXPECT_NEAR(expectedUs.front(), result.minUs, cMaxErrorUs);
+  EXPECT_NEAR(expectedUs.back(), result.maxUs, cMaxErrorUs);
+  EXPECT_NEAR(mean, result.meanUs, cMaxErrorUs);
+  EXPECT_NEAR(jitter, result.jitterUs, cMaxErrorUs);
+  const double framesPerUs = cSampleRate / 1000000.0;
+  EXPECT_NEAR(expectedUs.front() * framesPerUs, result.minFrames, 0.01);
+  EXPECT_NEAR(expectedUs.back() * framesPerUs, result.maxFrames, 0.01);
+  EXPECT_NEAR(mean * framesPerUs, result.meanFrames, 0.01);
+  EXPECT_NEAR(jitter * framesPerUs, result.jitterFrames, 0.01);
+}
+
+TEST_F(IasLatencyProbeTest, missedMarkers)
+{
+  const uint32_t numMeasurements = 2;
+  IasSimulatedLatencyProbe probe(getParams(numMeasurements));
+  const uint32_t numPeriods = run(probe, 0, false, [](uint32_t) { return 0u; });
+
+  IasIDebug::IasLatencyResult result;
+  probe.getResult(&result);
+  EXPECT_TRUE(result.isFinished);
+  EXPECT_EQ(0u, result.numMeasurements);
+  EXPECT_EQ(numMeasurements, result.numMissed);
+  EXPECT_EQ(0.0f, result.meanUs);
+  // Each marker is sent after the hold-off time of 250 ms and counted as missed after one second.
+  EXPECT_EQ(numMeasurements * (cSampleRate * 5 / 4) / cPeriodSize, numPeriods);
+}
+
+} // namespace IasAudio
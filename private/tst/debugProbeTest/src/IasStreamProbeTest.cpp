@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/*
+ * IasStreamProbeTest.cpp
+ *
+ *  Created 2018
+ */
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "smartx/IasStreamProbe.hpp"
+#include "avbaudiomodules/internal/audio/common/alsa_smartx_plugin/IasAlsaPluginShmConnection.hpp"
+#include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBuffer.hpp"
+
+using namespace IasAudio;
+
+namespace IasAudio {
+
+static const uint32_t cNumSourceChannels = 3;
+static const uint32_t cPeriodSize        = 480;
+
+/**
+ * @brief Feeds an interleaved source buffer with three channels into a stream probe, which records channels 1 and 2
+ *
+ * Each sample carries its channel and its frame number, so the reader can check which frames were recorded.
+ */
+class IasStreamProbeTest : public ::testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+      mNumFramesSent = 0;
+      mSource.resize(cPeriodSize * cNumSourceChannels);
+      for (uint32_t chan = 0; chan < cNumSourceChannels; ++chan)
+      {
+        mAreas[chan].start = mSource.data();
+        mAreas[chan].first = chan * 8 * static_cast<uint32_t>(sizeof(float));
+        mAreas[chan].step = cNumSourceChannels * 8 * static_cast<uint32_t>(sizeof(float));
+        mAreas[chan].index = chan;
+        mAreas[chan].maxIndex = cNumSourceChannels - 1;
+      }
+    }
+
+    static float getSample(uint32_t chan, uint64_t frame)
+    {
+      return static_cast<float>(chan * 100000 + frame);
+    }
+
+    void sendPeriod(IasStreamProbe &probe)
+    {
+      for (uint32_t frame = 0; frame < cPeriodSize; ++frame)
+      {
+        for (uint32_t chan = 0; chan < cNumSourceChannels; ++chan)
+        {
+          mSource[frame * cNumSourceChannels + chan] = getSample(chan, mNumFramesSent + frame);
+        }
+      }
+      probe.process(mAreas, eIasFormatFloat32, 0, cPeriodSize);
+      mNumFramesSent += cPeriodSize;
+    }
+
+    /**
+     * @brief Read numFrames from the shm ring buffer and check that they are the source frames starting at firstFrame
+     */
+    void expectRecorded(IasAudioRingBuffer *ringBuffer, uint64_t firstFrame, uint32_t numFrames)
+    {
+      uint32_t numFramesRemaining = numFrames;
+      while (numFramesRemaining > 0)
+      {
+        IasAudioArea *areas = nullptr;
+        uint32_t offset = 0;
+        uint32_t numFramesRead = numFramesRemaining;
+        ASSERT_EQ(eIasRingBuffOk, ringBuffer->beginAccess(eIasRingBufferAccessRead, &areas, &offset, &numFramesRead));
+        ASSERT_GT(numFramesRead, 0u);
+        for (uint32_t frame = 0; frame < numFramesRead; ++frame)
+        {
+          for (uint32_t chan = 0; chan < 2; ++chan)
+          {
+            const float *sample = reinterpret_cast<const float*>(static_cast<char*>(areas[chan].start) +
+                                                                 ((areas[chan].first + (offset + frame) * areas[chan].step) >> 3));
+            ASSERT_EQ(getSample(chan + 1, firstFrame + frame), *sample) << "frame=" << firstFrame + frame << " chan=" << chan;
+          }
+        }
+        ASSERT_EQ(eIasRingBuffOk, ringBuffer->endAccess(eIasRingBufferAccessRead, offset, numFramesRead));
+        numFramesRemaining -= numFramesRead;
+        firstFrame += numFramesRead;
+      }
+    }
+
+    std::vector<float> mSource;
+    IasAudioArea       mAreas[cNumSourceChannels];
+    uint64_t           mNumFramesSent;
+};
+
+TEST_F(IasStreamProbeTest, ringContentsAndOverruns)
+{
+  IasStreamProbeParams params;
+  params.name = "streamProbeTest";
+  params.index = 1;
+  params.numChannels = 2;
+  params.sampleRate = 48000;
+  params.periodSize = cPeriodSize;
+  params.dataFormat = eIasFormatFloat32;
+  IasStreamProbe probe(params);
+  ASSERT_EQ(IasStreamProbe::eIasOk, probe.init());
+
+  // Attach to the shm ring buffer like the alsa-smartx-plugin of an external analyser.
+  IasAlsaPluginShmConnection reader;
+  ASSERT_EQ(eIasResultOk, reader.findConnection("smartx_streamProbeTest_c"));
+  IasAudioRingBuffer *ringBuffer = reader.getRingBuffer();
+  ASSERT_TRUE(ringBuffer != nullptr);
+  uint32_t capacity = 0;
+  ASSERT_EQ(eIasRingBuffOk, ringBuffer->updateAvailable(eIasRingBufferAccessWrite, &capacity));
+  ASSERT_EQ(0u, capacity % cPeriodSize);
+  const uint32_t numPeriodsCapacity = capacity / cPeriodSize;
+
+  // The recorded channels of the first periods arrive unchanged.
+  for (uint32_t period = 0; period < 3; ++period)
+  {
+    sendPeriod(probe);
+  }
+  uint32_t numFramesAvailable = 0;
+  ASSERT_EQ(eIasRingBuffOk, ringBuffer->updateAvailable(eIasRingBufferAccessRead, &numFramesAvailable));
+  ASSERT_EQ(3 * cPeriodSize, numFramesAvailable);
+  expectRecorded(ringBuffer, 0, numFramesAvailable);
+
+  // The reader stalls: the buffer is filled completely and the following periods are dropped as one overrun.
+  const uint64_t firstFrameOfFill = mNumFramesSent;
+  for (uint32_t period = 0; period < numPeriodsCapacity + 3; ++period)
+  {
+    sendPeriod(probe);
+  }
+  IasIDebug::IasStreamProbeStatistics statistics;
+  probe.getStatistics(&statistics);
+  EXPECT_EQ(static_cast<uint64_t>(3 + numPeriodsCapacity) * cPeriodSize, statistics.numFramesWritten);
+  EXPECT_EQ(3u * cPeriodSize, statistics.numFramesDropped);
+  EXPECT_EQ(1u, statistics.numOverruns);
+
+  // The reader frees one period, so the next period is recorded directly after the last one that fit.
+  expectRecorded(ringBuffer, firstFrameOfFill, cPeriodSize);
+  const uint64_t firstFrameAfterGap = mNumFramesSent;
+  sendPeriod(probe);
+  // Another stall is counted as a new overrun.
+  sendPeriod(probe);
+  sendPeriod(probe);
+  probe.getStatistics(&statistics);
+  EXPECT_EQ(static_cast<uint64_t>(4 + numPeriodsCapacity) * cPeriodSize, statistics.numFramesWritten);
+  EXPECT_EQ(5u * cPeriodSize, statistics.numFramesDropped);
+  EXPECT_EQ(2u, statistics.numOverruns);
+
+  ASSERT_EQ(eIasRingBuffOk, ringBuffer->updateAvailable(eIasRingBufferAccessRead, &numFramesAvailable));
+  ASSERT_EQ(capacity, numFramesAvailable);
+  expectRecorded(ringBuffer, firstFrameOfFill + cPeriodSize, capacity - cPeriodSize);
+  expectRecorded(ringBuffer, firstFrameAfterGap, cPeriodSize);
+}
+
+} // namespace IasAudio
@@ -0,0 +1,18 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/*
+ * debugProbeTestMain.cpp
+ *
+ *  Created 2018
+ */
+
+#include "gtest/gtest.h"
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
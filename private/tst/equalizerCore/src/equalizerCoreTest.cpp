@@ -9,6 +9,7 @@
  *  Created on: August 2016
  */
 #include <cstdio>
+#include <math.h>
 #include <cstring>
 #include <iostream>
 
@@ -636,4 +637,197 @@ TEST_F(IasEqualizerCoreTest, main_test)
 }
 
 
+TEST_F(IasEqualizerCoreTest, parameterSnapshot)
+{
+  const uint32_t cNumChannels = 2;
+  const uint32_t cFadeLength  = 2*cIasFrameLength;
+  const uint32_t cNumStages   = 2;
+  const float    cMaxError    = 1.0e-5f;
+
+  IasAudioChain* audioChain = new IasAudioChain();
+  ASSERT_TRUE(audioChain != nullptr);
+  IasAudioChain::IasInitParams initParams;
+  initParams.periodSize = cIasFrameLength;
+  initParams.sampleRate = cIasSampleRate;
+  ASSERT_EQ(IasAudioChain::eIasOk, audioChain->init(initParams));
+  auto* hSink = audioChain->createInputAudioStream("Sink1", 1, cNumChannels, false);
+
+  setenv("AUDIO_PLUGIN_DIR", "../../..", true);
+  const auto cmdDispatcher = std::make_shared<IasCmdDispatcher>();
+  IasPluginEngine pluginEngine(cmdDispatcher);
+  ASSERT_EQ(eIasAudioProcOK, pluginEngine.loadPluginLibraries());
+  IasIGenericAudioCompConfig* config = nullptr;
+  ASSERT_EQ(eIasAudioProcOK, pluginEngine.createModuleConfig(&config));
+  ASSERT_TRUE(nullptr != config);
+  config->addStreamToProcess(hSink, "Sink1");
+  IasProperties properties;
+  properties.set("EqualizerMode", static_cast<int32_t>(IasEqualizer::IasEqualizerMode::eIasUser));
+  properties.set("numFilterStagesMax", 4);
+  config->setProperties(properties);
+  IasGenericAudioComp* equalizer = nullptr;
+  pluginEngine.createModule(config, "ias.equalizer", "MyEqualizer", &equalizer);
+  ASSERT_TRUE(nullptr != equalizer);
+  audioChain->addAudioComponent(equalizer);
+  auto* equalizerCore = equalizer->getCore();
+  ASSERT_TRUE(nullptr != equalizerCore);
+  equalizerCore->enableProcessing();
+  IasEqualizerCore* eqCore = dynamic_cast<IasEqualizerCore*>(equalizerCore);
+  ASSERT_TRUE(nullptr != eqCore);
+
+  // The filter cascade of the snapshot, both filters consist of one 2nd order section.
+  std::vector<IasAudioFilterParams> snapshotParamsTable;
+  snapshotParamsTable.push_back(IasAudioFilterParams{1000, 2.00f, 2.0f, eIasFilterTypePeak,        2, 0});
+  snapshotParamsTable.push_back(IasAudioFilterParams{ 200, 0.50f, 1.0f, eIasFilterTypeLowShelving, 2, 0});
+
+  // Reference filters, which are set directly to the parameters of the snapshot.
+  IasAudioChannelBundle referenceBundle(cIasFrameLength);
+  ASSERT_EQ(eIasAudioProcOK, referenceBundle.init());
+  std::vector<IasAudioFilter*> referenceFilters;
+  for (uint32_t cntStages = 0; cntStages < cNumStages; cntStages++)
+  {
+    IasAudioFilter* filter = new IasAudioFilter(cIasSampleRate, cIasFrameLength);
+    ASSERT_EQ(eIasAudioProcOK, filter->init());
+    filter->setBundlePointer(&referenceBundle);
+    IasAudioFilterParams params = snapshotParamsTable[cntStages];
+    params.section = 1;
+    for (uint32_t channel = 0; channel < cNumChannels; channel++)
+    {
+      ASSERT_EQ(0, filter->setChannelFilter(channel, &params));
+    }
+    referenceFilters.push_back(filter);
+  }
+
+  // Sine waves of different frequencies in both channels.
+  std::vector<std::vector<float>> frameData(cNumChannels, std::vector<float>(cIasFrameLength));
+  std::vector<float> input(cNumChannels*cIasFrameLength);
+  IasAudioFrame dataStream;
+  uint32_t cntSamples = 0;
+  auto processPeriod = [&]()
+  {
+    dataStream.clear();
+    for (uint32_t channel = 0; channel < cNumChannels; channel++)
+    {
+      for (uint32_t frame = 0; frame < cIasFrameLength; frame++)
+      {
+        float const freq = (channel == 0) ? 150.0f : 2500.0f;
+        input[channel*cIasFrameLength + frame] = 0.5f * sinf(2.0f*static_cast<float>(M_PI)*freq*static_cast<float>(cntSamples+frame)/static_cast<float>(cIasSampleRate));
+        frameData[channel][frame] = input[channel*cIasFrameLength + frame];
+      }
+      dataStream.push_back(frameData[channel].data());
+    }
+    cntSamples += cIasFrameLength;
+    hSink->asBundledStream()->writeFromNonInterleaved(dataStream);
+    EXPECT_EQ(eIasAudioProcOK, equalizerCore->process());
+    hSink->asBundledStream()->read(dataStream);
+  };
+  auto processReference = [&](std::vector<float> &output)
+  {
+    float* audioData = referenceBundle.getAudioDataPointer();
+    for (uint32_t frame = 0; frame < cIasFrameLength; frame++)
+    {
+      for (uint32_t channel = 0; channel < cNumChannels; channel++)
+      {
+        audioData[frame*cIasNumChannelsPerBundle + channel] = input[channel*cIasFrameLength + frame];
+      }
+    }
+    for (auto filter : referenceFilters)
+    {
+      filter->calculate();
+    }
+    output.resize(cNumChannels*cIasFrameLength);
+    for (uint32_t frame = 0; frame < cIasFrameLength; frame++)
+    {
+      for (uint32_t channel = 0; channel < cNumChannels; channel++)
+      {
+        output[channel*cIasFrameLength + frame] = audioData[frame*cIasNumChannelsPerBundle + channel];
+      }
+    }
+  };
+
+  // Without any filters the equalizer passes the input through.
+  processPeriod();
+  for (uint32_t channel = 0; channel < cNumChannels; channel++)
+  {
+    for (uint32_t frame = 0; frame < cIasFrameLength; frame++)
+    {
+      EXPECT_EQ(input[channel*cIasFrameLength + frame], frameData[channel][frame]);
+    }
+  }
+
+  // A snapshot of another module type has to be rejected.
+  EXPECT_EQ(eIasAudioProcInvalidParam, equalizerCore->setParameterSnapshot(std::make_shared<IasParameterSnapshot>(), 0));
+  EXPECT_EQ(eIasAudioProcInvalidParam, equalizerCore->setParameterSnapshot(nullptr, 0));
+
+  // An invalid snapshot is rejected as a whole, the valid stream before the invalid one is not adopted either.
+  uint32_t numFilters = 0;
+  auto invalidSnapshot = std::make_shared<IasEqualizerSnapshot>();
+  invalidSnapshot->addStream(1, std::vector<uint32_t>(), snapshotParamsTable);
+  invalidSnapshot->addStream(99, std::vector<uint32_t>(), snapshotParamsTable);
+  EXPECT_EQ(eIasAudioProcInvalidParam, equalizerCore->setParameterSnapshot(invalidSnapshot, cFadeLength));
+  EXPECT_EQ(eIasAudioProcOK, eqCore->getNumFiltersForChannel(1, 0, &numFilters));
+  EXPECT_EQ(0u, numFilters);
+  std::vector<IasAudioFilterParams> tooManyStages(snapshotParamsTable);
+  tooManyStages.push_back(IasAudioFilterParams{ 100, 1.00f, 1.0f, eIasFilterTypeHighpass, 6, 0});
+  invalidSnapshot = std::make_shared<IasEqualizerSnapshot>();
+  invalidSnapshot->addStream(1, std::vector<uint32_t>(), tooManyStages);
+  EXPECT_EQ(eIasAudioProcNoSpaceLeft, equalizerCore->setParameterSnapshot(invalidSnapshot, cFadeLength));
+  EXPECT_EQ(eIasAudioProcOK, eqCore->getNumFiltersForChannel(1, 0, &numFilters));
+  EXPECT_EQ(0u, numFilters);
+
+  auto snapshot = std::make_shared<IasEqualizerSnapshot>();
+  snapshot->addStream(1, std::vector<uint32_t>(), snapshotParamsTable);
+  EXPECT_EQ(eIasAudioProcOK, equalizerCore->setParameterSnapshot(snapshot, cFadeLength));
+  EXPECT_EQ(eIasAudioProcOK, eqCore->getNumFiltersForChannel(1, 0, &numFilters));
+  EXPECT_EQ(cNumStages, numFilters);
+  IasAudioFilterParams filterParams;
+  EXPECT_EQ(eIasAudioProcOK, eqCore->getFilterParamsForChannel(1, 1, 1, &filterParams));
+  EXPECT_EQ(200u, filterParams.freq);
+
+  // The output is faded out with the old filters during the first two periods, the snapshot is adopted
+  // while the output is silent and the output is faded in with the new filters during the next two periods.
+  std::vector<float> reference;
+  for (uint32_t cntPeriods = 0; cntPeriods < 8; cntPeriods++)
+  {
+    processPeriod();
+    bool const isFadeOut = (cntPeriods < 2);
+    if (isFadeOut == false)
+    {
+      processReference(reference);
+    }
+    for (uint32_t frame = 0; frame < cIasFrameLength; frame++)
+    {
+      float gain = 1.0f;
+      uint32_t const fadePosition = (cntPeriods % 2)*cIasFrameLength + frame + 1;
+      if (isFadeOut)
+      {
+        gain = 1.0f - static_cast<float>(fadePosition)/static_cast<float>(cFadeLength);
+      }
+      else if (cntPeriods < 4)
+      {
+        gain = static_cast<float>(fadePosition)/static_cast<float>(cFadeLength);
+      }
+      for (uint32_t channel = 0; channel < cNumChannels; channel++)
+      {
+        float const expected = gain * (isFadeOut ? input[channel*cIasFrameLength + frame] : reference[channel*cIasFrameLength + frame]);
+        EXPECT_NEAR(expected, frameData[channel][frame], cMaxError) << "period=" << cntPeriods << " frame=" << frame << " channel=" << channel;
+      }
+    }
+  }
+  // The snapshot changes the signal, otherwise the comparison above would not verify the coefficients.
+  float difference = 0.0f;
+  for (uint32_t frame = 0; frame < cIasFrameLength; frame++)
+  {
+    difference = std::max(difference, fabsf(reference[frame] - input[frame]));
+  }
+  EXPECT_GT(difference, 0.01f);
+
+  for (auto filter : referenceFilters)
+  {
+    delete filter;
+  }
+  delete(equalizerCore);
+  delete(audioChain);
+}
+
+
 } // namespace IasAudio
@@ -17,6 +17,7 @@
 #include <iostream>
 #include <malloc.h>
 #include <math.h>
+#include <vector>
 
 #include "filter/IasAudioFilter.hpp"
 
@@ -191,4 +192,179 @@ TEST_F(IasFilterCoverageTest, coverage_test)
 
   delete filter;
 }
+
+
+/*
+ * Ramp the gain of a peak filter and return the energy of the output signal within the band
+ * from 2 kHz to 6 kHz relative to the total energy, in dB. The input signal is a sine at the
+ * mid frequency of the filter, so the energy within this band is caused by the modulation of
+ * the filter output. If the coefficients are updated only once per frame, the stepped gain
+ * spreads energy into this band (zipper noise).
+ */
+static double measureZipperEnergy(uint32_t frameLength, uint32_t freq, float gainStart, float gainTarget)
+{
+  const uint32_t cNumSettleFrames = 8;
+  const uint32_t cNumSamples      = 8192;
+  IasAudioFilter filter(sampleFreq, frameLength);
+  IasAudioChannelBundle bundle(frameLength);
+  EXPECT_EQ(eIasAudioProcOK, bundle.init());
+  EXPECT_EQ(eIasAudioProcOK, filter.init());
+  filter.setBundlePointer(&bundle);
+
+  IasAudioFilterParams params;
+  params.freq    = freq;
+  params.gain    = gainStart;
+  params.quality = 1.0f;
+  params.type    = eIasFilterTypePeak;
+  params.order   = 2;
+  params.section = 1;
+  EXPECT_EQ(0, filter.setChannelFilter(0, &params));
+  EXPECT_EQ(0, filter.setRampGradient(0, 3.0f));
+
+  std::vector<double> output;
+  uint64_t sampleCnt = 0;
+  for (uint32_t frame = 0; output.size() < cNumSamples; frame++)
+  {
+    if (frame == cNumSettleFrames)
+    {
+      EXPECT_EQ(0, filter.rampGain(0, gainTarget, 0));
+    }
+    float *data = bundle.getAudioDataPointer();
+    for (uint32_t i = 0; i < frameLength; i++, sampleCnt++)
+    {
+      float sample = 0.5f * sinf(2.0f * static_cast<float>(M_PI) * static_cast<float>(freq * sampleCnt % sampleFreq) / static_cast<float>(sampleFreq));
+      for (uint32_t chan = 0; chan < cIasNumChannelsPerBundle; chan++)
+      {
+        data[cIasNumChannelsPerBundle*i + chan] = sample;
+      }
+    }
+    filter.calculate();
+    for (uint32_t i = 0; (frame >= cNumSettleFrames) && (i < frameLength); i++)
+    {
+      output.push_back(static_cast<double>(data[cIasNumChannelsPerBundle*i]));
+    }
+  }
+
+  // Apply a Hann window. The total energy of the spectrum follows from Parseval's theorem.
+  const uint32_t numSamples = static_cast<uint32_t>(output.size());
+  double totalEnergy = 0.0;
+  for (uint32_t n = 0; n < numSamples; n++)
+  {
+    output[n] *= 0.5 - 0.5 * cos(2.0 * M_PI * n / numSamples);
+    totalEnergy += output[n] * output[n];
+  }
+  totalEnergy *= numSamples;
+
+  double bandEnergy = 0.0;
+  for (uint32_t k = 2000 * numSamples / sampleFreq; k < 6000 * numSamples / sampleFreq; k++)
+  {
+    double re = 0.0;
+    double im = 0.0;
+    for (uint32_t n = 0; n < numSamples; n++)
+    {
+      double phase = 2.0 * M_PI * static_cast<double>((static_cast<uint64_t>(k) * n) % numSamples) / numSamples;
+      re += output[n] * cos(phase);
+      im -= output[n] * sin(phase);
+    }
+    // Count the negative frequencies as well.
+    bandEnergy += 2.0 * (re * re + im * im);
+  }
+  return 10.0 * log10(bandEnergy / totalEnergy);
+}
+
+
+/*
+ * Ramp the filter gain by 18 dB in steps of 3 dB per frame, using large frames. With one coefficient
+ * update per frame, the zipper energy is about -55 dB (single precision) or -85 dB (double precision).
+ * The per-sample interpolation of the coefficients keeps it close to the level without ramp.
+ */
+TEST_F(IasFilterCoverageTest, zipper_test)
+{
+  // 1 kHz peak filter, processed in single precision.
+  EXPECT_LT(measureZipperEnergy(1024, 1000, 1.0f, 8.0f), -85.0);
+  EXPECT_LT(measureZipperEnergy(1024, 1000, 8.0f, 1.0f), -85.0);
+
+  // 200 Hz peak filter, processed in double precision.
+  EXPECT_LT(measureZipperEnergy(1024, 200, 1.0f, 8.0f), -105.0);
+  EXPECT_LT(measureZipperEnergy(1024, 200, 8.0f, 1.0f), -105.0);
+}
+
+
+/*
+ * Process one frame of the same noise signal with two filters and verify that both outputs are identical.
+ */
+static void expectEqualOutput(IasAudioFilter &filterA, IasAudioChannelBundle &bundleA,
+                              IasAudioFilter &filterB, IasAudioChannelBundle &bundleB, uint32_t frameLength)
+{
+  float *dataA = bundleA.getAudioDataPointer();
+  float *dataB = bundleB.getAudioDataPointer();
+  for (uint32_t i = 0; i < frameLength * cIasNumChannelsPerBundle; i++)
+  {
+    dataA[i] = static_cast<float>(rand()) / static_cast<float>(RAND_MAX) - 0.5f;
+    dataB[i] = dataA[i];
+  }
+  filterA.calculate();
+  filterB.calculate();
+  for (uint32_t i = 0; i < frameLength * cIasNumChannelsPerBundle; i++)
+  {
+    ASSERT_EQ(dataB[i], dataA[i]) << "sample " << i;
+  }
+}
+
+
+/*
+ * A prepared update must not change the filter parameters of the channel before it is adopted,
+ * because later gain ramps are based on the stored parameters.
+ */
+TEST_F(IasFilterCoverageTest, prepared_update_test)
+{
+  const uint32_t cFrameLength = 64;
+  IasAudioFilter filterA(sampleFreq, cFrameLength);
+  IasAudioFilter filterB(sampleFreq, cFrameLength);
+  IasAudioChannelBundle bundleA(cFrameLength);
+  IasAudioChannelBundle bundleB(cFrameLength);
+  ASSERT_EQ(eIasAudioProcOK, bundleA.init());
+  ASSERT_EQ(eIasAudioProcOK, bundleB.init());
+  ASSERT_EQ(eIasAudioProcOK, filterA.init());
+  ASSERT_EQ(eIasAudioProcOK, filterB.init());
+  filterA.setBundlePointer(&bundleA);
+  filterB.setBundlePointer(&bundleB);
+
+  IasAudioFilterParams params;
+  params.freq    = 1000;
+  params.gain    = 1.0f;
+  params.quality = 1.0f;
+  params.type    = eIasFilterTypePeak;
+  params.order   = 2;
+  params.section = 1;
+  EXPECT_EQ(0, filterA.setChannelFilter(0, &params));
+  EXPECT_EQ(0, filterB.setChannelFilter(0, &params));
+
+  IasAudioFilterParams preparedParams = params;
+  preparedParams.freq    = 300;
+  preparedParams.quality = 2.0f;
+  IasAudioFilterQueueEntry updateEntry;
+
+  // Prepare an update for filter A, which is never adopted. The gain ramp of both filters
+  // is still based on the 1 kHz peak filter.
+  EXPECT_EQ(0, filterA.prepareChannelFilter(0, &preparedParams, &updateEntry));
+  EXPECT_EQ(0, filterA.rampGain(0, 4.0f, 0));
+  EXPECT_EQ(0, filterB.rampGain(0, 4.0f, 0));
+  for (uint32_t frame = 0; frame < 16; frame++)
+  {
+    expectEqualOutput(filterA, bundleA, filterB, bundleB, cFrameLength);
+  }
+
+  // Once the prepared update has been adopted, the gain ramp is based on the prepared parameters.
+  EXPECT_EQ(0, filterA.prepareChannelFilter(0, &preparedParams, &updateEntry));
+  filterA.applyPreparedUpdate(updateEntry);
+  EXPECT_EQ(0, filterB.setChannelFilter(0, &preparedParams));
+  expectEqualOutput(filterA, bundleA, filterB, bundleB, cFrameLength);
+  EXPECT_EQ(0, filterA.rampGain(0, 0.25f, 0));
+  EXPECT_EQ(0, filterB.rampGain(0, 0.25f, 0));
+  for (uint32_t frame = 0; frame < 16; frame++)
+  {
+    expectEqualOutput(filterA, bundleA, filterB, bundleB, cFrameLength);
+  }
+}
 }
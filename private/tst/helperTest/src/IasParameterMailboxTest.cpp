@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/*
+ * IasParameterMailboxTest.cpp
+ *
+ *  Created 2018
+ */
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "helper/IasParameterMailbox.hpp"
+
+using namespace IasAudio;
+
+namespace IasAudio {
+
+/**
+ * @brief Entry with two fields that are always written together, to detect torn reads.
+ */
+struct IasTestMailboxEntry
+{
+  int32_t id;
+  int32_t value;
+  int32_t check;
+};
+
+class IasParameterMailboxTest : public ::testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+TEST_F(IasParameterMailboxTest, postAndFetch)
+{
+  IasParameterMailbox<int32_t> mailbox;
+  EXPECT_EQ(nullptr, mailbox.fetch());
+
+  mailbox.post(1);
+  int32_t *value = mailbox.fetch();
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ(1, *value);
+  // The value is delivered only once.
+  EXPECT_EQ(nullptr, mailbox.fetch());
+
+  mailbox.post(2);
+  value = mailbox.fetch();
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ(2, *value);
+  EXPECT_EQ(nullptr, mailbox.fetch());
+}
+
+TEST_F(IasParameterMailboxTest, latestValueWins)
+{
+  IasParameterMailbox<int32_t> mailbox;
+  for (int32_t count = 1; count <= 10; count++)
+  {
+    mailbox.post(count);
+  }
+  int32_t *value = mailbox.fetch();
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ(10, *value);
+  EXPECT_EQ(nullptr, mailbox.fetch());
+
+  // Overwriting after a fetch must not hand out the slot the reader still owns.
+  mailbox.post(11);
+  mailbox.post(12);
+  int32_t *nextValue = mailbox.fetch();
+  ASSERT_NE(nullptr, nextValue);
+  EXPECT_EQ(12, *nextValue);
+  mailbox.post(13);
+  mailbox.post(14);
+  EXPECT_EQ(12, *nextValue);
+  nextValue = mailbox.fetch();
+  ASSERT_NE(nullptr, nextValue);
+  EXPECT_EQ(14, *nextValue);
+}
+
+TEST_F(IasParameterMailboxTest, forEachSlot)
+{
+  IasParameterMailbox<std::vector<float>> mailbox;
+  uint32_t numSlots = 0;
+  mailbox.forEachSlot([&numSlots](std::vector<float> &slot)
+  {
+    slot.reserve(16);
+    numSlots++;
+  });
+  EXPECT_EQ(3u, numSlots);
+
+  mailbox.post(std::vector<float>(16, 0.5f));
+  std::vector<float> *table = mailbox.fetch();
+  ASSERT_NE(nullptr, table);
+  EXPECT_EQ(16u, table->size());
+  EXPECT_EQ(0.5f, table->back());
+}
+
+TEST_F(IasParameterMailboxTest, mapInvalidKey)
+{
+  IasParameterMailboxMap<int32_t, IasTestMailboxEntry> mailboxes;
+  mailboxes.add(3);
+  mailboxes.add(5);
+  // Adding a key twice keeps the existing mailbox.
+  EXPECT_TRUE(mailboxes.post(5, {5, 50, 50}));
+  mailboxes.add(5);
+
+  EXPECT_FALSE(mailboxes.post(4, {4, 40, 40}));
+  EXPECT_FALSE(mailboxes.post(-1, {-1, 0, 0}));
+
+  std::map<int32_t, int32_t> fetched;
+  mailboxes.fetchAll([&fetched](int32_t key, IasTestMailboxEntry &entry)
+  {
+    fetched[key] = entry.value;
+  });
+  ASSERT_EQ(1u, fetched.size());
+  EXPECT_EQ(50, fetched[5]);
+}
+
+TEST_F(IasParameterMailboxTest, mapFetchAll)
+{
+  IasParameterMailboxMap<int32_t, IasTestMailboxEntry> mailboxes;
+  for (int32_t key = 0; key < 4; key++)
+  {
+    mailboxes.add(key);
+  }
+  EXPECT_TRUE(mailboxes.post(1, {1, 10, 10}));
+  EXPECT_TRUE(mailboxes.post(1, {1, 11, 11}));
+  EXPECT_TRUE(mailboxes.post(3, {3, 30, 30}));
+
+  std::map<int32_t, int32_t> fetched;
+  auto collect = [&fetched](int32_t key, IasTestMailboxEntry &entry)
+  {
+    EXPECT_EQ(key, entry.id);
+    fetched[key] = entry.value;
+  };
+  mailboxes.fetchAll(collect);
+  ASSERT_EQ(2u, fetched.size());
+  EXPECT_EQ(11, fetched[1]);
+  EXPECT_EQ(30, fetched[3]);
+
+  fetched.clear();
+  mailboxes.fetchAll(collect);
+  EXPECT_EQ(0u, fetched.size());
+}
+
+TEST_F(IasParameterMailboxTest, concurrentWritersAndReader)
+{
+  IasParameterMailbox<IasTestMailboxEntry> mailbox;
+  const int32_t cNumWriters = 2;
+  const int32_t cNumPosts = 20000;
+  std::atomic<int32_t> numWritersDone(0);
+  std::vector<std::thread> writers;
+  for (int32_t writer = 0; writer < cNumWriters; writer++)
+  {
+    writers.emplace_back([&mailbox, &numWritersDone, writer]()
+    {
+      for (int32_t count = 1; count <= cNumPosts; count++)
+      {
+        mailbox.post({writer, count, writer * cNumPosts + count});
+      }
+      numWritersDone.fetch_add(1);
+    });
+  }
+
+  // The values of one writer have to arrive in order and never torn.
+  std::vector<int32_t> lastValues(cNumWriters, 0);
+  bool consistent = true;
+  auto check = [&](const IasTestMailboxEntry *entry)
+  {
+    if ((entry->id < 0) || (entry->id >= cNumWriters) ||
+        (entry->check != entry->id * cNumPosts + entry->value) ||
+        (entry->value <= lastValues[entry->id]))
+    {
+      consistent = false;
+      return;
+    }
+    lastValues[entry->id] = entry->value;
+  };
+  while (numWritersDone.load() < cNumWriters)
+  {
+    IasTestMailboxEntry *entry = mailbox.fetch();
+    if (entry != nullptr)
+    {
+      check(entry);
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+  for (auto &thread : writers)
+  {
+    thread.join();
+  }
+  IasTestMailboxEntry *entry = mailbox.fetch();
+  if (entry != nullptr)
+  {
+    check(entry);
+  }
+  EXPECT_TRUE(consistent);
+  // The value posted last is never lost.
+  EXPECT_TRUE(lastValues[0] == cNumPosts || lastValues[1] == cNumPosts);
+}
+
+} // namespace IasAudio
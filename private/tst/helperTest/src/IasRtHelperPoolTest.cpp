@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/*
+ * IasRtHelperPoolTest.cpp
+ *
+ *  Created 2018
+ */
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "helper/IasRtHelperPool.hpp"
+
+using namespace IasAudio;
+
+namespace IasAudio {
+
+class IasRtHelperPoolTest : public ::testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+TEST_F(IasRtHelperPoolTest, initTwiceFails)
+{
+  IasRtHelperPool pool("initTwice", 2);
+  EXPECT_EQ(0u, pool.getNumThreads());
+  ASSERT_EQ(IasRtHelperPool::eIasOk, pool.init());
+  EXPECT_EQ(2u, pool.getNumThreads());
+  EXPECT_EQ(IasRtHelperPool::eIasFailed, pool.init());
+}
+
+TEST_F(IasRtHelperPoolTest, executeWithoutInit)
+{
+  // Without helper threads all jobs are executed by the calling thread.
+  IasRtHelperPool pool("noInit", 3);
+  const std::thread::id callerId = std::this_thread::get_id();
+  std::vector<uint32_t> numCalls(5, 0);
+  bool onlyCaller = true;
+  IasRtHelperPool::IasJobFunction job = [&](uint32_t index)
+  {
+    numCalls[index]++;
+    onlyCaller = onlyCaller && (std::this_thread::get_id() == callerId);
+  };
+  pool.execute(static_cast<uint32_t>(numCalls.size()), job);
+  EXPECT_TRUE(onlyCaller);
+  for (auto calls : numCalls)
+  {
+    EXPECT_EQ(1u, calls);
+  }
+}
+
+TEST_F(IasRtHelperPoolTest, executeEachJobOnce)
+{
+  const uint32_t cNumThreads = 3;
+  const uint32_t cMaxNumJobs = 9;
+  IasRtHelperPool pool("eachJobOnce", cNumThreads);
+  ASSERT_EQ(IasRtHelperPool::eIasOk, pool.init());
+
+  std::vector<std::atomic<uint32_t>> numCalls(cMaxNumJobs);
+  // Each job writes its own slot without synchronization, execute() has to make the writes visible.
+  std::vector<uint32_t> results(cMaxNumJobs, 0);
+  IasRtHelperPool::IasJobFunction job = [&](uint32_t index)
+  {
+    numCalls[index].fetch_add(1);
+    results[index] += index + 1;
+  };
+
+  const uint32_t cNumPeriods = 1000;
+  for (uint32_t period = 0; period < cNumPeriods; period++)
+  {
+    // Less, as many and more jobs than threads, including no job at all.
+    const uint32_t numJobs = period % (cMaxNumJobs + 1);
+    for (auto &calls : numCalls)
+    {
+      calls.store(0);
+    }
+    pool.execute(numJobs, job);
+    for (uint32_t index = 0; index < cMaxNumJobs; index++)
+    {
+      ASSERT_EQ(index < numJobs ? 1u : 0u, numCalls[index].load()) << "period " << period << ", job " << index;
+    }
+  }
+
+  for (uint32_t index = 0; index < cMaxNumJobs; index++)
+  {
+    // Job index is executed in all periods with more than index jobs.
+    uint32_t numExecutions = 0;
+    for (uint32_t period = 0; period < cNumPeriods; period++)
+    {
+      numExecutions += (index < period % (cMaxNumJobs + 1)) ? 1 : 0;
+    }
+    EXPECT_EQ(numExecutions * (index + 1), results[index]);
+  }
+}
+
+TEST_F(IasRtHelperPoolTest, executeOnHelperThreads)
+{
+  const uint32_t cNumThreads = 2;
+  IasRtHelperPool pool("helperThreads", cNumThreads);
+  ASSERT_EQ(IasRtHelperPool::eIasOk, pool.init());
+
+  // Each job waits until all jobs have been started, which is only possible if they run concurrently.
+  const uint32_t cNumJobs = cNumThreads + 1;
+  std::atomic<uint32_t> numStarted(0);
+  std::vector<std::thread::id> threadIds(cNumJobs);
+  IasRtHelperPool::IasJobFunction job = [&](uint32_t index)
+  {
+    threadIds[index] = std::this_thread::get_id();
+    numStarted.fetch_add(1);
+    while (numStarted.load() < cNumJobs)
+    {
+      std::this_thread::yield();
+    }
+  };
+  pool.execute(cNumJobs, job);
+
+  std::set<std::thread::id> uniqueIds(threadIds.begin(), threadIds.end());
+  EXPECT_EQ(cNumJobs, uniqueIds.size());
+  EXPECT_EQ(1u, uniqueIds.count(std::this_thread::get_id()));
+}
+
+} // namespace IasAudio
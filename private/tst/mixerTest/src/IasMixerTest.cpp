@@ -9,8 +9,11 @@
  *  Created on: August 2016
  */
 
+#include <cmath>
 #include <cstdio>
 #include <iostream>
+#include <set>
+#include <vector>
 #include <gtest/gtest.h>
 #include "audio/smartx/rtprocessingfwx/IasAudioStream.hpp"
 #include "mixer/IasMixerCore.hpp"
@@ -20,6 +23,8 @@
 #include "audio/smartx/IasProperties.hpp"
 #include "audio/smartx/rtprocessingfwx/IasIModuleId.hpp"
 #include "rtprocessingfwx/IasAudioChain.hpp"
+#include "rtprocessingfwx/IasAudioChannelBundle.hpp"
+#include "rtprocessingfwx/IasBundleAssignment.hpp"
 #include "audio/smartx/rtprocessingfwx/IasProcessingTypes.hpp"
 #include "rtprocessingfwx/IasCmdDispatcher.hpp"
 #include "rtprocessingfwx/IasPluginEngine.hpp"
@@ -424,4 +429,266 @@ TEST_F(IasMixerTest, mixerCmdInterfaceParseMessage)
 }
 
 
+TEST_F(IasMixerTest, sparseTilesMatchDenseProcessing)
+{
+  // A second mixer processes the same input streams with all gain tiles, the default mixer skips the zero tiles.
+  IasAudioStream *denseOutStream6 = mAudioChain->createOutputAudioStream("Output6Dense", 5, 6, false);
+  ASSERT_TRUE(nullptr != denseOutStream6);
+
+  IasIGenericAudioCompConfig *denseConfig = nullptr;
+  ASSERT_EQ(eIasAudioProcOK, mPluginEngine->createModuleConfig(&denseConfig));
+  ASSERT_TRUE(nullptr != denseConfig);
+  denseConfig->addStreamToProcess(mInStream0, "Input0");
+  denseConfig->addStreamToProcess(mInStream6, "Input6");
+  denseConfig->addStreamToProcess(denseOutStream6, "Output6");
+  IasProperties denseProperties;
+  denseProperties.set<int32_t>("skipZeroGainTiles", 0);
+  denseConfig->setProperties(denseProperties);
+  IasGenericAudioComp *denseMixer = nullptr;
+  ASSERT_EQ(eIasAudioProcOK, mPluginEngine->createModule(denseConfig, "ias.mixer", "MyDenseMixer", &denseMixer));
+  ASSERT_TRUE(nullptr != denseMixer);
+
+  mMixerConfig->addStreamMapping(mInStream0, "Input0", mOutStream6, "Output6");
+  mMixerConfig->addStreamMapping(mInStream6, "Input6", mOutStream6, "Output6");
+  denseConfig->addStreamMapping(mInStream0, "Input0", denseOutStream6, "Output6");
+  denseConfig->addStreamMapping(mInStream6, "Input6", denseOutStream6, "Output6");
+
+  auto *sparseCore = mMixer->getCore();
+  auto *denseCore = denseMixer->getCore();
+  ASSERT_TRUE(nullptr != sparseCore);
+  ASSERT_TRUE(nullptr != denseCore);
+  ASSERT_EQ(eIasAudioProcOK, sparseCore->init());
+  ASSERT_EQ(eIasAudioProcOK, denseCore->init());
+  IasIModuleId *cmdInterfaces[] = { mMixer->getCmdInterface(), denseMixer->getCmdInterface() };
+
+  auto setFader = [&](const char *pin, int32_t fader)
+  {
+    for (auto *cmdInterface : cmdInterfaces)
+    {
+      IasProperties cmdProperties;
+      IasProperties returnProperties;
+      cmdProperties.set<std::string>("pin", pin);
+      cmdProperties.set<int32_t>("cmd", IasMixer::IasMixerCmdIds::eIasSetFader);
+      cmdProperties.set<int32_t>("fader", fader);
+      EXPECT_EQ(IasIModuleId::eIasOk, cmdInterface->processCmd(cmdProperties, returnProperties));
+    }
+  };
+
+  std::vector<float> inputData(6 * cIasFrameLength);
+  IasAudioFrame inputFrame(6);
+  for (uint32_t channel = 0; channel < 6; channel++)
+  {
+    inputFrame[channel] = &inputData[channel * cIasFrameLength];
+  }
+  const IasAudioFrame stereoFrame(inputFrame.begin(), inputFrame.begin() + 2);
+  std::vector<float> sparseOutput(6 * cIasFrameLength);
+  std::vector<float> denseOutput(6 * cIasFrameLength);
+
+  // Each section is longer than the 100 ms ramps of the mixer, so every ramp settles before the next one starts.
+  const uint32_t cSectionLength = 100;
+  const uint32_t cNumSections = 5;
+  float maxDifference = 0.0f;
+  float rearEnergyFront = 0.0f;
+  float rearEnergyRear = 0.0f;
+  for (uint32_t frame = 0; frame < cNumSections * cSectionLength; frame++)
+  {
+    switch (frame)
+    {
+      case 0 * cSectionLength:
+        // Fully to the front, the rear gains ramp to zero and the rear tiles become inactive.
+        setFader("Input0", 10000);
+        setFader("Input6", 10000);
+        break;
+      case 1 * cSectionLength:
+        // Fully to the rear, the rear gains ramp up from zero and the front gains ramp to zero.
+        setFader("Input0", -10000);
+        setFader("Input6", -10000);
+        break;
+      case 2 * cSectionLength:
+        // Only the stereo input back to the front.
+        setFader("Input0", 10000);
+        break;
+      case 3 * cSectionLength:
+        setFader("Input0", 0);
+        setFader("Input6", 0);
+        break;
+    }
+
+    for (uint32_t channel = 0; channel < 6; channel++)
+    {
+      for (uint32_t sample = 0; sample < cIasFrameLength; sample++)
+      {
+        const uint32_t time = frame * cIasFrameLength + sample;
+        inputFrame[channel][sample] = 0.5f * std::sin(0.01f * static_cast<float>((channel + 1) * time));
+      }
+    }
+    ASSERT_EQ(eIasAudioProcOK, mInStream0->asBundledStream()->writeFromNonInterleaved(stereoFrame));
+    ASSERT_EQ(eIasAudioProcOK, mInStream6->asBundledStream()->writeFromNonInterleaved(inputFrame));
+
+    mAudioChain->clearOutputBundleBuffers();
+    sparseCore->process();
+    denseCore->process();
+    ASSERT_EQ(eIasAudioProcOK, mOutStream6->asBundledStream()->read(sparseOutput.data()));
+    ASSERT_EQ(eIasAudioProcOK, denseOutStream6->asBundledStream()->read(denseOutput.data()));
+
+    for (uint32_t index = 0; index < sparseOutput.size(); index++)
+    {
+      maxDifference = std::max(maxDifference, std::fabs(sparseOutput[index] - denseOutput[index]));
+    }
+    // Rear left and rear right, measured in the settled second half of the sections 0 and 1.
+    float rearEnergy = 0.0f;
+    for (uint32_t sample = 0; sample < cIasFrameLength; sample++)
+    {
+      rearEnergy += sparseOutput[6 * sample + 4] * sparseOutput[6 * sample + 4] +
+                    sparseOutput[6 * sample + 5] * sparseOutput[6 * sample + 5];
+    }
+    if (frame >= cSectionLength / 2 && frame < cSectionLength)
+    {
+      rearEnergyFront += rearEnergy;
+    }
+    else if (frame >= cSectionLength + cSectionLength / 2 && frame < 2 * cSectionLength)
+    {
+      rearEnergyRear += rearEnergy;
+    }
+  }
+
+  EXPECT_EQ(0.0f, maxDifference);
+  EXPECT_EQ(0.0f, rearEnergyFront);
+  EXPECT_GT(rearEnergyRear, 0.0f);
+
+  mPluginEngine->destroyModule(denseMixer);
+}
+
+
+TEST_F(IasMixerTest, parallelMatchesSerialProcessing)
+{
+  // Stereo output streams share channel bundles, so the parallel mixer has to group their elementary mixers.
+  const uint32_t cNumOutputs = 5;
+  IasIGenericAudioCompConfig *parallelConfig = nullptr;
+  ASSERT_EQ(eIasAudioProcOK, mPluginEngine->createModuleConfig(&parallelConfig));
+  ASSERT_TRUE(nullptr != parallelConfig);
+  parallelConfig->addStreamToProcess(mInStream0, "Input0");
+  parallelConfig->addStreamToProcess(mInStream1, "Input1");
+  std::vector<IasAudioStream*> serialOutputs;
+  std::vector<IasAudioStream*> parallelOutputs;
+  for (uint32_t outputIdx = 0; outputIdx < cNumOutputs; outputIdx++)
+  {
+    const std::string pinName = "Stereo" + std::to_string(outputIdx);
+    serialOutputs.push_back(mAudioChain->createOutputAudioStream("Serial" + pinName, 10 + outputIdx, 2, false));
+    parallelOutputs.push_back(mAudioChain->createOutputAudioStream("Parallel" + pinName, 20 + outputIdx, 2, false));
+    ASSERT_TRUE(nullptr != serialOutputs.back());
+    ASSERT_TRUE(nullptr != parallelOutputs.back());
+    mMixerConfig->addStreamToProcess(serialOutputs.back(), pinName);
+    parallelConfig->addStreamToProcess(parallelOutputs.back(), pinName);
+  }
+  IasProperties parallelProperties;
+  parallelProperties.set<int32_t>("numHelperThreads", 3);
+  parallelConfig->setProperties(parallelProperties);
+  IasGenericAudioComp *parallelMixer = nullptr;
+  ASSERT_EQ(eIasAudioProcOK, mPluginEngine->createModule(parallelConfig, "ias.mixer", "MyParallelMixer", &parallelMixer));
+  ASSERT_TRUE(nullptr != parallelMixer);
+
+  std::set<IasAudioChannelBundle*> parallelBundles;
+  uint32_t numParallelAssignments = 0;
+  for (uint32_t outputIdx = 0; outputIdx < cNumOutputs; outputIdx++)
+  {
+    const std::string pinName = "Stereo" + std::to_string(outputIdx);
+    // Both inputs to the even outputs, only one input to the odd outputs.
+    mMixerConfig->addStreamMapping(mInStream0, "Input0", serialOutputs[outputIdx], pinName);
+    parallelConfig->addStreamMapping(mInStream0, "Input0", parallelOutputs[outputIdx], pinName);
+    if (outputIdx % 2 == 0)
+    {
+      mMixerConfig->addStreamMapping(mInStream1, "Input1", serialOutputs[outputIdx], pinName);
+      parallelConfig->addStreamMapping(mInStream1, "Input1", parallelOutputs[outputIdx], pinName);
+    }
+    for (auto &assignment : parallelOutputs[outputIdx]->asBundledStream()->getBundleAssignments())
+    {
+      parallelBundles.insert(assignment.getBundle());
+      numParallelAssignments++;
+    }
+  }
+  ASSERT_LT(parallelBundles.size(), numParallelAssignments) << "the test needs output streams that share a bundle";
+
+  auto *serialCore = mMixer->getCore();
+  auto *parallelCore = parallelMixer->getCore();
+  ASSERT_TRUE(nullptr != serialCore);
+  ASSERT_TRUE(nullptr != parallelCore);
+  ASSERT_EQ(eIasAudioProcOK, serialCore->init());
+  ASSERT_EQ(eIasAudioProcOK, parallelCore->init());
+  IasIModuleId *cmdInterfaces[] = { mMixer->getCmdInterface(), parallelMixer->getCmdInterface() };
+
+  auto setBalance = [&](const char *pin, int32_t balance)
+  {
+    for (auto *cmdInterface : cmdInterfaces)
+    {
+      IasProperties cmdProperties;
+      IasProperties returnProperties;
+      cmdProperties.set<std::string>("pin", pin);
+      cmdProperties.set<int32_t>("cmd", IasMixer::IasMixerCmdIds::eIasSetBalance);
+      cmdProperties.set<int32_t>("balance", balance);
+      EXPECT_EQ(IasIModuleId::eIasOk, cmdInterface->processCmd(cmdProperties, returnProperties));
+    }
+  };
+
+  std::vector<float> inputData(2 * 2 * cIasFrameLength);
+  IasAudioFrame inputFrames[2] = { IasAudioFrame(2), IasAudioFrame(2) };
+  for (uint32_t channel = 0; channel < 4; channel++)
+  {
+    inputFrames[channel / 2][channel % 2] = &inputData[channel * cIasFrameLength];
+  }
+  std::vector<float> serialOutput(2 * cIasFrameLength);
+  std::vector<float> parallelOutput(2 * cIasFrameLength);
+
+  const uint32_t cNumFrames = 300;
+  float maxDifference = 0.0f;
+  float outputEnergy = 0.0f;
+  for (uint32_t frame = 0; frame < cNumFrames; frame++)
+  {
+    switch (frame)
+    {
+      case 50:
+        setBalance("Input0", 10000);
+        break;
+      case 150:
+        setBalance("Input0", -60);
+        setBalance("Input1", 10000);
+        break;
+      case 250:
+        setBalance("Input1", 0);
+        break;
+    }
+
+    for (uint32_t channel = 0; channel < 4; channel++)
+    {
+      for (uint32_t sample = 0; sample < cIasFrameLength; sample++)
+      {
+        const uint32_t time = frame * cIasFrameLength + sample;
+        inputData[channel * cIasFrameLength + sample] = 0.25f * std::sin(0.02f * static_cast<float>((channel + 1) * time));
+      }
+    }
+    ASSERT_EQ(eIasAudioProcOK, mInStream0->asBundledStream()->writeFromNonInterleaved(inputFrames[0]));
+    ASSERT_EQ(eIasAudioProcOK, mInStream1->asBundledStream()->writeFromNonInterleaved(inputFrames[1]));
+
+    mAudioChain->clearOutputBundleBuffers();
+    serialCore->process();
+    parallelCore->process();
+    for (uint32_t outputIdx = 0; outputIdx < cNumOutputs; outputIdx++)
+    {
+      ASSERT_EQ(eIasAudioProcOK, serialOutputs[outputIdx]->asBundledStream()->read(serialOutput.data()));
+      ASSERT_EQ(eIasAudioProcOK, parallelOutputs[outputIdx]->asBundledStream()->read(parallelOutput.data()));
+      for (uint32_t index = 0; index < serialOutput.size(); index++)
+      {
+        maxDifference = std::max(maxDifference, std::fabs(serialOutput[index] - parallelOutput[index]));
+        outputEnergy += serialOutput[index] * serialOutput[index];
+      }
+    }
+  }
+
+  EXPECT_EQ(0.0f, maxDifference);
+  EXPECT_GT(outputEnergy, 0.0f);
+
+  mPluginEngine->destroyModule(parallelMixer);
+}
+
+
 } // namespace IasAudio
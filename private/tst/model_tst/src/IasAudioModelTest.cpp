@@ -658,6 +658,7 @@ TEST_F(IasAudioModelTest, runnerThreadCoverage)
   ASSERT_TRUE(myRunner != nullptr);
   uint32_t multiple = myRunner->getPeriodSizeMultiple();
   ASSERT_EQ(4u, multiple);
+  ASSERT_EQ("TheParentZone.psm4", myRunner->getName());
   ASSERT_STREQ("IasRunnerThread::eIasOk", toString(IasRunnerThread::eIasOk).c_str());
   ASSERT_STREQ("IasRunnerThread::eIasInvalidParam", toString(IasRunnerThread::eIasInvalidParam).c_str());
   ASSERT_STREQ("IasRunnerThread::eIasInitFailed", toString(IasRunnerThread::eIasInitFailed).c_str());
@@ -16,9 +16,16 @@
 
 #include "audio/smartx/IasSmartX.hpp"
 #include "audio/smartx/IasISetup.hpp"
+#include "audio/smartx/IasIProcessing.hpp"
+#include "audio/smartx/IasProperties.hpp"
+#include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBuffer.hpp"
+#include "avbaudiomodules/internal/audio/common/audiobuffer/IasAudioRingBufferFactory.hpp"
+#include "avbaudiomodules/internal/audio/common/helper/IasCopyAudioAreaBuffers.hpp"
 
 #include "model/IasPipeline.hpp"
 #include "model/IasAudioPin.hpp"
+#include "model/IasAudioPort.hpp"
+#include "smartx/IasIStreamTap.hpp"
 #include "IasPipelineTest.hpp"
 
 
@@ -39,6 +46,29 @@ void IasPipelineTest::TearDown()
 }
 
 
+/**
+ * @brief Stream tap that keeps the first channel of the last period
+ */
+class IasCaptureTap : public IasIStreamTap
+{
+  public:
+    virtual void process(const IasAudioArea*, IasAudioCommonDataFormat, uint32_t, uint32_t)
+    {
+    }
+
+    virtual void process(const IasAudioFrame &audioFrame, uint32_t stride, uint32_t numFrames)
+    {
+      mSamples.resize(numFrames);
+      for (uint32_t frame = 0; frame < numFrames; ++frame)
+      {
+        mSamples[frame] = audioFrame[0][frame * stride];
+      }
+    }
+
+    std::vector<float> mSamples;
+};
+
+
 TEST_F(IasPipelineTest, convertResultToString)
 {
   std::cout << "Possible enum values of IasPipeline::IasResult:" << std::endl;
@@ -411,4 +441,494 @@ TEST_F(IasPipelineTest, Pipeline_Setup)
 }
 
 
+
+TEST_F(IasPipelineTest, Pipeline_RuntimeRelinking)
+{
+  /*
+   * This unit test inserts module 2 into a running pipeline and bypasses it again:
+   *
+   *             +----------+      +----------+
+   *            0| module 0 |0    1| module 1 |1
+   *      +----->O          O----->O          O-----+
+   *      |      +----------+      +----------+     |
+   *      |                 +---+                   |
+   *      +-----------------| T |<------------------+
+   *                        +---+
+   *
+   *     module 2 (pin 2) is not linked initially, afterwards it is inserted between module 0 and module 1.
+   */
+  IasSmartX* smartx = IasSmartX::create();
+  ASSERT_TRUE(smartx != nullptr);
+  IasISetup* setup = smartx->setup();
+  ASSERT_TRUE(setup != nullptr);
+
+  IasISetup::IasResult result;
+  IasPipelineParams pipelineParams =
+  {
+    /*.name =*/ "myRelinkablePipeline",
+    /*.samplerate =*/ 48000,
+    /*.periodSize =*/ 192
+  };
+  IasPipelinePtr pipeline = nullptr;
+  result = setup->createPipeline(pipelineParams, &pipeline);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  ASSERT_TRUE(pipeline != nullptr);
+
+  std::vector<IasProcessingModulePtr> processingModules;
+  std::vector<IasAudioPinPtr> modulePins;
+  for (uint32_t cntModules = 0; cntModules < 3; cntModules++)
+  {
+    IasProcessingModuleParams processingModuleParams =
+    {
+      /*.typeName     =*/ "simplevolume",
+      /*.instanceName =*/ "relink module " + std::to_string(cntModules)
+    };
+    IasProcessingModulePtr processingModule = nullptr;
+    result = setup->createProcessingModule(processingModuleParams, &processingModule);
+    ASSERT_EQ(IasISetup::eIasOk, result);
+    result = setup->addProcessingModule(pipeline, processingModule);
+    ASSERT_EQ(IasISetup::eIasOk, result);
+    processingModules.push_back(processingModule);
+
+    IasAudioPinParams pinParams =
+    {
+      /*.name =*/ "relink pin " + std::to_string(cntModules),
+      /*.numChannels =*/ 2,
+    };
+    IasAudioPinPtr inputOutputPin = nullptr;
+    result = setup->createAudioPin(pinParams, &inputOutputPin);
+    ASSERT_EQ(IasISetup::eIasOk, result);
+    result = setup->addAudioInOutPin(processingModule, inputOutputPin);
+    ASSERT_EQ(IasISetup::eIasOk, result);
+    modulePins.push_back(inputOutputPin);
+  }
+
+  result = setup->link(modulePins[0], modulePins[1], eIasAudioPinLinkTypeImmediate);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  result = setup->link(modulePins[1], modulePins[0], eIasAudioPinLinkTypeDelayed);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+
+  // Runtime relinking has to be enabled before the audio chain is initialized.
+  result = setup->setRuntimeRelinking(nullptr, true);
+  ASSERT_EQ(IasISetup::eIasFailed, result);
+  result = setup->commitPinLinks(pipeline, 0);
+  ASSERT_EQ(IasISetup::eIasFailed, result);
+  result = setup->setRuntimeRelinking(pipeline, true);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  ASSERT_TRUE(pipeline->isRuntimeRelinkingEnabled());
+  result = setup->commitPinLinks(pipeline, 0);
+  ASSERT_EQ(IasISetup::eIasFailed, result);
+  result = setup->initPipelineAudioChain(pipeline);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  result = setup->setRuntimeRelinking(pipeline, false);
+  ASSERT_EQ(IasISetup::eIasFailed, result);
+
+  // The audio component of module 2 has been created, although the module is not linked yet.
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->enableModuleTiming(true));
+  auto getModuleTime = [&pipeline](const std::string &instanceName) {
+    IasPipeline::IasModuleTimeVector moduleTimes;
+    pipeline->getModuleTimes(&moduleTimes);
+    EXPECT_EQ(3u, moduleTimes.size());
+    for (const auto &entry : moduleTimes)
+    {
+      if (entry.first == instanceName)
+      {
+        return entry.second;
+      }
+    }
+    return static_cast<uint64_t>(0);
+  };
+
+  pipeline->process();
+  EXPECT_LT(0u, getModuleTime("relink module 0"));
+  EXPECT_LT(0u, getModuleTime("relink module 1"));
+  EXPECT_EQ(0u, getModuleTime("relink module 2"));
+
+  // Insert module 2 between module 0 and module 1. Module 2 is processed after the fade-out period.
+  setup->unlink(modulePins[0], modulePins[1]);
+  result = setup->link(modulePins[0], modulePins[2], eIasAudioPinLinkTypeImmediate);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  result = setup->link(modulePins[2], modulePins[1], eIasAudioPinLinkTypeImmediate);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  result = setup->commitPinLinks(pipeline, 64);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  pipeline->process();
+  EXPECT_EQ(0u, getModuleTime("relink module 2"));
+  pipeline->process();
+  const uint64_t timeModule2 = getModuleTime("relink module 2");
+  EXPECT_LT(0u, timeModule2);
+
+  // Bypass module 2 again, without fading.
+  setup->unlink(modulePins[0], modulePins[2]);
+  setup->unlink(modulePins[2], modulePins[1]);
+  result = setup->link(modulePins[0], modulePins[1], eIasAudioPinLinkTypeImmediate);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  result = setup->commitPinLinks(pipeline, 0);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  pipeline->process();
+  pipeline->process();
+  EXPECT_EQ(timeModule2, getModuleTime("relink module 2"));
+
+  // Pins that are not linked to each other cannot be unlinked, the link of module 0 to module 1 has to stay.
+  ASSERT_EQ(IasPipeline::eIasFailed, pipeline->unlink(modulePins[2], modulePins[1]));
+  setup->unlink(modulePins[0], modulePins[2]);
+  result = setup->commitPinLinks(pipeline, 0);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+  const uint64_t timeModule1 = getModuleTime("relink module 1");
+  pipeline->process();
+  EXPECT_LT(timeModule1, getModuleTime("relink module 1"));
+
+  for (uint32_t cntModules = 0; cntModules < processingModules.size(); cntModules++)
+  {
+    setup->deleteAudioInOutPin(processingModules[cntModules], modulePins[cntModules]);
+    setup->destroyAudioPin(&modulePins[cntModules]);
+    setup->deleteProcessingModule(pipeline, processingModules[cntModules]);
+    setup->destroyProcessingModule(&processingModules[cntModules]);
+  }
+  setup->destroyPipeline(&pipeline);
+  ASSERT_TRUE(pipeline == nullptr);
+
+  /*
+   * Insert a module into a path that carries a constant signal, while a second path keeps running:
+   *
+   *             +----------+                     +----------+
+   *   in A    0 |  0.50    |0        out A       |  0.25    |
+   *     O------>O          O-------->O           O          O     (inserted between volume A and out A)
+   *             +----------+                     +----------+
+   *             +----------+
+   *   in B    0 |  1.00    |0        out B
+   *     O------>O          O-------->O
+   *             +----------+
+   */
+  const uint32_t periodSize = 192;
+  const uint32_t fadeLength = 64;
+  IasPipelineParams signalPipelineParams =
+  {
+    /*.name =*/ "mySignalPipeline",
+    /*.samplerate =*/ 48000,
+    /*.periodSize =*/ periodSize
+  };
+  result = setup->createPipeline(signalPipelineParams, &pipeline);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+
+  std::vector<IasAudioPinPtr> pipelinePins;
+  for (const std::string &pinName : { "in A", "in B", "out A", "out B" })
+  {
+    IasAudioPinParams pinParams = { pinName, 2 };
+    IasAudioPinPtr pin = nullptr;
+    ASSERT_EQ(IasISetup::eIasOk, setup->createAudioPin(pinParams, &pin));
+    pipelinePins.push_back(pin);
+  }
+  ASSERT_EQ(IasISetup::eIasOk, setup->addAudioInputPin(pipeline, pipelinePins[0]));
+  ASSERT_EQ(IasISetup::eIasOk, setup->addAudioInputPin(pipeline, pipelinePins[1]));
+  ASSERT_EQ(IasISetup::eIasOk, setup->addAudioOutputPin(pipeline, pipelinePins[2]));
+  ASSERT_EQ(IasISetup::eIasOk, setup->addAudioOutputPin(pipeline, pipelinePins[3]));
+
+  processingModules.clear();
+  modulePins.clear();
+  for (const std::string &moduleName : { "volume A", "inserted volume", "volume B" })
+  {
+    IasProcessingModuleParams moduleParams = { "simplevolume", moduleName };
+    IasProcessingModulePtr module = nullptr;
+    ASSERT_EQ(IasISetup::eIasOk, setup->createProcessingModule(moduleParams, &module));
+    ASSERT_EQ(IasISetup::eIasOk, setup->addProcessingModule(pipeline, module));
+    IasAudioPinParams pinParams = { moduleName + " pin", 2 };
+    IasAudioPinPtr pin = nullptr;
+    ASSERT_EQ(IasISetup::eIasOk, setup->createAudioPin(pinParams, &pin));
+    ASSERT_EQ(IasISetup::eIasOk, setup->addAudioInOutPin(module, pin));
+    processingModules.push_back(module);
+    modulePins.push_back(pin);
+  }
+  ASSERT_EQ(IasISetup::eIasOk, setup->link(pipelinePins[0], modulePins[0], eIasAudioPinLinkTypeImmediate));
+  ASSERT_EQ(IasISetup::eIasOk, setup->link(modulePins[0], pipelinePins[2], eIasAudioPinLinkTypeImmediate));
+  ASSERT_EQ(IasISetup::eIasOk, setup->link(pipelinePins[1], modulePins[2], eIasAudioPinLinkTypeImmediate));
+  ASSERT_EQ(IasISetup::eIasOk, setup->link(modulePins[2], pipelinePins[3], eIasAudioPinLinkTypeImmediate));
+  ASSERT_EQ(IasISetup::eIasOk, setup->setRuntimeRelinking(pipeline, true));
+  ASSERT_EQ(IasISetup::eIasOk, setup->initPipelineAudioChain(pipeline));
+
+  IasProperties cmdProperties;
+  IasProperties returnProperties;
+  cmdProperties.set<float>("volume", 0.5f);
+  ASSERT_EQ(IasIProcessing::eIasOk, smartx->processing()->sendCmd("volume A", cmdProperties, returnProperties));
+  cmdProperties.set<float>("volume", 0.25f);
+  ASSERT_EQ(IasIProcessing::eIasOk, smartx->processing()->sendCmd("inserted volume", cmdProperties, returnProperties));
+
+  // Feed the constant values 1.0 into in A and 0.75 into in B, via ports with ring buffers.
+  IasAudioRingBufferFactory *rbFactory = IasAudioRingBufferFactory::getInstance();
+  std::vector<IasAudioRingBuffer*> ringBuffers;
+  std::vector<IasAudioPortPtr> inputPorts;
+  const float inputValues[2] = { 1.0f, 0.75f };
+  for (uint32_t cntPorts = 0; cntPorts < 2; cntPorts++)
+  {
+    IasAudioRingBuffer *ringBuffer = nullptr;
+    ASSERT_EQ(eIasResultOk, rbFactory->createRingBuffer(&ringBuffer, periodSize, 4, 2, eIasFormatFloat32,
+                                                        eIasRingBufferLocalReal, "relinkRingBuffer" + std::to_string(cntPorts)));
+    ringBuffers.push_back(ringBuffer);
+    IasAudioPortParamsPtr portParams = std::make_shared<IasAudioPortParams>();
+    portParams->name = "relink port " + std::to_string(cntPorts);
+    portParams->numChannels = 2;
+    portParams->id = cntPorts + 1;
+    portParams->direction = eIasPortDirectionInput;
+    portParams->index = 0;
+    IasAudioPortPtr inputPort = std::make_shared<IasAudioPort>(portParams);
+    ASSERT_EQ(IasAudioPort::eIasOk, inputPort->setRingBuffer(ringBuffer));
+    ASSERT_EQ(IasPipeline::eIasOk, pipeline->link(inputPort, pipelinePins[cntPorts]));
+    inputPorts.push_back(inputPort);
+
+    std::vector<float> samples(periodSize * 2, inputValues[cntPorts]);
+    IasAudioArea sampleAreas[2];
+    for (uint32_t chan = 0; chan < 2; ++chan)
+    {
+      sampleAreas[chan].start = samples.data();
+      sampleAreas[chan].first = static_cast<uint32_t>(chan * 8 * sizeof(float));
+      sampleAreas[chan].step = static_cast<uint32_t>(2 * 8 * sizeof(float));
+      sampleAreas[chan].index = chan;
+      sampleAreas[chan].maxIndex = 1;
+    }
+    IasAudioArea *ringBufferAreas = nullptr;
+    ASSERT_EQ(eIasRingBuffOk, ringBuffer->getAreas(&ringBufferAreas));
+    copyAudioAreaBuffers(ringBufferAreas, eIasFormatFloat32, 0, 2, 0, periodSize,
+                         sampleAreas, eIasFormatFloat32, 0, 2, 0, periodSize);
+  }
+
+  std::shared_ptr<IasCaptureTap> tapA = std::make_shared<IasCaptureTap>();
+  std::shared_ptr<IasCaptureTap> tapB = std::make_shared<IasCaptureTap>();
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->startStreamProbe(pipelinePins[2], tapA));
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->startStreamProbe(pipelinePins[3], tapB));
+  auto processPeriod = [&]() {
+    uint32_t numFramesRemaining = 0;
+    for (const IasAudioPortPtr &inputPort : inputPorts)
+    {
+      ASSERT_EQ(IasPipeline::eIasOk, pipeline->provideInputData(inputPort, 0, periodSize, periodSize, &numFramesRemaining));
+    }
+    tapA->mSamples.clear();
+    tapB->mSamples.clear();
+    pipeline->process();
+    ASSERT_EQ(periodSize, tapA->mSamples.size());
+    ASSERT_EQ(periodSize, tapB->mSamples.size());
+  };
+
+  processPeriod();
+  for (uint32_t frame = 0; frame < periodSize; frame++)
+  {
+    ASSERT_FLOAT_EQ(0.5f, tapA->mSamples[frame]);
+    ASSERT_FLOAT_EQ(0.75f, tapB->mSamples[frame]);
+  }
+
+  // Insert the module between volume A and out A. A second commit before the next period replaces the
+  // first program in the mailbox, it must not lose the fade of the pins changed by the first commit.
+  ASSERT_EQ(IasPipeline::eIasFailed, pipeline->unlink(modulePins[1], pipelinePins[2]));
+  setup->unlink(modulePins[0], pipelinePins[2]);
+  ASSERT_EQ(IasISetup::eIasOk, setup->link(modulePins[0], modulePins[1], eIasAudioPinLinkTypeImmediate));
+  ASSERT_EQ(IasISetup::eIasOk, setup->link(modulePins[1], pipelinePins[2], eIasAudioPinLinkTypeImmediate));
+  ASSERT_EQ(IasISetup::eIasOk, setup->commitPinLinks(pipeline, fadeLength));
+  ASSERT_EQ(IasISetup::eIasOk, setup->commitPinLinks(pipeline, fadeLength));
+
+  // Out A is faded out at the end of the period, out B is not affected.
+  const float rampStep = 1.0f / static_cast<float>(fadeLength);
+  processPeriod();
+  for (uint32_t frame = 0; frame < periodSize; frame++)
+  {
+    float expected = 0.5f;
+    if (frame >= periodSize - fadeLength)
+    {
+      const float ramp = static_cast<float>(frame - (periodSize - fadeLength)) * rampStep;
+      expected = 0.5f * (1.0f - rampStep - ramp);
+    }
+    ASSERT_NEAR(expected, tapA->mSamples[frame], 1e-6f) << "frame " << frame;
+    ASSERT_FLOAT_EQ(0.75f, tapB->mSamples[frame]);
+  }
+
+  // The inserted module is faded in once at the start of the period, although two links changed.
+  processPeriod();
+  for (uint32_t frame = 0; frame < periodSize; frame++)
+  {
+    const float expected = (frame < fadeLength) ? 0.5f * (static_cast<float>(frame) * rampStep) * 0.25f : 0.125f;
+    ASSERT_NEAR(expected, tapA->mSamples[frame], 1e-6f) << "frame " << frame;
+    ASSERT_FLOAT_EQ(0.75f, tapB->mSamples[frame]);
+  }
+
+  processPeriod();
+  for (uint32_t frame = 0; frame < periodSize; frame++)
+  {
+    ASSERT_FLOAT_EQ(0.125f, tapA->mSamples[frame]);
+    ASSERT_FLOAT_EQ(0.75f, tapB->mSamples[frame]);
+  }
+
+  pipeline->stopStreamProbe(pipelinePins[2]);
+  pipeline->stopStreamProbe(pipelinePins[3]);
+  pipeline->unlink(inputPorts[0], pipelinePins[0]);
+  pipeline->unlink(inputPorts[1], pipelinePins[1]);
+  setup->unlink(pipelinePins[0], modulePins[0]);
+  setup->unlink(modulePins[0], modulePins[1]);
+  setup->unlink(modulePins[1], pipelinePins[2]);
+  setup->unlink(pipelinePins[1], modulePins[2]);
+  setup->unlink(modulePins[2], pipelinePins[3]);
+  for (uint32_t cntModules = 0; cntModules < processingModules.size(); cntModules++)
+  {
+    setup->deleteAudioInOutPin(processingModules[cntModules], modulePins[cntModules]);
+    setup->destroyAudioPin(&modulePins[cntModules]);
+    setup->deleteProcessingModule(pipeline, processingModules[cntModules]);
+    setup->destroyProcessingModule(&processingModules[cntModules]);
+  }
+  setup->deleteAudioInputPin(pipeline, pipelinePins[0]);
+  setup->deleteAudioInputPin(pipeline, pipelinePins[1]);
+  setup->deleteAudioOutputPin(pipeline, pipelinePins[2]);
+  setup->deleteAudioOutputPin(pipeline, pipelinePins[3]);
+  for (IasAudioPinPtr &pin : pipelinePins)
+  {
+    setup->destroyAudioPin(&pin);
+  }
+  setup->destroyPipeline(&pipeline);
+  for (IasAudioRingBuffer *ringBuffer : ringBuffers)
+  {
+    rbFactory->destroyRingBuffer(ringBuffer);
+  }
+  IasSmartX::destroy(smartx);
+}
+
+
+TEST_F(IasPipelineTest, Pipeline_StreamTapsAroundModule)
+{
+  /*
+   * This unit test taps the pipeline input pin and the in-place pin of a volume module, which share one audio stream:
+   *
+   *             +----------+
+   *    in      0|  volume  |0      out
+   *     O------>O          O------>O
+   *             +----------+
+   *
+   * The tap of the input pin has to see the data before the module, the tap of the module pin after it.
+   */
+  IasSmartX* smartx = IasSmartX::create();
+  ASSERT_TRUE(smartx != nullptr);
+  IasISetup* setup = smartx->setup();
+  ASSERT_TRUE(setup != nullptr);
+
+  const uint32_t periodSize = 192;
+  IasISetup::IasResult result;
+  IasPipelineParams pipelineParams =
+  {
+    /*.name =*/ "myTappedPipeline",
+    /*.samplerate =*/ 48000,
+    /*.periodSize =*/ periodSize
+  };
+  IasPipelinePtr pipeline = nullptr;
+  result = setup->createPipeline(pipelineParams, &pipeline);
+  ASSERT_EQ(IasISetup::eIasOk, result);
+
+  IasAudioPinParams inputPinParams = { "tap input pin", 2 };
+  IasAudioPinParams modulePinParams = { "tap module pin", 2 };
+  IasAudioPinParams outputPinParams = { "tap output pin", 2 };
+  IasAudioPinPtr inputPin = nullptr;
+  IasAudioPinPtr modulePin = nullptr;
+  IasAudioPinPtr outputPin = nullptr;
+  ASSERT_EQ(IasISetup::eIasOk, setup->createAudioPin(inputPinParams, &inputPin));
+  ASSERT_EQ(IasISetup::eIasOk, setup->createAudioPin(modulePinParams, &modulePin));
+  ASSERT_EQ(IasISetup::eIasOk, setup->createAudioPin(outputPinParams, &outputPin));
+  ASSERT_EQ(IasISetup::eIasOk, setup->addAudioInputPin(pipeline, inputPin));
+  ASSERT_EQ(IasISetup::eIasOk, setup->addAudioOutputPin(pipeline, outputPin));
+
+  IasProcessingModuleParams moduleParams =
+  {
+    /*.typeName     =*/ "simplevolume",
+    /*.instanceName =*/ "tapped volume"
+  };
+  IasProcessingModulePtr module = nullptr;
+  ASSERT_EQ(IasISetup::eIasOk, setup->createProcessingModule(moduleParams, &module));
+  ASSERT_EQ(IasISetup::eIasOk, setup->addProcessingModule(pipeline, module));
+  ASSERT_EQ(IasISetup::eIasOk, setup->addAudioInOutPin(module, modulePin));
+  ASSERT_EQ(IasISetup::eIasOk, setup->link(inputPin, modulePin, eIasAudioPinLinkTypeImmediate));
+  ASSERT_EQ(IasISetup::eIasOk, setup->link(modulePin, outputPin, eIasAudioPinLinkTypeImmediate));
+  ASSERT_EQ(IasISetup::eIasOk, setup->initPipelineAudioChain(pipeline));
+
+  IasProperties cmdProperties;
+  cmdProperties.set<float>("volume", 0.5f);
+  IasProperties returnProperties;
+  ASSERT_EQ(IasIProcessing::eIasOk, smartx->processing()->sendCmd("tapped volume", cmdProperties, returnProperties));
+
+  // Feed a ramp into the pipeline input pin via a port with a ring buffer.
+  IasAudioRingBufferFactory *rbFactory = IasAudioRingBufferFactory::getInstance();
+  IasAudioRingBuffer *ringBuffer = nullptr;
+  ASSERT_EQ(eIasResultOk, rbFactory->createRingBuffer(&ringBuffer, periodSize, 4, 2, eIasFormatFloat32,
+                                                      eIasRingBufferLocalReal, "tapInputRingBuffer"));
+  IasAudioPortParamsPtr portParams = std::make_shared<IasAudioPortParams>();
+  portParams->name = "tap input port";
+  portParams->numChannels = 2;
+  portParams->id = 1;
+  portParams->direction = eIasPortDirectionInput;
+  portParams->index = 0;
+  IasAudioPortPtr inputPort = std::make_shared<IasAudioPort>(portParams);
+  ASSERT_EQ(IasAudioPort::eIasOk, inputPort->setRingBuffer(ringBuffer));
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->link(inputPort, inputPin));
+
+  std::vector<float> ramp(periodSize * 2);
+  for (uint32_t frame = 0; frame < periodSize; ++frame)
+  {
+    ramp[2 * frame] = static_cast<float>(frame + 1) / static_cast<float>(periodSize);
+    ramp[2 * frame + 1] = -ramp[2 * frame];
+  }
+  IasAudioArea rampAreas[2];
+  for (uint32_t chan = 0; chan < 2; ++chan)
+  {
+    rampAreas[chan].start = ramp.data();
+    rampAreas[chan].first = static_cast<uint32_t>(chan * 8 * sizeof(float));
+    rampAreas[chan].step = static_cast<uint32_t>(2 * 8 * sizeof(float));
+    rampAreas[chan].index = chan;
+    rampAreas[chan].maxIndex = 1;
+  }
+  IasAudioArea *ringBufferAreas = nullptr;
+  ASSERT_EQ(eIasRingBuffOk, ringBuffer->getAreas(&ringBufferAreas));
+  copyAudioAreaBuffers(ringBufferAreas, eIasFormatFloat32, 0, 2, 0, periodSize,
+                       rampAreas, eIasFormatFloat32, 0, 2, 0, periodSize);
+
+  std::shared_ptr<IasCaptureTap> tapBefore = std::make_shared<IasCaptureTap>();
+  std::shared_ptr<IasCaptureTap> tapAfter = std::make_shared<IasCaptureTap>();
+  std::shared_ptr<IasCaptureTap> tapOutput = std::make_shared<IasCaptureTap>();
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->startStreamProbe(inputPin, tapBefore));
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->startStreamProbe(modulePin, tapAfter));
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->startStreamProbe(outputPin, tapOutput));
+
+  uint32_t numFramesRemaining = 0;
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->provideInputData(inputPort, 0, periodSize, periodSize, &numFramesRemaining));
+  ASSERT_EQ(0u, numFramesRemaining);
+  pipeline->process();
+
+  ASSERT_EQ(periodSize, tapBefore->mSamples.size());
+  ASSERT_EQ(periodSize, tapAfter->mSamples.size());
+  ASSERT_EQ(periodSize, tapOutput->mSamples.size());
+  for (uint32_t frame = 0; frame < periodSize; ++frame)
+  {
+    EXPECT_FLOAT_EQ(ramp[2 * frame], tapBefore->mSamples[frame]);
+    EXPECT_FLOAT_EQ(0.5f * ramp[2 * frame], tapAfter->mSamples[frame]);
+    EXPECT_FLOAT_EQ(0.5f * ramp[2 * frame], tapOutput->mSamples[frame]);
+  }
+
+  // Detaching the tap of the module pin must not detach the tap of the input pin, although both share one stream.
+  pipeline->stopStreamProbe(modulePin);
+  tapBefore->mSamples.clear();
+  tapAfter->mSamples.clear();
+  ASSERT_EQ(IasPipeline::eIasOk, pipeline->provideInputData(inputPort, 0, periodSize, periodSize, &numFramesRemaining));
+  pipeline->process();
+  EXPECT_EQ(periodSize, tapBefore->mSamples.size());
+  EXPECT_TRUE(tapAfter->mSamples.empty());
+
+  pipeline->stopStreamProbe(inputPin);
+  pipeline->stopStreamProbe(outputPin);
+  pipeline->unlink(inputPort, inputPin);
+  setup->unlink(modulePin, outputPin);
+  setup->unlink(inputPin, modulePin);
+  setup->deleteAudioInOutPin(module, modulePin);
+  setup->deleteProcessingModule(pipeline, module);
+  setup->destroyProcessingModule(&module);
+  setup->deleteAudioInputPin(pipeline, inputPin);
+  setup->deleteAudioOutputPin(pipeline, outputPin);
+  setup->destroyAudioPin(&inputPin);
+  setup->destroyAudioPin(&modulePin);
+  setup->destroyAudioPin(&outputPin);
+  setup->destroyPipeline(&pipeline);
+  rbFactory->destroyRingBuffer(ringBuffer);
+  IasSmartX::destroy(smartx);
+}
+
 }
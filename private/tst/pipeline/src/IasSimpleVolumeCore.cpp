@@ -63,7 +63,16 @@ IasAudioProcessingResult IasSimpleVolumeCore::processChild()
   for (IasStreamPointerList::const_iterator streamIt = streams.begin(); streamIt != streams.end(); ++streamIt)
   {
     std::cout << "  in-place processing on stream " << (*streamIt)->getName() << std::endl;
-    // This is the place where the actual streaming and processing would take place.
+    IasSimpleAudioStream *nonInterleaved = (*streamIt)->asNonInterleavedStream();
+    const IasAudioFrame &buffers = nonInterleaved->getAudioBuffers();
+    for (uint32_t chanIdx = 0; chanIdx < nonInterleaved->getNumberChannels(); ++chanIdx)
+    {
+      float *channel = buffers[chanIdx];
+      for (uint32_t frameIdx = 0; frameIdx < mFrameLength; ++frameIdx)
+      {
+        channel[frameIdx] *= mVolume;
+      }
+    }
   }
 
   // Iterate over all stream mappings.
@@ -9,6 +9,9 @@
  *  Created on: Aug 17, 2012
  */
 
+#include <math.h>
+#include <algorithm>
+#include <vector>
 #include "gtest/gtest.h"
 
 
@@ -23,6 +26,123 @@
 
 using namespace IasAudio;
 
+/**
+ * @brief Reference ramp, computes the ramp values one by one like IasRamp did before the block computation
+ */
+class IasReferenceRamp
+{
+  public:
+    IasReferenceRamp(uint32_t sampleFreq, uint32_t frameSize, float startValue, float endValue,
+                     uint32_t rampTime, IasRampShapes shape)
+      :mFrameSize(frameSize)
+      ,mStartValue(startValue)
+      ,mEndValue(endValue)
+      ,mIncrementAdd(0.0f)
+      ,mIncrementMult(1.0)
+      ,mCurrentValue(startValue)
+      ,mNumRampValues(0)
+    {
+      uint32_t numRampValues = static_cast<uint32_t>(floor(static_cast<float>(rampTime) * 0.001f *
+                                                           static_cast<float>(sampleFreq)));
+      if (startValue == endValue)
+      {
+        mIncrementMult = (shape == eIasRampShapeLinear) ? 1.0 : 0.0;
+        return;
+      }
+      mNumRampValues = numRampValues;
+      if (shape == eIasRampShapeLinear)
+      {
+        mIncrementAdd = (endValue - startValue) / static_cast<float>(numRampValues);
+        return;
+      }
+      float start = (startValue == 0.0f) ? MUTE : startValue;
+      float end = (endValue == 0.0f) ? MUTE : endValue;
+      mCurrentValue = start;
+      mIncrementMult = static_cast<double>(pow(static_cast<float>(fabs(end/start)), 1.0f/static_cast<float>(numRampValues)));
+    }
+
+    uint32_t getRampValues(float *data, uint32_t channelIndex, uint32_t numChannels)
+    {
+      float *frame = data + channelIndex;
+      for (uint32_t i = 0; i < mFrameSize; ++i)
+      {
+        float value = nextValue();
+        for (uint32_t j = 0; j < numChannels; ++j)
+        {
+          frame[j] = value;
+        }
+        frame += cIasNumChannelsPerBundle;
+      }
+      return mNumRampValues;
+    }
+
+    void getRampValues(float *data)
+    {
+      for (uint32_t i = 0; i < mFrameSize; ++i)
+      {
+        data[i] = nextValue();
+      }
+    }
+
+  private:
+    float nextValue()
+    {
+      if (mNumRampValues == 0)
+      {
+        mCurrentValue = mEndValue;
+        return mEndValue;
+      }
+      mCurrentValue += mIncrementAdd;
+      mCurrentValue *= mIncrementMult;
+      mNumRampValues--;
+      if ((mCurrentValue > mEndValue && mStartValue < mEndValue) ||
+          (mCurrentValue < mEndValue && mStartValue > mEndValue) ||
+          (mNumRampValues == 0))
+      {
+        mCurrentValue = mEndValue;
+      }
+      return static_cast<float>(mCurrentValue);
+    }
+
+    uint32_t mFrameSize;
+    float    mStartValue;
+    float    mEndValue;
+    float    mIncrementAdd;
+    double   mIncrementMult;
+    double   mCurrentValue;
+    uint32_t mNumRampValues;
+};
+
+struct IasRampTestParams
+{
+  float startValue;
+  float endValue;
+  uint32_t rampTime;
+  IasRampShapes shape;
+};
+
+// Ramps of 441 and 4410 values at 44.1 kHz, which are not multiples of the block size.
+static const IasRampTestParams cRampTestParams[] =
+{
+  { 0.0f, 1.0f, 10, eIasRampShapeLinear },
+  { 1.0f, 0.25f, 100, eIasRampShapeLinear },
+  { -0.5f, 0.5f, 10, eIasRampShapeLinear },
+  { 0.3f, 0.3f, 10, eIasRampShapeLinear },
+  { 0.0f, 1.0f, 100, eIasRampShapeExponential },
+  { 1.0f, 0.0f, 10, eIasRampShapeExponential },
+  { 0.5f, 1.0f, 10, eIasRampShapeExponential },
+  { 1.0f, 0.25f, 100, eIasRampShapeExponential },
+  { 0.3f, 0.3f, 10, eIasRampShapeExponential },
+};
+
+static const uint32_t cRampTestSampleFreq = 44100;
+static const uint32_t cRampTestFrameSizes[] = { 1, 13, 64, 100, 192 };
+
+static void expectRampValue(float expected, float actual)
+{
+  EXPECT_NEAR(expected, actual, std::max(fabsf(expected) * 1.0e-5f, 1.0e-9f));
+}
+
 class IasAudioRampTest : public ::testing::Test
 {
   protected:
@@ -190,3 +310,157 @@ TEST_F(IasAudioRampTest, getRampValues)
   delete[] data;
   delete myRamp; 
 }
+
+TEST_F(IasAudioRampTest, bundleValuesMatchReference)
+{
+  const float cUntouched = -100.0f;
+  for (const IasRampTestParams &params : cRampTestParams)
+  {
+    for (uint32_t frameSize : cRampTestFrameSizes)
+    {
+      for (uint32_t numChannels = 1; numChannels <= cIasNumChannelsPerBundle; ++numChannels)
+      {
+        for (uint32_t channelIndex = 0; channelIndex + numChannels <= cIasNumChannelsPerBundle; ++channelIndex)
+        {
+          SCOPED_TRACE(::testing::Message() << "start=" << params.startValue << " end=" << params.endValue
+                       << " shape=" << params.shape << " frameSize=" << frameSize
+                       << " channelIndex=" << channelIndex << " numChannels=" << numChannels);
+          IasRamp ramp(cRampTestSampleFreq, frameSize);
+          IasReferenceRamp reference(cRampTestSampleFreq, frameSize, params.startValue, params.endValue,
+                                     params.rampTime, params.shape);
+          ASSERT_EQ(eIasRampErrorNoError, ramp.setTimedRamp(params.startValue, params.endValue, params.rampTime, params.shape));
+          std::vector<float> data(frameSize * cIasNumChannelsPerBundle);
+          std::vector<float> expected(frameSize * cIasNumChannelsPerBundle);
+          uint32_t numValuesLeftToRamp = 0;
+          uint32_t numFrames = 0;
+          do
+          {
+            std::fill(data.begin(), data.end(), cUntouched);
+            std::fill(expected.begin(), expected.end(), cUntouched);
+            ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), channelIndex, numChannels, &numValuesLeftToRamp));
+            ASSERT_EQ(reference.getRampValues(expected.data(), channelIndex, numChannels), numValuesLeftToRamp);
+            for (uint32_t index = 0; index < data.size(); ++index)
+            {
+              expectRampValue(expected[index], data[index]);
+            }
+            ASSERT_LT(++numFrames, 10000u);
+          } while (numValuesLeftToRamp != 0);
+          // The last written value is exactly the end value.
+          EXPECT_EQ(params.endValue, data[(frameSize - 1) * cIasNumChannelsPerBundle + channelIndex]);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(IasAudioRampTest, frameValuesMatchReference)
+{
+  for (const IasRampTestParams &params : cRampTestParams)
+  {
+    for (uint32_t frameSize : cRampTestFrameSizes)
+    {
+      SCOPED_TRACE(::testing::Message() << "start=" << params.startValue << " end=" << params.endValue
+                   << " shape=" << params.shape << " frameSize=" << frameSize);
+      IasRamp ramp(cRampTestSampleFreq, frameSize);
+      IasReferenceRamp reference(cRampTestSampleFreq, frameSize, params.startValue, params.endValue,
+                                 params.rampTime, params.shape);
+      ASSERT_EQ(eIasRampErrorNoError, ramp.setTimedRamp(params.startValue, params.endValue, params.rampTime, params.shape));
+      std::vector<float> data(frameSize);
+      std::vector<float> expected(frameSize);
+      // Run one frame beyond the end of the ramp, so that the filled up end values are checked as well.
+      uint32_t numFrames = ramp.getNumSamples2Ramp() / frameSize + 2;
+      for (uint32_t frame = 0; frame < numFrames; ++frame)
+      {
+        ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data()));
+        reference.getRampValues(expected.data());
+        for (uint32_t index = 0; index < frameSize; ++index)
+        {
+          expectRampValue(expected[index], data[index]);
+        }
+      }
+      EXPECT_EQ(0u, ramp.getNumSamples2Ramp());
+      EXPECT_EQ(params.endValue, data[frameSize - 1]);
+    }
+  }
+}
+
+TEST_F(IasAudioRampTest, settledRampSkipsBuffer)
+{
+  const uint32_t cFrameSize = 13;
+  const float cUntouched = -100.0f;
+  IasRamp ramp(cRampTestSampleFreq, cFrameSize);
+  std::vector<float> data(cFrameSize * cIasNumChannelsPerBundle);
+  std::vector<float> other(cFrameSize * cIasNumChannelsPerBundle);
+  uint32_t numValuesLeftToRamp = 0;
+
+  ASSERT_EQ(eIasRampErrorNoError, ramp.setTimedRamp(0.0f, 1.0f, 1, eIasRampShapeLinear));
+  do
+  {
+    ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 1, 2, &numValuesLeftToRamp));
+  } while (numValuesLeftToRamp != 0);
+
+  // The first call after the end of the ramp writes the end value, further calls for the same buffer
+  // and channels leave the buffer alone.
+  ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 1, 2, &numValuesLeftToRamp));
+  EXPECT_EQ(1.0f, data[(cFrameSize - 1) * cIasNumChannelsPerBundle + 1]);
+  std::fill(data.begin(), data.end(), cUntouched);
+  ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 1, 2, &numValuesLeftToRamp));
+  EXPECT_EQ(0u, numValuesLeftToRamp);
+  EXPECT_TRUE(std::all_of(data.begin(), data.end(), [cUntouched](float value) { return value == cUntouched; }));
+
+  // Other channels of the same buffer and other buffers are written.
+  ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 0, 4, &numValuesLeftToRamp));
+  EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](float value) { return value == 1.0f; }));
+  std::fill(other.begin(), other.end(), cUntouched);
+  ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(other.data(), 0, 4, &numValuesLeftToRamp));
+  EXPECT_TRUE(std::all_of(other.begin(), other.end(), [](float value) { return value == 1.0f; }));
+
+  // The frame layout of the same buffer does not match the settled bundle layout.
+  std::fill(other.begin(), other.end(), cUntouched);
+  ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(other.data()));
+  EXPECT_TRUE(std::all_of(other.begin(), other.begin() + cFrameSize, [](float value) { return value == 1.0f; }));
+  std::fill(other.begin(), other.end(), cUntouched);
+  ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(other.data(), 0, 1, &numValuesLeftToRamp));
+  for (uint32_t index = 0; index < cFrameSize; ++index)
+  {
+    EXPECT_EQ(1.0f, other[index * cIasNumChannelsPerBundle]);
+  }
+}
+
+TEST_F(IasAudioRampTest, newRampResetsSettledBuffer)
+{
+  const uint32_t cFrameSize = 13;
+  IasRamp ramp(cRampTestSampleFreq, cFrameSize);
+  std::vector<float> data(cFrameSize * cIasNumChannelsPerBundle);
+  std::vector<float> frameData(cFrameSize);
+  uint32_t numValuesLeftToRamp = 0;
+
+  ASSERT_EQ(eIasRampErrorNoError, ramp.setTimedRamp(0.0f, 1.0f, 1, eIasRampShapeLinear));
+  do
+  {
+    ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 0, 4, &numValuesLeftToRamp));
+  } while (numValuesLeftToRamp != 0);
+  ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 0, 4, &numValuesLeftToRamp));
+  ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(frameData.data()));
+
+  // A new ramp without any ramp values still writes its end value to the buffers that held the old one.
+  for (IasRampShapes shape : { eIasRampShapeLinear, eIasRampShapeExponential })
+  {
+    ASSERT_EQ(eIasRampErrorNoError, ramp.setTimedRamp(0.5f, 0.5f, 1, shape));
+    ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 0, 4, &numValuesLeftToRamp));
+    EXPECT_EQ(0u, numValuesLeftToRamp);
+    EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](float value) { return value == 0.5f; }));
+    ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(frameData.data()));
+    EXPECT_TRUE(std::all_of(frameData.begin(), frameData.end(), [](float value) { return value == 0.5f; }));
+
+    ASSERT_EQ(eIasRampErrorNoError, ramp.setTimedRamp(0.5f, 1.0f, 1, shape));
+    do
+    {
+      ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 0, 4, &numValuesLeftToRamp));
+    } while (numValuesLeftToRamp != 0);
+    ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(data.data(), 0, 4, &numValuesLeftToRamp));
+    EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](float value) { return value == 1.0f; }));
+    ASSERT_EQ(eIasRampErrorNoError, ramp.getRampValues(frameData.data()));
+    EXPECT_TRUE(std::all_of(frameData.begin(), frameData.end(), [](float value) { return value == 1.0f; }));
+  }
+}
@@ -15,6 +15,7 @@
 #include "model/IasAudioSinkDevice.hpp"
 #include "model/IasAudioSourceDevice.hpp"
 #include "model/IasRoutingZoneWorkerThread.hpp"
+#include "model/IasSinkFillController.hpp"
 #include "alsahandler/IasAlsaHandler.hpp"
 
 #include "model/IasAudioPort.hpp"
@@ -201,6 +202,101 @@ TEST_F(IasRoutingZoneTest, routingZoneWorkerGetConversionBufferParams)
   ASSERT_EQ(0u, convBufMap.size());
 }
 
+TEST_F(IasRoutingZoneTest, sinkFillController)
+{
+  const uint32_t periodSize = 256;
+  const uint32_t windowLength = 10;
+  IasSinkFillController controller;
+  controller.init(periodSize, 4 * periodSize, 3 * periodSize, windowLength);
+  ASSERT_EQ(3 * periodSize, controller.getTarget());
+
+  // Fill level matches the default target, nothing to do.
+  for (uint32_t i = 0; i < 2 * windowLength; i++)
+  {
+    ASSERT_EQ(IasSinkFillController::eIasKeep, controller.update(2 * periodSize));
+  }
+
+  // Lower the target by one period, one period is dropped at the end of the window.
+  IasISetup::IasSinkPrefillParams params;
+  params.numFrames = 2 * periodSize;
+  controller.setParams(params);
+  ASSERT_EQ(2 * periodSize, controller.getTarget());
+  for (uint32_t i = 0; i < windowLength - 1; i++)
+  {
+    ASSERT_EQ(IasSinkFillController::eIasKeep, controller.update(2 * periodSize));
+  }
+  ASSERT_EQ(IasSinkFillController::eIasDropPeriod, controller.update(2 * periodSize));
+  ASSERT_EQ(1u, controller.getNumDroppedPeriods());
+  for (uint32_t i = 0; i < windowLength; i++)
+  {
+    ASSERT_EQ(IasSinkFillController::eIasKeep, controller.update(periodSize));
+  }
+
+  // Raise the target again, one period of zeros is inserted at the end of the window.
+  params.numFrames = 3 * periodSize;
+  controller.setParams(params);
+  for (uint32_t i = 0; i < windowLength - 1; i++)
+  {
+    ASSERT_EQ(IasSinkFillController::eIasKeep, controller.update(periodSize));
+  }
+  ASSERT_EQ(IasSinkFillController::eIasInsertPeriod, controller.update(periodSize));
+  ASSERT_EQ(1u, controller.getNumInsertedPeriods());
+
+  // Fill levels are rounded down to whole periods and limited to the buffer size minus one period.
+  params.numFrames = 2 * periodSize + periodSize / 2;
+  controller.setParams(params);
+  ASSERT_EQ(2 * periodSize, controller.getTarget());
+  params.numFrames = 10 * periodSize;
+  controller.setParams(params);
+  ASSERT_EQ(3 * periodSize, controller.getTarget());
+
+  // Adaptive mode: a large margin for ten windows lowers the target by one period.
+  params.numFrames = 3 * periodSize;
+  params.adaptive = true;
+  controller.setParams(params);
+  for (uint32_t window = 0; window < 9; window++)
+  {
+    for (uint32_t i = 0; i < windowLength; i++)
+    {
+      ASSERT_EQ(IasSinkFillController::eIasKeep, controller.update(2 * periodSize));
+    }
+  }
+  ASSERT_EQ(3 * periodSize, controller.getTarget());
+  for (uint32_t i = 0; i < windowLength - 1; i++)
+  {
+    ASSERT_EQ(IasSinkFillController::eIasKeep, controller.update(2 * periodSize));
+  }
+  ASSERT_EQ(IasSinkFillController::eIasDropPeriod, controller.update(2 * periodSize));
+  ASSERT_EQ(2 * periodSize, controller.getTarget());
+
+  // The lowest target of the adaptation is two periods by default.
+  for (uint32_t window = 0; window < 10; window++)
+  {
+    for (uint32_t i = 0; i < windowLength; i++)
+    {
+      controller.update(2 * periodSize);
+    }
+  }
+  ASSERT_EQ(2 * periodSize, controller.getTarget());
+
+  // Less than half a period of margin raises the target by one period.
+  for (uint32_t i = 0; i < windowLength - 1; i++)
+  {
+    ASSERT_EQ(IasSinkFillController::eIasKeep, controller.update(periodSize));
+  }
+  ASSERT_EQ(IasSinkFillController::eIasInsertPeriod, controller.update(periodSize / 4));
+  ASSERT_EQ(3 * periodSize, controller.getTarget());
+
+  // The prefill parameters of the worker thread are kept for the next start.
+  IasRoutingZoneParamsPtr myRoutingZoneParams = std::make_shared<IasRoutingZoneParams>();
+  myRoutingZoneParams->name = "MyRoutingZone";
+  IasRoutingZoneWorkerThreadPtr rzwt = std::make_shared<IasRoutingZoneWorkerThread>(myRoutingZoneParams);
+  ASSERT_EQ(0u, rzwt->getSinkPrefill().numFrames);
+  rzwt->setSinkPrefill(params);
+  ASSERT_EQ(params.numFrames, rzwt->getSinkPrefill().numFrames);
+  ASSERT_TRUE(rzwt->getSinkPrefill().adaptive);
+}
+
 TEST_F(IasRoutingZoneTest, addDerivedZoneFailure)
 {
   // Parameters for the routing zone configuration.
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/*
+ * IasRtLogTest.cpp
+ *
+ *  Created 2018
+ */
+
+#include <string>
+#include <thread>
+#include "gtest/gtest.h"
+#include "smartx/IasRtLog.hpp"
+
+using namespace IasAudio;
+
+namespace IasAudio {
+
+static const std::string cClassName = "IasRtLogTest::";
+
+// The log thread forwards the records of registered threads later, so the context has to outlive the tests.
+static int8_t gLogLevel = DLT_LOG_VERBOSE;
+static DltContext gContext;
+
+class IasRtLogTest : public ::testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+      gLogLevel = DLT_LOG_VERBOSE;
+      gContext.log_level_ptr = &gLogLevel;
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+TEST_F(IasRtLogTest, writeAndDrain)
+{
+  IasRtLogRing ring("writeAndDrain");
+  const std::string text = "text";
+  EXPECT_TRUE(IasRtLog::write(ring, &gContext, DLT_LOG_INFO, cClassName, "function", 42, "value", -3, 7u, 0.5, true, text));
+  EXPECT_TRUE(IasRtLog::write(ring, &gContext, DLT_LOG_INFO, cClassName, "function", 43, "second"));
+  EXPECT_EQ(2u, ring.writeIndex.load());
+  EXPECT_EQ(0u, ring.readIndex.load());
+
+  const IasRtLogRecord &record = ring.records[0];
+  EXPECT_EQ(&gContext, record.context);
+  EXPECT_EQ(6u, record.numArgs);
+  EXPECT_EQ(IasRtLogArg::eIasText, record.args[0].type);
+  EXPECT_EQ(IasRtLogArg::eIasInt, record.args[1].type);
+  EXPECT_EQ(IasRtLogArg::eIasUInt, record.args[2].type);
+  EXPECT_EQ(IasRtLogArg::eIasDouble, record.args[3].type);
+  EXPECT_EQ(IasRtLogArg::eIasBool, record.args[4].type);
+  EXPECT_EQ(IasRtLogArg::eIasText, record.args[5].type);
+  EXPECT_EQ("IasRtLogTest::function(42): value -3 7 0.5 true text", IasRtLog::format(record));
+
+  EXPECT_EQ(2u, IasRtLog::drain(ring));
+  EXPECT_EQ(2u, ring.readIndex.load());
+  EXPECT_EQ(0u, IasRtLog::drain(ring));
+}
+
+TEST_F(IasRtLogTest, truncateArgs)
+{
+  IasRtLogRing ring("truncateArgs");
+  EXPECT_TRUE(IasRtLog::write(ring, &gContext, DLT_LOG_INFO, cClassName, "function", 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10));
+  EXPECT_EQ(cIasRtLogMaxArgs, ring.records[0].numArgs);
+
+  const std::string longText(2 * cIasRtLogTextSize, 'x');
+  EXPECT_TRUE(IasRtLog::write(ring, &gContext, DLT_LOG_INFO, cClassName, "function", 2, longText, "dropped"));
+  const IasRtLogRecord &record = ring.records[1];
+  EXPECT_EQ(cIasRtLogTextSize, record.textUsed);
+  EXPECT_EQ(cIasRtLogTextSize, record.args[0].text.length);
+  EXPECT_EQ(0u, record.args[1].text.length);
+  EXPECT_EQ(2u, IasRtLog::drain(ring));
+}
+
+TEST_F(IasRtLogTest, overflow)
+{
+  IasRtLogRing ring("overflow");
+  const uint32_t numOverflow = 10;
+  for (uint32_t index = 0; index < cIasRtLogRingSize; ++index)
+  {
+    EXPECT_TRUE(IasRtLog::write(ring, &gContext, DLT_LOG_INFO, cClassName, "function", index, index));
+  }
+  for (uint32_t index = 0; index < numOverflow; ++index)
+  {
+    EXPECT_FALSE(IasRtLog::write(ring, &gContext, DLT_LOG_INFO, cClassName, "function", index, index));
+  }
+  EXPECT_EQ(numOverflow, ring.numDropped.load());
+  EXPECT_EQ(0u, ring.numReportedDropped);
+
+  // The records written before the ring was full are kept, the dropped ones are reported once.
+  EXPECT_EQ(cIasRtLogRingSize, IasRtLog::drain(ring));
+  EXPECT_EQ(numOverflow, ring.numReportedDropped);
+  EXPECT_EQ("IasRtLogTest::function(255): 255", IasRtLog::format(ring.records[cIasRtLogRingSize - 1]));
+
+  // After draining, the ring wraps around.
+  EXPECT_TRUE(IasRtLog::write(ring, &gContext, DLT_LOG_INFO, cClassName, "function", 1000, 1000));
+  EXPECT_EQ("IasRtLogTest::function(1000): 1000", IasRtLog::format(ring.records[0]));
+  EXPECT_EQ(1u, IasRtLog::drain(ring));
+  EXPECT_EQ(numOverflow, ring.numDropped.load());
+}
+
+TEST_F(IasRtLogTest, registration)
+{
+  bool registeredBefore = true;
+  bool registeredAfterLog = true;
+  bool registeredAfterRegister = false;
+  std::thread thread([&]()
+  {
+    registeredBefore = IasRtLog::isThreadRegistered();
+    // The log call of an unregistered thread goes to DLT directly and must not allocate a ring.
+    IAS_RT_LOG(gContext, DLT_LOG_INFO, "unregistered");
+    registeredAfterLog = IasRtLog::isThreadRegistered();
+    IasRtLog::registerThread("registration");
+    registeredAfterRegister = IasRtLog::isThreadRegistered();
+    IAS_RT_LOG(gContext, DLT_LOG_INFO, "registered");
+  });
+  thread.join();
+  EXPECT_FALSE(registeredBefore);
+  EXPECT_FALSE(registeredAfterLog);
+  EXPECT_TRUE(registeredAfterRegister);
+  EXPECT_EQ(0u, IasRtLog::getNumDropped());
+}
+
+TEST_F(IasRtLogTest, levelDisabled)
+{
+  gLogLevel = DLT_LOG_WARN;
+  IasRtLog::registerThread("levelDisabled");
+  uint64_t numDropped = IasRtLog::getNumDropped();
+  // Records below the log level are not created, so they can not fill the ring either.
+  for (uint32_t index = 0; index < 2 * cIasRtLogRingSize; ++index)
+  {
+    IAS_RT_LOG(gContext, DLT_LOG_INFO, "disabled", index);
+  }
+  EXPECT_EQ(numDropped, IasRtLog::getNumDropped());
+}
+
+} // namespace IasAudio
@@ -9,8 +9,13 @@
  * @brief  Contains some test cases for covering the IasAudioBuffer and IasAudioBufferPool classes.
  */
 
+#include <thread>
+#include <vector>
+
 #include "rtprocessingfwx/IasAudioBuffer.hpp"
 #include "rtprocessingfwx/IasAudioBufferPool.hpp"
+#include "rtprocessingfwx/IasAudioBufferPoolHandler.hpp"
+#include "audio/smartx/rtprocessingfwx/IasSimpleAudioStream.hpp"
 #include "IasRtProcessingFwTest.hpp"
 
 namespace IasAudio {
@@ -33,5 +38,226 @@ TEST_F(IasRtProcessingFwTest, AudioBufferTest)
   delete audioBuffer;
 }
 
+TEST_F(IasRtProcessingFwTest, AudioBufferPoolMaxNumBuffers)
+{
+  IasAudioBufferPool* audioBufferPool = new IasAudioBufferPool(1);
+  std::vector<IasAudioBuffer*> buffers;
+  for (uint32_t count = 0; count < IasAudioBufferPool::cMaxNumBuffers; ++count)
+  {
+    IasAudioBuffer* buffer = audioBufferPool->getBuffer();
+    ASSERT_TRUE(buffer != nullptr);
+    buffers.push_back(buffer);
+  }
+
+  // The pool is full, the request fails and is not counted as exhaustion event
+  EXPECT_EQ(nullptr, audioBufferPool->getBuffer());
+  IasIDebug::IasBufferPoolStatistics statistics;
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(IasAudioBufferPool::cMaxNumBuffers, statistics.numBuffers);
+  EXPECT_EQ(IasAudioBufferPool::cMaxNumBuffers, statistics.numInUse);
+  EXPECT_EQ(static_cast<uint64_t>(IasAudioBufferPool::cMaxNumBuffers), statistics.numExhausted);
+  EXPECT_EQ(1u, statistics.numFailed);
+
+  // A returned buffer can be handed out again
+  EXPECT_EQ(eIasAudioProcOK, IasAudioBufferPool::returnBuffer(buffers.back()));
+  buffers.back() = audioBufferPool->getBuffer();
+  EXPECT_TRUE(buffers.back() != nullptr);
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(1u, statistics.numFailed);
+
+  // A buffer that claims an index of the pool, but was not created by it, is not taken back
+  IasAudioBuffer* foreignBuffer = new IasAudioBuffer(1);
+  foreignBuffer->setHomePool(audioBufferPool);
+  foreignBuffer->setPoolIndex(0);
+  EXPECT_EQ(eIasAudioProcOK, IasAudioBufferPool::returnBuffer(foreignBuffer));
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(IasAudioBufferPool::cMaxNumBuffers, statistics.numInUse);
+  EXPECT_EQ(nullptr, audioBufferPool->getBuffer());
+  delete foreignBuffer;
+
+  for (auto buffer : buffers)
+  {
+    EXPECT_EQ(eIasAudioProcOK, IasAudioBufferPool::returnBuffer(buffer));
+  }
+  delete audioBufferPool;
+}
+
+TEST_F(IasRtProcessingFwTest, AudioBufferPoolReserve)
+{
+  IasAudioBufferPool* audioBufferPool = new IasAudioBufferPool(64);
+  IasIDebug::IasBufferPoolStatistics statistics;
+
+  audioBufferPool->reserve(4);
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(64u, statistics.bufferSize);
+  EXPECT_EQ(4u, statistics.numBuffers);
+  EXPECT_EQ(4u, statistics.numReserved);
+  EXPECT_EQ(0u, statistics.numInUse);
+
+  // The reserved buffers are handed out without growing the pool
+  std::vector<IasAudioBuffer*> buffers;
+  for (uint32_t count = 0; count < 4; ++count)
+  {
+    IasAudioBuffer* buffer = audioBufferPool->getBuffer();
+    ASSERT_TRUE(buffer != nullptr);
+    buffers.push_back(buffer);
+  }
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(4u, statistics.numBuffers);
+  EXPECT_EQ(4u, statistics.numInUse);
+  EXPECT_EQ(4u, statistics.highWaterMark);
+  EXPECT_EQ(0u, statistics.numExhausted);
+
+  // One more buffer exhausts the pool, which still grows but counts the event
+  IasAudioBuffer* extraBuffer = audioBufferPool->getBuffer();
+  ASSERT_TRUE(extraBuffer != nullptr);
+  buffers.push_back(extraBuffer);
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(5u, statistics.numBuffers);
+  EXPECT_EQ(5u, statistics.highWaterMark);
+  EXPECT_EQ(1u, statistics.numExhausted);
+
+  for (auto buffer : buffers)
+  {
+    EXPECT_EQ(eIasAudioProcOK, IasAudioBufferPool::returnBuffer(buffer));
+  }
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(0u, statistics.numInUse);
+  EXPECT_EQ(5u, statistics.highWaterMark);
+
+  // A reservation that is covered by the existing buffers does not allocate
+  audioBufferPool->release(4);
+  audioBufferPool->reserve(5);
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(5u, statistics.numBuffers);
+  EXPECT_EQ(5u, statistics.numReserved);
+  audioBufferPool->release(10);
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(0u, statistics.numReserved);
+
+  delete audioBufferPool;
+}
+
+TEST_F(IasRtProcessingFwTest, AudioBufferPoolConcurrent)
+{
+  const uint32_t cNumThreads = 4;
+  const uint32_t cNumIterations = 20000;
+  IasAudioBufferPool* audioBufferPool = new IasAudioBufferPool(16);
+  audioBufferPool->reserve(2 * cNumThreads);
+
+  std::vector<std::thread> threads;
+  for (uint32_t threadIdx = 0; threadIdx < cNumThreads; ++threadIdx)
+  {
+    threads.push_back(std::thread([audioBufferPool, threadIdx, cNumIterations]()
+    {
+      for (uint32_t count = 0; count < cNumIterations; ++count)
+      {
+        IasAudioBuffer* first = audioBufferPool->getBuffer();
+        IasAudioBuffer* second = audioBufferPool->getBuffer();
+        ASSERT_TRUE(first != nullptr);
+        ASSERT_TRUE(second != nullptr);
+        ASSERT_TRUE(first != second);
+        // Each thread owns its buffers exclusively until they are returned
+        first->getData()[0] = static_cast<float>(threadIdx);
+        second->getData()[0] = static_cast<float>(threadIdx);
+        ASSERT_EQ(static_cast<float>(threadIdx), first->getData()[0]);
+        IasAudioBufferPool::returnBuffer(first);
+        ASSERT_EQ(static_cast<float>(threadIdx), second->getData()[0]);
+        IasAudioBufferPool::returnBuffer(second);
+      }
+    }));
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  IasIDebug::IasBufferPoolStatistics statistics;
+  audioBufferPool->getStatistics(&statistics);
+  EXPECT_EQ(2 * cNumThreads, statistics.numBuffers);
+  EXPECT_EQ(0u, statistics.numInUse);
+  EXPECT_LE(statistics.highWaterMark, 2 * cNumThreads);
+  EXPECT_EQ(0u, statistics.numExhausted);
+
+  delete audioBufferPool;
+}
+
+TEST_F(IasRtProcessingFwTest, AudioBufferPoolHandler)
+{
+  IasAudioBufferPoolHandler* bufferPoolHandler = IasAudioBufferPoolHandler::getInstance();
+  ASSERT_TRUE(bufferPoolHandler != nullptr);
+  IasAudioBufferPool* audioBufferPool = bufferPoolHandler->getBufferPool(4711);
+  ASSERT_TRUE(audioBufferPool != nullptr);
+  EXPECT_EQ(audioBufferPool, bufferPoolHandler->getBufferPool(4711));
+  EXPECT_EQ(4711u, audioBufferPool->getBufferSize());
+
+  bufferPoolHandler->reserveBuffers(4711, 3);
+  std::vector<IasIDebug::IasBufferPoolStatistics> statistics;
+  bufferPoolHandler->getStatistics(&statistics);
+  bool found = false;
+  for (const auto &entry : statistics)
+  {
+    if (entry.bufferSize == 4711)
+    {
+      found = true;
+      EXPECT_EQ(3u, entry.numReserved);
+      EXPECT_GE(entry.numBuffers, 3u);
+    }
+  }
+  EXPECT_TRUE(found);
+  bufferPoolHandler->releaseBuffers(4711, 3);
+}
+
+TEST_F(IasRtProcessingFwTest, AudioBufferPoolHandlerMaxNumPools)
+{
+  IasAudioBufferPoolHandler bufferPoolHandler;
+  for (uint32_t size = 1; size <= IasAudioBufferPoolHandler::cMaxNumPools; ++size)
+  {
+    IasAudioBufferPool* audioBufferPool = bufferPoolHandler.getBufferPool(size);
+    ASSERT_TRUE(audioBufferPool != nullptr);
+    EXPECT_EQ(size, audioBufferPool->getBufferSize());
+  }
+
+  // No pool is created for a further size, but the existing pools are still found
+  EXPECT_EQ(nullptr, bufferPoolHandler.getBufferPool(IasAudioBufferPoolHandler::cMaxNumPools + 1));
+  EXPECT_TRUE(bufferPoolHandler.getBufferPool(IasAudioBufferPoolHandler::cMaxNumPools) != nullptr);
+  std::vector<IasIDebug::IasBufferPoolStatistics> statistics;
+  bufferPoolHandler.getStatistics(&statistics);
+  EXPECT_EQ(IasAudioBufferPoolHandler::cMaxNumPools, statistics.size());
+}
+
+TEST_F(IasRtProcessingFwTest, SimpleAudioStreamPoolExhausted)
+{
+  // A buffer size no other test uses, so that the pool of the stream can be filled up
+  const uint32_t cNumChannels = 2;
+  const uint32_t cFrameLength = 77;
+  IasAudioBufferPool* audioBufferPool = IasAudioBufferPoolHandler::getInstance()->getBufferPool(cNumChannels * cFrameLength);
+  ASSERT_TRUE(audioBufferPool != nullptr);
+  std::vector<IasAudioBuffer*> buffers;
+  for (IasAudioBuffer* buffer = audioBufferPool->getBuffer(); buffer != nullptr; buffer = audioBufferPool->getBuffer())
+  {
+    buffers.push_back(buffer);
+  }
+  ASSERT_EQ(IasAudioBufferPool::cMaxNumBuffers, buffers.size());
+
+  IasSimpleAudioStream stream;
+  EXPECT_EQ(eIasAudioProcNotEnoughMemory, stream.setProperties("stream", 1, cNumChannels, IasBaseAudioStream::eIasNonInterleaved,
+                                                               cFrameLength, IasBaseAudioStream::eIasAudioStreamInput, false));
+  EXPECT_TRUE(stream.getAudioBuffers().empty());
+
+  // As soon as a buffer is available again, the properties can be set
+  EXPECT_EQ(eIasAudioProcOK, IasAudioBufferPool::returnBuffer(buffers.back()));
+  buffers.pop_back();
+  EXPECT_EQ(eIasAudioProcOK, stream.setProperties("stream", 1, cNumChannels, IasBaseAudioStream::eIasNonInterleaved,
+                                                  cFrameLength, IasBaseAudioStream::eIasAudioStreamInput, false));
+  EXPECT_EQ(cNumChannels, stream.getAudioBuffers().size());
+  stream.cleanup();
+
+  for (auto buffer : buffers)
+  {
+    EXPECT_EQ(eIasAudioProcOK, IasAudioBufferPool::returnBuffer(buffer));
+  }
+}
+
 
 } // namespace IasAudio
@@ -8,8 +8,11 @@
  * @brief  Contains some test cases for the IasCmdDispatcher class
  */
 
+#include "audio/smartx/IasIProcessing.hpp"
 #include "audio/smartx/rtprocessingfwx/IasIModuleId.hpp"
+#include "audio/smartx/rtprocessingfwx/IasAudioStream.hpp"
 #include "rtprocessingfwx/IasCmdDispatcher.hpp"
+#include "rtprocessingfwx/IasGenericAudioCompConfig.hpp"
 #include "IasRtProcessingFwTest.hpp"
 
 namespace IasAudio {
@@ -32,6 +35,25 @@ class IasTestModuleId : public IasIModuleId
       (void)returnProperties;
       return eIasOk;
     }
+
+    virtual bool isFastCmd(int32_t cmdId) const
+    {
+      return (cmdId == 1);
+    }
+
+    virtual IasResult processFastCmd(const IasCmdHandle &handle, float value)
+    {
+      mLastCmdId = handle.cmdId;
+      mLastStreamId = handle.streamId;
+      mLastRampTime = handle.rampTime;
+      mLastValue = value;
+      return eIasOk;
+    }
+
+    int32_t mLastCmdId = -1;
+    int32_t mLastStreamId = -1;
+    int32_t mLastRampTime = -1;
+    float mLastValue = 0.0f;
 };
 
 TEST_F(IasRtProcessingFwTest, CmdDispatcherTest)
@@ -57,5 +79,109 @@ TEST_F(IasRtProcessingFwTest, CmdDispatcherTest)
   delete cmdDispatcher;
 }
 
+TEST_F(IasRtProcessingFwTest, CmdDispatcherFastCmdTest)
+{
+  IasGenericAudioCompConfig *config = new IasGenericAudioCompConfig();
+  IasAudioStream *inputStream = new IasAudioStream("InStream", 1234, 2, IasBaseAudioStream::eIasAudioStreamInput, false);
+  IasAudioStream *outputStream = new IasAudioStream("OutStream", 4321, 2, IasBaseAudioStream::eIasAudioStreamOutput, false);
+  config->addStreamMapping(inputStream, "InPin", outputStream, "OutPin");
+
+  IasCmdDispatcher *cmdDispatcher = new IasCmdDispatcher();
+  IasTestModuleId *testModule = new IasTestModuleId(config);
+  IasICmdRegistration::IasResult res = cmdDispatcher->registerModuleIdInterface("MyModule", testModule);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+
+  IasCmdHandle handle;
+  res = cmdDispatcher->dispatchCmd(handle, 1.0f);
+  ASSERT_EQ(IasICmdRegistration::eIasFailed, res);
+  res = cmdDispatcher->resolveCmd("MyModule", 1, "InPin", nullptr);
+  ASSERT_EQ(IasICmdRegistration::eIasFailed, res);
+  res = cmdDispatcher->resolveCmd("unregistered", 1, "InPin", &handle);
+  ASSERT_EQ(IasICmdRegistration::eIasFailed, res);
+  res = cmdDispatcher->resolveCmd("MyModule", 2, "InPin", &handle);
+  ASSERT_EQ(IasICmdRegistration::eIasFailed, res);
+  res = cmdDispatcher->resolveCmd("MyModule", 1, "UnknownPin", &handle);
+  ASSERT_EQ(IasICmdRegistration::eIasFailed, res);
+
+  res = cmdDispatcher->resolveCmd("MyModule", 1, "InPin", &handle);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  res = cmdDispatcher->dispatchCmd(handle, -12.5f);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  EXPECT_EQ(1, testModule->mLastCmdId);
+  EXPECT_EQ(inputStream->getId(), testModule->mLastStreamId);
+  EXPECT_EQ(-12.5f, testModule->mLastValue);
+  EXPECT_EQ(0, testModule->mLastRampTime);
+  // The ramp parameters set by the application are passed to the module.
+  handle.rampTime = 200;
+  res = cmdDispatcher->dispatchCmd(handle, -12.5f);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  EXPECT_EQ(200, testModule->mLastRampTime);
+
+  // After unregistering the module, the handle must not be usable anymore, also not after
+  // registering another module with the same name.
+  cmdDispatcher->unregisterModuleIdInterface("MyModule");
+  res = cmdDispatcher->dispatchCmd(handle, 1.0f);
+  ASSERT_EQ(IasICmdRegistration::eIasFailed, res);
+  res = cmdDispatcher->registerModuleIdInterface("MyModule", testModule);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  res = cmdDispatcher->dispatchCmd(handle, 1.0f);
+  ASSERT_EQ(IasICmdRegistration::eIasFailed, res);
+  IasCmdHandle newHandle;
+  res = cmdDispatcher->resolveCmd("MyModule", 1, "OutPin", &newHandle);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  EXPECT_NE(handle.moduleIndex, newHandle.moduleIndex);
+  res = cmdDispatcher->dispatchCmd(newHandle, 1.0f);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  EXPECT_EQ(outputStream->getId(), testModule->mLastStreamId);
+
+  delete cmdDispatcher;
+  delete testModule;
+  delete inputStream;
+  delete outputStream;
+  delete config;
+}
+
+TEST_F(IasRtProcessingFwTest, CmdDispatcherLockModuleCmdsTest)
+{
+  IasGenericAudioCompConfig *config = new IasGenericAudioCompConfig();
+  IasAudioStream *inputStream = new IasAudioStream("InStream", 1234, 2, IasBaseAudioStream::eIasAudioStreamInput, false);
+  IasAudioStream *outputStream = new IasAudioStream("OutStream", 4321, 2, IasBaseAudioStream::eIasAudioStreamOutput, false);
+  config->addStreamMapping(inputStream, "InPin", outputStream, "OutPin");
+
+  IasCmdDispatcher *cmdDispatcher = new IasCmdDispatcher();
+  IasTestModuleId *testModule = new IasTestModuleId(config);
+  IasTestModuleId *lateModule = new IasTestModuleId(config);
+  IasICmdRegistration::IasResult res = cmdDispatcher->registerModuleIdInterface("MyModule", testModule);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+
+  // Only the registered module is locked, the module registered while the lock is held is not.
+  IasCmdDispatcher::IasCmdEntryVector lockedEntries = cmdDispatcher->lockModuleCmds({"MyModule", "LateModule", "unknown"});
+  EXPECT_EQ(1u, lockedEntries.size());
+  res = cmdDispatcher->registerModuleIdInterface("LateModule", lateModule);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  IasCmdHandle lateHandle;
+  res = cmdDispatcher->resolveCmd("LateModule", 1, "InPin", &lateHandle);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  res = cmdDispatcher->dispatchCmd(lateHandle, 2.0f);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  EXPECT_EQ(2.0f, lateModule->mLastValue);
+  cmdDispatcher->unlockModuleCmds(lockedEntries);
+
+  // After unlocking, the commands to the locked module are processed again.
+  IasCmdHandle handle;
+  res = cmdDispatcher->resolveCmd("MyModule", 1, "InPin", &handle);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  res = cmdDispatcher->dispatchCmd(handle, 3.0f);
+  ASSERT_EQ(IasICmdRegistration::eIasOk, res);
+  EXPECT_EQ(3.0f, testModule->mLastValue);
+
+  delete cmdDispatcher;
+  delete testModule;
+  delete lateModule;
+  delete inputStream;
+  delete outputStream;
+  delete config;
+}
+
 
 }
@@ -13,6 +13,8 @@
 #include <unistd.h>
 #include <iostream>
 #include <iomanip>
+#include <chrono>
+#include <limits>
 #include <fstream>
 #include <thread>
 #include <mutex>
@@ -1124,6 +1126,70 @@ TEST_F(IasSmartX_API_Test, smartxclient)
   delete smartxclient;
 }
 
+/**
+ * Several SmartX clients served by in-process plugin endpoints. The IPC threads are stopped by a shutdown
+ * package in the incoming queue, which has to stay invisible to the plugin while the client runs.
+ */
+TEST_F(IasSmartX_API_Test, smartxclient_shutdown)
+{
+  const uint32_t cNumClients = 4;
+  std::vector<IasSmartXClient*> clients;
+  std::vector<IasAlsaPluginShmConnection*> endpoints;
+  for (uint32_t index = 0; index < cNumClients; ++index)
+  {
+    IasAudioDeviceParamsPtr devParams = std::make_shared<IasAudioDeviceParams>();
+    devParams->clockType = eIasClockProvided;
+    devParams->dataFormat = eIasFormatInt16;
+    devParams->name = "MyWakeupClient" + std::to_string(index);
+    devParams->numChannels = 2;
+    devParams->numPeriods = 4;
+    devParams->periodSize = 256;
+    devParams->samplerate = 48000;
+    IasSmartXClient *smartxclient = new IasSmartXClient(devParams);
+    ASSERT_TRUE(smartxclient != nullptr);
+    ASSERT_EQ(IasSmartXClient::eIasOk, smartxclient->init(eIasDeviceTypeSource));
+    clients.push_back(smartxclient);
+    IasAlsaPluginShmConnection *shmCon = new IasAlsaPluginShmConnection();
+    ASSERT_TRUE(shmCon != nullptr);
+    ASSERT_EQ(eIasResultOk, shmCon->findConnection("smartx_" + devParams->name + "_p"));
+    endpoints.push_back(shmCon);
+  }
+
+  // All clients answer concurrently issued requests
+  for (auto shmCon : endpoints)
+  {
+    ASSERT_EQ(eIasResultOk, shmCon->getOutIpc()->push<IasAudioIpcPluginControl>(eIasAudioIpcStart));
+  }
+  for (auto shmCon : endpoints)
+  {
+    IasAudioIpcPluginControlResponse response;
+    ASSERT_EQ(eIasResultOk, shmCon->getInIpc()->pop_timed_wait<IasAudioIpcPluginControlResponse>(&response, 100));
+    EXPECT_EQ(eIasAudioIpcStart, response.control);
+    EXPECT_EQ(eIasAudioIpcACK, response.response);
+  }
+
+  // The shutdown package is an invalid control, which is still rejected while the client runs
+  for (auto shmCon : endpoints)
+  {
+    ASSERT_EQ(eIasResultOk, shmCon->getOutIpc()->push<IasAudioIpcPluginControl>(eIasAudioIpcInvalid));
+    IasAudioIpcPluginControlResponse response;
+    ASSERT_EQ(eIasResultOk, shmCon->getInIpc()->pop_timed_wait<IasAudioIpcPluginControlResponse>(&response, 100));
+    EXPECT_EQ(eIasAudioIpcInvalid, response.control);
+    EXPECT_EQ(eIasAudioIpcNAK, response.response);
+  }
+
+  // Idle clients are stopped while their IPC threads wait for packages. The threads have to be woken
+  // up by the shutdown package, not canceled.
+  for (uint32_t index = 0; index < cNumClients; ++index)
+  {
+    EXPECT_EQ(IasSmartXClient::eIasOk, clients[index]->stopIpcThread());
+    // Stopping again, as done by the destructor, has no effect
+    EXPECT_EQ(IasSmartXClient::eIasOk, clients[index]->stopIpcThread());
+    delete clients[index];
+    delete endpoints[index];
+  }
+}
+
 TEST_F(IasSmartX_API_Test, setup_two_source_two_sinks_helper)
 {
   IasISetup::IasResult result = IasISetup::eIasOk;
@@ -1920,6 +1986,118 @@ TEST_F(IasSmartX_API_Test, Configuration)
   IasSmartX::destroy(smartx);
 }
 
+/**
+ * Builds topologies with 1000 and 5000 ports and pins in the configuration and looks up every
+ * object by name and id. The lookups are hashed, so the time per lookup must not grow with the
+ * number of objects. A linear scan per lookup would make it about 5 times as long in the larger
+ * topology. The lookups are timed in batches of equal size and the fastest batch is compared, so
+ * that a batch that got preempted on a loaded machine does not distort the result.
+ */
+TEST_F(IasSmartX_API_Test, Configuration_Scaling)
+{
+  const uint32_t cBatchSize = 500;
+  auto measureLookups = [cBatchSize](uint32_t numObjects) -> double
+  {
+    IasConfiguration config;
+    std::vector<IasAudioPortPtr> ports;
+    ports.reserve(numObjects);
+    for (uint32_t i = 0; i < numObjects; ++i)
+    {
+      IasAudioPinParamsPtr pinParams = std::make_shared<IasAudioPinParams>();
+      pinParams->name = "pin_" + std::to_string(i);
+      pinParams->numChannels = 2;
+      EXPECT_EQ(IasConfiguration::eIasOk, config.addPin(std::make_shared<IasAudioPin>(pinParams)));
+
+      IasAudioPortParamsPtr portParams = std::make_shared<IasAudioPortParams>();
+      portParams->name = "port_" + std::to_string(i);
+      portParams->id = static_cast<int32_t>(i);
+      portParams->numChannels = 2;
+      portParams->index = 0;
+      portParams->direction = (i % 2 == 0) ? eIasPortDirectionInput : eIasPortDirectionOutput;
+      ports.push_back(std::make_shared<IasAudioPort>(portParams));
+      EXPECT_EQ(IasConfiguration::eIasOk, config.addPort(ports.back()));
+    }
+    EXPECT_EQ(numObjects, config.getPinMap().size());
+    EXPECT_EQ(numObjects, config.getPortMap().size());
+
+    std::vector<std::string> pinNames;
+    std::vector<std::string> portNames;
+    for (uint32_t i = 0; i < numObjects; ++i)
+    {
+      pinNames.push_back("pin_" + std::to_string(i));
+      portNames.push_back("port_" + std::to_string(i));
+    }
+
+    // The batches cycle through the whole topology, both topologies are measured with the same number of batches.
+    double bestBatch = std::numeric_limits<double>::max();
+    for (uint32_t cntBatches = 0; cntBatches < 40; ++cntBatches)
+    {
+      const uint32_t first = (cntBatches * cBatchSize) % numObjects;
+      uint32_t numFound = 0;
+      const auto start = std::chrono::steady_clock::now();
+      for (uint32_t i = first; i < first + cBatchSize; ++i)
+      {
+        IasAudioPinPtr pin;
+        IasAudioPortPtr port;
+        IasAudioPortPtr portById;
+        const bool foundById = (i % 2 == 0) ? (config.getInputPort(static_cast<int32_t>(i), &portById) == IasConfiguration::eIasOk)
+                                            : (config.getOutputPort(static_cast<int32_t>(i), &portById) == IasConfiguration::eIasOk);
+        if ((config.getPinByName(pinNames[i], &pin) == IasConfiguration::eIasOk) &&
+            (config.getPortByName(portNames[i], &port) == IasConfiguration::eIasOk) &&
+            foundById && (port == ports[i]) && (portById == ports[i]))
+        {
+          numFound++;
+        }
+      }
+      const auto end = std::chrono::steady_clock::now();
+      EXPECT_EQ(cBatchSize, numFound);
+      bestBatch = std::min(bestBatch, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    return bestBatch;
+  };
+
+  const double smallTime = measureLookups(1000);
+  const double largeTime = measureLookups(5000);
+  RecordProperty("lookupBatchTime1000ObjectsUs", static_cast<int>(smallTime));
+  RecordProperty("lookupBatchTime5000ObjectsUs", static_cast<int>(largeTime));
+  EXPECT_LT(largeTime, 2.5 * smallTime);
+
+  // Deleting keeps the ordered maps and the lookups consistent
+  IasConfiguration config;
+  IasAudioPinParamsPtr pinParams = std::make_shared<IasAudioPinParams>();
+  pinParams->name = "MyPin";
+  pinParams->numChannels = 2;
+  EXPECT_EQ(IasConfiguration::eIasOk, config.addPin(std::make_shared<IasAudioPin>(pinParams)));
+  config.removePin("MyPin");
+  IasAudioPinPtr pin;
+  EXPECT_EQ(IasConfiguration::eIasObjectNotFound, config.getPinByName("MyPin", &pin));
+  EXPECT_EQ(0u, config.getPinMap().size());
+
+  IasAudioPortParamsPtr portParams = std::make_shared<IasAudioPortParams>();
+  portParams->name = "MyPort";
+  portParams->id = 7;
+  portParams->numChannels = 2;
+  portParams->index = 0;
+  portParams->direction = eIasPortDirectionOutput;
+  EXPECT_EQ(IasConfiguration::eIasOk, config.addPort(std::make_shared<IasAudioPort>(portParams)));
+  config.deleteOutputPort(7);
+  IasAudioPortPtr port;
+  EXPECT_EQ(IasConfiguration::eIasObjectNotFound, config.getPortByName("MyPort", &port));
+  EXPECT_EQ(IasConfiguration::eIasFailed, config.getOutputPort(7, &port));
+  EXPECT_EQ(0u, config.getPortMap().size());
+
+  // A port with an id that is already in use is not added at all
+  EXPECT_EQ(IasConfiguration::eIasOk, config.addPort(std::make_shared<IasAudioPort>(portParams)));
+  IasAudioPortParamsPtr otherParams = std::make_shared<IasAudioPortParams>(*portParams);
+  otherParams->name = "MyOtherPort";
+  EXPECT_EQ(IasConfiguration::eIasFailed, config.addPort(std::make_shared<IasAudioPort>(otherParams)));
+  EXPECT_EQ(IasConfiguration::eIasObjectNotFound, config.getPortByName("MyOtherPort", &port));
+  EXPECT_EQ(1u, config.getPortMap().size());
+  config.deletePortByName("MyPort");
+  EXPECT_EQ(IasConfiguration::eIasObjectNotFound, config.getPortByName("MyPort", &port));
+  EXPECT_EQ(IasConfiguration::eIasOk, config.getOutputPort(7, &port));
+}
+
 TEST_F(IasSmartX_API_Test, add_delete_ports)
 {
   // Create the smartx instance
@@ -2398,6 +2576,196 @@ TEST_F(IasSmartX_API_Test, config_file_runner_specific_enabled)
   EXPECT_EQ(IasConfigFile::eIasDisabled, configFile->getRunnerThreadState("AdditionalOne"));
 }
 
+TEST_F(IasSmartX_API_Test, config_file_thread_roles)
+{
+  setenv("SMARTX_CFG_DIR", std::string(std::string(SMARTX_CONFIG_DIR) + "thread_roles").c_str(), true);
+  IasConfigFile *configFile = IasConfigFile::getInstance();
+  ASSERT_TRUE(configFile != nullptr);
+  configFile->load();
+  EXPECT_EQ(SCHED_FIFO, configFile->getSchedPolicy());
+  EXPECT_EQ(30u, configFile->getSchedPriority());
+  EXPECT_EQ(4u, configFile->getCpuAffinities().size());
+
+  // Base zone overrides priority and affinity, policy is taken from the global params
+  IasConfigFile::IasThreadSchedulingParams params = configFile->getThreadSchedulingParams(IasConfigFile::eIasThreadRoleBaseZone, "MyBaseZone");
+  EXPECT_EQ(SCHED_FIFO, params.policy);
+  EXPECT_EQ(40u, params.priority);
+  ASSERT_EQ(1u, params.cpuAffinities.size());
+  EXPECT_EQ(1u, params.cpuAffinities[0]);
+
+  // Runner overrides affinity only, the priority is one less than the global priority
+  params = configFile->getThreadSchedulingParams(IasConfigFile::eIasThreadRoleRunner, "MyBaseZone.psm4", eIasPriorityOneLess);
+  EXPECT_EQ(SCHED_FIFO, params.policy);
+  EXPECT_EQ(29u, params.priority);
+  ASSERT_EQ(1u, params.cpuAffinities.size());
+  EXPECT_EQ(3u, params.cpuAffinities[0]);
+
+  // ALSA handler priority is out of range and therefore ignored
+  params = configFile->getThreadSchedulingParams(IasConfigFile::eIasThreadRoleAlsaHandler, "MyAlsaDevice");
+  EXPECT_EQ(SCHED_RR, params.policy);
+  EXPECT_EQ(30u, params.priority);
+  EXPECT_EQ(2u, params.cpuAffinities.size());
+
+  // Helper pool policy is invalid and therefore ignored
+  params = configFile->getThreadSchedulingParams(IasConfigFile::eIasThreadRoleHelperPool, "MyPool");
+  EXPECT_EQ(SCHED_FIFO, params.policy);
+  EXPECT_EQ(25u, params.priority);
+  EXPECT_EQ(4u, params.cpuAffinities.size());
+
+  // Unknown names and the same name with a different role use the global params
+  params = configFile->getThreadSchedulingParams(IasConfigFile::eIasThreadRoleBaseZone, "MyBaseZone.psm4");
+  EXPECT_EQ(SCHED_FIFO, params.policy);
+  EXPECT_EQ(30u, params.priority);
+  EXPECT_EQ(4u, params.cpuAffinities.size());
+
+  // A runner thread for another period size multiple of the same base zone uses the global params
+  params = configFile->getThreadSchedulingParams(IasConfigFile::eIasThreadRoleRunner, "MyBaseZone.psm2", eIasPriorityOneLess);
+  EXPECT_EQ(29u, params.priority);
+  EXPECT_EQ(4u, params.cpuAffinities.size());
+
+  DltContext *logCtx = IasAudioLogging::registerDltContext("TST", "Test Context");
+  setShallFail = false;
+  getShallFail = false;
+  setAffinityShallFail = false;
+  IasConfigFile::configureThreadSchedulingParameters(logCtx, IasConfigFile::eIasThreadRoleBaseZone, "MyBaseZone");
+  IasConfigFile::configureThreadSchedulingParameters(logCtx, IasConfigFile::eIasThreadRoleRunner, "MyBaseZone.psm4", eIasPriorityOneLess);
+}
+
+/**
+ * With startup.threads > 1, the routing zones and source devices are started by a pool of threads.
+ * The result has to be the same as with the serial start: every routing zone is active and every
+ * source device can be connected.
+ */
+TEST_F(IasSmartX_API_Test, startup_threads)
+{
+  setenv("SMARTX_CFG_DIR", std::string(std::string(SMARTX_CONFIG_DIR) + "startup_threads").c_str(), true);
+  IasSmartX *smartx = IasSmartX::create();
+  ASSERT_TRUE(smartx != nullptr);
+  EXPECT_EQ(4u, IasConfigFile::getInstance()->getStartupThreads());
+  IasISetup *setup = smartx->setup();
+  ASSERT_TRUE(setup != nullptr);
+
+  // More zones and sources than threads, so that each thread has to start several of them
+  const uint32_t cNumZones = 6;
+  const uint32_t cNumSources = 6;
+  std::vector<IasRoutingZonePtr> routingZones;
+  for (uint32_t index = 0; index < cNumZones; ++index)
+  {
+    IasAudioDeviceParams sinkParams =
+    {
+      "startupSink" + std::to_string(index),
+      2,
+      48000,
+      eIasFormatInt16,
+      eIasClockReceived,
+      192,
+      4
+    };
+    IasAudioSinkDevicePtr sink = nullptr;
+    IasRoutingZonePtr routingZone = nullptr;
+    ASSERT_EQ(IasISetup::eIasOk, IasSetupHelper::createAudioSinkDevice(setup, sinkParams, 200 + index, &sink, &routingZone));
+    ASSERT_TRUE(routingZone != nullptr);
+    routingZones.push_back(routingZone);
+  }
+  for (uint32_t index = 0; index < cNumSources; ++index)
+  {
+    IasAudioDeviceParams sourceParams =
+    {
+      "startupSource" + std::to_string(index),
+      2,
+      48000,
+      eIasFormatInt16,
+      eIasClockProvided,
+      192,
+      4
+    };
+    IasAudioSourceDevicePtr source = nullptr;
+    ASSERT_EQ(IasISetup::eIasOk, IasSetupHelper::createAudioSourceDevice(setup, sourceParams, 300 + index, &source));
+  }
+
+  EXPECT_EQ(IasSmartX::eIasOk, smartx->start());
+  for (auto &routingZone : routingZones)
+  {
+    EXPECT_TRUE(routingZone->isActive());
+  }
+  for (uint32_t index = 0; index < cNumSources; ++index)
+  {
+    EXPECT_EQ(IasIRouting::eIasOk, smartx->routing()->connect(300 + index, 200 + (index % cNumZones)));
+  }
+  for (uint32_t index = 0; index < cNumSources; ++index)
+  {
+    EXPECT_EQ(IasIRouting::eIasOk, smartx->routing()->disconnect(300 + index, 200 + (index % cNumZones)));
+  }
+
+  EXPECT_EQ(IasSmartX::eIasOk, smartx->stop());
+  for (auto &routingZone : routingZones)
+  {
+    EXPECT_FALSE(routingZone->isActive());
+  }
+  IasSmartX::destroy(smartx);
+  unsetenv("SMARTX_CFG_DIR");
+}
+
+/**
+ * With startup.preload_plugins enabled, the plug-in libraries are loaded in the background. Creating a pipeline
+ * waits for them and fails, if no plug-in library could be loaded.
+ */
+TEST_F(IasSmartX_API_Test, startup_preload_plugins)
+{
+  setenv("SMARTX_CFG_DIR", std::string(std::string(SMARTX_CONFIG_DIR) + "preload_plugins").c_str(), true);
+  IasPipelineParams pipelineParams;
+  pipelineParams.name = "MyPipeline";
+  pipelineParams.periodSize = 192;
+  pipelineParams.samplerate = 48000;
+
+  // The plug-in libraries are loaded while the modules are created
+  setenv("AUDIO_PLUGIN_DIR", AUDIO_PLUGIN_DIR, true);
+  IasSmartX *smartx = IasSmartX::create();
+  ASSERT_TRUE(smartx != nullptr);
+  EXPECT_EQ(IasConfigFile::eIasEnabled, IasConfigFile::getInstance()->getPreloadPlugins());
+  IasISetup *setup = smartx->setup();
+  ASSERT_TRUE(setup != nullptr);
+  IasProcessingModuleParams moduleParams;
+  moduleParams.typeName = "ias.volume";
+  moduleParams.instanceName = "MyVolume";
+  IasProcessingModulePtr volume = nullptr;
+  ASSERT_EQ(IasISetup::eIasOk, setup->createProcessingModule(moduleParams, &volume));
+  IasProperties volumeProperties;
+  volumeProperties.set<int32_t>("numFilterBands", 3);
+  setup->setProperties(volume, volumeProperties);
+  IasPipelinePtr pipeline = nullptr;
+  ASSERT_EQ(IasISetup::eIasOk, setup->createPipeline(pipelineParams, &pipeline));
+  ASSERT_TRUE(pipeline != nullptr);
+  EXPECT_EQ(IasISetup::eIasOk, setup->addProcessingModule(pipeline, volume));
+
+  // The second pipeline uses the plugin engine loaded in the background as well
+  IasPipelineParams secondPipelineParams = pipelineParams;
+  secondPipelineParams.name = "MySecondPipeline";
+  IasPipelinePtr secondPipeline = nullptr;
+  EXPECT_EQ(IasISetup::eIasOk, setup->createPipeline(secondPipelineParams, &secondPipeline));
+  setup->destroyPipeline(&secondPipeline);
+  setup->destroyPipeline(&pipeline);
+  IasSmartX::destroy(smartx);
+
+  // A failed background load is reported by createPipeline
+  setenv("AUDIO_PLUGIN_DIR", "/nonexisting", true);
+  smartx = IasSmartX::create();
+  ASSERT_TRUE(smartx != nullptr);
+  setup = smartx->setup();
+  ASSERT_TRUE(setup != nullptr);
+  pipeline = nullptr;
+  EXPECT_EQ(IasISetup::eIasFailed, setup->createPipeline(pipelineParams, &pipeline));
+  EXPECT_EQ(nullptr, pipeline);
+  IasSmartX::destroy(smartx);
+
+  // Destroying the SmartX instance while the plug-in libraries are loaded waits for the background thread
+  setenv("AUDIO_PLUGIN_DIR", AUDIO_PLUGIN_DIR, true);
+  smartx = IasSmartX::create();
+  ASSERT_TRUE(smartx != nullptr);
+  IasSmartX::destroy(smartx);
+  unsetenv("SMARTX_CFG_DIR");
+}
+
 TEST_F(IasSmartX_API_Test, config_file_set_sched_params_too_long)
 {
   DltContext *logCtx = IasAudioLogging::registerDltContext("TST", "Test Context");
@@ -2542,6 +2910,107 @@ TEST_F(IasSmartX_API_Test, debug_api_fail_probing)
   dbgRes = debug->stopProbing("non_existing");
   EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
 
+  IasIDebug::IasLatencyResult latencyResult;
+  dbgRes = debug->getLatencyProbeResult(&latencyResult);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->stopLatencyProbe();
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startLatencyProbe("MySource_port", "non_existing", 10);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startLatencyProbe(sinkPortName, sinkRzPortName, 10);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startLatencyProbe("MySource_port", sinkRzPortName, 0);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+
+  dbgRes = debug->startLatencyProbe("MySource_port", sinkRzPortName, 10);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->startLatencyProbe("MySource_port", sinkPortName, 10);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->getLatencyProbeResult(&latencyResult);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  EXPECT_LE(latencyResult.numMeasurements + latencyResult.numMissed, 10u);
+  dbgRes = debug->stopLatencyProbe();
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+
+  dbgRes = debug->startLatencyProbe("MySource_port", sinkPortName, 10);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->stopLatencyProbe();
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->getLatencyProbeResult(&latencyResult);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+
+  IasIDebug::IasStreamProbeStatistics streamStatistics;
+  dbgRes = debug->getStreamRecordStatistics("MySource_port", &streamStatistics);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->stopStreamRecord("MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startStreamRecord("probe_stream", "non_existing");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startStreamRecord("", "MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+
+  dbgRes = debug->startStreamRecord("probe_stream", "MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->startStreamRecord("probe_stream_2", "MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startStreamRecord("probe_stream", sinkPortName);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startStreamRecord("probe_stream_2", sinkPortName);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->getStreamRecordStatistics("MySource_port", &streamStatistics);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->getStreamRecordStatistics("MySource_port", nullptr);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->stopStreamRecord("MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->stopStreamRecord(sinkPortName);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->stopStreamRecord(sinkPortName);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+
+  IasIDebug::IasMultiPointHeader multiPointHeader;
+  dbgRes = debug->getMultiPointRecordHeader("multi_stream", &multiPointHeader);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->stopMultiPointRecord("multi_stream");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startMultiPointRecord("multi_stream", {});
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startMultiPointRecord("", {"MySource_port", sinkPortName});
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startMultiPointRecord("multi_stream", {"MySource_port", "non_existing"});
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startMultiPointRecord("multi_stream", {"MySource_port", "MySource_port"});
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+
+  dbgRes = debug->startMultiPointRecord("multi_stream", {"MySource_port", sinkPortName});
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->startMultiPointRecord("multi_stream", {sinkRzPortName});
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startStreamRecord("probe_stream", "MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->stopStreamRecord("MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->getMultiPointRecordHeader("multi_stream", &multiPointHeader);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  EXPECT_EQ("multi_stream", multiPointHeader.streamName);
+  ASSERT_EQ(2u, multiPointHeader.points.size());
+  EXPECT_EQ("MySource_port", multiPointHeader.points[0].name);
+  EXPECT_EQ(0u, multiPointHeader.points[0].firstChannel);
+  EXPECT_EQ(multiPointHeader.points[0].numChannels, multiPointHeader.points[1].firstChannel);
+  EXPECT_EQ(multiPointHeader.numChannels, multiPointHeader.points[0].numChannels + multiPointHeader.points[1].numChannels);
+  dbgRes = debug->getMultiPointRecordStatistics("multi_stream", &streamStatistics);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->getMultiPointRecordStatistics("multi_stream", nullptr);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->stopMultiPointRecord("multi_stream");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->stopMultiPointRecord("multi_stream");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->startStreamRecord("probe_stream", "MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  dbgRes = debug->stopStreamRecord("MySource_port");
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+
   rznRes = routingZone->stop();
   EXPECT_EQ(IasRoutingZone::eIasOk, rznRes);
 
@@ -2657,6 +3126,28 @@ TEST_F(IasSmartX_API_Test, debug_api_mutex_decorator_fail_probing)
   dbgRes = debug->stopProbing("non_existing");
   EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
 
+  std::vector<IasIDebug::IasLockStatistics> lockStatistics;
+  dbgRes = debug->getLockStatistics(nullptr);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->getLockStatistics(&lockStatistics);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  ASSERT_EQ(4u, lockStatistics.size());
+  EXPECT_EQ("debug", lockStatistics[3].domain);
+  EXPECT_LT(0u, lockStatistics[3].numExclusive);
+  EXPECT_LE(lockStatistics[3].maxHoldTimeNs, lockStatistics[3].totalHoldTimeNs);
+
+  std::vector<IasIDebug::IasBufferPoolStatistics> bufferPoolStatistics;
+  dbgRes = debug->getBufferPoolStatistics(nullptr);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasFailed);
+  dbgRes = debug->getBufferPoolStatistics(&bufferPoolStatistics);
+  EXPECT_EQ(dbgRes, IasIDebug::eIasOk);
+  EXPECT_LT(0u, bufferPoolStatistics.size());
+  for (const auto &entry : bufferPoolStatistics)
+  {
+    EXPECT_LE(entry.numInUse, entry.numBuffers);
+    EXPECT_LE(entry.highWaterMark, entry.numBuffers);
+  }
+
   rznRes = routingZone->stop();
   EXPECT_EQ(IasRoutingZone::eIasOk, rznRes);
 
@@ -4261,5 +4752,52 @@ TEST_F(IasSmartX_API_Test, test_TC1_5_4_1_100)
 
   IasSmartX::destroy(smartx);
 }
+
+TEST_F(IasSmartX_API_Test, event_coalescing)
+{
+  IasEventProvider *eventProvider = IasEventProvider::getInstance();
+  ASSERT_TRUE(eventProvider != nullptr);
+  eventProvider->clearEventQueue();
+  uint64_t numCoalesced = eventProvider->getNumCoalescedEvents();
+
+  // Identical events are dropped as long as the first one was not received.
+  for (uint32_t count = 0; count < 1000; ++count)
+  {
+    IasSetupEventPtr event = eventProvider->createSetupEvent();
+    ASSERT_TRUE(event != nullptr);
+    event->setEventType(IasSetupEvent::eIasUnrecoverableSinkDeviceError);
+    eventProvider->send(event);
+  }
+  EXPECT_EQ(numCoalesced + 999, eventProvider->getNumCoalescedEvents());
+
+  // A different event in between is delivered, and so is the following repetition of the first event.
+  IasConnectionEventPtr connectionEvent = eventProvider->createConnectionEvent();
+  connectionEvent->setEventType(IasConnectionEvent::eIasConnectionEstablished);
+  eventProvider->send(connectionEvent);
+  IasSetupEventPtr setupEvent = eventProvider->createSetupEvent();
+  setupEvent->setEventType(IasSetupEvent::eIasUnrecoverableSinkDeviceError);
+  eventProvider->send(setupEvent);
+
+  IasEventPtr receivedEvent;
+  EXPECT_EQ(IasEventProvider::eIasOk, eventProvider->waitForEvent(100));
+  EXPECT_EQ(IasEventProvider::eIasOk, eventProvider->getNextEvent(&receivedEvent));
+  EXPECT_TRUE(std::dynamic_pointer_cast<IasSetupEvent>(receivedEvent) != nullptr);
+  EXPECT_EQ(IasEventProvider::eIasOk, eventProvider->waitForEvent(100));
+  EXPECT_EQ(IasEventProvider::eIasOk, eventProvider->getNextEvent(&receivedEvent));
+  EXPECT_TRUE(std::dynamic_pointer_cast<IasConnectionEvent>(receivedEvent) != nullptr);
+  EXPECT_EQ(IasEventProvider::eIasOk, eventProvider->waitForEvent(100));
+  EXPECT_EQ(IasEventProvider::eIasOk, eventProvider->getNextEvent(&receivedEvent));
+  EXPECT_TRUE(std::dynamic_pointer_cast<IasSetupEvent>(receivedEvent) != nullptr);
+  EXPECT_EQ(IasEventProvider::eIasTimeout, eventProvider->waitForEvent(1));
+  EXPECT_EQ(IasEventProvider::eIasNoEventAvailable, eventProvider->getNextEvent(&receivedEvent));
+
+  // After the event was received, the same event is delivered again.
+  setupEvent = eventProvider->createSetupEvent();
+  setupEvent->setEventType(IasSetupEvent::eIasUnrecoverableSinkDeviceError);
+  eventProvider->send(setupEvent);
+  EXPECT_EQ(IasEventProvider::eIasOk, eventProvider->waitForEvent(100));
+  EXPECT_EQ(IasEventProvider::eIasOk, eventProvider->getNextEvent(&receivedEvent));
+  eventProvider->clearEventQueue();
+}
 }
 
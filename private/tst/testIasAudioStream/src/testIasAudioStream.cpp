@@ -14,6 +14,7 @@
 #include <string.h>
 #include <iostream>
 #include <cstdlib>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "audio/smartx/rtprocessingfwx/IasAudioStream.hpp"
@@ -22,6 +23,7 @@
 
 #include "audio/smartx/rtprocessingfwx/IasSimpleAudioStream.hpp"
 #include "rtprocessingfwx/IasAudioBufferPoolHandler.hpp"
+#include "rtprocessingfwx/IasSampleLayoutConverter.hpp"
 
 /*
  *  Set PROFILE to 1 to enable perf measurement
@@ -316,3 +318,147 @@ TEST_F(IasAudioStreamTest, test1)
   printf("Test has been passed.\n");
   fflush(stdout);
 }
+
+/**
+ * Fill a buffer with random bit patterns, which also includes NaNs and denormals.
+ */
+static void fillRandomBits(std::vector<float> &buffer)
+{
+  for (auto &sample : buffer)
+  {
+    uint32_t bits = (static_cast<uint32_t>(rand()) << 16) ^ static_cast<uint32_t>(rand());
+    memcpy(&sample, &bits, sizeof(bits));
+  }
+}
+
+TEST_F(IasAudioStreamTest, layout_conversion_bit_exact)
+{
+  const uint32_t cFrameLengths[] = { 1, 3, 4, 7, 8, 13, 64, 67 };
+  for (uint32_t numChannels = 1; numChannels <= 9; ++numChannels)
+  {
+    for (uint32_t numFrames : cFrameLengths)
+    {
+      // Use a stride with gaps and misaligned buffers to cover the unaligned loads and stores.
+      uint32_t stride = numChannels + 3;
+      std::vector<float> strided(stride * numFrames + 1);
+      std::vector<float> reference(stride * numFrames + 1);
+      std::vector<float> nonInterleaved(numChannels * numFrames + 1);
+      std::vector<float> result(numChannels * numFrames + 1);
+      std::vector<const float*> sourceChannels;
+      std::vector<float*> resultChannels;
+      for (uint32_t channel = 0; channel < numChannels; ++channel)
+      {
+        sourceChannels.push_back(&nonInterleaved[1 + channel * numFrames]);
+        resultChannels.push_back(&result[1 + channel * numFrames]);
+      }
+
+      fillRandomBits(nonInterleaved);
+      fillRandomBits(strided);
+      reference = strided;
+      for (uint32_t channel = 0; channel < numChannels; ++channel)
+      {
+        for (uint32_t frame = 0; frame < numFrames; ++frame)
+        {
+          reference[1 + frame * stride + channel] = sourceChannels[channel][frame];
+        }
+      }
+      IasSampleLayoutConverter::interleave(sourceChannels.data(), numChannels, &strided[1], stride, numFrames);
+      ASSERT_EQ(0, memcmp(reference.data(), strided.data(), sizeof(float) * strided.size())) << numChannels << " channels, " << numFrames << " frames";
+
+      fillRandomBits(result);
+      IasSampleLayoutConverter::deinterleave(&strided[1], stride, resultChannels.data(), numChannels, numFrames);
+      ASSERT_EQ(0, memcmp(&nonInterleaved[1], &result[1], sizeof(float) * numChannels * numFrames)) << numChannels << " channels, " << numFrames << " frames";
+
+      // Copy into the dense interleaved layout and back into the strided layout.
+      fillRandomBits(result);
+      IasSampleLayoutConverter::copyStrided(&strided[1], stride, &result[1], numChannels, numChannels, numFrames);
+      for (uint32_t channel = 0; channel < numChannels; ++channel)
+      {
+        for (uint32_t frame = 0; frame < numFrames; ++frame)
+        {
+          ASSERT_EQ(0, memcmp(&sourceChannels[channel][frame], &result[1 + frame * numChannels + channel], sizeof(float)));
+        }
+      }
+      fillRandomBits(strided);
+      reference = strided;
+      for (uint32_t channel = 0; channel < numChannels; ++channel)
+      {
+        for (uint32_t frame = 0; frame < numFrames; ++frame)
+        {
+          reference[1 + frame * stride + channel] = result[1 + frame * numChannels + channel];
+        }
+      }
+      IasSampleLayoutConverter::copyStrided(&result[1], numChannels, &strided[1], stride, numChannels, numFrames);
+      ASSERT_EQ(0, memcmp(reference.data(), strided.data(), sizeof(float) * strided.size())) << numChannels << " channels, " << numFrames << " frames";
+    }
+  }
+}
+
+TEST_F(IasAudioStreamTest, stream_conversion_bit_exact)
+{
+  IasAudioBufferPoolHandler ringBufferPoolHandler;
+
+  IasAudioChain *myAudioChain = new IasAudioChain();
+  ASSERT_TRUE(myAudioChain != nullptr);
+  IasAudioChain::IasInitParams initParams;
+  initParams.periodSize = cIasFrameLength;
+  initParams.sampleRate = cIasSampleRate;
+  ASSERT_EQ(IasAudioChain::eIasOk, myAudioChain->init(initParams));
+
+  // The first stream leaves two channels of its second bundle free, so the second stream starts
+  // in the middle of a bundle and spans three bundles.
+  IasAudioStream *hSink1 = myAudioChain->createInputAudioStream("Sink1", 1, 6, false);
+  IasAudioStream *hSink2 = myAudioChain->createInputAudioStream("Sink2", 2, 7, false);
+  ASSERT_TRUE(hSink1 != nullptr);
+  ASSERT_TRUE(hSink2 != nullptr);
+  const uint32_t cNumChannels = 7;
+
+  std::vector<float> input(cNumChannels * cIasFrameLength);
+  std::vector<float> output(cNumChannels * cIasFrameLength);
+  std::vector<float> interleaved(cNumChannels * cIasFrameLength);
+  IasAudioFrame inputFrame;
+  IasAudioFrame outputFrame;
+  for (uint32_t channel = 0; channel < cNumChannels; ++channel)
+  {
+    inputFrame.push_back(&input[channel * cIasFrameLength]);
+    outputFrame.push_back(&output[channel * cIasFrameLength]);
+  }
+  fillRandomBits(input);
+
+  // bundled => interleaved => non-interleaved => bundled => interleaved
+  ASSERT_EQ(eIasAudioProcOK, hSink2->asBundledStream()->writeFromNonInterleaved(inputFrame));
+  IasSimpleAudioStream *interleavedStream = hSink2->asInterleavedStream();
+  float *interleavedData = interleavedStream->getAudioBuffers()[0];
+  for (uint32_t channel = 0; channel < cNumChannels; ++channel)
+  {
+    for (uint32_t frame = 0; frame < cIasFrameLength; ++frame)
+    {
+      ASSERT_EQ(0, memcmp(&inputFrame[channel][frame], &interleavedData[frame * cNumChannels + channel], sizeof(float)));
+    }
+  }
+  memcpy(interleaved.data(), interleavedData, sizeof(float) * interleaved.size());
+
+  hSink2->asNonInterleavedStream()->copyToOutputAudioChannels(outputFrame);
+  ASSERT_EQ(0, memcmp(input.data(), output.data(), sizeof(float) * input.size()));
+
+  fillRandomBits(output);
+  hSink2->asBundledStream()->read(outputFrame);
+  ASSERT_EQ(0, memcmp(input.data(), output.data(), sizeof(float) * input.size()));
+
+  fillRandomBits(output);
+  ASSERT_EQ(eIasAudioProcOK, hSink2->asBundledStream()->read(output.data()));
+  ASSERT_EQ(0, memcmp(interleaved.data(), output.data(), sizeof(float) * output.size()));
+
+  fillRandomBits(output);
+  hSink2->asInterleavedStream()->copyToOutputAudioChannels(outputFrame);
+  ASSERT_EQ(0, memcmp(input.data(), output.data(), sizeof(float) * input.size()));
+
+  // interleaved => bundled
+  fillRandomBits(input);
+  ASSERT_EQ(eIasAudioProcOK, hSink2->asInterleavedStream()->writeFromNonInterleaved(inputFrame));
+  fillRandomBits(output);
+  hSink2->asBundledStream()->read(outputFrame);
+  ASSERT_EQ(0, memcmp(input.data(), output.data(), sizeof(float) * input.size()));
+
+  delete(myAudioChain);
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/**
+ * @file   IasTestFrameworkAllocationCounter.cpp
+ * @date   2018
+ * @brief  Counting of heap allocations for the benchmark mode of the test framework.
+ *
+ * Replaces the global operators new and delete of the executable it is linked into.
+ */
+
+#include <cstdlib>
+#include <new>
+
+#include "testfwx/IasTestFrameworkAllocationCounter.hpp"
+
+
+namespace IasAudio {
+
+static thread_local uint64_t sNumThreadAllocations = 0;
+
+uint64_t getNumThreadAllocations()
+{
+  return sNumThreadAllocations;
+}
+
+static void* countedAlloc(std::size_t size)
+{
+  void *ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr != nullptr)
+  {
+    ++sNumThreadAllocations;
+  }
+  return ptr;
+}
+
+} // namespace IasAudio
+
+
+void* operator new(std::size_t size)
+{
+  void *ptr = IasAudio::countedAlloc(size);
+  if (ptr == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return IasAudio::countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return IasAudio::countedAlloc(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
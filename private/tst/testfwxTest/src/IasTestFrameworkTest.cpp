@@ -1227,4 +1227,103 @@ TEST_F(IasTestFrameworkTest, start_process_and_stop_test_framework_invalid_cases
   IasTestFramework::destroy(testfwx);
 }
 
+static IasTestFramework::IasResult setupBenchmarkPipeline(IasTestFramework *testfwx, uint32_t instanceIndex)
+{
+  IasTestFrameworkSetup *setup = testfwx->setup();
+  IasProcessingModulePtr module = nullptr;
+  IasAudioPinPtr moduleInOutPin = nullptr;
+  IasAudioPinPtr pipelineInputPin = nullptr;
+  IasAudioPinPtr pipelineOutputPin = nullptr;
+  IasTestFrameworkWaveFileParams outputFileParams("output_benchmark_" + std::to_string(instanceIndex) + ".wav");
+  IasProperties volumeProperties;
+  volumeProperties.set("numFilterBands", 3);
+
+  if (setup->createProcessingModule(moduleParams, &module) != IasTestFrameworkSetup::eIasOk ||
+      setup->createAudioPin(moduleInOutPinParams, &moduleInOutPin) != IasTestFrameworkSetup::eIasOk ||
+      setup->createAudioPin(pipelineInputPinParams1, &pipelineInputPin) != IasTestFrameworkSetup::eIasOk ||
+      setup->createAudioPin(pipelineOutputPinParams1, &pipelineOutputPin) != IasTestFrameworkSetup::eIasOk)
+  {
+    return IasTestFramework::eIasFailed;
+  }
+  setup->setProperties(module, volumeProperties);
+  if (setup->addAudioInputPin(pipelineInputPin) != IasTestFrameworkSetup::eIasOk ||
+      setup->linkWaveFile(pipelineInputPin, inputWaveFileParams) != IasTestFrameworkSetup::eIasOk ||
+      setup->addAudioOutputPin(pipelineOutputPin) != IasTestFrameworkSetup::eIasOk ||
+      setup->linkWaveFile(pipelineOutputPin, outputFileParams) != IasTestFrameworkSetup::eIasOk ||
+      setup->addProcessingModule(module) != IasTestFrameworkSetup::eIasOk ||
+      setup->addAudioInOutPin(module, moduleInOutPin) != IasTestFrameworkSetup::eIasOk ||
+      setup->link(pipelineInputPin, moduleInOutPin, eIasAudioPinLinkTypeImmediate) != IasTestFrameworkSetup::eIasOk ||
+      setup->link(moduleInOutPin, pipelineOutputPin, eIasAudioPinLinkTypeImmediate) != IasTestFrameworkSetup::eIasOk)
+  {
+    return IasTestFramework::eIasFailed;
+  }
+  return IasTestFramework::eIasOk;
+}
+
+
+TEST_F(IasTestFrameworkTest, benchmark_test)
+{
+  const uint32_t numPeriods = 1000;
+
+  // single instance, created by the application
+  IasTestFramework *testfwx = IasTestFramework::create(pipelineParams);
+  ASSERT_TRUE(testfwx != nullptr);
+  ASSERT_EQ(IasTestFramework::eIasOk, setupBenchmarkPipeline(testfwx, 0));
+
+  IasBenchmarkResult result;
+  IasTestFramework::IasResult testfwx_result = testfwx->benchmark(numPeriods, &result);
+  ASSERT_EQ(IasTestFramework::eIasFailed, testfwx_result); // not started yet
+  ASSERT_EQ(IasTestFramework::eIasOk, testfwx->start());
+  testfwx_result = testfwx->benchmark(numPeriods, nullptr);
+  ASSERT_EQ(IasTestFramework::eIasNullPointer, testfwx_result);
+  testfwx_result = testfwx->benchmark(numPeriods, &result);
+  ASSERT_EQ(IasTestFramework::eIasOk, testfwx_result);
+  EXPECT_EQ(1u, result.numInstances);
+  EXPECT_EQ(numPeriods, result.numPeriods);
+  EXPECT_EQ(static_cast<uint64_t>(numPeriods) * cIasFrameLength * 1000000000ull / cIasSampleRate, result.audioTimeNs);
+  EXPECT_GT(result.processTimeNs, 0u);
+  EXPECT_GT(result.realtimeFactor, 0.0f);
+  ASSERT_EQ(1u, result.moduleTimes.size());
+  EXPECT_EQ(moduleParams.instanceName, result.moduleTimes[0].instanceName);
+  EXPECT_GT(result.moduleTimes[0].processTimeNs, 0u);
+  EXPECT_LE(result.moduleTimes[0].processTimeNs, result.processTimeNs);
+  EXPECT_TRUE(result.allocationsCounted);
+  RecordProperty("singleInstanceRealtimeFactor", std::to_string(result.realtimeFactor));
+  RecordProperty("singleInstanceAllocations", std::to_string(result.numAllocations));
+
+  // concurrent instances are not possible while an application instance exists
+  IasBenchmarkParams benchmarkParams(numPeriods, 2);
+  testfwx_result = IasTestFramework::benchmark(pipelineParams, setupBenchmarkPipeline, benchmarkParams, &result);
+  ASSERT_EQ(IasTestFramework::eIasFailed, testfwx_result);
+  ASSERT_EQ(IasTestFramework::eIasOk, testfwx->stop());
+  IasTestFramework::destroy(testfwx);
+
+  // concurrent instances
+  testfwx_result = IasTestFramework::benchmark(pipelineParams, setupBenchmarkPipeline, benchmarkParams, nullptr);
+  ASSERT_EQ(IasTestFramework::eIasNullPointer, testfwx_result);
+  testfwx_result = IasTestFramework::benchmark(pipelineParams, setupBenchmarkPipeline, IasBenchmarkParams(0, 2), &result);
+  ASSERT_EQ(IasTestFramework::eIasFailed, testfwx_result);
+  // the instances belong to the benchmark, the setup function can neither create another one nor destroy them
+  auto setupGuardedPipeline = [](IasTestFramework *instance, uint32_t instanceIndex) {
+    EXPECT_TRUE(IasTestFramework::create(pipelineParams) == nullptr);
+    IasTestFramework::destroy(instance);
+    return setupBenchmarkPipeline(instance, instanceIndex);
+  };
+  testfwx_result = IasTestFramework::benchmark(pipelineParams, setupGuardedPipeline, benchmarkParams, &result);
+  ASSERT_EQ(IasTestFramework::eIasOk, testfwx_result);
+  EXPECT_EQ(2u, result.numInstances);
+  EXPECT_EQ(numPeriods, result.numPeriods);
+  EXPECT_GT(result.realtimeFactor, 0.0f);
+  ASSERT_EQ(1u, result.moduleTimes.size());
+  EXPECT_GT(result.moduleTimes[0].processTimeNs, 0u);
+  EXPECT_TRUE(result.allocationsCounted);
+  RecordProperty("twoInstancesRealtimeFactor", std::to_string(result.realtimeFactor));
+  RecordProperty("twoInstancesAllocations", std::to_string(result.numAllocations));
+
+  // the test framework can be created again afterwards
+  testfwx = IasTestFramework::create(pipelineParams);
+  ASSERT_TRUE(testfwx != nullptr);
+  IasTestFramework::destroy(testfwx);
+}
+
 } //namespace IasAudio
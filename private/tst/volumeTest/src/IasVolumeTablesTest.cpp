@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2018 Intel Corporation.All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+*/
+/*
+ * IasVolumeTablesTest.cpp
+ *
+ *  Created 2018
+ */
+
+#include <math.h>
+#include <gtest/gtest.h>
+#include "volume/IasVolumeLoudnessCore.hpp"
+#include "volume/IasVolumeHelper.hpp"
+
+using namespace IasAudio;
+
+namespace IasAudio
+{
+
+static const float cIasMaxRelativeError = 1.0e-5f;
+
+/**
+ * @brief Reference of the loudness gain, interpolated in [dB/10] between the data points of the table
+ */
+static double referenceLoudnessGain(int32_t volume, const IasVolumeLoudnessTable &table)
+{
+  double gainDb = table.gains.back();
+  if (volume >= table.volumes.front())
+  {
+    gainDb = table.gains.front();
+  }
+  else
+  {
+    for (uint32_t index = 1; index < table.volumes.size(); ++index)
+    {
+      if (volume >= table.volumes[index])
+      {
+        double coeff = static_cast<double>(table.volumes[index-1] - volume) / static_cast<double>(table.volumes[index-1] - table.volumes[index]);
+        gainDb = table.gains[index-1] + coeff * static_cast<double>(table.gains[index] - table.gains[index-1]);
+        break;
+      }
+    }
+  }
+  return pow(10.0, gainDb / 200.0);
+}
+
+/**
+ * @brief Reference of the sdv gain in [dB/10], interpolated between the data points of the table
+ */
+static double referenceSDVGainDb(uint32_t speed, const IasVolumeSDVTable &table, const std::vector<uint32_t> &gains)
+{
+  if (speed <= table.speed.front())
+  {
+    return 0.0;
+  }
+  for (uint32_t index = 1; index < table.speed.size(); ++index)
+  {
+    if (speed < table.speed[index])
+    {
+      double coeff = static_cast<double>(speed - table.speed[index-1]) / static_cast<double>(table.speed[index] - table.speed[index-1]);
+      return gains[index-1] + coeff * static_cast<double>(gains[index] - gains[index-1]);
+    }
+  }
+  return gains.back();
+}
+
+static void expectNear(double expected, float actual)
+{
+  EXPECT_NEAR(expected, actual, expected * cIasMaxRelativeError);
+}
+
+TEST(IasVolumeTablesTest, loudnessGainTableMatchesReference)
+{
+  IasVolumeLoudnessTable table;
+  IasVolumeHelper::getDefaultLoudnessTable(table);
+  IasVolumeLoudnessGainTable gainTable;
+  IasVolumeHelper::buildLoudnessGainTable(table, &gainTable);
+  for (int32_t volume = cIasMinLoudnessVolume; volume <= 100; ++volume)
+  {
+    expectNear(referenceLoudnessGain(volume, table), IasVolumeHelper::getLoudnessGain(volume, gainTable));
+  }
+
+  IasVolumeLoudnessGainTable emptyGainTable;
+  IasVolumeLoudnessTable emptyTable;
+  IasVolumeHelper::buildLoudnessGainTable(emptyTable, &emptyGainTable);
+  EXPECT_EQ(1.0f, IasVolumeHelper::getLoudnessGain(-200, emptyGainTable));
+}
+
+TEST(IasVolumeTablesTest, sdvGainTableMatchesReference)
+{
+  IasVolumeSDVTable table;
+  IasVolumeHelper::getDefaultSDVTable(table);
+  // Add a data point beyond the precomputed range.
+  table.speed.push_back(cIasMaxSDVGainTableSpeed + 200);
+  table.gain_inc.push_back(table.gain_inc.back() + 20);
+  table.gain_dec.push_back(table.gain_dec.back() + 20);
+  IasVolumeSDVGainTable gainTable;
+  IasVolumeHelper::buildSDVGainTable(table, &gainTable);
+  ASSERT_EQ(cIasMaxSDVGainTableSpeed + 1, gainTable.gain_inc.size());
+  EXPECT_EQ(-static_cast<float>(table.gain_inc.back()), gainTable.criticalVolumeDb);
+
+  for (uint32_t speed = 0; speed <= cIasMaxSDVGainTableSpeed + 300; ++speed)
+  {
+    double refInc = referenceSDVGainDb(speed, table, table.gain_inc);
+    double refDec = referenceSDVGainDb(speed, table, table.gain_dec);
+    EXPECT_NEAR(refInc, IasVolumeHelper::interpolateSDV_GainDb(speed, table, table.gain_inc), 1.0e-3);
+    EXPECT_NEAR(refDec, IasVolumeHelper::interpolateSDV_GainDb(speed, table, table.gain_dec), 1.0e-3);
+    if (speed < gainTable.gain_inc.size())
+    {
+      expectNear(pow(10.0, refInc / 200.0), gainTable.gain_inc[speed]);
+      expectNear(pow(10.0, refDec / 200.0), gainTable.gain_dec[speed]);
+      EXPECT_NEAR(refInc, gainTable.gainDb_inc[speed], 1.0e-3);
+      EXPECT_NEAR(refDec, gainTable.gainDb_dec[speed], 1.0e-3);
+    }
+    // The conversion table covers all gains of the table.
+    expectNear(pow(10.0, refDec / 200.0), IasVolumeHelper::getSDV_LinearGain(static_cast<float>(refDec), gainTable));
+  }
+}
+
+TEST(IasVolumeTablesTest, sdvReductionMatchesReference)
+{
+  IasVolumeSDVTable table;
+  IasVolumeHelper::getDefaultSDVTable(table);
+  IasVolumeSDVGainTable gainTable;
+  IasVolumeHelper::buildSDVGainTable(table, &gainTable);
+  const float criticalVolume = powf(10.0f, gainTable.criticalVolumeDb / 200.0f);
+
+  // Maximum user volumes between the critical volume and 0 dB
+  for (int32_t maxVolumeDb = static_cast<int32_t>(gainTable.criticalVolumeDb) + 1; maxVolumeDb <= 0; ++maxVolumeDb)
+  {
+    float maxVolume = powf(10.0f, static_cast<float>(maxVolumeDb) / 200.0f);
+    float reduction = IasVolumeHelper::convertVolumeToDb(maxVolume) / gainTable.criticalVolumeDb;
+    for (uint32_t speed = 0; speed < gainTable.gain_inc.size(); ++speed)
+    {
+      // The reduction as computed before the gains were precomputed
+      double gain = gainTable.gain_inc[speed];
+      double reference = pow(10.0, log10(maxVolume) * log10(gain) / log10(criticalVolume));
+      expectNear(reference, IasVolumeHelper::getSDV_LinearGain(gainTable.gainDb_inc[speed] * reduction, gainTable));
+    }
+  }
+}
+
+TEST(IasVolumeTablesTest, convertVolumeToDb)
+{
+  EXPECT_NEAR(0.0f, IasVolumeHelper::convertVolumeToDb(1.0f), 1.0e-4);
+  EXPECT_NEAR(-200.0f, IasVolumeHelper::convertVolumeToDb(0.1f), 1.0e-3);
+  EXPECT_EQ(static_cast<float>(cIasMinLoudnessVolume), IasVolumeHelper::convertVolumeToDb(0.0f));
+}
+
+} // namespace IasAudio
@@ -27,6 +27,19 @@ namespace IasAudio {
  */
 IAS_AUDIO_PUBLIC bool parseConfig(IasAudio::IasSmartX *smartx, const char * xmlFileName);
 
+/**
+ * @brief Parse SmartXbar XML configuration file or replay the topology from a cache file
+ *
+ * If the cache file was created from the same XML file and SmartX API version, the topology is created from the
+ * cache file without reading the XML file. Otherwise the XML file is parsed and the cache file is written afterwards.
+ *
+ * @param[in] smartx Pointer to the smartx
+ * @param[in] xmlFileName XML file name
+ * @param[in] cacheFileName Cache file name, nullptr disables the cache
+ * @return success or fail
+ */
+IAS_AUDIO_PUBLIC bool parseConfig(IasAudio::IasSmartX *smartx, const char * xmlFileName, const char * cacheFileName);
+
 }
 
 #endif // IASSMARTXCONFIGPARSERFILE_HPP
@@ -12,9 +12,9 @@
 #ifndef IASEVENTPROVIDER_HPP
 #define IASEVENTPROVIDER_HPP
 
+#include <atomic>
+#include <memory>
 #include <thread>
-#include <mutex>
-#include <condition_variable>
 
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
 #include "avbaudiomodules/internal/audio/common/IasAudioLogging.hpp"
@@ -28,9 +28,17 @@ namespace IasAudio {
 using IasEventQueue = tbb::concurrent_queue<IasEventPtr>;
 
 class IasConnectionEvent;
+class IasSetupEvent;
+class IasModuleEvent;
+template <typename T> class IasEventPool;
 
 /**
  * @brief The event provider is used to create and send events back to the user
+ *
+ * The events are taken from pools of preallocated events and the customer application is woken up via an eventfd,
+ * so creating and sending events neither allocates memory nor takes a lock. This allows sending events from the
+ * real-time threads. An event that is identical to the previous event sent by the same thread is dropped as long as
+ * the previous event was not received by the application yet, so a misbehaving device cannot flood the event queue.
  */
 class IAS_AUDIO_PUBLIC IasEventProvider
 {
@@ -117,6 +125,9 @@ class IAS_AUDIO_PUBLIC IasEventProvider
     /**
      * @brief Send the event to the customer application
      *
+     * The event is dropped if it is identical to the previous event sent by the calling thread and the previous event
+     * is still in the event queue.
+     *
      * @param[in] event The event to be sent
      *
      * @return The result of the method
@@ -160,6 +171,13 @@ class IAS_AUDIO_PUBLIC IasEventProvider
      */
     void clearEventQueue();
 
+    /**
+     * @brief Get the number of events that were dropped because they were identical to the previous event
+     *
+     * @return The number of dropped events since start
+     */
+    uint64_t getNumCoalescedEvents() const;
+
   private:
 
     /**
@@ -176,11 +194,41 @@ class IAS_AUDIO_PUBLIC IasEventProvider
      */
     IasEventProvider& operator=(IasEventProvider const &other);
 
-    DltContext               *mLog;           //!< DLT log context
-    IasEventQueue             mEventQueue;    //!< The event queue
-    std::mutex                mMutex;         //!< Mutex for condition variable
-    std::condition_variable   mCondition;     //!< Condition variable to signal new event
-    uint32_t               mNrEvents;      //!< The number of events in the queue
+    /**
+     * @brief Entry of the event queue
+     */
+    struct IasEventQueueEntry
+    {
+      IasEventPtr   event;    //!< The event
+      uint64_t      index;    //!< Index of the event, taken when the event is put into the queue
+    };
+
+    /**
+     * @brief Get a key that is equal for identical events
+     *
+     * @param[in] event The event
+     *
+     * @return The key of the event, 0 for events of an unknown type
+     */
+    static uint64_t getEventKey(const IasEventPtr &event);
+
+    /**
+     * @brief Mark the event with the given queue index as fetched
+     *
+     * @param[in] index The queue index of the fetched event
+     */
+    void markFetched(uint64_t index);
+
+    DltContext                                           *mLog;                   //!< DLT log context
+    std::unique_ptr<IasEventPool<IasConnectionEvent>>     mConnectionEventPool;   //!< Preallocated connection events
+    std::unique_ptr<IasEventPool<IasSetupEvent>>          mSetupEventPool;        //!< Preallocated setup events
+    std::unique_ptr<IasEventPool<IasModuleEvent>>         mModuleEventPool;       //!< Preallocated module events
+    tbb::concurrent_queue<IasEventQueueEntry>             mEventQueue;            //!< The event queue
+    int32_t                                               mEventFd;               //!< eventfd in semaphore mode to signal new events
+    std::atomic<uint64_t>                                 mNumQueued;             //!< Number of events put into the queue
+    std::atomic<uint64_t>                                 mNumFetched;            //!< Number of events removed from the queue
+    std::atomic<uint64_t>                                 mFetchedIndexEnd;       //!< One above the highest index of the events removed from the queue
+    std::atomic<uint64_t>                                 mNumCoalesced;          //!< Number of events dropped because they were identical to the previous one
 };
 
 } //namespace IasAudio
@@ -34,6 +34,158 @@ class IAS_AUDIO_PUBLIC IasIDebug
       eIasFailed,                 //!< Operation failed
     };
 
+    /**
+     * @brief The statistics of a latency measurement, see #startLatencyProbe
+     *
+     * The values in frames are given at the sample rate of the detection location.
+     */
+    struct IasLatencyResult
+    {
+      /**
+       * @brief Constructor
+       */
+      IasLatencyResult()
+        :numMeasurements(0)
+        ,numMissed(0)
+        ,isFinished(false)
+        ,minUs(0.0f)
+        ,maxUs(0.0f)
+        ,meanUs(0.0f)
+        ,jitterUs(0.0f)
+        ,minFrames(0.0f)
+        ,maxFrames(0.0f)
+        ,meanFrames(0.0f)
+        ,jitterFrames(0.0f)
+      {}
+
+      uint32_t numMeasurements;   //!< Number of markers that were detected
+      uint32_t numMissed;         //!< Number of markers that were not detected within one second
+      bool     isFinished;        //!< True if all requested markers were sent through the path
+      float    minUs;             //!< Minimum latency in microseconds
+      float    maxUs;             //!< Maximum latency in microseconds
+      float    meanUs;            //!< Mean latency in microseconds
+      float    jitterUs;          //!< Standard deviation of the latency in microseconds
+      float    minFrames;         //!< Minimum latency in frames
+      float    maxFrames;         //!< Maximum latency in frames
+      float    meanFrames;        //!< Mean latency in frames
+      float    jitterFrames;      //!< Standard deviation of the latency in frames
+    };
+
+    /**
+     * @brief The statistics of a stream recording, see #startStreamRecord
+     */
+    struct IasStreamProbeStatistics
+    {
+      /**
+       * @brief Constructor
+       */
+      IasStreamProbeStatistics()
+        :numFramesWritten(0)
+        ,numFramesDropped(0)
+        ,numOverruns(0)
+      {}
+
+      uint64_t numFramesWritten;  //!< Number of frames written to the shared memory ring buffer
+      uint64_t numFramesDropped;  //!< Number of frames dropped because the reader did not keep up
+      uint32_t numOverruns;       //!< Number of overrun events, i.e. gaps in the recorded stream
+    };
+
+    /**
+     * @brief Description of one probed port or pin within a multi-point recording
+     */
+    struct IasProbePointInfo
+    {
+      /**
+       * @brief Constructor
+       */
+      IasProbePointInfo()
+        :name()
+        ,firstChannel(0)
+        ,numChannels(0)
+      {}
+
+      std::string name;           //!< Name of the port or pin
+      uint32_t firstChannel;      //!< First channel of the port or pin in the recorded stream
+      uint32_t numChannels;       //!< Number of channels of the port or pin
+    };
+
+    /**
+     * @brief Header of a multi-point recording, see #startMultiPointRecord
+     */
+    struct IasMultiPointHeader
+    {
+      /**
+       * @brief Constructor
+       */
+      IasMultiPointHeader()
+        :streamName()
+        ,sampleRate(0)
+        ,numChannels(0)
+        ,startTimeNs(0)
+        ,points()
+      {}
+
+      std::string streamName;                 //!< Name of the recorded stream
+      uint32_t sampleRate;                    //!< Sample rate of the recorded stream
+      uint32_t numChannels;                   //!< Total number of channels of the recorded stream
+      int64_t startTimeNs;                    //!< CLOCK_MONOTONIC time of the first frame of the recorded stream in nanoseconds
+      std::vector<IasProbePointInfo> points;  //!< The probed ports and pins in the order of their channels
+    };
+
+    /**
+     * @brief The statistics of one lock domain of the SmartXbar interfaces, see #getLockStatistics
+     */
+    struct IasLockStatistics
+    {
+      /**
+       * @brief Constructor
+       */
+      IasLockStatistics()
+        :domain()
+        ,numShared(0)
+        ,numExclusive(0)
+        ,totalWaitTimeNs(0)
+        ,maxWaitTimeNs(0)
+        ,totalHoldTimeNs(0)
+        ,maxHoldTimeNs(0)
+      {}
+
+      std::string domain;         //!< Name of the lock domain, e.g. "topology" or "routing"
+      uint64_t numShared;         //!< Number of times the domain was locked for reading
+      uint64_t numExclusive;      //!< Number of times the domain was locked for writing
+      uint64_t totalWaitTimeNs;   //!< Accumulated time callers waited for the domain in nanoseconds
+      uint64_t maxWaitTimeNs;     //!< Maximum time a caller waited for the domain in nanoseconds
+      uint64_t totalHoldTimeNs;   //!< Accumulated time the domain was held in nanoseconds
+      uint64_t maxHoldTimeNs;     //!< Maximum time the domain was held in nanoseconds
+    };
+
+    /**
+     * @brief The usage statistics of one audio buffer pool of the processing framework, see #getBufferPoolStatistics
+     */
+    struct IasBufferPoolStatistics
+    {
+      /**
+       * @brief Constructor
+       */
+      IasBufferPoolStatistics()
+        :bufferSize(0)
+        ,numBuffers(0)
+        ,numReserved(0)
+        ,numInUse(0)
+        ,highWaterMark(0)
+        ,numExhausted(0)
+        ,numFailed(0)
+      {}
+
+      uint32_t bufferSize;        //!< Size of the buffers of the pool in samples
+      uint32_t numBuffers;        //!< Number of buffers allocated by the pool
+      uint32_t numReserved;       //!< Number of buffers reserved for the audio streams of the pipelines
+      uint32_t numInUse;          //!< Number of buffers currently in use
+      uint32_t highWaterMark;     //!< Maximum number of buffers in use at the same time
+      uint64_t numExhausted;      //!< Number of times a buffer had to be allocated because the pool was empty
+      uint64_t numFailed;         //!< Number of times no buffer could be provided, because the pool reached its maximum size
+    };
+
     /**
     * @brief Destructor.
     */
@@ -88,6 +240,173 @@ class IAS_AUDIO_PUBLIC IasIDebug
      */
     virtual IasResult stopProbing(const std::string &name)=0;
 
+    /**
+     * @brief Start measuring the latency of an audio path.
+     *
+     * A single impulse is written into all channels of the source port. As soon as it appears at the
+     * sink port or pin, the latency is measured and the next impulse is sent after a hold-off time of 250ms.
+     * The source port has to deliver silence during the measurement, otherwise the audio content
+     * itself would be detected as marker. Only one latency measurement can be active at a time.
+     *
+     * @param[in] sourceName The name of the output port of a source device where the marker is injected
+     * @param[in] sinkName The name of the input port or pipeline pin where the marker is detected
+     * @param[in] numMeasurements The number of markers to send through the path
+     *
+     * @return The result of the start operation
+     * @retval IasIDebug::eIasOk Measurement started
+     * @retval IasIDebug::eIasFailed Failed to start the measurement, e.g. because the ports are not connected
+     */
+    virtual IasResult startLatencyProbe(const std::string &sourceName, const std::string &sinkName, uint32_t numMeasurements)=0;
+
+    /**
+     * @brief Get the statistics of the current or the last latency measurement.
+     *
+     * @param[out] result The statistics of the measurement
+     *
+     * @return The result of the operation
+     * @retval IasIDebug::eIasOk Result is valid
+     * @retval IasIDebug::eIasFailed No latency measurement was started
+     */
+    virtual IasResult getLatencyProbeResult(IasLatencyResult *result)=0;
+
+    /**
+     * @brief Stop the latency measurement.
+     *
+     * The result of the measurement can still be retrieved afterwards via #getLatencyProbeResult.
+     *
+     * @return The result of the stop
+     * @retval IasIDebug::eIasOk All went well
+     * @retval IasIDebug::eIasFailed No latency measurement was started
+     */
+    virtual IasResult stopLatencyProbe()=0;
+
+    /**
+     * @brief Record data of an audio port/pin continuously into a shared memory ring buffer.
+     *
+     * In contrast to #startRecord, no files are written and there is no limit for the recording time.
+     * The ring buffer is named like the one of a SmartX sink device, so an external analyser can read
+     * the stream with the alsa-smartx-plugin, e.g. "arecord -D smartx:<streamName> -c <channels> ...".
+     * The ring buffer holds one second of audio. If the analyser does not keep up or is not attached,
+     * the data is dropped and counted as overrun, the real-time thread is never blocked.
+     *
+     * @param[in] streamName The name of the stream, which is used to name the shared memory
+     * @param[in] name The name of the audio port/pin
+     *
+     * @return The result of the record operation
+     * @retval IasIDebug::eIasOk All went well, recording started
+     * @retval IasIDebug::eIasFailed Failed to start the recording, e.g. because the stream name is already in use
+     */
+    virtual IasResult startStreamRecord(const std::string &streamName, const std::string &name)=0;
+
+    /**
+     * @brief Get the statistics of a stream recording.
+     *
+     * @param[in] name The name of the audio port/pin
+     * @param[out] statistics The statistics of the stream recording
+     *
+     * @return The result of the operation
+     * @retval IasIDebug::eIasOk Statistics are valid
+     * @retval IasIDebug::eIasFailed No stream recording active for this port/pin
+     */
+    virtual IasResult getStreamRecordStatistics(const std::string &name, IasStreamProbeStatistics *statistics)=0;
+
+    /**
+     * @brief Stop a stream recording and remove the shared memory ring buffer.
+     *
+     * @param[in] name The name of the audio port/pin
+     *
+     * @return The result of the stop
+     * @retval IasIDebug::eIasOk All went well
+     * @retval IasIDebug::eIasFailed No stream recording active for this port/pin
+     */
+    virtual IasResult stopStreamRecord(const std::string &name)=0;
+
+    /**
+     * @brief Record several audio ports/pins at the same time into one interleaved stream.
+     *
+     * The channels of all ports/pins are written sample aligned into one shared memory ring buffer in the
+     * order of the names, see #startStreamRecord for how to read the stream. The layout of the stream and
+     * the time of its first frame are written to the header file /tmp/<streamName>.hdr and can be read via
+     * #getMultiPointRecordHeader. All ports/pins must run at the same sample rate. The merging is done in a
+     * separate thread, the real-time threads only copy their data into a lock-free FIFO.
+     *
+     * @param[in] streamName The name of the stream, which is used to name the shared memory
+     * @param[in] names The names of the audio ports/pins
+     *
+     * @return The result of the record operation
+     * @retval IasIDebug::eIasOk All went well, recording started
+     * @retval IasIDebug::eIasFailed Failed to start the recording
+     */
+    virtual IasResult startMultiPointRecord(const std::string &streamName, const IasStringVector &names)=0;
+
+    /**
+     * @brief Get the header of a multi-point recording.
+     *
+     * @param[in] streamName The name of the stream
+     * @param[out] header The header of the recording
+     *
+     * @return The result of the operation
+     * @retval IasIDebug::eIasOk Header is valid
+     * @retval IasIDebug::eIasFailed No multi-point recording active with this name
+     */
+    virtual IasResult getMultiPointRecordHeader(const std::string &streamName, IasMultiPointHeader *header)=0;
+
+    /**
+     * @brief Get the statistics of a multi-point recording.
+     *
+     * The dropped frames and overruns include those of the FIFOs of all ports/pins.
+     *
+     * @param[in] streamName The name of the stream
+     * @param[out] statistics The statistics of the recording
+     *
+     * @return The result of the operation
+     * @retval IasIDebug::eIasOk Statistics are valid
+     * @retval IasIDebug::eIasFailed No multi-point recording active with this name
+     */
+    virtual IasResult getMultiPointRecordStatistics(const std::string &streamName, IasStreamProbeStatistics *statistics)=0;
+
+    /**
+     * @brief Stop a multi-point recording.
+     *
+     * @param[in] streamName The name of the stream
+     *
+     * @return The result of the stop
+     * @retval IasIDebug::eIasOk All went well
+     * @retval IasIDebug::eIasFailed No multi-point recording active with this name
+     */
+    virtual IasResult stopMultiPointRecord(const std::string &streamName)=0;
+
+    /**
+     * @brief Get the wait and hold time statistics of the locks that make the SmartXbar interfaces thread-safe.
+     *
+     * The setup, routing, processing and debug interfaces lock separate domains, e.g. the topology of
+     * devices and routing zones, the pipelines or the connections. The statistics show which domain
+     * causes long blocking times of the interface methods.
+     *
+     * @param[out] statistics The statistics, one entry per lock domain
+     *
+     * @return The result of the operation
+     * @retval IasIDebug::eIasOk Statistics are valid
+     * @retval IasIDebug::eIasFailed statistics == nullptr
+     */
+    virtual IasResult getLockStatistics(std::vector<IasLockStatistics> *statistics)=0;
+
+    /**
+     * @brief Get the usage statistics of the audio buffer pools of the processing framework.
+     *
+     * The buffers for the audio streams of the pipelines are preallocated when the pipelines are initialized.
+     * A pool that is exhausted allocates further buffers, possibly in a real-time thread. Such events are
+     * counted in IasBufferPoolStatistics::numExhausted. Requests that fail because a pool reached its
+     * maximum size are counted in IasBufferPoolStatistics::numFailed.
+     *
+     * @param[out] statistics The statistics, one entry per buffer size
+     *
+     * @return The result of the operation
+     * @retval IasIDebug::eIasOk Statistics are valid
+     * @retval IasIDebug::eIasFailed statistics == nullptr
+     */
+    virtual IasResult getBufferPoolStatistics(std::vector<IasBufferPoolStatistics> *statistics)=0;
+
 };
 
 /**
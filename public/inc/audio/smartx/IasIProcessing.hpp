@@ -18,6 +18,26 @@ namespace IasAudio {
 
 class IasProperties;
 
+/**
+ * @brief Handle of a command that has been resolved by IasIProcessing::resolveCmd
+ *
+ * The handle is only valid for the IasIProcessing instance that created it. It becomes invalid as soon
+ * as the addressed audio module is deleted, sending a command with an invalid handle fails.
+ *
+ * The ramp parameters are not touched by IasIProcessing::resolveCmd. The application can set them at any
+ * time, they are passed to the audio module with each command. With the default ramp time 0, the audio
+ * module uses its default ramp for the fast command path. Audio modules that do not support a ramp
+ * for a command reject commands with a ramp time other than 0, see the documentation of the audio module.
+ */
+struct IAS_AUDIO_PUBLIC IasCmdHandle
+{
+  uint32_t moduleIndex = 0xFFFFFFFF;   //!< Index of the audio module in the command dispatcher
+  int32_t  cmdId = -1;                 //!< The command id as defined by the audio module
+  int32_t  streamId = -1;              //!< The stream id of the addressed pin
+  int32_t  rampTime = 0;               //!< Ramp time in ms like in the "ramp" property of the command, 0 for the default ramp
+  int32_t  rampShape = 0;              //!< Ramp shape like in the "ramp" property of the command, ignored for the default ramp
+};
+
 /**
   * @brief The processing interface class
   *
@@ -56,6 +76,40 @@ class IAS_AUDIO_PUBLIC IasIProcessing
      * @retval eIasFailed Error sending cmd
      */
     virtual IasResult sendCmd(const std::string &instanceName, const IasProperties &cmdProperties, IasProperties &returnProperties) = 0;
+
+    /**
+     * @brief Resolve a command of an audio module and a pin into a handle for the fast command path
+     *
+     * Commands that are sent at a high rate, e.g. volume or balance changes during animations, can be
+     * resolved once and then sent with #sendCmd(const IasCmdHandle&, float) without string lookups and
+     * without creating properties. Only commands that an audio module explicitly supports for the fast path
+     * can be resolved, see the documentation of the audio module.
+     *
+     * @param[in] instanceName The unique instance name of the audio module being addressed.
+     * @param[in] cmdId The command id as defined by the audio module.
+     * @param[in] pinName The name of the pin the command refers to.
+     * @param[out] handle The resolved command handle.
+     *
+     * @returns Result of the method call
+     * @retval eIasOk Successfully resolved the command
+     * @retval eIasFailed Unknown module or pin, or the command does not support the fast path
+     */
+    virtual IasResult resolveCmd(const std::string &instanceName, int32_t cmdId, const std::string &pinName, IasCmdHandle *handle) = 0;
+
+    /**
+     * @brief Send a resolved command to an audio module
+     *
+     * The meaning and the unit of the value are the same as for the corresponding command property of the
+     * audio module, e.g. the volume in dB/10 for the volume module.
+     *
+     * @param[in] handle The command handle returned by #resolveCmd.
+     * @param[in] value The new value.
+     *
+     * @returns Result of the method call
+     * @retval eIasOk Successfully send cmd
+     * @retval eIasFailed Invalid handle or error sending cmd
+     */
+    virtual IasResult sendCmd(const IasCmdHandle &handle, float value) = 0;
 };
 
 /**
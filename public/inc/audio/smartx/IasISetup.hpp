@@ -41,6 +41,27 @@ class IAS_AUDIO_PUBLIC IasISetup
       eIasFailed                  //!< Operation failed
     };
 
+    /**
+     * @brief Parameters of the sink device prefill of a routing zone, see #setSinkPrefill
+     */
+    struct IasSinkPrefillParams
+    {
+      /**
+       * @brief Constructor, selects the default behavior
+       */
+      IasSinkPrefillParams()
+        :numFrames(0)
+        ,adaptive(false)
+        ,minFrames(0)
+        ,maxFrames(0)
+      {}
+
+      uint32_t numFrames;     //!< Fill level of the sink device buffer in frames, 0 selects the default
+      bool     adaptive;      //!< Adapt the fill level at runtime to the observed underrun margin
+      uint32_t minFrames;     //!< Lowest fill level of the adaptation in frames, 0 selects two periods
+      uint32_t maxFrames;     //!< Highest fill level of the adaptation in frames, 0 selects the buffer size minus one period
+    };
+
     /**
       * @brief Destructor.
       */
@@ -686,6 +707,11 @@ class IAS_AUDIO_PUBLIC IasISetup
      * The output pin and the input pin can also be combined input/output pins. These combined pins
      * are used for in-place processing components.
      *
+     * Pins of a running pipeline can only be linked and unlinked if runtime relinking has been enabled
+     * for the pipeline, see #setRuntimeRelinking. The changes take effect when #commitPinLinks is called.
+     *
+     * Nothing is changed if the output pin is not linked to the input pin.
+     *
      * @param[in] outputPin Audio output or combined input/output pin
      * @param[in] inputPin Audio input or combined input/output pin
      */
@@ -734,6 +760,69 @@ class IAS_AUDIO_PUBLIC IasISetup
      */
     virtual IasResult initPipelineAudioChain(IasPipelinePtr pipeline) = 0;
 
+    /**
+     * @brief Enable or disable relinking the audio pins of a pipeline while its routing zone is running.
+     *
+     * This function has to be called before #initPipelineAudioChain. If enabled, the audio components of all
+     * processing modules of the pipeline are created, even if the modules are not linked yet, and each audio
+     * pin gets an audio stream of its own. While the routing zone is running, audio pins can then be linked
+     * and unlinked to insert, bypass or reorder processing modules. The new links take effect when
+     * #commitPinLinks is called. Due to the additional copies between the audio streams, a relinkable
+     * pipeline needs somewhat more processing time than a static one.
+     *
+     * @param[in] pipeline Pointer to the pipeline
+     * @param[in] enable   true to enable runtime relinking
+     *
+     * @return The result of the method call
+     * @retval eIasOk Method succeeded.
+     * @retval eIasFailed Invalid pipeline or the audio chain of the pipeline has already been initialized.
+     */
+    virtual IasResult setRuntimeRelinking(IasPipelinePtr pipeline, bool enable) = 0;
+
+    /**
+     * @brief Apply the current links of the audio pins to a running pipeline.
+     *
+     * The pipeline switches to the new links at the next period boundary. The audio pins whose source changed
+     * are faded out at the end of the last period with the old links and faded in at the start of the first
+     * period with the new links. All other signal paths of the pipeline are not affected.
+     *
+     * @param[in] pipeline        Pointer to the pipeline, runtime relinking has to be enabled for it
+     * @param[in] crossfadeLength Length of the fade-out and of the fade-in in frames, limited to one period.
+     *                            A length of 0 switches without fading.
+     *
+     * @return The result of the method call
+     * @retval eIasOk Method succeeded.
+     * @retval eIasFailed Invalid pipeline, runtime relinking is not enabled or the audio chain is not initialized.
+     */
+    virtual IasResult commitPinLinks(IasPipelinePtr pipeline, uint32_t crossfadeLength) = 0;
+
+    /**
+     * @brief Set the prefill depth of the sink device buffer of a derived routing zone.
+     *
+     * When a derived zone is started, the buffer of its sink device is filled with zeros before
+     * the first period is transferred. By default, an ALSA handler is filled with the buffer size
+     * minus one period, which gives the largest margin against underruns, but also the largest
+     * output latency. A SmartXbar plugin is filled with one period.
+     *
+     * If the fill level is changed while the zone is running, the zone approaches the new fill level by
+     * inserting a period of zeros or by dropping a period, at most once per second. If adaptive is set,
+     * the zone additionally lowers the fill level by one period when the buffer never came closer than
+     * one and a half periods to an underrun for ten seconds, and raises it by one period when the buffer
+     * came closer than half a period to an underrun. The runtime adaptation is only done for ALSA
+     * handlers that are not clocked asynchronously.
+     *
+     * All fill levels are rounded down to a multiple of the period size of the sink device.
+     * The parameters have no effect for base zones, which are paced by their sink device.
+     *
+     * @param[in] routingZone The routing zone
+     * @param[in] params The prefill parameters
+     * @return The result of the method call
+     * @retval eIasOk Prefill parameters set.
+     * @retval eIasFailed Invalid parameters, e.g. a fill level that leaves less than one period of free space
+     *                    in the buffer of the linked sink device.
+     */
+    virtual IasResult setSinkPrefill(IasRoutingZonePtr routingZone, const IasSinkPrefillParams &params) = 0;
+
 };
 
 /**
@@ -117,6 +117,15 @@ class IAS_AUDIO_PUBLIC IasProperties
      */
     IasResult getKeyDataType(std::string key, std::string &dataType) const;
 
+    /**
+     * @brief Get a hash value of all keys and values
+     *
+     * Two instances with the same properties have the same hash value. Used e.g. to detect repeated identical events.
+     *
+     * @returns The hash value
+     */
+    uint64_t getHash() const;
+
   private:
     /**
      * @brief Generic method to get the value for a given key from a given map
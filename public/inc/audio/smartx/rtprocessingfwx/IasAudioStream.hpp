@@ -231,6 +231,18 @@ class IAS_AUDIO_PUBLIC IasAudioStream
      */
     void getAudioDataPointers(IasAudioFrame& audioFrame);
 
+    /**
+     * @brief Get a frame with pointers to the internal channel buffers without finishing the current round.
+     *
+     * In contrast to #getAudioDataPointers, the current representation stays active, so the stream can be
+     * inspected between two audio components. Samples that are still waiting in the input audio buffers
+     * are copied into the bundled representation first.
+     *
+     * @param[out] audioFrame  Returns a pointer to the audio frame, nullptr if the stream has no samples in this round.
+     * @param[out] stride      Distance between two samples of one channel, expressed in samples.
+     */
+    void peekAudioDataPointers(IasAudioFrame **audioFrame, std::uint32_t *stride);
+
     /**
      * @brief set the connected device for the stream
      *
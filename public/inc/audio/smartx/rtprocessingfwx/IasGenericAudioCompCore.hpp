@@ -40,6 +40,54 @@ class IasGenericAudioCompCore;
 class IasGenericAudioCompConfig;
 class IasIGenericAudioCompConfig;
 struct IasProbingQueueEntry;
+template <typename T> class IasParameterMailbox;
+
+/**
+ * @class IasParameterSnapshot
+ *
+ * Base class of a complete parameter set of an audio module, e.g. all filter tables of an equalizer.
+ * Audio modules that support hot-reloading of their parameters derive their snapshot type from this class.
+ * A snapshot is prepared in a non-real-time thread and adopted by the processing thread at a period
+ * boundary, see IasGenericAudioCompCore::setParameterSnapshot.
+ */
+class IAS_AUDIO_PUBLIC IasParameterSnapshot
+{
+  public:
+    /**
+     * @brief Constructor.
+     */
+    IasParameterSnapshot() {}
+
+    /**
+     * @brief Destructor, virtual by default.
+     */
+    virtual ~IasParameterSnapshot() {}
+
+  private:
+    /**
+     * @brief Copy constructor, private unimplemented to prevent misuse.
+     */
+    IasParameterSnapshot(IasParameterSnapshot const &other);
+
+    /**
+     * @brief Assignment operator, private unimplemented to prevent misuse.
+     */
+    IasParameterSnapshot& operator=(IasParameterSnapshot const &other);
+};
+
+/**
+ * @brief Shared pointer type of a parameter snapshot
+ */
+using IasParameterSnapshotPtr = std::shared_ptr<IasParameterSnapshot>;
+
+/**
+ * @brief A parameter snapshot together with the length of the fade used to adopt it
+ */
+struct IasParameterSnapshotEntry
+{
+  IasParameterSnapshotPtr snapshot;     //!< The prepared snapshot
+  uint32_t                fadeLength;   //!< Length of the fade-out and of the fade-in in frames, 0 to adopt the snapshot without fade
+};
 
 /**
  * @brief A map containing IasAudioAreas corresponding to stream Ids
@@ -210,7 +258,50 @@ class IAS_AUDIO_PUBLIC IasGenericAudioCompCore
                                        bool input,
                                        bool output);
 
+    /**
+     * @brief Hot-reload a complete parameter set without re-initializing the audio chain
+     *
+     * The snapshot is prepared by the audio module in the calling thread, e.g. filter coefficients are calculated,
+     * and afterwards adopted by the processing thread at the start of a period. If fadeLength is not zero, the output
+     * of the module is faded out, the snapshot is adopted while the output is silent and the output is faded in again.
+     * A snapshot that was not adopted yet is replaced by a new one.
+     *
+     * Must not be called by the processing thread.
+     *
+     * @param[in] snapshot    The new parameter set, its type has to match the audio module
+     * @param[in] fadeLength  Length of the fade-out and of the fade-in in frames, 0 to adopt the snapshot without fade
+     *
+     * @returns Error code
+     * @retval eIasAudioProcOK              The snapshot will be adopted with one of the next periods
+     * @retval eIasAudioProcInvalidParam    The snapshot is invalid or does not match the audio module
+     * @retval eIasAudioProcNotImplemented  The audio module does not support parameter snapshots
+     */
+    IasAudioProcessingResult setParameterSnapshot(IasParameterSnapshotPtr snapshot, uint32_t fadeLength);
+
   protected:
+    /**
+     * @brief Prepare a parameter snapshot, called by setParameterSnapshot in a non-real-time thread.
+     *
+     * Audio modules that support parameter snapshots verify the snapshot and do all expensive calculations here,
+     * so that applyParameterSnapshot only has to copy the prepared parameters. The default implementation
+     * returns eIasAudioProcNotImplemented.
+     *
+     * @param[in,out] snapshot The snapshot to be prepared
+     *
+     * @returns Error code, eIasAudioProcOK if the snapshot can be adopted
+     */
+    virtual IasAudioProcessingResult prepareParameterSnapshot(IasParameterSnapshot &snapshot);
+
+    /**
+     * @brief Adopt a prepared parameter snapshot, called by the processing thread before processChild.
+     *
+     * Must neither allocate memory nor block. The snapshot is released by a non-real-time thread, so the
+     * audio module must not keep a reference to it.
+     *
+     * @param[in] snapshot The snapshot, prepared by prepareParameterSnapshot
+     */
+    virtual void applyParameterSnapshot(const IasParameterSnapshot &snapshot);
+
     /**
      * @brief Processes the audio data by applying the algorithm of the audio component, pure virtual.
      *
@@ -246,6 +337,31 @@ class IAS_AUDIO_PUBLIC IasGenericAudioCompCore
      */
     void setupProbingInfo(IasAudioStream* stream, IasAudioArea* area);
 
+    /**
+     * @brief State of the fade used to adopt a parameter snapshot
+     */
+    enum IasFadeState
+    {
+      eIasFadeIdle,   //!< No fade active
+      eIasFadeOut,    //!< Output is faded out, the snapshot is adopted afterwards
+      eIasFadeIn      //!< Output is faded in after the snapshot was adopted
+    };
+
+    /**
+     * @brief Adopt a new parameter snapshot or start the fade-out for it, called at the start of each period.
+     */
+    void updateParameterSnapshot();
+
+    /**
+     * @brief Apply the fade gain to the output streams, called after processChild.
+     */
+    void applyFade();
+
+    /**
+     * @brief Apply a linear gain ramp to all channels of one stream.
+     */
+    void applyGainRamp(IasAudioStream *stream, float gain, float step);
+
     // Member variables
     IasAudioCompState                            mProcessingState;         //!< Used to enable or disable the processing.
     std::string                                  mComponentName;           //!< Unique Name of the specific Component set by the developer during implementation
@@ -256,6 +372,11 @@ class IAS_AUDIO_PUBLIC IasGenericAudioCompCore
     IasGenericProbeAreas                         mInputDataProbesAreas;    //!< Map containing IasAudioAreas for InputProbes for streamIds
     IasGenericProbeAreas                         mOutputDataProbesAreas;   //!< Map containing IasAudioAreas for OutputProbes for streamIds
     tbb::concurrent_queue<IasProbingQueueEntry>  mProbingQueue;            //!< The queue for the probing
+    std::unique_ptr<IasParameterMailbox<IasParameterSnapshotEntry>> mSnapshotMailbox;   //!< The latest snapshot not adopted yet
+    IasParameterSnapshotEntry                   *mPendingSnapshot;         //!< Snapshot waiting for the end of the fade-out
+    IasFadeState                                 mFadeState;               //!< State of the fade
+    float                                        mFadeGain;                //!< Current fade gain
+    float                                        mFadeStep;                //!< Gain increment per frame of the fade
 };
 
 } //namespace IasAudio
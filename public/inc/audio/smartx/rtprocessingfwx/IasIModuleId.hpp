@@ -26,6 +26,8 @@ namespace IasAudio {
 static constexpr std::int32_t cGetParametersCmdId = 200;
 static constexpr std::int32_t cSetParametersCmdId = 201;
 
+struct IasCmdHandle;   // defined in audio/smartx/IasIProcessing.hpp
+
 /*!
  * @brief Documentation for class IasIModuleId
  */
@@ -78,6 +80,59 @@ class IAS_AUDIO_PUBLIC IasIModuleId
      */
     virtual IasResult processCmd(const IasProperties &cmdProperties, IasProperties &returnProperties) = 0;
 
+    /**
+     * @brief Check whether a command can be sent via the fast command path.
+     *
+     * The fast command path passes a single value for one stream without properties, see
+     * IasIProcessing::resolveCmd. Modules that support it override this method and #processFastCmd.
+     *
+     * @param[in] cmdId The command id
+     *
+     * @returns True if the command supports the fast command path
+     */
+    virtual bool isFastCmd(int32_t cmdId) const
+    {
+      (void)cmdId;
+      return false;
+    }
+
+    /**
+     * @brief Process a command received via the fast command path.
+     *
+     * @param[in] handle The command handle, with a command id for which #isFastCmd returned true,
+     *                   the stream id of the addressed pin and the ramp parameters
+     * @param[in] value The value in the unit of the corresponding command property
+     *
+     * @returns The result of the method
+     * @retval eIasOk Successfully processed cmd
+     * @retval eIasFailed Failed to process cmd, e.g. because of invalid ramp parameters
+     */
+    virtual IasResult processFastCmd(const IasCmdHandle &handle, float value)
+    {
+      (void)handle;
+      (void)value;
+      return eIasFailed;
+    }
+
+    /**
+     * @brief Get the stream id of a pin of the module.
+     *
+     * @param[in] pinName The name of the pin
+     * @param[out] streamId The stream id of the pin
+     *
+     * @returns The result of the method
+     * @retval eIasOk Successfully resolved the pin
+     * @retval eIasFailed Unknown pin
+     */
+    IasResult resolveStreamId(const std::string &pinName, int32_t *streamId) const
+    {
+      if (mConfig == nullptr || streamId == nullptr)
+      {
+        return eIasFailed;
+      }
+      return (mConfig->getStreamId(pinName, *streamId) == eIasAudioProcOK) ? eIasOk : eIasFailed;
+    }
+
   protected:
 
     /**
@@ -51,6 +51,11 @@ class IAS_AUDIO_PUBLIC IasSimpleAudioStream : public IasBaseAudioStream
      * @param[in] numberChannels The number of channels of the audio stream.
      * @param[in] sampleLayout The layout of the samples in the buffer. See #IasSampleLayout.
      * @param[in] frameLength The number of frames of one buffer.
+     * @param[in] type The type of the audio stream.
+     * @param[in] sidAvailable Flag, whether the stream has a stream id.
+     *
+     * @returns eIasAudioProcOK in case of success, eIasAudioProcNotEnoughMemory if no buffer of the required
+     *          size is available, because the buffer pools reached their maximum size.
      */
     IasAudioProcessingResult setProperties(const std::string &name,
                                            int32_t id,
@@ -13,8 +13,10 @@
 #define AUDIO_DAEMON2_PUBLIC_INC_AUDIO_SMARTX_TESTFWX_IASTESTFRAMEWORK_HPP_
 
 #include <atomic>
+#include <functional>
 
 #include "avbaudiomodules/audio/common/IasAudioCommonTypes.hpp"
+#include "audio/testfwx/IasTestFrameworkPublicTypes.hpp"
 
 namespace IasAudio {
 
@@ -44,6 +46,15 @@ class IAS_AUDIO_PUBLIC IasTestFramework
       eIasNoEventAvailable  //!< No event available in the event queue
     };
 
+    /**
+     * @brief Function that sets up one pipeline instance for the benchmark mode, see IasTestFramework::benchmark
+     *
+     * The function receives the test framework of the instance and the index of the instance. It has to
+     * create and link the modules, pins and wave files, exactly as it would be done for a test, but it must
+     * not call IasTestFramework::start. It returns eIasOk on success.
+     */
+    using IasSetupFunction = std::function<IasResult(IasTestFramework *testFramework, uint32_t instanceIndex)>;
+
     /**
      * @brief Create an instance of the IasTestFramework.
      *
@@ -117,6 +128,55 @@ class IAS_AUDIO_PUBLIC IasTestFramework
      */
     IasResult process(uint32_t numPeriods);
 
+    /**
+     * @brief Process a number of periods as fast as possible and measure the performance of the pipeline.
+     *
+     * Before the measurement starts, the input wave files are read into memory, so that the file access
+     * does not influence the result. Input files that are shorter than numPeriods are played in a loop.
+     * The output data is discarded, i.e., nothing is written to the output wave files.
+     * The result contains the processing time, the realtime factor, the processing time of each module
+     * and the number of heap allocations during the processing.
+     *
+     * The method has to be called after IasTestFramework::start. It continues reading the input files at
+     * their current position.
+     *
+     * @param[in] numPeriods Number of periods to be processed
+     * @param[out] result The result of the benchmark
+     * @return The status of the benchmark call
+     * @retval eIasOk Benchmark finished successfully
+     * @retval eIasNullPointer Parameter result is a nullptr
+     * @retval eIasFailed Benchmark failed
+     */
+    IasResult benchmark(uint32_t numPeriods, IasBenchmarkResult *result);
+
+    /**
+     * @brief Measure the performance of several pipeline instances that are processed concurrently.
+     *
+     * This method creates params.numInstances test framework instances and calls setupFunction for each of
+     * them. Then all instances are started and processed concurrently, each in its own thread, in the same way
+     * as described for the benchmark method above. The result contains the wall clock time needed by all
+     * instances, the realtime factor of all instances together, the sum of the heap allocations and the sum of
+     * the processing time of each module over all instances. This allows to measure the multi-core scaling of a
+     * processing configuration.
+     *
+     * Since all instances are created internally, no other instance of the test framework must exist while this
+     * method is called. The instances belong to the benchmark: while it runs, IasTestFramework::create fails and
+     * IasTestFramework::destroy ignores them, also if called by setupFunction.
+     *
+     * @param[in] pipelineParams The configuration parameters for the pipeline of each instance
+     * @param[in] setupFunction Function that sets up the topology of one instance
+     * @param[in] params The benchmark parameters
+     * @param[out] result The result of the benchmark
+     * @return The status of the benchmark call
+     * @retval eIasOk Benchmark finished successfully
+     * @retval eIasNullPointer Parameter result is a nullptr
+     * @retval eIasFailed Benchmark failed, e.g., because another instance of the test framework exists
+     */
+    static IasResult benchmark(const IasPipelineParams &pipelineParams,
+                               const IasSetupFunction &setupFunction,
+                               const IasBenchmarkParams &params,
+                               IasBenchmarkResult *result);
+
     /**
      * @brief Get a pointer to the IasTestFrameworkSetup interface
      *
@@ -12,7 +12,10 @@
 #ifndef IASTESTFRAMEWORKPUBLICTYPES_HPP_
 #define IASTESTFRAMEWORKPUBLICTYPES_HPP_
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 
 /**
@@ -38,6 +41,70 @@ struct IasTestFrameworkWaveFileParams
  */
 using IasTestFrameworkWaveFileParamsPtr = std::shared_ptr<IasTestFrameworkWaveFileParams>;
 
+/**
+ * @brief Processing time of one processing module measured by the benchmark mode
+ */
+struct IasBenchmarkModuleTime
+{
+  IasBenchmarkModuleTime()
+    :instanceName()
+    ,processTimeNs(0)
+  {}
+
+  IasBenchmarkModuleTime(std::string p_instanceName, uint64_t p_processTimeNs)
+    :instanceName(p_instanceName)
+    ,processTimeNs(p_processTimeNs)
+  {}
+
+  std::string instanceName;   //!< Instance name of the processing module
+  uint64_t    processTimeNs;  //!< Accumulated processing time in nanoseconds, summed up over all pipeline instances
+};
+
+/**
+ * @brief Parameters of the benchmark mode
+ */
+struct IasBenchmarkParams
+{
+  IasBenchmarkParams()
+    :numPeriods(0)
+    ,numInstances(1)
+  {}
+
+  IasBenchmarkParams(uint32_t p_numPeriods, uint32_t p_numInstances)
+    :numPeriods(p_numPeriods)
+    ,numInstances(p_numInstances)
+  {}
+
+  uint32_t numPeriods;        //!< Number of periods processed by each pipeline instance
+  uint32_t numInstances;      //!< Number of pipeline instances processed concurrently, each in its own thread
+};
+
+/**
+ * @brief Result of the benchmark mode
+ */
+struct IasBenchmarkResult
+{
+  IasBenchmarkResult()
+    :numInstances(0)
+    ,numPeriods(0)
+    ,audioTimeNs(0)
+    ,processTimeNs(0)
+    ,realtimeFactor(0.0f)
+    ,allocationsCounted(false)
+    ,numAllocations(0)
+    ,moduleTimes()
+  {}
+
+  uint32_t    numInstances;   //!< Number of pipeline instances that have been processed concurrently
+  uint32_t    numPeriods;     //!< Number of periods processed by each pipeline instance
+  uint64_t    audioTimeNs;    //!< Duration of the audio processed by each pipeline instance in nanoseconds
+  uint64_t    processTimeNs;  //!< Wall clock time needed to process all pipeline instances in nanoseconds
+  float       realtimeFactor; //!< Processed audio time of all instances divided by processTimeNs
+  bool        allocationsCounted; //!< True if the executable counts heap allocations, otherwise numAllocations is not available
+  uint64_t    numAllocations; //!< Number of heap allocations in the processing loops of all instances, see allocationsCounted
+  std::vector<IasBenchmarkModuleTime> moduleTimes; //!< Processing time of each module in the order of execution
+};
+
 } // Namespace IasAudio
 
 